@@ -0,0 +1,118 @@
+#pragma once
+
+#include "eicos.hpp"
+
+namespace EiCOS
+{
+
+    struct ADMMSettings
+    {
+        const double rho = 0.1;               // initial step size / penalty parameter
+        const double rho_eq_factor = 1e3;     // penalty factor on equality constraints
+        const double rho_min = 1e-6;          // smallest penalty parameter
+        const double rho_max = 1e6;           // largest penalty parameter
+        const double sigma = 1e-6;            // regularization on the primal variables
+        const double alpha = 1.6;             // over-relaxation parameter
+        const double eps_abs = 1e-5;          // absolute tolerance on residuals
+        const double eps_rel = 1e-5;          // relative tolerance on residuals
+        const size_t maxit = 10000;           // maximum number of iterations
+        const size_t check_interval = 10;     // iterations between termination checks
+        const size_t adaptive_interval = 100; // iterations between penalty updates
+        const double adaptive_tol = 5.;       // factor that triggers a penalty update
+        const size_t equil_iters = 3;         // eqilibration iterations
+        bool verbose = false;                 // print solver output
+        std::shared_ptr<LogSink> log_sink;    // receives the verbose output instead of stdout
+    };
+
+    // verbose output, to the log sink of the settings if there is one, printed otherwise
+    void logMessage(const ADMMSettings &settings, const std::string &text);
+
+    struct ADMMInformation
+    {
+        double pcost;
+        double pres;
+        double dres;
+        double rho;
+        size_t iter;
+        size_t n_factorizations;
+    };
+
+    /**
+     * First-order operator splitting solver for the same problem class as Solver.
+     *
+     * The iterates are only accurate to moderate precision, but each iteration costs
+     * one solve with a factorization that changes only when the penalty is adapted.
+     * The result can be used to warm start the interior point solver for final accuracy.
+     */
+    class ADMMSolver
+    {
+    public:
+        ADMMSolver(const Eigen::SparseMatrix<double> &G,
+                   const Eigen::SparseMatrix<double> &A,
+                   const Eigen::VectorXd &c,
+                   const Eigen::VectorXd &h,
+                   const Eigen::VectorXd &b,
+                   const Eigen::VectorXi &soc_dims);
+
+        exitcode solve(bool verbose = false);
+
+        // hand the current iterate to the interior point solver as its initial point
+        void warmStart(Solver &solver) const;
+
+        const Eigen::VectorXd &solution() const;
+        const Eigen::VectorXd &dualEquality() const;
+        const Eigen::VectorXd &dualConic() const;
+        const Eigen::VectorXd &slack() const;
+
+        ADMMSettings &getSettings();
+        const ADMMInformation &getInfo() const;
+
+    private:
+        ADMMSettings settings;
+        ADMMInformation info;
+
+        size_t n_var;  // Number of variables (n)
+        size_t n_eq;   // Number of equality constraints (p)
+        size_t n_ineq; // Number of inequality constraints (m)
+        size_t n_lc;   // Number of linear constraints (l)
+        size_t n_con;  // Number of constraints (p + m)
+
+        std::vector<SOCone> so_cones;
+
+        Eigen::SparseMatrix<double> G;
+        Eigen::SparseMatrix<double> A;
+        Eigen::SparseMatrix<double> Gt;
+        Eigen::SparseMatrix<double> At;
+        Eigen::VectorXd c;
+        Eigen::VectorXd h;
+        Eigen::VectorXd b;
+
+        // Equilibration vectors
+        Eigen::VectorXd x_equil; // (size n_var)
+        Eigen::VectorXd A_equil; // (size n_eq)
+        Eigen::VectorXd G_equil; // (size n_ineq)
+
+        // Iterates of the equilibrated problem, constraints are stacked as [A; G]
+        Eigen::VectorXd x; // (size n_var)
+        Eigen::VectorXd z; // (size n_con), z = [A; G] * x at convergence
+        Eigen::VectorXd y; // (size n_con)
+
+        // Unscaled solution
+        Eigen::VectorXd x_sol, y_sol, z_sol, s_sol;
+
+        // KKT
+        Eigen::VectorXd rho_vec; // (size n_con)
+        Eigen::SparseMatrix<double> K;
+        using LDLT_t = Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>, Eigen::Upper>;
+        LDLT_t ldlt;
+        std::vector<double *> KKT_rho_ptr; // Pointer to penalty elements for fast update
+
+        void setupKKT();
+        bool updateRho(double rho);
+        void productM(const Eigen::VectorXd &x, Eigen::VectorXd &y) const;
+        void productMt(const Eigen::VectorXd &y, Eigen::VectorXd &x) const;
+        void project(Eigen::VectorXd &v) const;
+        void unscaleSolution();
+    };
+
+} // namespace EiCOS
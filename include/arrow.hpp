@@ -0,0 +1,53 @@
+#pragma once
+
+#include <Eigen/Dense>
+#include <Eigen/Sparse>
+
+#include <vector>
+
+namespace EiCOS
+{
+
+    /**
+     * LDL' factorization of a symmetric matrix with block-angular (arrow) structure
+     *
+     *      [ K_1              B_1' ]
+     *      [      K_2         B_2' ]
+     *  K = [           ...    ...  ]
+     *      [ B_1  B_2  ...    K_c  ]
+     *
+     * The diagonal blocks are factored in parallel, the coupling block is
+     * handled through the dense Schur complement S = K_c - sum_i B_i K_i^-1 B_i'.
+     */
+    class ArrowLDLT
+    {
+    public:
+        // blocks and coupling partition the indices of K, only the upper triangle of K is read
+        void analyzePattern(const Eigen::SparseMatrix<double> &K,
+                            const std::vector<std::vector<int>> &blocks,
+                            const std::vector<int> &coupling);
+        bool factorize(const Eigen::SparseMatrix<double> &K);
+        Eigen::VectorXd solve(const Eigen::VectorXd &rhs) const;
+
+    private:
+        using LDLT_t = Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>, Eigen::Upper>;
+
+        struct Block
+        {
+            std::vector<int> indices;             // rows of K in this block
+            Eigen::SparseMatrix<double> K;        // diagonal block, upper triangle
+            Eigen::SparseMatrix<double> B;        // coupling rows, (n_coupling x size)
+            std::vector<int> K_src;               // positions of the values of K in the full matrix
+            std::vector<int> B_src;               // positions of the values of B in the full matrix
+            LDLT_t ldlt;
+            Eigen::MatrixXd KinvBt;               // K^-1 * B'
+        };
+
+        std::vector<Block> blocks;
+        std::vector<int> coupling;                // rows of K in the coupling block
+        std::vector<std::pair<int, int>> K_c_src; // (position in S, position in the full matrix)
+        Eigen::MatrixXd S;                        // Schur complement, lower triangle
+        Eigen::LDLT<Eigen::MatrixXd> S_ldlt;
+    };
+
+} // namespace EiCOS
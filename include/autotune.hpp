@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+namespace EiCOS
+{
+
+    /**
+     * Configuration of the linear algebra that Solver::tune() found fastest
+     * for one problem structure on one machine.
+     */
+    struct TuningProfile
+    {
+        bool threaded_products = false; // split the products with G and A over threads
+        unsigned threads = 0;           // hardware threads of the machine that was tuned
+        double solve_time = 0.;         // shortest solve with this configuration in ms
+    };
+
+    /**
+     * Tuning profiles keyed by the fingerprint of the KKT pattern, shared by all
+     * solvers of the process. Solvers look up the profile of their structure when
+     * they are set up and use it instead of the default choices. With a directory,
+     * the profiles are also stored as files, so that other processes can load them.
+     * Profiles of a machine with a different number of hardware threads are ignored.
+     *
+     * File format (text): EICOSTUN version fingerprint threads threaded_products solve_time
+     */
+    class TuningProfiles
+    {
+    public:
+        static TuningProfiles &global();
+
+        std::optional<TuningProfile> find(uint64_t fingerprint);
+        void insert(uint64_t fingerprint, const TuningProfile &profile);
+
+        // directory of the files, empty to keep the profiles in memory only
+        void setDirectory(const std::string &path);
+        // drops the profiles in memory, the files are kept
+        void clear();
+
+        size_t size() const;
+
+    private:
+        std::optional<TuningProfile> load(uint64_t fingerprint) const;
+        void store(uint64_t fingerprint, const TuningProfile &profile) const;
+        std::string filePath(uint64_t fingerprint) const;
+
+        mutable std::mutex mutex;
+        std::unordered_map<uint64_t, TuningProfile> entries;
+        std::string directory;
+    };
+
+} // namespace EiCOS
@@ -0,0 +1,201 @@
+#pragma once
+
+#include <Eigen/Sparse>
+
+#include <vector>
+
+namespace EiCOS
+{
+
+    struct LPCone
+    {
+        Eigen::VectorXd w; // size n_lc
+        Eigen::VectorXd v; // size n_lc
+    };
+
+    struct SOCone
+    {
+        size_t dim;            // dimension of cone
+        Eigen::VectorXd skbar; // temporary variables to work with
+        Eigen::VectorXd zkbar; // temporary variables to work with
+        double a;              // = wbar(1)
+        double d1;             // first element of D
+        double w;              // = q'*q
+        double eta;            // eta = (sres / zres)^(1/4)
+        double eta_square;     // eta^2 = (sres / zres)^(1/2)
+        Eigen::VectorXd q;     // = wbar(2:end)
+        double u0;             // eta
+        double u1;             // u = [u0; u1 * q]
+        double v1;             // v = [0; v1 * q]
+    };
+
+    /**
+     * Contiguous group of cones of one type.
+     *
+     * The conic vectors (s, z, lambda, ...) hold the cones one after the other,
+     * the cone block of K holds every cone followed by its expansion rows.
+     * A group covers the rows from start in the conic vectors and from kkt_start
+     * in the cone block of K. The cone type provides the kernels:
+     *
+     *   forEachCone(f)                     f(row, kkt_row, dim, n_expansion) for every block of rows
+     *   allocate()
+     *   updateScalings(s, z)               false if s or z left the cone
+     *   scale(z, lambda)                   lambda = W * z
+     *   unscale(lambda, z)                 z = W \ lambda
+     *   scale2add(x, y)                    y += W^2 * x on the cone block of K
+     *   conicProduct(u, v, w, mu)          w = u o v, mu += e' * |w|
+     *   conicDivision(u, w, v)             v = u \ w
+     *   stepLength(lambda, ds, dz, alpha)  alpha = min(alpha, largest step in the cone)
+     *   maxResidual(r, alpha)              alpha = max(alpha, distance of r outside the cone)
+     *   addIdentity(x, alpha)              x += alpha * e
+     *   refinementResidual(bz, Gdx, dz, delta, ez)
+     *   scalingEntries()                   number of scaling entries of the cone block of K
+     *   countKKTColumns(outer, col)        entries of the expansion columns
+     *   fillKKTColumns(K, col)             pattern of the expansion columns
+     *   cacheScalings(K, col, ptrs)        pointers to the scaling entries
+     *   updateKKTScalings(ptr, delta)      writes W^2 with static regularization
+     *   resetKKTScalings(ptr)              writes the identity
+     *
+     * The solver calls them on every group through static dispatch, the group
+     * types are fixed at compile time.
+     */
+    template <typename Derived>
+    class ConeGroup
+    {
+    public:
+        size_t rows() const { return n_rows; }
+        size_t kktRows() const { return n_kkt_rows; }
+
+        // copies the rows of x into the cone block y of K, the expansion rows become zero
+        void expand(const Eigen::Ref<const Eigen::VectorXd> &x, Eigen::Ref<Eigen::VectorXd> y) const
+        {
+            derived().forEachCone([&](size_t row, size_t kkt_row, size_t dim, size_t n_expansion) {
+                y.segment(kkt_row, dim) = x.segment(row, dim);
+                y.segment(kkt_row + dim, n_expansion).setZero();
+            });
+        }
+
+        // copies the rows of the cone block x of K into y, the inverse of expand
+        void compress(const Eigen::Ref<const Eigen::VectorXd> &x, Eigen::Ref<Eigen::VectorXd> y) const
+        {
+            derived().forEachCone([&](size_t row, size_t kkt_row, size_t dim, size_t) {
+                y.segment(row, dim) = x.segment(kkt_row, dim);
+            });
+        }
+
+        // column of K for every row, col is the first column of the cone block
+        void mapRows(size_t col, std::vector<int> &row_col) const
+        {
+            derived().forEachCone([&](size_t row, size_t kkt_row, size_t dim, size_t) {
+                for (size_t k = 0; k < dim; k++)
+                {
+                    row_col[row + k] = col + kkt_row + k;
+                }
+            });
+        }
+
+    protected:
+        ConeGroup(size_t start, size_t kkt_start, size_t n_rows, size_t n_kkt_rows)
+            : start(start), kkt_start(kkt_start), n_rows(n_rows), n_kkt_rows(n_kkt_rows) {}
+
+        const Derived &derived() const { return static_cast<const Derived &>(*this); }
+
+        size_t start;      // first row in the conic vectors
+        size_t kkt_start;  // first row in the cone block of K
+        size_t n_rows;     // rows in the conic vectors
+        size_t n_kkt_rows; // rows in the cone block of K
+    };
+
+    /**
+     * Nonnegative orthant, the linear constraints.
+     */
+    class LPConeGroup : public ConeGroup<LPConeGroup>
+    {
+    public:
+        LPConeGroup(LPCone &cone, size_t start, size_t kkt_start, size_t n);
+
+        template <typename F>
+        void forEachCone(F &&f) const
+        {
+            f(start, kkt_start, n_rows, size_t(0));
+        }
+
+        void allocate();
+        bool updateScalings(const Eigen::VectorXd &s, const Eigen::VectorXd &z);
+        void scale(const Eigen::VectorXd &z, Eigen::VectorXd &lambda) const;
+        void unscale(const Eigen::VectorXd &lambda, Eigen::VectorXd &z) const;
+        void scale2add(const Eigen::VectorXd &x, Eigen::VectorXd &y) const;
+        void conicProduct(const Eigen::VectorXd &u, const Eigen::VectorXd &v,
+                          Eigen::VectorXd &w, double &mu) const;
+        void conicDivision(const Eigen::VectorXd &u, const Eigen::VectorXd &w, Eigen::VectorXd &v) const;
+        void stepLength(const Eigen::VectorXd &lambda, const Eigen::VectorXd &ds,
+                        const Eigen::VectorXd &dz, double &alpha) const;
+        void maxResidual(const Eigen::VectorXd &r, double &alpha) const;
+        void addIdentity(Eigen::VectorXd &x, double alpha) const;
+        void refinementResidual(const Eigen::VectorXd &bz, const Eigen::VectorXd &Gdx,
+                                const Eigen::VectorXd &dz, double delta, Eigen::VectorXd &ez) const;
+
+        size_t scalingEntries() const;
+        void countKKTColumns(int *outer, size_t col) const;
+        void fillKKTColumns(Eigen::SparseMatrix<double> &K, size_t col) const;
+        void cacheScalings(Eigen::SparseMatrix<double> &K, size_t col, std::vector<double *> &ptrs) const;
+        void updateKKTScalings(double *const *&ptr, double delta) const;
+        void resetKKTScalings(double *const *&ptr) const;
+
+    private:
+        LPCone &cone;
+    };
+
+    /**
+     * Second-order cones, each expanded by two rows in K.
+     */
+    class SOConeGroup : public ConeGroup<SOConeGroup>
+    {
+    public:
+        SOConeGroup(std::vector<SOCone> &cones, size_t start, size_t kkt_start);
+
+        template <typename F>
+        void forEachCone(F &&f) const
+        {
+            size_t row = start;
+            size_t kkt_row = kkt_start;
+            for (const SOCone &sc : cones)
+            {
+                f(row, kkt_row, sc.dim, size_t(2));
+                row += sc.dim;
+                kkt_row += sc.dim + 2;
+            }
+        }
+
+        void allocate();
+        bool updateScalings(const Eigen::VectorXd &s, const Eigen::VectorXd &z);
+        void scale(const Eigen::VectorXd &z, Eigen::VectorXd &lambda) const;
+        void unscale(const Eigen::VectorXd &lambda, Eigen::VectorXd &z) const;
+        void scale2add(const Eigen::VectorXd &x, Eigen::VectorXd &y) const;
+        void conicProduct(const Eigen::VectorXd &u, const Eigen::VectorXd &v,
+                          Eigen::VectorXd &w, double &mu) const;
+        void conicDivision(const Eigen::VectorXd &u, const Eigen::VectorXd &w, Eigen::VectorXd &v) const;
+        void stepLength(const Eigen::VectorXd &lambda, const Eigen::VectorXd &ds,
+                        const Eigen::VectorXd &dz, double &alpha) const;
+        void maxResidual(const Eigen::VectorXd &r, double &alpha) const;
+        void addIdentity(Eigen::VectorXd &x, double alpha) const;
+        void refinementResidual(const Eigen::VectorXd &bz, const Eigen::VectorXd &Gdx,
+                                const Eigen::VectorXd &dz, double delta, Eigen::VectorXd &ez) const;
+
+        size_t scalingEntries() const;
+        void countKKTColumns(int *outer, size_t col) const;
+        void fillKKTColumns(Eigen::SparseMatrix<double> &K, size_t col) const;
+        void cacheScalings(Eigen::SparseMatrix<double> &K, size_t col, std::vector<double *> &ptrs) const;
+        void updateKKTScalings(double *const *&ptr, double delta) const;
+        void resetKKTScalings(double *const *&ptr) const;
+
+    private:
+        std::vector<SOCone> &cones;
+    };
+
+    /**
+     * Euclidean projection onto K = R^n_lc_+ x SOC(q_1) x ... x SOC(q_ncones), in place.
+     */
+    void projectToCone(size_t n_lc, const std::vector<SOCone> &so_cones, Eigen::VectorXd &x);
+
+} // namespace EiCOS
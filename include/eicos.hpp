@@ -2,9 +2,26 @@
 
 #include <Eigen/Sparse>
 
+#include "arrow.hpp"
+#include "autotune.hpp"
+#include "cones.hpp"
+#include "log_sink.hpp"
+#include "metrics.hpp"
+#include "parallel.hpp"
+#include "spmv.hpp"
+#include "symbolic_cache.hpp"
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+
 namespace EiCOS
 {
 
+    class SolutionCache;
+    struct SolutionKey;
+
     enum class exitcode
     {
         optimal = 0,           /* Problem solved to optimality              */
@@ -13,6 +30,7 @@ namespace EiCOS
         maxit = -1,            /* Maximum number of iterations reached      */
         numerics = -2,         /* Search direction unreliable               */
         outcone = -3,          /* s or z got outside the cone, numerics?    */
+        interrupted = -4,      /* Setup cancelled by the progress callback  */
         fatal = -7,            /* Unknown problem in solver                 */
         close_to_optimal = 10,
         close_to_primal_infeasible = 11,
@@ -25,7 +43,7 @@ namespace EiCOS
         const double gamma = 0.99;         // scaling the final step length
         const double delta = 2e-7;         // regularization parameter
         const double deltastat = 7e-8;     // static regularization parameter
-        const double eps = 1e13;           // regularization threshold
+        const double eps = 1e-13;          // regularization threshold
         const double feastol = 1e-8;       // primal/dual infeasibility tolerance
         const double abstol = 1e-8;        // absolute tolerance on duality gap
         const double reltol = 1e-8;        // relative tolerance on duality gap
@@ -35,6 +53,7 @@ namespace EiCOS
         const size_t nitref = 9;           // maximum number of iterative refinement steps
         const size_t maxit = 100;          // maximum number of iterations
         bool verbose = false;              // print solver output
+        bool decompose = false;            // solve independent blocks as separate problems in parallel
         const double linsysacc = 1e-14;    // rel. accuracy of search direction
         const double irerrfact = 6;        // factor by which IR should reduce err
         const double stepmin = 1e-6;       // smallest step that we do take
@@ -44,6 +63,14 @@ namespace EiCOS
         const size_t equil_iters = 3;      // eqilibration iterations
         const size_t iter_max = 100;       // maximum solver iterations
         const size_t safeguard = 500;      // Maximum increase in PRES before NUMERICS is thrown.
+        const double cg_tol = 1e-10;       // rel. accuracy of conjugate gradients (matrix-free mode)
+        const size_t cg_maxit = 500;       // maximum conjugate gradient iterations (matrix-free mode)
+        const double cg_eqreg = 1e-6;      // penalty on equality constraints (matrix-free mode)
+        const size_t spmv_nnz = 100000;    // minimum non-zeros for multithreaded products
+        size_t fixed_iters = 0;            // if > 0, every solve runs exactly this many iterations, without early exits
+        size_t fixed_nitref = 2;           // refinement steps of every KKT solve when fixed_iters > 0
+        std::shared_ptr<LogSink> log_sink; // receives the verbose output instead of stdout
+        std::shared_ptr<Metrics> metrics;  // registry that every solve reports to
     };
 
     struct Information
@@ -72,26 +99,49 @@ namespace EiCOS
         bool isBetterThan(Information &other) const;
     };
 
-    struct LPCone
+    /**
+     * A matrix that is only available through its products,
+     * used to pass G and A to the solver in matrix-free mode.
+     */
+    struct LinearOperator
+    {
+        using Product = std::function<void(const Eigen::VectorXd &x, Eigen::VectorXd &y)>;
+
+        Eigen::Index rows = 0;
+        Eigen::Index cols = 0;
+        Product apply;                   // y = M * x
+        Product apply_transpose;         // y = M' * x
+        Product apply_transpose_squared; // y = (M .* M)' * x, optional, enables preconditioning
+    };
+
+    /**
+     * Reports the progress of the problem setup with the name of the next stage
+     * and the fraction of the stages that are done. Returning false cancels the
+     * setup, solve() then returns exitcode::interrupted.
+     */
+    using SetupCallback = std::function<bool(const std::string &stage, double progress)>;
+
+    /**
+     * Factorization and solve of the KKT system for one fixed sparsity pattern,
+     * e.g. the functions emitted by Solver::generateKKTSolver.
+     */
+    struct KKTKernel
     {
-        Eigen::VectorXd w; // size n_lc
-        Eigen::VectorXd v; // size n_lc
+        bool (*factor)(const double *Kx) = nullptr; // factors K given the values of its upper triangle
+        void (*solve)(double *x) = nullptr;         // overwrites the right hand side with the solution
+        size_t dim = 0;                             // dimension of K
+        size_t nnz = 0;                             // non-zeros in the upper triangle of K
     };
 
-    struct SOCone
+    /**
+     * Variables and constraints of one independent block of the problem.
+     */
+    struct Component
     {
-        size_t dim;            // dimension of cone
-        Eigen::VectorXd skbar; // temporary variables to work with
-        Eigen::VectorXd zkbar; // temporary variables to work with
-        double a;              // = wbar(1)
-        double d1;             // first element of D
-        double w;              // = q'*q
-        double eta;            // eta = (sres / zres)^(1/4)
-        double eta_square;     // eta^2 = (sres / zres)^(1/2)
-        Eigen::VectorXd q;     // = wbar(2:end)
-        double u0;             // eta
-        double u1;             // u = [u0; u1 * q]
-        double v1;             // v = [0; v1 * q]
+        std::vector<int> vars;      // columns of G and A
+        std::vector<int> eq_rows;   // rows of A
+        std::vector<int> ineq_rows; // rows of G, linear constraints first, then whole cones
+        std::vector<int> cone_dims; // dimensions of the second order cones
     };
 
     struct Work
@@ -113,6 +163,21 @@ namespace EiCOS
         Information i;
     };
 
+    /**
+     * Exit conditions of the interior point method for the statistics of an iterate,
+     * with the relaxed tolerances in reduced accuracy mode. Sets the infeasibility
+     * flags and returns not_converged_yet if none of the conditions is met.
+     */
+    exitcode checkExitConditions(const Settings &settings, Information &info,
+                                 double cx, double by, double hz, double tau, double kap,
+                                 bool reduced_accuracy);
+
+    // line of an iteration in the verbose output, with the header before the first iteration
+    std::string formatIteration(const Information &info);
+    // verbose output, to the log sink of the settings if there is one, printed otherwise
+    void logIteration(const Settings &settings, const Information &info);
+    void logMessage(const Settings &settings, const std::string &text);
+
     class Solver
     {
         /**    
@@ -140,13 +205,22 @@ namespace EiCOS
                const Eigen::VectorXd &c,
                const Eigen::VectorXd &h,
                const Eigen::VectorXd &b,
-               const Eigen::VectorXi &soc_dims);
+               const Eigen::VectorXi &soc_dims,
+               const SetupCallback &progress = {});
         void updateData(const Eigen::SparseMatrix<double> &G,
                         const Eigen::SparseMatrix<double> &A,
                         const Eigen::VectorXd &c,
                         const Eigen::VectorXd &h,
                         const Eigen::VectorXd &b);
 
+        // matrix-free interface, Newton systems are solved with conjugate gradients
+        Solver(const LinearOperator &G,
+               const LinearOperator &A,
+               const Eigen::VectorXd &c,
+               const Eigen::VectorXd &h,
+               const Eigen::VectorXd &b,
+               const Eigen::VectorXi &soc_dims);
+
         // traditional interface for compatibility
         Solver(int n, int m, int p, int l, int ncones, int *q,
                double *Gpr, int *Gjc, int *Gir,
@@ -158,9 +232,36 @@ namespace EiCOS
         exitcode solve(bool verbose = false);
 
         const Eigen::VectorXd &solution() const;
+        const Eigen::VectorXd &dualEquality() const;
+        const Eigen::VectorXd &dualConic() const;
+        const Eigen::VectorXd &slack() const;
+
+        // start the next solve from the given point instead of the default initialization
+        void setInitialPoint(const Eigen::VectorXd &x,
+                             const Eigen::VectorXd &y,
+                             const Eigen::VectorXd &z,
+                             const Eigen::VectorXd &s);
 
         Settings &getSettings();
         const Information &getInfo() const;
+        const SolveStatistics &getStatistics() const;
+
+        // emit standalone code that factors and solves the KKT system of this problem structure
+        void generateKKTSolver(const std::string &path = "kkt_solver.hpp",
+                               const std::string &name = "kkt_solver") const;
+        // use generated code instead of the sparse LDLT, the problem structure must be the same
+        void setKKTKernel(const KKTKernel &kernel);
+        // label each variable with its block, -1 for coupling variables, to factor the KKT system by blocks
+        void setBlockStructure(const Eigen::VectorXi &var_blocks);
+        // reorder variables, rows and cones internally for locality, results stay in the original order
+        void reorder();
+        // run the parallel work of this solver, and of its blocks, on the pool instead of the current one
+        void setThreadPool(std::shared_ptr<ThreadPool> pool);
+        // return the stored result when the same problem is solved again, null to always solve
+        void setSolutionCache(std::shared_ptr<SolutionCache> cache);
+        std::shared_ptr<SolutionCache> solutionCache() const;
+        // benchmark the product threading on this instance, keep and store the fastest, without the solution cache
+        TuningProfile tune(size_t runs = 3);
 
         // void saveProblemData(const std::string &path = "problem_data.hpp");
 
@@ -170,10 +271,23 @@ namespace EiCOS
                    const Eigen::VectorXd &c,
                    const Eigen::VectorXd &h,
                    const Eigen::VectorXd &b,
-                   const Eigen::VectorXi &soc_dims);
+                   const Eigen::VectorXi &soc_dims,
+                   const SetupCallback &progress = {});
+        void setupCones(const Eigen::VectorXi &soc_dims);
 
         Settings settings;
         Work w, w_best;
+        SolveStatistics statistics; // of the last solve
+        exitcode solveInteriorPoint(bool verbose);
+        bool warm_start = false;
+        bool setup_cancelled = false;
+        bool kkt_analyzed = false; // symbolic analysis of the sparse LDLT is done
+        std::shared_ptr<ThreadPool> thread_pool; // null to use the current pool of the calling thread
+        std::optional<bool> threaded_products; // set by a tuning profile, by size of the matrices otherwise
+        std::shared_ptr<SolutionCache> solution_cache;
+        SolutionKey solutionKey() const;
+        size_t threadParts(size_t nnz) const;
+        void applyProfile(const TuningProfile &profile);
 
         size_t n_var;  // Number of variables (n)
         size_t n_eq;   // Number of equality constraints (p)
@@ -185,20 +299,67 @@ namespace EiCOS
         LPCone lp_cone;
         std::vector<SOCone> so_cones;
 
+        // calls f on the group of linear constraints, then on the group of second-order cones
+        template <typename F>
+        void forEachConeGroup(F &&f)
+        {
+            LPConeGroup lp(lp_cone, 0, 0, n_lc);
+            SOConeGroup so(so_cones, n_lc, n_lc);
+            f(lp);
+            f(so);
+        }
+
         Eigen::SparseMatrix<double> G;
         Eigen::SparseMatrix<double> A;
-        Eigen::SparseMatrix<double> Gt;
-        Eigen::SparseMatrix<double> At;
+        SparseRows G_csr; // row-wise index of G, shares the values of G
+        SparseRows A_csr; // row-wise index of A, shares the values of A
         Eigen::VectorXd c;
         Eigen::VectorXd h;
         Eigen::VectorXd b;
 
+        // Decomposition into independent blocks
+        std::vector<Component> components;
+        std::vector<std::unique_ptr<Solver>> sub_solvers;
+        void findComponents();
+        void setupSubproblems();
+        void syncSubSettings(Solver &sub_solver) const;
+        exitcode solveDecomposed();
+
+        // Reordering for locality, internal index -> index in the user data (empty if not reordered)
+        std::vector<int> var_order, eq_order, ineq_order;
+        std::vector<int> G_src, A_src; // positions of the values of G and A in the user data
+        static Eigen::VectorXd gatherInternal(const Eigen::VectorXd &v, const std::vector<int> &order);
+        static Eigen::VectorXd scatterUser(const Eigen::VectorXd &v, const std::vector<int> &order);
+        void copyValues(const double *Gpr, const double *Apr);
+
+        // Matrix-free mode
+        bool matrix_free = false;
+        LinearOperator G_op;
+        LinearOperator A_op;
+        size_t solveNormalEquations(const Eigen::VectorXd &rhs,
+                                    Eigen::VectorXd &dx,
+                                    Eigen::VectorXd &dy,
+                                    Eigen::VectorXd &dz,
+                                    bool initialize);
+        void applyNormalMatrix(const Eigen::VectorXd &x, Eigen::VectorXd &y, bool initialize);
+        void scaleSquaredInverse(const Eigen::VectorXd &x, Eigen::VectorXd &y, bool initialize);
+
+        // Products with the problem matrices, y += alpha * M * x
+        RowPartition G_rows, Gt_rows, A_rows, At_rows;
+        void partitionProducts();
+        void productG(const Eigen::VectorXd &x, Eigen::VectorXd &y, double alpha = 1.) const;
+        void productGt(const Eigen::VectorXd &x, Eigen::VectorXd &y, double alpha = 1.) const;
+        void productA(const Eigen::VectorXd &x, Eigen::VectorXd &y, double alpha = 1.) const;
+        void productAt(const Eigen::VectorXd &x, Eigen::VectorXd &y, double alpha = 1.) const;
+
         // Residuals
         Eigen::VectorXd rx; // (size n_var)
         Eigen::VectorXd ry; // (size n_eq)
         Eigen::VectorXd rz; // (size n_ineq)
         double hresx, hresy, hresz;
+        double nrx, nry, nrz; // norms of the residuals
         double rt;
+        double gap; // s' * z
 
         // Norm iterates
         double nx, ny, nz, ns;
@@ -218,10 +379,16 @@ namespace EiCOS
         Eigen::VectorXd rhs1; // The right hand side in the first  KKT equation.
         Eigen::VectorXd rhs2; // The right hand side in the second KKT equation.
         Eigen::SparseMatrix<double> K;
-        using LDLT_t = Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>, Eigen::Upper>;
-        LDLT_t ldlt;
+        SymbolicLDLT ldlt;
+        Eigen::VectorXi K_signs;          // expected sign of every pivot of K, for the dynamic regularization
         std::vector<double *> KKT_V_ptr;  // Pointer to scaling/regularization elements for fast update
         std::vector<double *> KKT_AG_ptr; // Pointer to A/G elements for fast update
+        std::optional<KKTKernel> kkt_kernel;
+        std::unique_ptr<ArrowLDLT> arrow_ldlt;
+        uint64_t structureFingerprint() const;
+        void analyzeKKT();
+        bool factorizeKKT();
+        Eigen::VectorXd solveFactorized(const Eigen::VectorXd &rhs) const;
         void setupKKT();
         void resetKKTScalings();
         void updateKKTScalings();
@@ -231,6 +398,7 @@ namespace EiCOS
                         Eigen::VectorXd &dy,
                         Eigen::VectorXd &dz,
                         bool initialize);
+        double cdx, bdy, hdz; // c' * dx, b' * dy and h' * dz of the last KKT solution
 
         void allocate();
 
@@ -245,6 +413,7 @@ namespace EiCOS
         void RHScombined();
         void scale2add(const Eigen::VectorXd &x, Eigen::VectorXd &y);
         void scale(const Eigen::VectorXd &z, Eigen::VectorXd &lambda);
+        void unscale(const Eigen::VectorXd &lambda, Eigen::VectorXd &z);
         double lineSearch(Eigen::VectorXd &lambda,
                           Eigen::VectorXd &ds,
                           Eigen::VectorXd &dz,
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "eicos.hpp"
+
+namespace EiCOS
+{
+
+    /**
+     * Iteratively equilibrates the rows and columns of A and G in place.
+     * Rows of G that belong to the same second-order cone share one scaling factor.
+     * The accumulated scalings are returned in x_equil, A_equil and G_equil.
+     * A_rows and G_rows index the rows of A and G, the matrices are processed in n_parts parallel ranges.
+     */
+    void equilibrate(Eigen::SparseMatrix<double> &A,
+                     Eigen::SparseMatrix<double> &G,
+                     const SparseRows &A_rows,
+                     const SparseRows &G_rows,
+                     size_t n_parts,
+                     size_t n_var,
+                     size_t n_lc,
+                     const std::vector<SOCone> &so_cones,
+                     size_t iterations,
+                     Eigen::VectorXd &x_equil,
+                     Eigen::VectorXd &A_equil,
+                     Eigen::VectorXd &G_equil);
+
+    /**
+     * Undoes the equilibration of a matrix, m = diag(d) * m * diag(e)
+     */
+    void restore(const Eigen::VectorXd &d, const Eigen::VectorXd &e,
+                 Eigen::SparseMatrix<double> &m);
+
+} // namespace EiCOS
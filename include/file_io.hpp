@@ -0,0 +1,16 @@
+#pragma once
+
+#include <string>
+
+namespace EiCOS
+{
+
+    /**
+     * Replaces the file at path by data. The data is written to a new file with a
+     * unique name in the same directory, which is then renamed over path, so that
+     * readers see either the old or the new file and concurrent writers, in this or
+     * other processes, never share a temporary file. Returns false on failure.
+     */
+    bool writeFileAtomic(const std::string &path, const std::string &data);
+
+} // namespace EiCOS
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+
+namespace EiCOS
+{
+
+    /**
+     * Inner loops of the products, the linear cone operations and the equilibration on raw arrays.
+     *
+     * With EICOS_CPU_DISPATCH they are compiled for several instruction sets
+     * (AVX-512, AVX2, SSE4.2 and the baseline) and the best version for the
+     * running CPU is chosen when the library is loaded. All versions give the
+     * same results, the terms are summed in the same order and not contracted.
+     * Every term of the products is value * (alpha * x), as in Eigen's column
+     * major product, for any alpha.
+     *
+     * The elementwise loops and the divisions are vectorized. The row sums and
+     * maxima stay scalar in every version, vectorizing them would change the
+     * order of the sums. The second-order cone operations (scaling, conic
+     * product and division) are not dispatched and run at the baseline ISA.
+     */
+
+    // instruction set of the selected kernels: "avx512f", "avx2", "sse4.2" or "default"
+    const char *cpuDispatchLevel();
+
+    // y[row] += sum_k value[k] * (alpha * x[col[k]]) over the entries k of the rows [begin, end)
+    void accumulateRows(const int *row_start, const int *col, const double *value,
+                        const double *x, double *y, double alpha, ptrdiff_t begin, ptrdiff_t end);
+    // same, the values are value[position[k]]
+    void accumulateRowsGather(const int *row_start, const int *col, const int *position, const double *value,
+                              const double *x, double *y, double alpha, ptrdiff_t begin, ptrdiff_t end);
+
+    // elementwise out = a .* b, out = a ./ b, out = sqrt(a) and y += a .* b
+    void multiplyElements(size_t n, const double *a, const double *b, double *out);
+    void divideElements(size_t n, const double *a, const double *b, double *out);
+    void sqrtElements(size_t n, const double *a, double *out);
+    void addProductElements(size_t n, const double *a, const double *b, double *y);
+
+    // e[j] = max(e[j], |value[k]|) over the entries k of the rows or columns [begin, end)
+    void maxAbsRanges(const int *start, const double *value, double *e, ptrdiff_t begin, ptrdiff_t end);
+    // same, the values are value[position[k]]
+    void maxAbsRangesGather(const int *start, const int *position, const double *value,
+                            double *e, ptrdiff_t begin, ptrdiff_t end);
+    // value[k] /= e[index[k]] over the entries k of the columns [begin, end), value must not overlap e
+    void divideByIndex(const int *start, const int *index, const double *e, double *value,
+                       ptrdiff_t begin, ptrdiff_t end);
+    // value[k] /= e[j] over the entries k of the columns j in [begin, end)
+    void divideByColumn(const int *start, const double *e, double *value, ptrdiff_t begin, ptrdiff_t end);
+
+} // namespace EiCOS
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "eicos.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <type_traits>
+
+namespace EiCOS
+{
+
+    struct LatencyReport
+    {
+        size_t runs = 0;                 // measured solves
+        size_t iterations = 0;           // iterations done by the slowest solve
+        double worst = 0.;               // longest solve in ms
+        double best = 0.;                // shortest solve in ms
+        double mean = 0.;                // mean solve time in ms
+        double worst_per_iteration = 0.; // longest solve divided by its iterations, in ms
+    };
+
+    /**
+     * Solves the problem of a Solver or StaticSolver runs times and measures the
+     * solve times, including the first solve with cold caches. Meant for the mode
+     * with fixed_iters, where every solve does the same work and the worst case
+     * bounds the time of further solves on the same machine. The solution cache
+     * of a Solver is detached while it is measured, so every run is a solve.
+     */
+    template <typename SolverType>
+    LatencyReport measureLatency(SolverType &solver, size_t runs = 100)
+    {
+        LatencyReport report;
+        report.runs = runs;
+        report.best = std::numeric_limits<double>::max();
+
+        std::shared_ptr<SolutionCache> cache;
+        if constexpr (std::is_same_v<SolverType, Solver>)
+        {
+            cache = solver.solutionCache();
+            solver.setSolutionCache(nullptr);
+        }
+
+        double total = 0.;
+        for (size_t run = 0; run < runs; run++)
+        {
+            const auto t0 = std::chrono::steady_clock::now();
+            solver.solve();
+            const double time = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+
+            if (time > report.worst)
+            {
+                report.worst = time;
+                report.iterations = solver.getSettings().fixed_iters > 0 ? solver.getSettings().fixed_iters
+                                                                         : solver.getInfo().iter;
+            }
+            report.best = std::min(report.best, time);
+            total += time;
+        }
+
+        if constexpr (std::is_same_v<SolverType, Solver>)
+        {
+            solver.setSolutionCache(cache);
+        }
+
+        if (runs > 0)
+        {
+            report.mean = total / runs;
+            report.worst_per_iteration = report.worst / std::max<size_t>(report.iterations, 1);
+        }
+        else
+        {
+            report.best = 0.;
+        }
+        return report;
+    }
+
+} // namespace EiCOS
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace EiCOS
+{
+
+    struct Information;
+
+    /**
+     * Receives the verbose output of the solvers. The calls come from the solving
+     * threads, so they should return quickly and not block on I/O.
+     */
+    class LogSink
+    {
+    public:
+        virtual ~LogSink() = default;
+
+        // statistics of an interior point iteration
+        virtual void iteration(const Information &info) = 0;
+        // status and summary lines
+        virtual void message(const std::string &text) = 0;
+    };
+
+    /**
+     * Log sink that only puts the records into a bounded lock-free queue. A
+     * background thread formats and writes them, so a slow terminal or pipe never
+     * stalls a solve. Records that arrive while the queue is full are dropped and
+     * counted. Any number of solvers can log into the same sink concurrently.
+     * While the queue is empty, the writer sleeps on a condition variable; the
+     * solving threads only take its mutex to wake it up.
+     */
+    class AsyncLogSink : public LogSink
+    {
+    public:
+        // out stays open and owned by the caller, capacity is rounded up to a power of two
+        explicit AsyncLogSink(std::FILE *out = stdout, size_t capacity = 1024);
+        ~AsyncLogSink() override;
+        AsyncLogSink(const AsyncLogSink &) = delete;
+        AsyncLogSink &operator=(const AsyncLogSink &) = delete;
+
+        void iteration(const Information &info) override;
+        void message(const std::string &text) override;
+
+        // waits until all records that were logged so far are written
+        void flush();
+        size_t dropped() const;
+
+    private:
+        struct Record;
+        struct Slot;
+
+        bool push(const Record &record);
+        bool pop(Record &record);
+        bool queued() const;
+        void write();
+
+        std::FILE *out;
+        std::unique_ptr<Slot[]> slots;
+        size_t mask;
+        alignas(64) std::atomic<size_t> head{0}; // next slot to write
+        alignas(64) std::atomic<size_t> tail{0}; // next slot to read
+        std::atomic<size_t> n_pushed{0};
+        std::atomic<size_t> n_written{0};
+        std::atomic<size_t> n_dropped{0};
+        std::atomic<bool> stop{false};
+        std::atomic<bool> waiting{false}; // the writer sleeps or is about to
+        std::mutex mutex;
+        std::condition_variable ready;   // records were pushed, or stop was set
+        std::condition_variable written; // n_written grew
+        std::thread writer;
+    };
+
+} // namespace EiCOS
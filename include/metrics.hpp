@@ -0,0 +1,120 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace EiCOS
+{
+
+    enum class exitcode;
+    struct Information;
+
+    /**
+     * Work of one solve that Information does not cover.
+     */
+    struct SolveStatistics
+    {
+        double solve_time = 0.;        // in s
+        double factor_time = 0.;       // of all factorizations of K, in s
+        size_t factorizations = 0;     // numeric factorizations of K
+        size_t refinement_steps = 0;   // iterative refinement steps of all KKT solves
+        size_t fallbacks = 0;          // restores of the best iterate after a failed step
+        size_t regularized_pivots = 0; // pivots replaced by the dynamic regularization
+    };
+
+    /**
+     * Counters and histograms of the solves of any number of solvers, for monitoring.
+     * Solvers report to the registry of their settings at the end of solve(). Results
+     * taken from a solution cache only count as cache hits, not as solves. All
+     * updates are relaxed atomic increments, so reporting never blocks; an export
+     * that runs concurrently may see a solve only partly counted.
+     */
+    class Metrics
+    {
+    public:
+        enum class Format
+        {
+            prometheus, // text exposition format
+            json
+        };
+
+        Metrics();
+
+        void record(exitcode code, const Information &info, const SolveStatistics &statistics);
+        void recordCacheHit();
+
+        std::string text(Format format) const;
+        bool writeFile(const std::string &path, Format format) const;
+
+        uint64_t solves() const;
+        uint64_t cacheHits() const;
+
+    private:
+        // upper bounds of the buckets, the last bucket is unbounded
+        template <size_t N>
+        struct Histogram
+        {
+            Histogram(const std::array<double, N> &bounds, double unit) : bounds(bounds), unit(unit) {}
+            void add(double value);
+
+            const std::array<double, N> bounds;
+            const double unit; // of the sum
+            std::array<std::atomic<uint64_t>, N + 1> counts{};
+            std::atomic<uint64_t> sum{0};
+        };
+
+        static constexpr size_t n_codes = 12;
+
+        std::chrono::steady_clock::time_point start;
+        std::atomic<uint64_t> n_solves{0};
+        std::atomic<uint64_t> n_cache_hits{0};
+        std::array<std::atomic<uint64_t>, n_codes> exit_codes{};
+        std::atomic<uint64_t> factorizations{0};
+        std::atomic<uint64_t> refinement_steps{0};
+        std::atomic<uint64_t> fallbacks{0};
+        std::atomic<uint64_t> regularized_pivots{0};
+        Histogram<10> iterations;
+        Histogram<11> solve_time;
+        Histogram<11> factor_time; // per factorization
+    };
+
+    /**
+     * Background thread that exports a registry periodically, to a file or to a
+     * callback, and once more when it is destroyed.
+     */
+    class MetricsExporter
+    {
+    public:
+        using Callback = std::function<void(const std::string &text)>;
+
+        MetricsExporter(std::shared_ptr<const Metrics> metrics, Metrics::Format format,
+                        std::chrono::milliseconds period, Callback callback);
+        MetricsExporter(std::shared_ptr<const Metrics> metrics, Metrics::Format format,
+                        std::chrono::milliseconds period, const std::string &path);
+        ~MetricsExporter();
+        MetricsExporter(const MetricsExporter &) = delete;
+        MetricsExporter &operator=(const MetricsExporter &) = delete;
+
+    private:
+        void run();
+
+        std::shared_ptr<const Metrics> metrics;
+        Metrics::Format format;
+        std::chrono::milliseconds period;
+        Callback callback;
+
+        std::mutex mutex;
+        std::condition_variable wake;
+        bool stop = false;
+        std::thread thread;
+    };
+
+} // namespace EiCOS
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace EiCOS
+{
+
+    /**
+     * Worker threads that run the parallel loops of the solver.
+     *
+     * The calling thread takes part in every loop, so a pool of n threads starts
+     * n - 1 workers and a pool of one thread runs everything inline. With a list
+     * of CPUs, worker t is pinned to cpus[(t + 1) % cpus.size()], so with one
+     * thread per CPU, cpus[0] gets no worker. The pool does not pin the calling
+     * thread; a caller that should run on cpus[0] pins itself with
+     * setThreadAffinity. Memory that a worker
+     * touches first is placed on the NUMA node of its CPU, so the CPUs of one
+     * node (numaNodeCpus) keep a solve on that node.
+     *
+     * A pool runs one loop at a time. Loops started from its own workers, or while
+     * it is busy with the loop of another thread, run inline.
+     */
+    class ThreadPool
+    {
+    public:
+        // 0 threads means one per hardware thread, or one per CPU of the list
+        explicit ThreadPool(size_t n_threads = 0, const std::vector<int> &cpus = {});
+        ~ThreadPool();
+        ThreadPool(const ThreadPool &) = delete;
+        ThreadPool &operator=(const ThreadPool &) = delete;
+
+        // calls f(i) for i = 0, ..., n - 1, indices are handed out one at a time
+        void parallelFor(size_t n, const std::function<void(size_t)> &f);
+
+        size_t size() const;
+        const std::vector<int> &cpus() const;
+
+        // pool of the process, one thread per hardware thread without affinity
+        static ThreadPool &global();
+        // pool of the innermost Scope of this thread, the own pool on workers, else the global one
+        static ThreadPool &current();
+
+        /**
+         * Makes a pool the current one of this thread while the scope lives,
+         * a null pool keeps the current one.
+         */
+        class Scope
+        {
+        public:
+            explicit Scope(ThreadPool *pool);
+            ~Scope();
+            Scope(const Scope &) = delete;
+            Scope &operator=(const Scope &) = delete;
+
+        private:
+            ThreadPool *previous;
+            bool active;
+        };
+
+    private:
+        void work(size_t worker);
+        void runLoop();
+
+        std::vector<int> cpu_list;
+        std::vector<std::thread> workers;
+
+        std::mutex loop_mutex; // held by the thread whose loop is running
+        std::mutex mutex;
+        std::condition_variable wake, done;
+        const std::function<void(size_t)> *loop = nullptr;
+        size_t loop_size = 0;
+        std::atomic<size_t> next{0};
+        size_t generation = 0; // number of loops started
+        size_t running = 0;    // workers still in the current loop
+        bool stop = false;
+    };
+
+    // pins the calling thread to the CPUs, returns false if that is not supported or fails
+    bool setThreadAffinity(const std::vector<int> &cpus);
+
+    // CPUs of a NUMA node, empty if the node does not exist or the topology is unknown
+    std::vector<int> numaNodeCpus(int node);
+
+    // runs the loop on the current pool
+    inline void parallelFor(size_t n, const std::function<void(size_t)> &f)
+    {
+        ThreadPool::current().parallelFor(n, f);
+    }
+
+} // namespace EiCOS
@@ -1,3 +1,5 @@
+#pragma once
+
 constexpr bool debug_printing = false;
 
 #if __has_include(<fmt/format.h>)
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <Eigen/Sparse>
+
+#include <istream>
+#include <ostream>
+#include <string>
+
+namespace EiCOS
+{
+
+    /**
+     * Data of a problem in the form of the Eigen constructor of Solver:
+     * minimize c'x s.t. A x = b, h - G x in the cones, linear rows of G first.
+     */
+    struct Problem
+    {
+        std::string name;
+        Eigen::SparseMatrix<double> G;
+        Eigen::SparseMatrix<double> A;
+        Eigen::VectorXd c;
+        Eigen::VectorXd h;
+        Eigen::VectorXd b;
+        Eigen::VectorXi soc_dims;
+        bool maximize = false;         // c was negated to turn a maximization into a minimization
+        double objective_offset = 0.;  // constant term of the objective in the original sense
+    };
+
+    enum class ProblemFormat
+    {
+        binary, // written by writeProblem, any number of problems per stream
+        mps,    // linear programs, fixed or free
+        cbf     // conic benchmark format with linear and second order cones
+    };
+
+    // format by the extension of a file name, binary if it is neither .mps nor .cbf
+    ProblemFormat problemFormat(const std::string &path);
+
+    /**
+     * Reads the next problem of a stream. Returns false with an empty error at the
+     * end of the stream, and false with a description of the problem if the data is
+     * invalid. Integer markers of MPS and CBF files are ignored, so mixed-integer
+     * problems are read as their relaxation.
+     *
+     * Binary format (native byte order):
+     *   char[8] "EICOSPRB", uint32 version, int32 n, m, p, ncones, int32 q[ncones],
+     *   G and A as int32 jc[n + 1], int32 ir[nnz], double pr[nnz],
+     *   double c[n], h[m], b[p], uint8 maximize, double offset, uint32 length, char name[length].
+     */
+    bool readProblem(std::istream &in, ProblemFormat format, Problem &problem, std::string &error);
+    bool writeProblem(std::ostream &out, const Problem &problem);
+
+    // objective of a primal cost in the original sense of the problem
+    double objectiveValue(const Problem &problem, double pcost);
+
+} // namespace EiCOS
@@ -0,0 +1,134 @@
+#pragma once
+
+#include "eicos.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace EiCOS
+{
+
+    /**
+     * Solve of a problem by an eicos_server, as the client receives it.
+     */
+    struct ServerResult
+    {
+        exitcode code = exitcode::fatal;
+        Information info;
+        Eigen::VectorXd x, y, z, s;
+    };
+
+    /**
+     * Keeps warm solvers for the problem structures of its clients, so that processes
+     * on one host share the setup and symbolic analysis of a structure.
+     *
+     * Clients connect over a Unix domain socket. Each client passes a shared memory
+     * ring of value slots on connecting, as a memfd sealed against shrinking, registers its structures, then writes the
+     * values of each solve into the next slot and sends the slot number. The results
+     * go back over the socket in the order of the requests. Each connection is served
+     * by its own thread; up to max_idle solvers per structure are kept between solves.
+     *
+     * Messages: uint32 type, uint32 reserved, uint64 payload size, payload.
+     *   hello: uint64 slot size, uint64 slots, the memfd of the slots attached as SCM_RIGHTS
+     *   setup: int32 n, m, p, l, ncones, q, Gjc, Gir, Ajc, Air, then Gpr, Apr, c, h, b as double
+     *          -> uint64 structure id, 0 if the problem is invalid
+     *   solve: uint64 structure id, uint64 slot holding Gpr, Apr, c, h, b
+     *          -> int32 exit code, Information, x, y, z, s
+     * The peers run on the same host, so all values are in native layout.
+     */
+    class SolverServer
+    {
+    public:
+        explicit SolverServer(const std::string &socket_path, size_t max_idle = 4);
+        ~SolverServer();
+        SolverServer(const SolverServer &) = delete;
+        SolverServer &operator=(const SolverServer &) = delete;
+
+        // false if the socket could not be created
+        bool listening() const;
+        // accepts clients until stop() is called
+        void run();
+        void stop();
+
+        size_t structures() const;
+        size_t solversCreated() const;
+
+    private:
+        struct Structure;
+
+        std::shared_ptr<Structure> registerStructure(const std::vector<char> &payload, uint64_t &id);
+        std::shared_ptr<Structure> findStructure(uint64_t id) const;
+        void serve(int fd, uint64_t connection);
+        void joinFinished();
+
+        std::string socket_path;
+        size_t max_idle;
+        int listen_fd = -1;
+        std::atomic<bool> stopping{false};
+
+        mutable std::mutex mutex;
+        std::map<uint64_t, std::shared_ptr<Structure>> structure_map;
+        std::set<int> client_fds;
+        std::map<uint64_t, std::thread> client_threads; // by connection number
+        std::vector<std::thread> finished_threads;      // threads of closed connections, joined by run()
+        std::condition_variable clients_done;
+        uint64_t n_connections = 0;
+        std::atomic<size_t> n_created{0};
+    };
+
+    /**
+     * Connection of a process to an eicos_server.
+     */
+    class ServerClient
+    {
+    public:
+        // slot_size is the largest number of values of a solve, n_slots the solves that can be in flight
+        ServerClient(const std::string &socket_path, size_t slot_size, size_t n_slots = 4);
+        ~ServerClient();
+        ServerClient(const ServerClient &) = delete;
+        ServerClient &operator=(const ServerClient &) = delete;
+
+        bool connected() const;
+
+        // registers a structure with the arguments of the traditional constructor, returns its id, 0 on failure
+        uint64_t setup(int n, int m, int p, int l, int ncones, const int *q,
+                       const double *Gpr, const int *Gjc, const int *Gir,
+                       const double *Apr, const int *Ajc, const int *Air,
+                       const double *c, const double *h, const double *b);
+
+        // sends the values of a solve, false if all slots are in flight or the values do not fit
+        bool submit(uint64_t structure,
+                    const double *Gpr, const double *Apr,
+                    const double *c, const double *h, const double *b);
+        // waits for the result of the oldest solve in flight
+        bool receive(ServerResult &result);
+        bool solve(uint64_t structure,
+                   const double *Gpr, const double *Apr,
+                   const double *c, const double *h, const double *b,
+                   ServerResult &result);
+
+    private:
+        struct Dimensions
+        {
+            int n, m, p;
+            size_t G_nnz, A_nnz;
+        };
+
+        int fd = -1;
+        double *slots = nullptr;
+        size_t slot_size;
+        size_t n_slots;
+        size_t next_slot = 0;
+        std::deque<uint64_t> in_flight; // structures of the solves in flight, oldest first
+        std::map<uint64_t, Dimensions> dimensions;
+    };
+
+} // namespace EiCOS
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "eicos.hpp"
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace EiCOS
+{
+
+    /**
+     * 128 bit hash of the data of a problem, two independent 64 bit lanes
+     * over the raw words, so that equal data always gives the same key.
+     */
+    struct SolutionKey
+    {
+        uint64_t lane1 = 0x243f6a8885a308d3;
+        uint64_t lane2 = 0x13198a2e03707344;
+
+        void add(uint64_t word);
+        void add(const double *values, size_t count);
+        void add(const int *values, size_t count);
+        SolutionKey finish() const;
+
+        bool operator==(const SolutionKey &other) const { return lane1 == other.lane1 and lane2 == other.lane2; }
+    };
+
+    /**
+     * Result of a solve as it is kept in a SolutionCache.
+     */
+    struct CachedSolution
+    {
+        exitcode code;
+        Information info;
+        Eigen::VectorXd x, y, z, s;
+    };
+
+    /**
+     * Results of solves keyed by the hash of the problem data, so that a solver
+     * that gets the same problem again returns the stored result without solving.
+     * The least recently used results are dropped once the results take more than
+     * the capacity in bytes. One cache can be shared by any number of solvers and
+     * threads.
+     */
+    class SolutionCache
+    {
+    public:
+        explicit SolutionCache(size_t capacity = size_t(64) << 20);
+
+        std::shared_ptr<const CachedSolution> find(const SolutionKey &key);
+        void insert(const SolutionKey &key, CachedSolution solution);
+
+        // in bytes of the stored vectors and entries, 0 disables the cache
+        void setCapacity(size_t capacity);
+        void clear();
+
+        size_t size() const;
+        size_t bytes() const;
+        size_t hits() const;
+        size_t misses() const;
+
+    private:
+        struct KeyHash
+        {
+            size_t operator()(const SolutionKey &key) const { return key.lane1; }
+        };
+        using Entry = std::pair<SolutionKey, std::shared_ptr<const CachedSolution>>;
+
+        static size_t entryBytes(const CachedSolution &solution);
+        void evict(size_t capacity);
+
+        mutable std::mutex mutex;
+        std::list<Entry> entries; // most recently used first
+        std::unordered_map<SolutionKey, std::list<Entry>::iterator, KeyHash> index;
+        size_t capacity;
+        size_t n_bytes = 0;
+        size_t n_hits = 0;
+        size_t n_misses = 0;
+    };
+
+} // namespace EiCOS
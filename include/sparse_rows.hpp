@@ -0,0 +1,57 @@
+#pragma once
+
+#include <Eigen/Sparse>
+
+#include <vector>
+
+namespace EiCOS
+{
+
+    /**
+     * Compressed row index of a column major matrix. No values are stored:
+     * every entry holds the position of its value in the column major storage,
+     * so the matrix is walked by rows and by columns over one value array.
+     * The index only depends on the sparsity pattern and survives value updates.
+     */
+    class SparseRows
+    {
+    public:
+        // the columns of M are sorted in n_parts parallel ranges
+        void setup(const Eigen::SparseMatrix<double> &M, size_t n_parts = 1);
+
+        Eigen::Index rows() const { return row_start.size() - 1; }
+        Eigen::Index nonZeros() const { return cols.size(); }
+        const int *outerIndexPtr() const { return row_start.data(); }
+        const int *colPtr() const { return cols.data(); }
+        const int *positionPtr() const { return positions.data(); }
+
+        // entries of one row in the order of their columns, the values are read from M
+        class InnerIterator
+        {
+        public:
+            InnerIterator(const SparseRows &rows, const Eigen::SparseMatrix<double> &M, Eigen::Index row)
+                : rows(rows), values(M.valuePtr()), k(rows.row_start[row]), end(rows.row_start[row + 1]) {}
+
+            explicit operator bool() const { return k < end; }
+            InnerIterator &operator++()
+            {
+                k++;
+                return *this;
+            }
+            Eigen::Index col() const { return rows.cols[k]; }
+            Eigen::Index position() const { return rows.positions[k]; }
+            double value() const { return values[rows.positions[k]]; }
+
+        private:
+            const SparseRows &rows;
+            const double *values;
+            int k, end;
+        };
+
+    private:
+        std::vector<int> row_start; // first entry of each row, size rows + 1
+        std::vector<int> cols;      // column of each entry
+        std::vector<int> positions; // position of each entry in the column major storage
+    };
+
+} // namespace EiCOS
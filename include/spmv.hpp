@@ -0,0 +1,36 @@
+#pragma once
+
+#include <Eigen/Sparse>
+
+#include "sparse_rows.hpp"
+
+#include <vector>
+
+namespace EiCOS
+{
+
+    /**
+     * Split of the rows of a sparse matrix into contiguous ranges
+     * that hold about the same number of non-zeros, given by their boundaries.
+     */
+    using RowPartition = std::vector<Eigen::Index>;
+
+    // the rows of M are the columns of Mt, i.e. Mt is the compressed row storage of M
+    RowPartition partitionRows(const Eigen::SparseMatrix<double> &Mt, size_t n_parts);
+    RowPartition partitionRows(const SparseRows &rows, size_t n_parts);
+
+    // y += alpha * M * x, the ranges of the partition are processed in parallel
+    void multiplyRows(const Eigen::SparseMatrix<double> &Mt,
+                      const RowPartition &partition,
+                      const Eigen::VectorXd &x,
+                      Eigen::VectorXd &y,
+                      double alpha = 1.);
+    // y += alpha * M * x over the row index of M
+    void multiplyRows(const SparseRows &rows,
+                      const Eigen::SparseMatrix<double> &M,
+                      const RowPartition &partition,
+                      const Eigen::VectorXd &x,
+                      Eigen::VectorXd &y,
+                      double alpha = 1.);
+
+} // namespace EiCOS
@@ -0,0 +1,1224 @@
+#pragma once
+
+#include <Eigen/Dense>
+
+#include "eicos.hpp"
+#include "printing.hpp"
+
+#include <array>
+#include <chrono>
+#include <tuple>
+#include <utility>
+
+namespace EiCOS
+{
+
+    /**
+     * Solver for a problem structure that is fixed at compile time: N variables,
+     * P equality constraints, L linear inequalities and second-order cones of the
+     * dimensions SOC...
+     *
+     *   StaticSolver<2, 0, 0, 3> solver(G, A, c, h, b);
+     *
+     * The interior point method is the one of Solver::solve(). All vectors and
+     * matrices are fixed-size members, so a solver on the stack works without heap
+     * memory, and the loops over the cones are unrolled at compile time. G and A are
+     * dense. The KKT matrix is dense as well, ordered cones first, then x and y, and
+     * factored by an LDL' with dynamic regularization. The dimension of the KKT matrix
+     * is limited by the stack allocation limit of Eigen (about 120 rows).
+     */
+    template <int N, int P, int L, int... SOC>
+    class StaticSolver
+    {
+        static_assert(N > 0 and P >= 0 and L >= 0, "invalid problem dimensions");
+        static_assert(((SOC > 0) and ...), "invalid cone dimensions");
+
+    public:
+        static constexpr int n_var = N;
+        static constexpr int n_eq = P;
+        static constexpr int n_lc = L;
+        static constexpr int n_sc = sizeof...(SOC);
+        static constexpr int n_ineq = L + (0 + ... + SOC);
+        static constexpr int mtilde = n_ineq + 2 * n_sc; // rows of the cone block of K
+        static constexpr int dim_K = mtilde + N + P;
+
+        using VectorX = Eigen::Matrix<double, N, 1>;
+        using VectorY = Eigen::Matrix<double, P, 1>;
+        using VectorZ = Eigen::Matrix<double, n_ineq, 1>;
+        using MatrixG = Eigen::Matrix<double, n_ineq, N>;
+        using MatrixA = Eigen::Matrix<double, P, N>;
+
+        StaticSolver(const MatrixG &G, const MatrixA &A, const VectorX &c, const VectorZ &h, const VectorY &b)
+        {
+            updateData(G, A, c, h, b);
+        }
+
+        void updateData(const MatrixG &G, const MatrixA &A, const VectorX &c, const VectorZ &h, const VectorY &b)
+        {
+            this->G = G;
+            this->A = A;
+            this->c = c;
+            this->h = h;
+            this->b = b;
+
+            setEquilibration();
+            setupKKT();
+        }
+
+        exitcode solve(bool verbose = false);
+
+        const VectorX &solution() const { return w.x; }
+        const VectorY &dualEquality() const { return w.y; }
+        const VectorZ &dualConic() const { return w.z; }
+        const VectorZ &slack() const { return w.s; }
+
+        Settings &getSettings() { return settings; }
+        const Information &getInfo() const { return w.i; }
+
+    private:
+        using VectorK = Eigen::Matrix<double, dim_K, 1>;
+        using VectorC = Eigen::Matrix<double, mtilde, 1>;
+        using MatrixK = Eigen::Matrix<double, dim_K, dim_K>;
+
+        /* Rows of x and y in K, the cone block comes first */
+        static constexpr int kx = mtilde;
+        static constexpr int ky = mtilde + N;
+
+        template <int Dim>
+        struct Cone
+        {
+            Eigen::Matrix<double, Dim - 1, 1> q; // = wbar(2:end)
+            double a;                            // = wbar(1)
+            double d1;                           // first element of D
+            double w;                            // = q'*q
+            double eta;                          // eta = (sres / zres)^(1/4)
+            double eta_square;                   // eta^2 = (sres / zres)^(1/2)
+            double u0;                           // eta
+            double u1;                           // u = [u0; u1 * q]
+            double v1;                           // v = [0; v1 * q]
+        };
+
+        struct Work
+        {
+            VectorX x;
+            VectorY y;
+            VectorZ z;
+            VectorZ s;
+            VectorZ lambda;
+            double kap;
+            double tau;
+            double cx, by, hz;
+            Information i;
+        };
+
+        static constexpr std::array<int, n_sc> cone_dims = {SOC...};
+
+        // first row of a cone in the conic vectors
+        static constexpr int coneStart(size_t cone)
+        {
+            int start = L;
+            for (size_t k = 0; k < cone; k++)
+            {
+                start += cone_dims[k];
+            }
+            return start;
+        }
+
+        // first row of a cone in K, every cone is followed by its two expansion rows
+        static constexpr int coneKKTStart(size_t cone)
+        {
+            int start = L;
+            for (size_t k = 0; k < cone; k++)
+            {
+                start += cone_dims[k] + 2;
+            }
+            return start;
+        }
+
+        // calls f(std::integral_constant<size_t, k>) for every second-order cone k
+        template <typename F>
+        static void forEachCone(F &&f)
+        {
+            forEachCone(f, std::make_index_sequence<n_sc>());
+        }
+        template <typename F, size_t... K>
+        static void forEachCone(F &f, std::index_sequence<K...>)
+        {
+            (f(std::integral_constant<size_t, K>()), ...);
+        }
+
+        Settings settings;
+        Work w, w_best;
+
+        MatrixG G;
+        MatrixA A;
+        VectorX c;
+        VectorZ h;
+        VectorY b;
+
+        // Equilibration vectors
+        VectorX x_equil;
+        VectorY A_equil;
+        VectorZ G_equil;
+
+        // Scalings
+        Eigen::Matrix<double, L, 1> lp_v;
+        Eigen::Matrix<double, L, 1> lp_w;
+        std::tuple<Cone<SOC>...> so_cones;
+
+        // Residuals
+        VectorX rx;
+        VectorY ry;
+        VectorZ rz;
+        double hresx, hresy, hresz;
+        double nrx, nry, nrz;
+        double rt;
+        double gap;
+        double nx, ny, nz, ns;
+        double resx0, resy0, resz0;
+
+        VectorZ dsaff_by_W, W_times_dzaff, dsaff;
+
+        // KKT
+        VectorK rhs1;
+        VectorK rhs2;
+        MatrixK K;      // lower triangle
+        MatrixK LD;     // unit lower triangle L below the diagonal, D on the diagonal
+        VectorK signs;  // expected signs of the pivots
+        double cdx, bdy, hdz;
+
+        void setEquilibration();
+        void setupKKT();
+        void resetKKTScalings();
+        void updateKKTScalings();
+        bool factorizeKKT();
+        VectorK solveFactorized(const VectorK &rhs) const;
+        size_t solveKKT(const VectorK &rhs, VectorX &dx, VectorY &dy, VectorZ &dz, bool initialize);
+
+        void computeResiduals();
+        void updateStatistics();
+        exitcode checkExitConditions(bool reduced_accuracy)
+        {
+            return EiCOS::checkExitConditions(settings, w.i, w.cx, w.by, w.hz, w.tau, w.kap, reduced_accuracy);
+        }
+
+        void expand(const VectorZ &x, VectorK &y) const;
+        void compress(const VectorK &x, VectorZ &y) const;
+        bool updateScalings();
+        void scale(const VectorZ &z, VectorZ &lambda) const;
+        void unscale(const VectorZ &lambda, VectorZ &z) const;
+        void scale2add(const VectorC &x, VectorC &y) const;
+        double conicProduct(const VectorZ &u, const VectorZ &v, VectorZ &w) const;
+        void conicDivision(const VectorZ &u, const VectorZ &w, VectorZ &v) const;
+        void addIdentity(VectorZ &x, double alpha) const;
+        void bringToCone(const VectorZ &r, VectorZ &s) const;
+        double lineSearch(const VectorZ &lambda, const VectorZ &ds, const VectorZ &dz,
+                          double tau, double dtau, double kap, double dkap) const;
+        void RHSaffine();
+        void RHScombined();
+        void backscale();
+    };
+
+    /* ========================== Setup ========================== */
+
+    /**
+     * Same equilibration as for the sparse matrices, the zeros of the
+     * dense matrices do not change the maxima.
+     */
+    template <int N, int P, int L, int... SOC>
+    void StaticSolver<N, P, L, SOC...>::setEquilibration()
+    {
+        x_equil.setOnes();
+        A_equil.setOnes();
+        G_equil.setOnes();
+
+        for (size_t iter = 0; iter < settings.equil_iters; iter++)
+        {
+            VectorX x_tmp;
+            VectorY A_tmp;
+            VectorZ G_tmp;
+
+            /* Maxima of the columns of A and G and of the rows */
+            for (int j = 0; j < N; j++)
+            {
+                double e = 0.;
+                for (int i = 0; i < P; i++)
+                {
+                    e = std::max(std::fabs(A(i, j)), e);
+                }
+                for (int i = 0; i < n_ineq; i++)
+                {
+                    e = std::max(std::fabs(G(i, j)), e);
+                }
+                x_tmp(j) = e;
+            }
+            A_tmp = A.cwiseAbs().rowwise().maxCoeff();
+            G_tmp = G.cwiseAbs().rowwise().maxCoeff();
+
+            /* Rows of a second-order cone share the total */
+            forEachCone([&](auto cone) {
+                constexpr int dim = cone_dims[cone];
+                constexpr int start = coneStart(cone);
+                const double total = G_tmp.template segment<dim>(start).sum();
+                G_tmp.template segment<dim>(start).setConstant(total);
+            });
+
+            auto sqrt_op = [](const double a) { return std::fabs(a) < 1e-6 ? 1. : std::sqrt(a); };
+            x_tmp = x_tmp.unaryExpr(sqrt_op);
+            A_tmp = A_tmp.unaryExpr(sqrt_op);
+            G_tmp = G_tmp.unaryExpr(sqrt_op);
+
+            for (int j = 0; j < N; j++)
+            {
+                for (int i = 0; i < P; i++)
+                {
+                    A(i, j) = A(i, j) / A_tmp(i) / x_tmp(j);
+                }
+                for (int i = 0; i < n_ineq; i++)
+                {
+                    G(i, j) = G(i, j) / G_tmp(i) / x_tmp(j);
+                }
+            }
+
+            x_equil = x_equil.cwiseProduct(x_tmp);
+            A_equil = A_equil.cwiseProduct(A_tmp);
+            G_equil = G_equil.cwiseProduct(G_tmp);
+        }
+
+        c = c.cwiseQuotient(x_equil);
+        b = b.cwiseQuotient(A_equil);
+        h = h.cwiseQuotient(G_equil);
+    }
+
+    /**
+     *      [ -V  0  G ]
+     *  K = [ G'  0  A']
+     *      [ 0   A  0 ]
+     *
+     * with the static regularization, only the lower triangle is used.
+     * Positive pivots are expected for x and for the last expansion row of every cone.
+     */
+    template <int N, int P, int L, int... SOC>
+    void StaticSolver<N, P, L, SOC...>::setupKKT()
+    {
+        K.setZero();
+        K.diagonal().template segment<N>(kx).setConstant(settings.deltastat);
+        K.diagonal().template segment<P>(ky).setConstant(-settings.deltastat);
+        K.template block<P, N>(ky, kx) = A;
+        K.template block<N, L>(kx, 0) = G.template topRows<L>().transpose();
+
+        signs.setConstant(-1.);
+        signs.template segment<N>(kx).setOnes();
+
+        forEachCone([&](auto cone) {
+            constexpr int dim = cone_dims[cone];
+            constexpr int start = coneStart(cone);
+            constexpr int kkt_start = coneKKTStart(cone);
+            K.template block<N, dim>(kx, kkt_start) = G.template middleRows<dim>(start).transpose();
+            signs(kkt_start + dim + 1) = 1.;
+        });
+    }
+
+    template <int N, int P, int L, int... SOC>
+    void StaticSolver<N, P, L, SOC...>::resetKKTScalings()
+    {
+        K.diagonal().template head<L>().setConstant(-1.);
+
+        forEachCone([&](auto cone) {
+            constexpr int dim = cone_dims[cone];
+            constexpr int kkt_start = coneKKTStart(cone);
+            K.template block<dim + 2, dim + 2>(kkt_start, kkt_start).setZero();
+            K.diagonal().template segment<dim + 1>(kkt_start).setConstant(-1.);
+            K(kkt_start + dim + 1, kkt_start + dim + 1) = 1.;
+        });
+    }
+
+    template <int N, int P, int L, int... SOC>
+    void StaticSolver<N, P, L, SOC...>::updateKKTScalings()
+    {
+        const double delta = settings.deltastat;
+
+        K.diagonal().template head<L>() = -lp_v.array() - delta;
+
+        forEachCone([&](auto cone) {
+            constexpr int dim = cone_dims[cone];
+            constexpr int kkt_start = coneKKTStart(cone);
+            constexpr int v_row = kkt_start + dim;
+            constexpr int u_row = v_row + 1;
+            const auto &sc = std::get<cone>(so_cones);
+
+            /* D */
+            K(kkt_start, kkt_start) = -sc.eta_square * sc.d1 - delta;
+            K.diagonal().template segment<dim - 1>(kkt_start + 1).setConstant(-sc.eta_square - delta);
+
+            /* v */
+            K(v_row, v_row) = -sc.eta_square;
+            K.template block<1, dim - 1>(v_row, kkt_start + 1) = -sc.eta_square * sc.v1 * sc.q.transpose();
+
+            /* u */
+            K(u_row, u_row) = sc.eta_square + delta;
+            K(u_row, kkt_start) = -sc.eta_square * sc.u0;
+            K.template block<1, dim - 1>(u_row, kkt_start + 1) = -sc.eta_square * sc.u1 * sc.q.transpose();
+        });
+    }
+
+    /* ========================== KKT system ========================== */
+
+    /**
+     * Right-looking LDL' of the lower triangle of K. Pivots that are too small
+     * or have the wrong sign are replaced by sign * delta. The zeros of the
+     * cone block are skipped.
+     */
+    template <int N, int P, int L, int... SOC>
+    bool StaticSolver<N, P, L, SOC...>::factorizeKKT()
+    {
+        LD.template triangularView<Eigen::Lower>() = K;
+
+        for (int k = 0; k < dim_K; k++)
+        {
+            double d = LD(k, k);
+            if (signs(k) * d <= settings.eps)
+            {
+                d = signs(k) * settings.delta;
+            }
+            LD(k, k) = d;
+
+            for (int j = k + 1; j < dim_K; j++)
+            {
+                const double l_jk = LD(j, k) / d;
+                if (l_jk != 0.)
+                {
+                    for (int i = j; i < dim_K; i++)
+                    {
+                        LD(i, j) -= LD(i, k) * l_jk;
+                    }
+                }
+            }
+            LD.col(k).tail(dim_K - k - 1) /= d;
+        }
+
+        return LD.diagonal().allFinite();
+    }
+
+    template <int N, int P, int L, int... SOC>
+    typename StaticSolver<N, P, L, SOC...>::VectorK
+    StaticSolver<N, P, L, SOC...>::solveFactorized(const VectorK &rhs) const
+    {
+        VectorK x = rhs;
+        LD.template triangularView<Eigen::UnitLower>().solveInPlace(x);
+        x.array() /= LD.diagonal().array();
+        LD.template triangularView<Eigen::UnitLower>().transpose().solveInPlace(x);
+        return x;
+    }
+
+    /**
+     * Solves the KKT system with iterative refinement, as Solver::solveKKT.
+     */
+    template <int N, int P, int L, int... SOC>
+    size_t StaticSolver<N, P, L, SOC...>::solveKKT(const VectorK &rhs, VectorX &dx, VectorY &dy, VectorZ &dz,
+                                                   bool initialize)
+    {
+        VectorK x = solveFactorized(rhs);
+
+        const double error_threshold = (1. + rhs.template lpNorm<Eigen::Infinity>()) * settings.linsysacc;
+
+        double nerr_prev = std::numeric_limits<double>::max();
+        VectorK dx_ref;
+
+        /* A fixed number of steps with fixed_iters */
+        const bool fixed = settings.fixed_iters > 0;
+        const size_t nitref = fixed ? settings.fixed_nitref : settings.nitref;
+        size_t k_ref;
+        for (k_ref = 0; k_ref <= nitref; k_ref++)
+        {
+            dx = x.template segment<N>(kx);
+            dy = x.template segment<P>(ky);
+            compress(x, dz);
+
+            /* ex = bx - A' * dy - G' * dz */
+            VectorX ex = rhs.template segment<N>(kx) - G.transpose() * dz;
+            if (P > 0)
+            {
+                ex -= A.transpose() * dy;
+            }
+            ex -= settings.deltastat * dx;
+            const double nex = ex.template lpNorm<Eigen::Infinity>();
+
+            /* ey = by - A * dx */
+            VectorY ey = rhs.template segment<P>(ky);
+            if (P > 0)
+            {
+                ey -= A * dx;
+            }
+            ey += settings.deltastat * dy;
+            const double ney = P > 0 ? ey.template lpNorm<Eigen::Infinity>() : 0.;
+
+            /* ez = bz - G * dx + V * dz_true */
+            const VectorZ Gdx = G * dx;
+            VectorC ez;
+            ez.template head<L>() = rhs.template head<L>() - Gdx.template head<L>() +
+                                    settings.deltastat * dz.template head<L>();
+            forEachCone([&](auto cone) {
+                constexpr int dim = cone_dims[cone];
+                constexpr int start = coneStart(cone);
+                constexpr int kkt_start = coneKKTStart(cone);
+                ez.template segment<dim>(kkt_start) = rhs.template segment<dim>(kkt_start) -
+                                                      Gdx.template segment<dim>(start);
+                ez.template segment<dim - 1>(kkt_start) += settings.deltastat * dz.template segment<dim - 1>(start);
+                ez(kkt_start + dim - 1) -= settings.deltastat * dz(start + dim - 1);
+                ez(kkt_start + dim) = 0.;
+                ez(kkt_start + dim + 1) = 0.;
+            });
+
+            const VectorC dz_true = x.template head<mtilde>();
+            if (initialize)
+            {
+                ez += dz_true;
+            }
+            else
+            {
+                scale2add(dz_true, ez);
+            }
+            const double nez = ez.template lpNorm<Eigen::Infinity>();
+
+            /* maximum error (infinity norm of e) */
+            double nerr = std::max({nex, ney, nez});
+
+            if (fixed)
+            {
+                if (k_ref == nitref)
+                {
+                    break;
+                }
+            }
+            else
+            {
+                /* Check whether refinement brought decrease */
+                if (k_ref > 0 and nerr > nerr_prev)
+                {
+                    x -= dx_ref;
+                    k_ref--;
+                    break;
+                }
+
+                /* Check whether to stop refining */
+                if (k_ref == nitref or
+                    (nerr < error_threshold) or
+                    (k_ref > 0 and nerr_prev < settings.irerrfact * nerr))
+                {
+                    break;
+                }
+            }
+            nerr_prev = nerr;
+
+            /* Solve for refinement */
+            VectorK e;
+            e << ez, ex, ey;
+            dx_ref = solveFactorized(e);
+
+            x += dx_ref;
+        }
+
+        dx = x.template segment<N>(kx);
+        dy = x.template segment<P>(ky);
+        compress(x, dz);
+        cdx = c.dot(dx);
+        bdy = b.dot(dy);
+        hdz = h.dot(dz);
+
+        return k_ref;
+    }
+
+    /* ========================== Cones ========================== */
+
+    // copies the rows of x into the cone block y of K, the expansion rows become zero
+    template <int N, int P, int L, int... SOC>
+    void StaticSolver<N, P, L, SOC...>::expand(const VectorZ &x, VectorK &y) const
+    {
+        y.template head<L>() = x.template head<L>();
+        forEachCone([&](auto cone) {
+            constexpr int dim = cone_dims[cone];
+            constexpr int kkt_start = coneKKTStart(cone);
+            y.template segment<dim>(kkt_start) = x.template segment<dim>(coneStart(cone));
+            y.template segment<2>(kkt_start + dim).setZero();
+        });
+    }
+
+    // copies the rows of the cone block x of K into y, the inverse of expand
+    template <int N, int P, int L, int... SOC>
+    void StaticSolver<N, P, L, SOC...>::compress(const VectorK &x, VectorZ &y) const
+    {
+        y.template head<L>() = x.template head<L>();
+        forEachCone([&](auto cone) {
+            constexpr int dim = cone_dims[cone];
+            y.template segment<dim>(coneStart(cone)) = x.template segment<dim>(coneKKTStart(cone));
+        });
+    }
+
+    /**
+     * Update scalings, false as soon as any multiplier or slack leaves the cone.
+     */
+    template <int N, int P, int L, int... SOC>
+    bool StaticSolver<N, P, L, SOC...>::updateScalings()
+    {
+        const VectorZ &s = w.s;
+        const VectorZ &z = w.z;
+
+        lp_v = s.template head<L>().cwiseQuotient(z.template head<L>());
+        lp_w = lp_v.cwiseSqrt();
+
+        bool in_cone = true;
+        forEachCone([&](auto cone) {
+            constexpr int dim = cone_dims[cone];
+            constexpr int k = coneStart(cone);
+            auto &sc = std::get<cone>(so_cones);
+            if (not in_cone)
+            {
+                return;
+            }
+
+            const double sres = s(k) * s(k) - s.template segment<dim - 1>(k + 1).squaredNorm();
+            const double zres = z(k) * z(k) - z.template segment<dim - 1>(k + 1).squaredNorm();
+            if (sres <= 0 or zres <= 0)
+            {
+                in_cone = false;
+                return;
+            }
+
+            /* Normalize variables */
+            const double snorm = std::sqrt(sres);
+            const double znorm = std::sqrt(zres);
+
+            const Eigen::Matrix<double, dim, 1> skbar = s.template segment<dim>(k) / snorm;
+            const Eigen::Matrix<double, dim, 1> zkbar = z.template segment<dim>(k) / znorm;
+
+            sc.eta_square = snorm / znorm;
+            sc.eta = std::sqrt(sc.eta_square);
+
+            /* Normalized Nesterov-Todd scaling point */
+            double gamma = 1. + skbar.dot(zkbar);
+            gamma = std::sqrt(0.5 * gamma);
+
+            const double a = (0.5 / gamma) * (skbar(0) + zkbar(0));
+            sc.q = (0.5 / gamma) * (skbar.template tail<dim - 1>() - zkbar.template tail<dim - 1>());
+            const double w = sc.q.squaredNorm();
+
+            /* Pre-compute variables needed for KKT matrix (used in KKT scaling) */
+            const double c = (1. + a) + w / (1. + a);
+            const double d = 1. + 2. / (1. + a) + w / std::pow(1. + a, 2);
+
+            const double d1 = std::max(0., 0.5 * (std::pow(a, 2) + w * (1. - std::pow(c, 2) / (1. + w * d))));
+            const double u0_square = std::pow(a, 2) + w - d1;
+
+            const double c2byu02 = (c * c) / u0_square;
+            if (c2byu02 - d <= 0)
+            {
+                in_cone = false;
+                return;
+            }
+
+            sc.d1 = d1;
+            sc.u0 = std::sqrt(u0_square);
+            sc.u1 = std::sqrt(c2byu02);
+            sc.v1 = std::sqrt(c2byu02 - d);
+            sc.a = a;
+            sc.w = w;
+        });
+        if (not in_cone)
+        {
+            return false;
+        }
+
+        /* lambda = W * z */
+        scale(z, w.lambda);
+
+        return true;
+    }
+
+    // lambda = W * z
+    template <int N, int P, int L, int... SOC>
+    void StaticSolver<N, P, L, SOC...>::scale(const VectorZ &z, VectorZ &lambda) const
+    {
+        lambda.template head<L>() = lp_w.cwiseProduct(z.template head<L>());
+        forEachCone([&](auto cone) {
+            constexpr int dim = cone_dims[cone];
+            constexpr int k = coneStart(cone);
+            const auto &sc = std::get<cone>(so_cones);
+
+            const double zeta = sc.q.dot(z.template segment<dim - 1>(k + 1));
+            const double factor = z(k) + zeta / (1. + sc.a);
+            lambda(k) = sc.eta * (sc.a * z(k) + zeta);
+            lambda.template segment<dim - 1>(k + 1) = sc.eta * (z.template segment<dim - 1>(k + 1) + factor * sc.q);
+        });
+    }
+
+    // z = W \ lambda
+    template <int N, int P, int L, int... SOC>
+    void StaticSolver<N, P, L, SOC...>::unscale(const VectorZ &lambda, VectorZ &z) const
+    {
+        z.template head<L>() = lambda.template head<L>().cwiseQuotient(lp_w);
+        forEachCone([&](auto cone) {
+            constexpr int dim = cone_dims[cone];
+            constexpr int k = coneStart(cone);
+            const auto &sc = std::get<cone>(so_cones);
+
+            const double zeta = sc.q.dot(lambda.template segment<dim - 1>(k + 1));
+            const double factor = -lambda(k) + zeta / (1. + sc.a);
+            z(k) = (sc.a * lambda(k) - zeta) / sc.eta;
+            z.template segment<dim - 1>(k + 1) = (lambda.template segment<dim - 1>(k + 1) + factor * sc.q) / sc.eta;
+        });
+    }
+
+    // y += W^2 * x on the cone block of K
+    template <int N, int P, int L, int... SOC>
+    void StaticSolver<N, P, L, SOC...>::scale2add(const VectorC &x, VectorC &y) const
+    {
+        y.template head<L>() += lp_v.cwiseProduct(x.template head<L>());
+        forEachCone([&](auto cone) {
+            constexpr int dim = cone_dims[cone];
+            constexpr int i1 = coneKKTStart(cone);
+            constexpr int i2 = i1 + 1;
+            constexpr int i3 = i2 + dim - 1;
+            constexpr int i4 = i3 + 1;
+            const auto &sc = std::get<cone>(so_cones);
+
+            y(i1) += sc.eta_square * (sc.d1 * x(i1) + sc.u0 * x(i4));
+
+            const double v1x3_plus_u1x4 = sc.v1 * x(i3) + sc.u1 * x(i4);
+            y.template segment<dim - 1>(i2) += sc.eta_square * (x.template segment<dim - 1>(i2) + v1x3_plus_u1x4 * sc.q);
+
+            const double qtx2 = sc.q.dot(x.template segment<dim - 1>(i2));
+            y(i3) += sc.eta_square * (sc.v1 * qtx2 + x(i3));
+            y(i4) = sc.eta_square * (sc.u0 * x(i1) + sc.u1 * qtx2 - x(i4));
+        });
+    }
+
+    // w = u o v, returns e' * |w|
+    template <int N, int P, int L, int... SOC>
+    double StaticSolver<N, P, L, SOC...>::conicProduct(const VectorZ &u, const VectorZ &v, VectorZ &w) const
+    {
+        w.template head<L>() = u.template head<L>().cwiseProduct(v.template head<L>());
+        double mu = w.template head<L>().template lpNorm<1>();
+        forEachCone([&](auto cone) {
+            constexpr int dim = cone_dims[cone];
+            constexpr int k = coneStart(cone);
+            const double u0 = u(k);
+            const double v0 = v(k);
+            w(k) = u.template segment<dim>(k).dot(v.template segment<dim>(k));
+            mu += std::abs(w(k));
+            w.template segment<dim - 1>(k + 1) = u0 * v.template segment<dim - 1>(k + 1) +
+                                                 v0 * u.template segment<dim - 1>(k + 1);
+        });
+        return mu;
+    }
+
+    // v = u \ w
+    template <int N, int P, int L, int... SOC>
+    void StaticSolver<N, P, L, SOC...>::conicDivision(const VectorZ &u, const VectorZ &w, VectorZ &v) const
+    {
+        v.template head<L>() = w.template head<L>().cwiseQuotient(u.template head<L>());
+        forEachCone([&](auto cone) {
+            constexpr int dim = cone_dims[cone];
+            constexpr int k = coneStart(cone);
+            const double u0 = u(k);
+            const double w0 = w(k);
+            const double rho = u0 * u0 - u.template segment<dim - 1>(k + 1).squaredNorm();
+            const double zeta = u.template segment<dim - 1>(k + 1).dot(w.template segment<dim - 1>(k + 1));
+            const double factor = (zeta / u0 - w0) / rho;
+            v(k) = (u0 * w0 - zeta) / rho;
+            v.template segment<dim - 1>(k + 1) = factor * u.template segment<dim - 1>(k + 1) +
+                                                 w.template segment<dim - 1>(k + 1) / u0;
+        });
+    }
+
+    // x += alpha * e
+    template <int N, int P, int L, int... SOC>
+    void StaticSolver<N, P, L, SOC...>::addIdentity(VectorZ &x, double alpha) const
+    {
+        x.template head<L>().array() += alpha;
+        forEachCone([&](auto cone) { x(coneStart(cone)) += alpha; });
+    }
+
+    /**
+     * s = r if r is strictly in the cone, s = r + (1 + alpha) * e otherwise
+     * where alpha is the largest residual.
+     */
+    template <int N, int P, int L, int... SOC>
+    void StaticSolver<N, P, L, SOC...>::bringToCone(const VectorZ &r, VectorZ &s) const
+    {
+        double alpha = -settings.gamma;
+
+        for (int i = 0; i < L; i++)
+        {
+            if (r(i) <= 0 and -r(i) > alpha)
+            {
+                alpha = -r(i);
+            }
+        }
+        forEachCone([&](auto cone) {
+            constexpr int dim = cone_dims[cone];
+            constexpr int k = coneStart(cone);
+            const double cres = r(k) - r.template segment<dim - 1>(k + 1).norm();
+            if (cres <= 0 and -cres > alpha)
+            {
+                alpha = -cres;
+            }
+        });
+
+        s = r;
+        addIdentity(s, alpha + 1.);
+    }
+
+    template <int N, int P, int L, int... SOC>
+    double StaticSolver<N, P, L, SOC...>::lineSearch(const VectorZ &lambda, const VectorZ &ds, const VectorZ &dz,
+                                                     double tau, double dtau, double kap, double dkap) const
+    {
+        /* Largest step that keeps every cone, 10 if none is blocking */
+        double alpha = 10.;
+
+        if (L > 0)
+        {
+            const double rhomin = ds.template head<L>().cwiseQuotient(lambda.template head<L>()).minCoeff();
+            const double sigmamin = dz.template head<L>().cwiseQuotient(lambda.template head<L>()).minCoeff();
+            const double eps = 1e-13;
+            if (-sigmamin > -rhomin)
+            {
+                alpha = std::min(alpha, sigmamin < 0. ? 1. / (-sigmamin) : 1. / eps);
+            }
+            else
+            {
+                alpha = std::min(alpha, rhomin < 0. ? 1. / (-rhomin) : 1. / eps);
+            }
+        }
+
+        forEachCone([&](auto cone) {
+            constexpr int dim = cone_dims[cone];
+            constexpr int k = coneStart(cone);
+
+            const double lknorm2 = std::pow(lambda(k), 2) - lambda.template segment<dim - 1>(k + 1).squaredNorm();
+            if (lknorm2 <= 0.)
+            {
+                return;
+            }
+
+            const double lknorm = std::sqrt(lknorm2);
+            const Eigen::Matrix<double, dim, 1> lkbar = lambda.template segment<dim>(k) / lknorm;
+            const double lknorminv = 1. / lknorm;
+
+            const double lkbar_times_dsk = lkbar(0) * ds(k) -
+                                           lkbar.template tail<dim - 1>().dot(ds.template segment<dim - 1>(k + 1));
+            const double lkbar_times_dzk = lkbar(0) * dz(k) -
+                                           lkbar.template tail<dim - 1>().dot(dz.template segment<dim - 1>(k + 1));
+
+            double factor = (lkbar_times_dsk + ds(k)) / (lkbar(0) + 1.);
+            const double rho0 = lknorminv * lkbar_times_dsk;
+            const Eigen::Matrix<double, dim - 1, 1> rho1 =
+                lknorminv * (ds.template segment<dim - 1>(k + 1) - factor * lkbar.template tail<dim - 1>());
+            const double rhonorm = rho1.norm() - rho0;
+
+            factor = (lkbar_times_dzk + dz(k)) / (lkbar(0) + 1.);
+            const double sigma0 = lknorminv * lkbar_times_dzk;
+            const Eigen::Matrix<double, dim - 1, 1> sigma1 =
+                lknorminv * (dz.template segment<dim - 1>(k + 1) - factor * lkbar.template tail<dim - 1>());
+            const double sigmanorm = sigma1.norm() - sigma0;
+
+            const double conic_step = std::max({0., sigmanorm, rhonorm});
+            if (conic_step != 0.)
+            {
+                alpha = std::min(1. / conic_step, alpha);
+            }
+        });
+
+        /* tau and kappa */
+        const double minus_tau_by_dtau = -tau / dtau;
+        const double minus_kap_by_dkap = -kap / dkap;
+        if (minus_tau_by_dtau > 0. and minus_tau_by_dtau < alpha)
+        {
+            alpha = minus_tau_by_dtau;
+        }
+        if (minus_kap_by_dkap > 0. and minus_kap_by_dkap < alpha)
+        {
+            alpha = minus_kap_by_dkap;
+        }
+
+        return std::clamp(alpha, settings.stepmin, settings.stepmax);
+    }
+
+    /* ========================== Interior point method ========================== */
+
+    template <int N, int P, int L, int... SOC>
+    void StaticSolver<N, P, L, SOC...>::computeResiduals()
+    {
+        rx = -(G.transpose() * w.z);
+        ry.setZero();
+        if (P > 0)
+        {
+            rx -= A.transpose() * w.y;
+            ry = A * w.x;
+        }
+        rz = w.s + G * w.x;
+
+        hresx = rx.norm();
+        hresy = ry.norm();
+        hresz = rz.norm();
+
+        rx -= w.tau * c;
+        ry -= w.tau * b;
+        rz -= w.tau * h;
+
+        nrx = rx.norm();
+        nry = ry.norm();
+        nrz = rz.norm();
+
+        w.cx = c.dot(w.x);
+        w.by = b.dot(w.y);
+        w.hz = h.dot(w.z);
+        rt = w.kap + w.cx + w.by + w.hz;
+
+        nx = w.x.norm();
+        ny = w.y.norm();
+        nz = w.z.norm();
+        ns = w.s.norm();
+        gap = w.s.dot(w.z);
+    }
+
+    template <int N, int P, int L, int... SOC>
+    void StaticSolver<N, P, L, SOC...>::updateStatistics()
+    {
+        w.i.gap = gap;
+        w.i.mu = (w.i.gap + w.kap * w.tau) / ((n_lc + n_sc) + 1);
+        w.i.kapovert = w.kap / w.tau;
+        w.i.pcost = w.cx / w.tau;
+        w.i.dcost = -(w.hz + w.by) / w.tau;
+
+        /* Relative duality gap */
+        if (w.i.pcost < 0.)
+        {
+            w.i.relgap = w.i.gap / (-w.i.pcost);
+        }
+        else if (w.i.dcost > 0.)
+        {
+            w.i.relgap = w.i.gap / w.i.dcost;
+        }
+        else
+        {
+            w.i.relgap = std::nullopt;
+        }
+
+        /* Residuals */
+        const double pres_y = P > 0 ? nry / std::max(resy0 + nx, 1.) : 0.;
+        const double pres_z = nrz / std::max(resz0 + nx + ns, 1.);
+        w.i.pres = std::max(pres_y, pres_z) / w.tau;
+        w.i.dres = nrx / std::max(resx0 + ny + nz, 1.) / w.tau;
+
+        /* Infeasibility measures */
+        if ((w.hz + w.by) / std::max(ny + nz, 1.) < -settings.reltol)
+        {
+            w.i.pinfres = hresx / std::max(ny + nz, 1.);
+        }
+        if (w.cx / std::max(nx, 1.) < -settings.reltol)
+        {
+            w.i.dinfres = std::max(hresy / std::max(nx, 1.),
+                                   hresz / std::max(nx + ns, 1.));
+        }
+
+        if (settings.verbose)
+        {
+            logIteration(settings, w.i);
+        }
+    }
+
+    template <int N, int P, int L, int... SOC>
+    void StaticSolver<N, P, L, SOC...>::RHSaffine()
+    {
+        rhs2.template segment<N>(kx) = rx;
+        rhs2.template segment<P>(ky) = -ry;
+        expand(w.s - rz, rhs2);
+    }
+
+    template <int N, int P, int L, int... SOC>
+    void StaticSolver<N, P, L, SOC...>::RHScombined()
+    {
+        VectorZ ds1;
+        VectorZ ds2;
+
+        /* ds = lambda o lambda + W \ s o Wz - sigma * mu * e) */
+        conicProduct(w.lambda, w.lambda, ds1);
+        conicProduct(dsaff_by_W, W_times_dzaff, ds2);
+
+        addIdentity(ds1, -w.i.sigma * w.i.mu);
+        ds1 += ds2;
+
+        /* dz = -(1 - sigma) * rz + W * (lambda \ ds) */
+        conicDivision(w.lambda, ds1, dsaff_by_W);
+        scale(dsaff_by_W, ds1);
+
+        const double one_minus_sigma = 1. - w.i.sigma;
+        rhs2.template tail<N + P>() *= one_minus_sigma;
+        expand(-one_minus_sigma * rz + ds1, rhs2);
+    }
+
+    template <int N, int P, int L, int... SOC>
+    void StaticSolver<N, P, L, SOC...>::backscale()
+    {
+        w.x = w.x.cwiseQuotient(x_equil * w.tau);
+        w.y = w.y.cwiseQuotient(A_equil * w.tau);
+        w.z = w.z.cwiseQuotient(G_equil * w.tau);
+        w.s = w.s.cwiseProduct(G_equil / w.tau);
+    }
+
+    /**
+     * The interior point loop of Solver::solve() without warm start.
+     */
+    template <int N, int P, int L, int... SOC>
+    exitcode StaticSolver<N, P, L, SOC...>::solve(bool verbose)
+    {
+        auto t0 = std::chrono::high_resolution_clock::now();
+
+        settings.verbose = verbose;
+        exitcode code = exitcode::fatal;
+        const bool fixed = settings.fixed_iters > 0;
+
+        resetKKTScalings();
+
+        /* First right hand side [0; b; h] and second right hand side [-c; 0; 0] */
+        rhs1.setZero();
+        rhs1.template segment<P>(ky) = b;
+        expand(h, rhs1);
+        rhs2.setZero();
+        rhs2.template segment<N>(kx) = -c;
+
+        resx0 = std::max(1., c.norm());
+        resy0 = std::max(1., b.norm());
+        resz0 = std::max(1., h.norm());
+
+        if (not factorizeKKT())
+        {
+            return exitcode::fatal;
+        }
+
+        VectorX dx1, dx2;
+        VectorY dy1, dy2;
+        VectorZ dz1, dz2;
+
+        /* Primal variables: least squares for x, r = h - G * x brought to the cone */
+        w.i.nitref1 = solveKKT(rhs1, dx1, dy1, dz1, true);
+        w.x = dx1;
+        bringToCone(-dz1, w.s);
+
+        /* Dual variables: least norm z with G' * z + A' * y + c = 0 brought to the cone */
+        w.i.nitref2 = solveKKT(rhs2, dx2, dy2, dz2, true);
+        w.y = dy2;
+        bringToCone(dz2, w.z);
+
+        rhs1.template segment<N>(kx) = -c;
+
+        w.kap = 1.;
+        w.tau = 1.;
+
+        w.i.step = 0.;
+        w.i.step_aff = 0.;
+        w.i.pinf = false;
+        w.i.dinf = false;
+        w.i.pinfres = std::nullopt;
+        w.i.dinfres = std::nullopt;
+        w.i.iter_max = fixed ? settings.fixed_iters : settings.iter_max;
+
+        double pres_prev = std::numeric_limits<double>::max();
+        bool converged = false;
+        bool factorization_failed = false;
+
+        /* Main interior point loop */
+        for (w.i.iter = 0; w.i.iter <= w.i.iter_max; w.i.iter++)
+        {
+            computeResiduals();
+            updateStatistics();
+
+            /* Fixed number of iterations: the first converged iterate is kept, no early exit */
+            if (fixed)
+            {
+                if (not converged)
+                {
+                    code = checkExitConditions(false);
+                    if (code != exitcode::not_converged_yet)
+                    {
+                        w_best = w;
+                        converged = true;
+                    }
+                }
+                if (w.i.iter == w.i.iter_max)
+                {
+                    break;
+                }
+            }
+            else
+            {
+                /* Safeguard: back to the best iterate if pres increased a lot or the gap became negative */
+                if (w.i.iter > 0 and
+                    (w.i.pres > settings.safeguard * pres_prev or w.i.gap < 0.))
+                {
+                    if (settings.verbose)
+                    {
+                        logMessage(settings, format("Unreliable search direction detected, recovering best iterate ({}) and stopping.\n",
+                                                    w_best.i.iter));
+                    }
+                    w = w_best;
+                    code = checkExitConditions(true);
+                    if (code == exitcode::not_converged_yet)
+                    {
+                        code = exitcode::numerics;
+                    }
+                    break;
+                }
+
+                pres_prev = w.i.pres;
+
+                code = checkExitConditions(false);
+
+                if (code == exitcode::not_converged_yet)
+                {
+                    /* Zero step length */
+                    if (w.i.iter > 0 and w.i.step == settings.stepmin * settings.gamma)
+                    {
+                        if (settings.verbose)
+                        {
+                            logMessage(settings, format("No further progress possible, recovering best iterate ({}) and stopping.", w_best.i.iter));
+                        }
+                        w = w_best;
+                        code = checkExitConditions(true);
+                        if (code == exitcode::not_converged_yet)
+                        {
+                            code = exitcode::numerics;
+                        }
+                        break;
+                    }
+                    /* maxit reached */
+                    else if (w.i.iter == w.i.iter_max)
+                    {
+                        if (not w.i.isBetterThan(w_best.i))
+                        {
+                            w = w_best;
+                        }
+                        code = checkExitConditions(true);
+                        if (code == exitcode::not_converged_yet)
+                        {
+                            code = exitcode::maxit;
+                        }
+                        break;
+                    }
+                    /* Stuck on NAN */
+                    else if (std::isnan(w.i.pcost))
+                    {
+                        if (not(w.i.iter == 0 or w.i.isBetterThan(w_best.i)))
+                        {
+                            w = w_best;
+                            code = checkExitConditions(true);
+                            if (code == exitcode::not_converged_yet)
+                            {
+                                code = exitcode::numerics;
+                            }
+                        }
+                        break;
+                    }
+                }
+                else
+                {
+                    break;
+                }
+
+                /* Keep the best iterate */
+                if (w.i.iter == 0 or w.i.isBetterThan(w_best.i))
+                {
+                    w_best = w;
+                }
+            }
+
+            updateScalings();
+            updateKKTScalings();
+            if (not factorizeKKT())
+            {
+                if (not fixed)
+                {
+                    return exitcode::fatal;
+                }
+                factorization_failed = true;
+            }
+
+            /* Solve for RHS1, which is used later also in combined direction */
+            solveKKT(rhs1, dx1, dy1, dz1, false);
+
+            const double dtau_denom = w.kap / w.tau - cdx - bdy - hdz;
+
+            /* Affine search direction */
+            RHSaffine();
+            solveKKT(rhs2, dx2, dy2, dz2, false);
+
+            const double dtauaff = (rt - w.kap + cdx + bdy + hdz) / dtau_denom;
+
+            dz2 += dtauaff * dz1;
+            scale(dz2, W_times_dzaff);
+            dsaff_by_W = -W_times_dzaff - w.lambda;
+
+            const double dkapaff = -w.kap - w.kap / w.tau * dtauaff;
+
+            w.i.step_aff = lineSearch(w.lambda, dsaff_by_W, W_times_dzaff, w.tau, dtauaff, w.kap, dkapaff);
+
+            /* Centering parameter */
+            w.i.sigma = std::clamp(std::pow(1. - w.i.step_aff, 3), settings.sigmamin, settings.sigmamax);
+
+            /* Combined search direction */
+            RHScombined();
+            w.i.nitref3 = solveKKT(rhs2, dx2, dy2, dz2, false);
+
+            const double bkap = w.kap * w.tau + dkapaff * dtauaff - w.i.sigma * w.i.mu;
+            const double dtau = ((1. - w.i.sigma) * rt - bkap / w.tau + cdx + bdy + hdz) / dtau_denom;
+
+            dx2 += dtau * dx1;
+            dy2 += dtau * dy1;
+            dz2 += dtau * dz1;
+
+            scale(dz2, W_times_dzaff);
+            dsaff_by_W = -(dsaff_by_W + W_times_dzaff);
+
+            const double dkap = -(bkap + w.kap * dtau) / w.tau;
+
+            w.i.step = settings.gamma * lineSearch(w.lambda, dsaff_by_W, W_times_dzaff, w.tau, dtau, w.kap, dkap);
+
+            /* ds = W * ds_by_W */
+            scale(dsaff_by_W, dsaff);
+
+            /* Update variables */
+            w.x += w.i.step * dx2;
+            w.y += w.i.step * dy2;
+            w.z += w.i.step * dz2;
+            w.s += w.i.step * dsaff;
+
+            w.kap += w.i.step * dkap;
+            w.tau += w.i.step * dtau;
+        }
+
+        if (fixed)
+        {
+            if (converged)
+            {
+                w = w_best;
+            }
+            else
+            {
+                code = checkExitConditions(true);
+                if (code == exitcode::not_converged_yet)
+                {
+                    code = factorization_failed ? exitcode::numerics : exitcode::maxit;
+                }
+            }
+        }
+
+        backscale();
+
+        if (settings.verbose)
+            logMessage(settings, format("Runtime: {}ms\n", std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - t0).count()));
+
+        return code;
+    }
+
+} // namespace EiCOS
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <Eigen/Sparse>
+#include <Eigen/SparseCholesky>
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace EiCOS
+{
+
+    /**
+     * The expensive part of the symbolic analysis of a sparse LDL' factorization,
+     * the fill-reducing ordering. The elimination tree and the column counts are
+     * cheap and always computed from the matrix to factor, so an ordering that
+     * belongs to another pattern only costs fill-in.
+     */
+    struct SymbolicAnalysis
+    {
+        Eigen::VectorXi permutation; // fill-reducing ordering, as computed by the ordering method
+    };
+
+    /**
+     * Sparse LDL' factorization whose ordering can be taken out and put back,
+     * with the dynamic regularization of the pivots.
+     */
+    class SymbolicLDLT : public Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>, Eigen::Upper>
+    {
+    public:
+        SymbolicAnalysis symbolic() const;
+        // replaces analyzePattern, with the ordering of the analysis instead of a new one
+        void setSymbolic(const Eigen::SparseMatrix<double> &a, const SymbolicAnalysis &analysis);
+        // replaces factorize, pivots d with signs(k) * d <= eps become signs(k) * delta, returns their number
+        size_t factorizeRegularized(const Eigen::SparseMatrix<double> &a, const Eigen::VectorXi &signs,
+                                    double eps, double delta);
+    };
+
+    // hash of the dimensions, the cone sizes and the pattern of the upper triangle of K
+    uint64_t kktFingerprint(const Eigen::SparseMatrix<double> &K,
+                            size_t n_var,
+                            size_t n_eq,
+                            size_t n_lc,
+                            const std::vector<size_t> &cone_dims);
+
+    /**
+     * Symbolic analyses of KKT matrices keyed by the fingerprint of their pattern,
+     * shared by all solvers of the process. With a directory, the analyses are also
+     * stored as files, so that other processes can load them. The files are read
+     * and written without holding the lock of the cache.
+     *
+     * File format (native byte order):
+     *   char[8] "EICOSSYM", uint32 version, uint64 fingerprint, int32 dimension,
+     *   then the permutation as int32[dimension].
+     */
+    class SymbolicCache
+    {
+    public:
+        static SymbolicCache &global();
+
+        // analysis of a matrix of dimension dim, analyses of another dimension or damaged files are not returned
+        std::shared_ptr<const SymbolicAnalysis> find(uint64_t fingerprint, Eigen::Index dim);
+        void insert(uint64_t fingerprint, const SymbolicAnalysis &analysis);
+
+        // analyses kept in memory, the oldest are dropped first, 0 disables the cache in memory
+        void setCapacity(size_t capacity);
+        // directory of the files, empty to keep the analyses in memory only
+        void setDirectory(const std::string &path);
+        // drops the analyses in memory, the files are kept
+        void clear();
+
+        size_t size() const;
+        size_t hits() const;
+        size_t misses() const;
+
+    private:
+        static std::shared_ptr<const SymbolicAnalysis> load(const std::string &path, uint64_t fingerprint, Eigen::Index dim);
+        static void store(const std::string &path, uint64_t fingerprint, const SymbolicAnalysis &analysis);
+        void remember(uint64_t fingerprint, std::shared_ptr<const SymbolicAnalysis> analysis);
+        std::string filePath(uint64_t fingerprint) const;
+
+        mutable std::mutex mutex;
+        std::unordered_map<uint64_t, std::shared_ptr<const SymbolicAnalysis>> entries;
+        std::deque<uint64_t> insertion_order;
+        size_t capacity = 64;
+        std::string directory;
+        size_t n_hits = 0;
+        size_t n_misses = 0;
+    };
+
+} // namespace EiCOS
@@ -0,0 +1,335 @@
+#include "admm.hpp"
+
+#include "cones.hpp"
+#include "equilibration.hpp"
+#include "printing.hpp"
+
+namespace EiCOS
+{
+
+    void logMessage(const ADMMSettings &settings, const std::string &text)
+    {
+        if (settings.log_sink)
+        {
+            settings.log_sink->message(text);
+        }
+        else
+        {
+            print("{}", text);
+        }
+    }
+
+    ADMMSolver::ADMMSolver(const Eigen::SparseMatrix<double> &G,
+                           const Eigen::SparseMatrix<double> &A,
+                           const Eigen::VectorXd &c,
+                           const Eigen::VectorXd &h,
+                           const Eigen::VectorXd &b,
+                           const Eigen::VectorXi &soc_dims)
+        : G(G), A(A), c(c), h(h), b(b)
+    {
+        assert(not(c.hasNaN() or h.hasNaN() or b.hasNaN()));
+
+        // Dimensions
+        n_var = c.size();
+        n_eq = A.rows();
+        n_ineq = G.rows();
+        n_lc = n_ineq - soc_dims.sum();
+        n_con = n_eq + n_ineq;
+
+        // Same cone layout as the interior point solver
+        so_cones.resize(soc_dims.size());
+        for (int i = 0; i < soc_dims.size(); i++)
+        {
+            so_cones[i].dim = soc_dims[i];
+        }
+
+        this->A.makeCompressed();
+        this->G.makeCompressed();
+        SparseRows A_rows, G_rows;
+        A_rows.setup(this->A);
+        G_rows.setup(this->G);
+        equilibrate(this->A, this->G, A_rows, G_rows, 1, n_var, n_lc, so_cones, settings.equil_iters,
+                    x_equil, A_equil, G_equil);
+        this->c = this->c.cwiseQuotient(x_equil);
+        this->b = this->b.cwiseQuotient(A_equil);
+        this->h = this->h.cwiseQuotient(G_equil);
+
+        Gt = this->G.transpose();
+        At = this->A.transpose();
+
+        x.setZero(n_var);
+        z.setZero(n_con);
+        y.setZero(n_con);
+
+        info.iter = 0;
+        info.n_factorizations = 0;
+
+        setupKKT();
+    }
+
+    ADMMSettings &ADMMSolver::getSettings()
+    {
+        return settings;
+    }
+
+    const ADMMInformation &ADMMSolver::getInfo() const
+    {
+        return info;
+    }
+
+    const Eigen::VectorXd &ADMMSolver::solution() const
+    {
+        return x_sol;
+    }
+
+    const Eigen::VectorXd &ADMMSolver::dualEquality() const
+    {
+        return y_sol;
+    }
+
+    const Eigen::VectorXd &ADMMSolver::dualConic() const
+    {
+        return z_sol;
+    }
+
+    const Eigen::VectorXd &ADMMSolver::slack() const
+    {
+        return s_sol;
+    }
+
+    void ADMMSolver::warmStart(Solver &solver) const
+    {
+        solver.setInitialPoint(x_sol, y_sol, z_sol, s_sol);
+    }
+
+    /* y = [A; G] * x */
+    void ADMMSolver::productM(const Eigen::VectorXd &x, Eigen::VectorXd &y) const
+    {
+        if (n_eq > 0)
+        {
+            y.head(n_eq).noalias() = A * x;
+        }
+        y.tail(n_ineq).noalias() = G * x;
+    }
+
+    /* x = [A; G]' * y */
+    void ADMMSolver::productMt(const Eigen::VectorXd &y, Eigen::VectorXd &x) const
+    {
+        x.noalias() = Gt * y.tail(n_ineq);
+        if (n_eq > 0)
+        {
+            x.noalias() += At * y.head(n_eq);
+        }
+    }
+
+    /**
+     * Projection onto the constraint set D = {b} x (h - K)
+     */
+    void ADMMSolver::project(Eigen::VectorXd &v) const
+    {
+        v.head(n_eq) = b;
+
+        Eigen::VectorXd s = h - v.tail(n_ineq);
+        projectToCone(n_lc, so_cones, s);
+        v.tail(n_ineq) = h - s;
+    }
+
+    void ADMMSolver::setupKKT()
+    {
+        /**
+         *      [ sigma * I    A'          G'         ]
+         *  K = [ A           -1/rho_eq    0          ]
+         *      [ G            0          -1/rho      ]
+         *
+         *  Only the upper triangular part is constructed here.
+         */
+        const size_t dim_K = n_var + n_con;
+        K.resize(dim_K, dim_K);
+
+        std::vector<Eigen::Triplet<double>> K_triplets;
+        K_triplets.reserve(dim_K + A.nonZeros() + G.nonZeros());
+
+        for (size_t k = 0; k < n_var; k++)
+        {
+            K_triplets.emplace_back(k, k, settings.sigma);
+        }
+        for (int col = 0; col < At.cols(); col++)
+        {
+            for (Eigen::SparseMatrix<double>::InnerIterator it(At, col); it; ++it)
+            {
+                K_triplets.emplace_back(it.row(), n_var + col, it.value());
+            }
+        }
+        for (int col = 0; col < Gt.cols(); col++)
+        {
+            for (Eigen::SparseMatrix<double>::InnerIterator it(Gt, col); it; ++it)
+            {
+                K_triplets.emplace_back(it.row(), n_var + n_eq + col, it.value());
+            }
+        }
+        for (size_t k = n_var; k < dim_K; k++)
+        {
+            K_triplets.emplace_back(k, k, -1.);
+        }
+
+        K.setFromTriplets(K_triplets.begin(), K_triplets.end());
+
+        KKT_rho_ptr.clear();
+        for (size_t k = n_var; k < dim_K; k++)
+        {
+            KKT_rho_ptr.push_back(&K.coeffRef(k, k));
+        }
+
+        ldlt.analyzePattern(K);
+        updateRho(settings.rho);
+    }
+
+    /**
+     * Sets the penalty parameter and refactors the KKT matrix.
+     */
+    bool ADMMSolver::updateRho(double rho)
+    {
+        info.rho = std::clamp(rho, settings.rho_min, settings.rho_max);
+
+        rho_vec.resize(n_con);
+        rho_vec.head(n_eq).setConstant(settings.rho_eq_factor * info.rho);
+        rho_vec.tail(n_ineq).setConstant(info.rho);
+
+        for (size_t k = 0; k < n_con; k++)
+        {
+            *KKT_rho_ptr[k] = -1. / rho_vec(k);
+        }
+
+        ldlt.factorize(K);
+        info.n_factorizations++;
+
+        return ldlt.info() == Eigen::Success;
+    }
+
+    exitcode ADMMSolver::solve(bool verbose)
+    {
+        settings.verbose = verbose;
+
+        Eigen::VectorXd rhs(n_var + n_con);
+        Eigen::VectorXd sol(n_var + n_con);
+        Eigen::VectorXd z_tilde(n_con);
+        Eigen::VectorXd z_relaxed(n_con);
+        Eigen::VectorXd Mx(n_con);
+        Eigen::VectorXd Mty(n_var);
+
+        const double c_norm = c.lpNorm<Eigen::Infinity>();
+
+        if (settings.verbose)
+        {
+            logMessage(settings, "It     pcost       pres      dres      rho\n");
+        }
+
+        exitcode code = exitcode::maxit;
+        for (size_t iter = 1; iter <= settings.maxit; iter++)
+        {
+            info.iter = iter;
+
+            /**
+             * Solve the KKT system
+             *
+             *  [ sigma * I   M'       ] [ x_tilde ]   [ sigma * x - c ]
+             *  [ M          -1 / rho  ] [ nu      ] = [ z - y / rho   ]
+             */
+            rhs.head(n_var) = settings.sigma * x - c;
+            rhs.tail(n_con) = z - y.cwiseQuotient(rho_vec);
+            sol = ldlt.solve(rhs);
+
+            /* z_tilde = z + (nu - y) / rho */
+            z_tilde = z + (sol.tail(n_con) - y).cwiseQuotient(rho_vec);
+
+            /* Over-relaxation */
+            x = settings.alpha * sol.head(n_var) + (1. - settings.alpha) * x;
+            z_relaxed = settings.alpha * z_tilde + (1. - settings.alpha) * z;
+
+            /* z = P_D(z_relaxed + y / rho) */
+            const Eigen::VectorXd z_prev = z;
+            z = z_relaxed + y.cwiseQuotient(rho_vec);
+            project(z);
+
+            /* Dual update */
+            y += rho_vec.cwiseProduct(z_relaxed - z);
+
+            const bool check = iter % settings.check_interval == 0 or iter == settings.maxit;
+            const bool adapt = iter % settings.adaptive_interval == 0;
+            if (not(check or adapt))
+            {
+                continue;
+            }
+
+            /* Residuals */
+            productM(x, Mx);
+            productMt(y, Mty);
+            info.pres = (Mx - z).lpNorm<Eigen::Infinity>();
+            info.dres = (c + Mty).lpNorm<Eigen::Infinity>();
+            info.pcost = c.dot(x);
+
+            const double pres_scale = std::max(Mx.lpNorm<Eigen::Infinity>(), z.lpNorm<Eigen::Infinity>());
+            const double dres_scale = std::max(Mty.lpNorm<Eigen::Infinity>(), c_norm);
+
+            if (settings.verbose and check)
+            {
+                logMessage(settings, format("{:4d}  {:+5.3e}  {:5.3e}  {:5.3e}  {:5.3e}\n",
+                                            info.iter, info.pcost, info.pres, info.dres, info.rho));
+            }
+
+            if (info.pres <= settings.eps_abs + settings.eps_rel * pres_scale and
+                info.dres <= settings.eps_abs + settings.eps_rel * dres_scale)
+            {
+                code = exitcode::close_to_optimal;
+                break;
+            }
+
+            /* Balance primal and dual residuals by adapting the penalty */
+            if (adapt)
+            {
+                const double ratio = (info.pres / std::max(pres_scale, 1e-10)) /
+                                     std::max(info.dres / std::max(dres_scale, 1e-10), 1e-10);
+                const double rho_new = info.rho * std::sqrt(ratio);
+                if (rho_new > settings.adaptive_tol * info.rho or
+                    rho_new < info.rho / settings.adaptive_tol)
+                {
+                    if (not updateRho(rho_new))
+                    {
+                        code = exitcode::fatal;
+                        break;
+                    }
+                }
+            }
+        }
+
+        if (settings.verbose)
+        {
+            if (code == exitcode::close_to_optimal)
+            {
+                logMessage(settings, format("Converged to moderate accuracy (pres={:3.1e}, dres={:3.1e}).\n",
+                                            info.pres, info.dres));
+            }
+            else
+            {
+                logMessage(settings, "Maximum number of iterations reached.\n");
+            }
+        }
+
+        unscaleSolution();
+
+        return code;
+    }
+
+    /**
+     * Recovers the solution of the original problem.
+     * The dual of the conic constraints is the multiplier y of G * x = z.
+     */
+    void ADMMSolver::unscaleSolution()
+    {
+        x_sol = x.cwiseQuotient(x_equil);
+        y_sol = y.head(n_eq).cwiseQuotient(A_equil);
+        z_sol = y.tail(n_ineq).cwiseQuotient(G_equil);
+        s_sol = (h - z.tail(n_ineq)).cwiseProduct(G_equil);
+    }
+
+} // namespace EiCOS
@@ -0,0 +1,293 @@
+#include "arrow.hpp"
+
+#include "eicos.hpp"
+#include "parallel.hpp"
+#include "printing.hpp"
+
+namespace EiCOS
+{
+
+    /**
+     * Sorts the entries of the upper triangle of K into the blocks and remembers
+     * where their values come from, so that factorize only copies values.
+     */
+    void ArrowLDLT::analyzePattern(const Eigen::SparseMatrix<double> &K,
+                                   const std::vector<std::vector<int>> &block_indices,
+                                   const std::vector<int> &coupling)
+    {
+        const int n = K.rows();
+        const int n_c = coupling.size();
+        this->coupling = coupling;
+
+        /* Block and local index of every row of K, the coupling block has number -1 */
+        std::vector<int> block_of(n, -2);
+        std::vector<int> local(n);
+        for (size_t b = 0; b < block_indices.size(); b++)
+        {
+            for (size_t k = 0; k < block_indices[b].size(); k++)
+            {
+                block_of[block_indices[b][k]] = b;
+                local[block_indices[b][k]] = k;
+            }
+        }
+        for (int k = 0; k < n_c; k++)
+        {
+            block_of[coupling[k]] = -1;
+            local[coupling[k]] = k;
+        }
+
+        using Triplets = std::vector<Eigen::Triplet<double>>;
+        std::vector<Triplets> K_triplets(block_indices.size()), B_triplets(block_indices.size());
+        std::vector<Block>(block_indices.size()).swap(blocks); // the factorizations are not movable
+        K_c_src.clear();
+
+        /* The triplet values hold the positions in K, so the order after compression is known */
+        for (int col = 0; col < K.outerSize(); col++)
+        {
+            for (Eigen::SparseMatrix<double>::InnerIterator it(K, col); it; ++it)
+            {
+                const int pos = &it.value() - K.valuePtr();
+                const int b_row = block_of[it.row()];
+                const int b_col = block_of[it.col()];
+                assert(b_row >= -1 and b_col >= -1);
+
+                if (b_row >= 0 and b_row == b_col)
+                {
+                    K_triplets[b_row].emplace_back(std::min(local[it.row()], local[it.col()]),
+                                                   std::max(local[it.row()], local[it.col()]), pos);
+                }
+                else if (b_row == -1 and b_col == -1)
+                {
+                    /* Column major index into the lower triangle of S */
+                    K_c_src.emplace_back(std::min(local[it.row()], local[it.col()]) * n_c +
+                                             std::max(local[it.row()], local[it.col()]),
+                                         pos);
+                }
+                else if (b_row == -1)
+                {
+                    B_triplets[b_col].emplace_back(local[it.row()], local[it.col()], pos);
+                }
+                else if (b_col == -1)
+                {
+                    B_triplets[b_row].emplace_back(local[it.col()], local[it.row()], pos);
+                }
+                else
+                {
+                    assert(false && "Blocks of the arrow structure are coupled.");
+                }
+            }
+        }
+
+        for (size_t b = 0; b < blocks.size(); b++)
+        {
+            Block &block = blocks[b];
+            const int n_b = block_indices[b].size();
+            block.indices = block_indices[b];
+
+            block.K.resize(n_b, n_b);
+            block.K.setFromTriplets(K_triplets[b].begin(), K_triplets[b].end());
+            block.K_src.assign(block.K.valuePtr(), block.K.valuePtr() + block.K.nonZeros());
+
+            block.B.resize(n_c, n_b);
+            block.B.setFromTriplets(B_triplets[b].begin(), B_triplets[b].end());
+            block.B_src.assign(block.B.valuePtr(), block.B.valuePtr() + block.B.nonZeros());
+
+            block.ldlt.analyzePattern(block.K);
+        }
+
+        S.resize(n_c, n_c);
+    }
+
+    bool ArrowLDLT::factorize(const Eigen::SparseMatrix<double> &K)
+    {
+        const double *values = K.valuePtr();
+        std::vector<char> success(blocks.size());
+
+        /* Factor the diagonal blocks and compute their contributions K_i^-1 * B_i' */
+        parallelFor(blocks.size(), [&](size_t b) {
+            Block &block = blocks[b];
+            for (size_t k = 0; k < block.K_src.size(); k++)
+            {
+                block.K.valuePtr()[k] = values[block.K_src[k]];
+            }
+            for (size_t k = 0; k < block.B_src.size(); k++)
+            {
+                block.B.valuePtr()[k] = values[block.B_src[k]];
+            }
+
+            block.ldlt.factorize(block.K);
+            success[b] = block.ldlt.info() == Eigen::Success;
+            if (success[b] and not coupling.empty())
+            {
+                block.KinvBt = block.ldlt.solve(Eigen::MatrixXd(block.B.transpose()));
+            }
+        });
+
+        if (std::find(success.begin(), success.end(), false) != success.end())
+        {
+            return false;
+        }
+
+        if (coupling.empty())
+        {
+            return true;
+        }
+
+        /* S = K_c - sum_i B_i * K_i^-1 * B_i' */
+        S.setZero();
+        for (const auto &[dst, src] : K_c_src)
+        {
+            S.data()[dst] = values[src];
+        }
+        for (const Block &block : blocks)
+        {
+            const Eigen::MatrixXd BKinvBt = block.B * block.KinvBt;
+            S.triangularView<Eigen::Lower>() -= BKinvBt;
+        }
+
+        S_ldlt.compute(S.selfadjointView<Eigen::Lower>());
+        return S_ldlt.info() == Eigen::Success;
+    }
+
+    /**
+     * Block elimination:
+     *   y_i = K_i \ r_i
+     *   S * x_c = r_c - sum_i B_i * y_i
+     *   x_i = y_i - (K_i^-1 * B_i') * x_c
+     */
+    Eigen::VectorXd ArrowLDLT::solve(const Eigen::VectorXd &rhs) const
+    {
+        Eigen::VectorXd x(rhs.size());
+        std::vector<Eigen::VectorXd> y(blocks.size());
+
+        parallelFor(blocks.size(), [&](size_t b) {
+            const Block &block = blocks[b];
+            Eigen::VectorXd r(block.indices.size());
+            for (size_t k = 0; k < block.indices.size(); k++)
+            {
+                r(k) = rhs(block.indices[k]);
+            }
+            y[b] = block.ldlt.solve(r);
+        });
+
+        Eigen::VectorXd x_c(coupling.size());
+        if (not coupling.empty())
+        {
+            Eigen::VectorXd r_c(coupling.size());
+            for (size_t k = 0; k < coupling.size(); k++)
+            {
+                r_c(k) = rhs(coupling[k]);
+            }
+            for (size_t b = 0; b < blocks.size(); b++)
+            {
+                r_c.noalias() -= blocks[b].B * y[b];
+            }
+            x_c = S_ldlt.solve(r_c);
+
+            for (size_t k = 0; k < coupling.size(); k++)
+            {
+                x(coupling[k]) = x_c(k);
+            }
+        }
+
+        parallelFor(blocks.size(), [&](size_t b) {
+            const Block &block = blocks[b];
+            if (not coupling.empty())
+            {
+                y[b].noalias() -= block.KinvBt * x_c;
+            }
+            for (size_t k = 0; k < block.indices.size(); k++)
+            {
+                x(block.indices[k]) = y[b](k);
+            }
+        });
+
+        return x;
+    }
+
+    /**
+     * Assigns the rows of K to the blocks of the variables they contain. Constraints
+     * that involve several blocks, or only coupling variables, become coupling rows.
+     * Rows of a second order cone, including its expansion, stay together.
+     */
+    void Solver::setBlockStructure(const Eigen::VectorXi &var_blocks)
+    {
+        assert(not matrix_free and not kkt_kernel);
+        assert(size_t(var_blocks.size()) == n_var);
+
+        const ThreadPool::Scope pool_scope(thread_pool.get());
+
+        /* Labels of the variables in the internal order */
+        Eigen::VectorXi labels = var_blocks;
+        for (size_t i = 0; i < var_order.size(); i++)
+        {
+            labels(i) = var_blocks(var_order[i]);
+        }
+
+        const int n_blocks = n_var > 0 ? labels.maxCoeff() + 1 : 0;
+
+        /* Block of the given rows of G or A, -1 for coupling rows */
+        auto rowBlock = [&](const SparseRows &rows, const Eigen::SparseMatrix<double> &M, size_t start, size_t count) {
+            int block = -1;
+            for (size_t row = start; row < start + count; row++)
+            {
+                for (SparseRows::InnerIterator it(rows, M, row); it; ++it)
+                {
+                    const int label = labels(it.col());
+                    if (label < 0 or label == block)
+                    {
+                        continue;
+                    }
+                    if (block >= 0)
+                    {
+                        return -1;
+                    }
+                    block = label;
+                }
+            }
+            return block;
+        };
+
+        std::vector<std::vector<int>> blocks(n_blocks);
+        std::vector<int> coupling;
+        auto assign = [&](int block, int index) {
+            (block < 0 ? coupling : blocks[block]).push_back(index);
+        };
+
+        for (size_t i = 0; i < n_var; i++)
+        {
+            assign(labels(i), i);
+        }
+        for (size_t row = 0; row < n_eq; row++)
+        {
+            assign(rowBlock(A_csr, A, row, 1), n_var + row);
+        }
+        for (size_t row = 0; row < n_lc; row++)
+        {
+            assign(rowBlock(G_csr, G, row, 1), n_var + n_eq + row);
+        }
+        size_t row = n_lc;
+        size_t index = n_var + n_eq + n_lc;
+        for (const SOCone &sc : so_cones)
+        {
+            const int block = rowBlock(G_csr, G, row, sc.dim);
+            for (size_t k = 0; k < sc.dim + 2; k++)
+            {
+                assign(block, index + k);
+            }
+            row += sc.dim;
+            index += sc.dim + 2;
+        }
+        assert(index == dim_K);
+
+        blocks.erase(std::remove_if(blocks.begin(), blocks.end(),
+                                    [](const std::vector<int> &block) { return block.empty(); }),
+                     blocks.end());
+
+        print_dbg("Arrow structure: {} blocks, {} coupling rows\n", blocks.size(), coupling.size());
+
+        arrow_ldlt = std::make_unique<ArrowLDLT>();
+        arrow_ldlt->analyzePattern(K, blocks, coupling);
+    }
+
+} // namespace EiCOS
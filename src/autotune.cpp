@@ -0,0 +1,206 @@
+#include "autotune.hpp"
+
+#include "eicos.hpp"
+#include "file_io.hpp"
+#include "printing.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace EiCOS
+{
+
+    namespace
+    {
+
+        const char magic[] = "EICOSTUN";
+        const unsigned version = 2;
+
+    } // namespace
+
+    TuningProfiles &TuningProfiles::global()
+    {
+        static TuningProfiles profiles;
+        return profiles;
+    }
+
+    std::optional<TuningProfile> TuningProfiles::find(uint64_t fingerprint)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        std::optional<TuningProfile> profile;
+        const auto entry = entries.find(fingerprint);
+        if (entry != entries.end())
+        {
+            profile = entry->second;
+        }
+        else if ((profile = load(fingerprint)))
+        {
+            entries.emplace(fingerprint, *profile);
+        }
+
+        if (profile and profile->threads != std::thread::hardware_concurrency())
+        {
+            return std::nullopt;
+        }
+        return profile;
+    }
+
+    void TuningProfiles::insert(uint64_t fingerprint, const TuningProfile &profile)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        entries[fingerprint] = profile;
+        store(fingerprint, profile);
+    }
+
+    void TuningProfiles::setDirectory(const std::string &path)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        directory = path;
+    }
+
+    void TuningProfiles::clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        entries.clear();
+    }
+
+    size_t TuningProfiles::size() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return entries.size();
+    }
+
+    std::string TuningProfiles::filePath(uint64_t fingerprint) const
+    {
+        char name[32];
+        std::snprintf(name, sizeof(name), "%016llx.tune", static_cast<unsigned long long>(fingerprint));
+        return directory + "/" + name;
+    }
+
+    /* Files that do not exist, or do not match, are ignored */
+    std::optional<TuningProfile> TuningProfiles::load(uint64_t fingerprint) const
+    {
+        if (directory.empty())
+        {
+            return std::nullopt;
+        }
+
+        std::ifstream in(filePath(fingerprint));
+        std::string file_magic;
+        unsigned file_version;
+        uint64_t file_fingerprint;
+        TuningProfile profile;
+        in >> file_magic >> file_version >> std::hex >> file_fingerprint >> std::dec >> profile.threads >>
+            profile.threaded_products >> profile.solve_time;
+        if (not in or file_magic != magic or file_version != version or file_fingerprint != fingerprint)
+        {
+            return std::nullopt;
+        }
+        return profile;
+    }
+
+    /* Replaced atomically, so that other processes never read a partial file */
+    void TuningProfiles::store(uint64_t fingerprint, const TuningProfile &profile) const
+    {
+        if (directory.empty())
+        {
+            return;
+        }
+
+        std::ostringstream out;
+        out << magic << ' ' << version << ' ' << std::hex << fingerprint << std::dec << ' ' << profile.threads << ' '
+            << profile.threaded_products << ' ' << profile.solve_time << '\n';
+        writeFileAtomic(filePath(fingerprint), out.str());
+    }
+
+    /**
+     * Solves the problem runs times with every candidate configuration and keeps
+     * the one with the shortest solve. The candidates are single and multithreaded
+     * products. The current configuration is measured first and sets the exit
+     * code that the others have to reproduce on every run.
+     * The profile is stored for the structure of the problem, so later solvers
+     * with the same structure are set up with it.
+     */
+    TuningProfile Solver::tune(size_t runs)
+    {
+        assert(not matrix_free and runs > 0);
+
+        const bool verbose = settings.verbose;
+        const bool decompose = settings.decompose;
+        settings.verbose = false;
+        settings.decompose = false;
+        /* Cache hits would be timed instead of solves */
+        const std::shared_ptr<SolutionCache> cache = std::move(solution_cache);
+
+        TuningProfile current;
+        current.threaded_products = threadParts(G.nonZeros() + A.nonZeros()) > 1;
+        current.threads = std::thread::hardware_concurrency();
+        const size_t pool_size = (thread_pool ? *thread_pool : ThreadPool::current()).size();
+
+        std::vector<TuningProfile> candidates = {current};
+        for (const bool threaded : {false, true})
+        {
+            if ((threaded and pool_size < 2) or threaded == current.threaded_products)
+            {
+                continue;
+            }
+            TuningProfile candidate = current;
+            candidate.threaded_products = threaded;
+            candidates.push_back(candidate);
+        }
+
+        exitcode reference = exitcode::not_converged_yet;
+        TuningProfile best;
+        for (TuningProfile &candidate : candidates)
+        {
+            applyProfile(candidate);
+
+            bool consistent = true;
+            candidate.solve_time = std::numeric_limits<double>::max();
+            for (size_t run = 0; run < runs; run++)
+            {
+                const auto t0 = std::chrono::steady_clock::now();
+                const exitcode code = solve();
+                const double time = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+
+                if (&candidate == &candidates.front() and run == 0)
+                {
+                    reference = code;
+                }
+                consistent = consistent and code == reference;
+                candidate.solve_time = std::min(candidate.solve_time, time);
+            }
+
+            print_dbg("Tuning: threaded products {}: {:.3}ms{}\n",
+                      candidate.threaded_products, candidate.solve_time,
+                      consistent ? "" : " (different result)");
+
+            if (&candidate == &candidates.front() or (consistent and candidate.solve_time < best.solve_time))
+            {
+                best = candidate;
+            }
+        }
+
+        applyProfile(best);
+        TuningProfiles::global().insert(structureFingerprint(), best);
+
+        settings.verbose = verbose;
+        settings.decompose = decompose;
+        solution_cache = cache;
+        return best;
+    }
+
+    void Solver::applyProfile(const TuningProfile &profile)
+    {
+        threaded_products = profile.threaded_products;
+        partitionProducts();
+    }
+
+} // namespace EiCOS
@@ -0,0 +1,255 @@
+#include "eicos.hpp"
+
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <Eigen/OrderingMethods>
+
+namespace EiCOS
+{
+
+    /**
+     * Writes a standalone header with a fully unrolled LDL' factorization and solve
+     * for the sparsity pattern of the current KKT matrix.
+     *
+     * The fill-reducing permutation and the symbolic factorization are computed here,
+     * once, so the generated code is straight-line and only touches fixed-size static
+     * arrays. The matrix values are read in the storage order of the upper triangle
+     * of K, which does not change when the problem data is updated.
+     *
+     * The generated functions can be plugged into a Solver for the same problem
+     * structure with setKKTKernel.
+     */
+    void Solver::generateKKTSolver(const std::string &path, const std::string &name) const
+    {
+        assert(not matrix_free);
+
+        const int n = dim_K;
+
+        /* Fill-reducing ordering, the same one SimplicialLDLT uses */
+        const Eigen::SparseMatrix<double> K_full = K.selfadjointView<Eigen::Upper>();
+        Eigen::PermutationMatrix<Eigen::Dynamic, Eigen::Dynamic, int> P_inv;
+        Eigen::AMDOrdering<int> ordering;
+        ordering(K_full, P_inv);
+        const Eigen::VectorXi perm = P_inv.indices(); // old index of new index
+        Eigen::VectorXi perm_inv(n);                  // new index of old index
+        for (int i = 0; i < n; i++)
+        {
+            perm_inv(perm(i)) = i;
+        }
+
+        /* Lower triangle of the permuted matrix, maps (row, col) to the position in K */
+        std::vector<std::map<int, int>> K_cols(n);
+        std::vector<int> K_diag(n, -1);
+        for (int col = 0; col < K.outerSize(); col++)
+        {
+            for (Eigen::SparseMatrix<double>::InnerIterator it(K, col); it; ++it)
+            {
+                const int i = perm_inv(it.row());
+                const int j = perm_inv(it.col());
+                const int pos = &it.value() - K.valuePtr();
+                if (i == j)
+                {
+                    K_diag[i] = pos;
+                }
+                else
+                {
+                    K_cols[std::min(i, j)][std::max(i, j)] = pos;
+                }
+            }
+        }
+
+        /* Symbolic factorization: the pattern of column j of L is the pattern of the
+           matrix column merged with the patterns of its children in the elimination tree */
+        std::vector<std::vector<int>> L_cols(n);
+        std::vector<std::vector<int>> children(n);
+        for (int j = 0; j < n; j++)
+        {
+            std::vector<int> pattern;
+            for (const auto &entry : K_cols[j])
+            {
+                pattern.push_back(entry.first);
+            }
+            for (const int child : children[j])
+            {
+                std::vector<int> merged;
+                std::set_union(pattern.begin(), pattern.end(),
+                               L_cols[child].begin() + 1, L_cols[child].end(),
+                               std::back_inserter(merged));
+                pattern.swap(merged);
+            }
+            if (not pattern.empty())
+            {
+                children[pattern.front()].push_back(j);
+            }
+            L_cols[j] = pattern;
+        }
+
+        /* Positions of the factor entries and the row patterns */
+        std::map<std::pair<int, int>, int> L_index;
+        std::vector<std::vector<int>> L_rows(n);
+        int nnz_L = 0;
+        for (int j = 0; j < n; j++)
+        {
+            for (const int i : L_cols[j])
+            {
+                L_index[{i, j}] = nnz_L++;
+                L_rows[i].push_back(j);
+            }
+        }
+
+        std::ofstream out(path);
+
+        out << "// Generated by EiCOS::Solver::generateKKTSolver, do not edit.\n"
+            << "// Solves K * x = b for one fixed sparsity pattern with a static LDL' factorization.\n"
+            << "\n"
+            << "#pragma once\n"
+            << "\n"
+            << "#include <cmath>\n"
+            << "\n"
+            << "namespace " << name << "\n"
+            << "{\n"
+            << "\n"
+            << "    constexpr int dim = " << n << ";\n"
+            << "    constexpr int nnz = " << K.nonZeros() << "; // non-zeros in the upper triangle of K\n"
+            << "    constexpr int nnz_L = " << nnz_L << "; // non-zeros in the strict lower triangle of L\n"
+            << "\n"
+            << "    inline double L[nnz_L > 0 ? nnz_L : 1];\n"
+            << "    inline double D[dim];\n"
+            << "    inline double D_inv[dim];\n"
+            << "    inline double work[dim];\n"
+            << "\n";
+
+        /* Numeric factorization, left-looking by columns */
+        out << "    /* Factors K, Kx holds the values of the upper triangle in column major order */\n"
+            << "    inline bool factor(const double *Kx)\n"
+            << "    {\n";
+        for (int j = 0; j < n; j++)
+        {
+            /* Temporaries L(j, k) * D(k) for all k in the row pattern of L(j, :) */
+            for (const int k : L_rows[j])
+            {
+                out << "        const double t" << j << "_" << k
+                    << " = L[" << L_index.at({j, k}) << "] * D[" << k << "];\n";
+            }
+
+            out << "        D[" << j << "] = ";
+            if (K_diag[j] >= 0)
+            {
+                out << "Kx[" << K_diag[j] << "]";
+            }
+            else
+            {
+                out << "0.";
+            }
+            for (const int k : L_rows[j])
+            {
+                out << " - L[" << L_index.at({j, k}) << "] * t" << j << "_" << k;
+            }
+            out << ";\n";
+            out << "        D_inv[" << j << "] = 1. / D[" << j << "];\n";
+
+            for (const int i : L_cols[j])
+            {
+                std::ostringstream expr;
+                bool update = false;
+                const auto entry = K_cols[j].find(i);
+                if (entry != K_cols[j].end())
+                {
+                    expr << "Kx[" << entry->second << "]";
+                }
+
+                /* Sum over the common row pattern of L(i, :) and L(j, :) left of column j */
+                auto ki = L_rows[i].begin();
+                auto kj = L_rows[j].begin();
+                while (ki != L_rows[i].end() and kj != L_rows[j].end())
+                {
+                    if (*ki < *kj)
+                    {
+                        ki++;
+                    }
+                    else if (*kj < *ki)
+                    {
+                        kj++;
+                    }
+                    else
+                    {
+                        expr << (expr.tellp() > 0 ? " - " : "-")
+                             << "L[" << L_index.at({i, *ki}) << "] * t" << j << "_" << *kj;
+                        update = true;
+                        ki++;
+                        kj++;
+                    }
+                }
+
+                out << "        L[" << L_index.at({i, j}) << "] = ";
+                if (update)
+                {
+                    out << "(" << expr.str() << ") * D_inv[" << j << "];\n";
+                }
+                else if (expr.tellp() > 0)
+                {
+                    out << expr.str() << " * D_inv[" << j << "];\n";
+                }
+                else
+                {
+                    out << "0.;\n";
+                }
+            }
+        }
+        out << "        for (int k = 0; k < dim; k++)\n"
+            << "        {\n"
+            << "            if (not std::isfinite(D_inv[k]))\n"
+            << "            {\n"
+            << "                return false;\n"
+            << "            }\n"
+            << "        }\n"
+            << "        return true;\n"
+            << "    }\n"
+            << "\n";
+
+        /* Permuted forward and backward substitution */
+        out << "    /* Overwrites x = b with the solution of K * x = b, requires a previous factor() */\n"
+            << "    inline void solve(double *x)\n"
+            << "    {\n";
+        for (int i = 0; i < n; i++)
+        {
+            out << "        work[" << i << "] = x[" << perm(i) << "];\n";
+        }
+        for (int i = 0; i < n; i++)
+        {
+            for (const int j : L_rows[i])
+            {
+                out << "        work[" << i << "] -= L[" << L_index.at({i, j}) << "] * work[" << j << "];\n";
+            }
+        }
+        for (int i = 0; i < n; i++)
+        {
+            out << "        work[" << i << "] *= D_inv[" << i << "];\n";
+        }
+        for (int j = n - 1; j >= 0; j--)
+        {
+            for (const int i : L_cols[j])
+            {
+                out << "        work[" << j << "] -= L[" << L_index.at({i, j}) << "] * work[" << i << "];\n";
+            }
+        }
+        for (int i = 0; i < n; i++)
+        {
+            out << "        x[" << perm(i) << "] = work[" << i << "];\n";
+        }
+        out << "    }\n"
+            << "\n"
+            << "} // namespace " << name << "\n";
+    }
+
+    void Solver::setKKTKernel(const KKTKernel &kernel)
+    {
+        assert(not matrix_free);
+        assert(kernel.factor and kernel.solve);
+        assert(kernel.dim == dim_K and kernel.nnz == size_t(K.nonZeros()));
+
+        kkt_kernel = kernel;
+    }
+
+} // namespace EiCOS
@@ -0,0 +1,642 @@
+#include "cones.hpp"
+
+#include "kernels.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+namespace EiCOS
+{
+
+    /* ========================== LP cone ========================== */
+
+    LPConeGroup::LPConeGroup(LPCone &cone, size_t start, size_t kkt_start, size_t n)
+        : ConeGroup(start, kkt_start, n, n), cone(cone) {}
+
+    void LPConeGroup::allocate()
+    {
+        cone.v.resize(n_rows);
+        cone.w.resize(n_rows);
+    }
+
+    bool LPConeGroup::updateScalings(const Eigen::VectorXd &s, const Eigen::VectorXd &z)
+    {
+        divideElements(n_rows, s.data() + start, z.data() + start, cone.v.data());
+        sqrtElements(n_rows, cone.v.data(), cone.w.data());
+        return true;
+    }
+
+    void LPConeGroup::scale(const Eigen::VectorXd &z, Eigen::VectorXd &lambda) const
+    {
+        multiplyElements(n_rows, cone.w.data(), z.data() + start, lambda.data() + start);
+    }
+
+    void LPConeGroup::unscale(const Eigen::VectorXd &lambda, Eigen::VectorXd &z) const
+    {
+        divideElements(n_rows, lambda.data() + start, cone.w.data(), z.data() + start);
+    }
+
+    void LPConeGroup::scale2add(const Eigen::VectorXd &x, Eigen::VectorXd &y) const
+    {
+        addProductElements(n_rows, cone.v.data(), x.data() + kkt_start, y.data() + kkt_start);
+    }
+
+    void LPConeGroup::conicProduct(const Eigen::VectorXd &u, const Eigen::VectorXd &v,
+                                   Eigen::VectorXd &w, double &mu) const
+    {
+        multiplyElements(n_rows, u.data() + start, v.data() + start, w.data() + start);
+        mu += w.segment(start, n_rows).lpNorm<1>();
+    }
+
+    void LPConeGroup::conicDivision(const Eigen::VectorXd &u, const Eigen::VectorXd &w, Eigen::VectorXd &v) const
+    {
+        divideElements(n_rows, w.data() + start, u.data() + start, v.data() + start);
+    }
+
+    void LPConeGroup::stepLength(const Eigen::VectorXd &lambda, const Eigen::VectorXd &ds,
+                                 const Eigen::VectorXd &dz, double &alpha) const
+    {
+        if (n_rows == 0)
+        {
+            return;
+        }
+
+        const double rhomin = (ds.segment(start, n_rows).cwiseQuotient(lambda.segment(start, n_rows))).minCoeff();
+        const double sigmamin = (dz.segment(start, n_rows).cwiseQuotient(lambda.segment(start, n_rows))).minCoeff();
+        const double eps = 1e-13;
+        if (-sigmamin > -rhomin)
+        {
+            alpha = std::min(alpha, sigmamin < 0. ? 1. / (-sigmamin) : 1. / eps);
+        }
+        else
+        {
+            alpha = std::min(alpha, rhomin < 0. ? 1. / (-rhomin) : 1. / eps);
+        }
+    }
+
+    void LPConeGroup::maxResidual(const Eigen::VectorXd &r, double &alpha) const
+    {
+        for (size_t i = start; i < start + n_rows; i++)
+        {
+            if (r(i) <= 0 and -r(i) > alpha)
+            {
+                alpha = -r(i);
+            }
+        }
+    }
+
+    void LPConeGroup::addIdentity(Eigen::VectorXd &x, double alpha) const
+    {
+        x.segment(start, n_rows).array() += alpha;
+    }
+
+    void LPConeGroup::refinementResidual(const Eigen::VectorXd &bz, const Eigen::VectorXd &Gdx,
+                                         const Eigen::VectorXd &dz, double delta, Eigen::VectorXd &ez) const
+    {
+        ez.segment(kkt_start, n_rows) = bz.segment(kkt_start, n_rows) - Gdx.segment(start, n_rows) +
+                                        delta * dz.segment(start, n_rows);
+    }
+
+    size_t LPConeGroup::scalingEntries() const
+    {
+        return n_rows;
+    }
+
+    void LPConeGroup::countKKTColumns(int *, size_t) const
+    {
+        /* The diagonal is counted with the rows of G */
+    }
+
+    void LPConeGroup::fillKKTColumns(Eigen::SparseMatrix<double> &, size_t) const
+    {
+        /* The diagonal is placed with the rows of G */
+    }
+
+    void LPConeGroup::cacheScalings(Eigen::SparseMatrix<double> &K, size_t col, std::vector<double *> &ptrs) const
+    {
+        const int *outer = K.outerIndexPtr();
+        double *values = K.valuePtr();
+        for (size_t k = 0; k < n_rows; k++)
+        {
+            ptrs.push_back(&values[outer[col + kkt_start + k + 1] - 1]);
+        }
+    }
+
+    void LPConeGroup::updateKKTScalings(double *const *&ptr, double delta) const
+    {
+        for (size_t k = 0; k < n_rows; k++)
+        {
+            **ptr++ = -cone.v(k) - delta;
+        }
+    }
+
+    void LPConeGroup::resetKKTScalings(double *const *&ptr) const
+    {
+        for (size_t k = 0; k < n_rows; k++)
+        {
+            **ptr++ = -1.;
+        }
+    }
+
+    /* ========================== SO cone ========================== */
+
+    namespace
+    {
+        size_t totalDimension(const std::vector<SOCone> &cones)
+        {
+            size_t dim = 0;
+            for (const SOCone &sc : cones)
+            {
+                dim += sc.dim;
+            }
+            return dim;
+        }
+    } // namespace
+
+    SOConeGroup::SOConeGroup(std::vector<SOCone> &cones, size_t start, size_t kkt_start)
+        : ConeGroup(start, kkt_start, totalDimension(cones), totalDimension(cones) + 2 * cones.size()),
+          cones(cones) {}
+
+    void SOConeGroup::allocate()
+    {
+        for (SOCone &sc : cones)
+        {
+            sc.q.resize(sc.dim - 1);
+            sc.skbar.resize(sc.dim);
+            sc.zkbar.resize(sc.dim);
+        }
+    }
+
+    bool SOConeGroup::updateScalings(const Eigen::VectorXd &s, const Eigen::VectorXd &z)
+    {
+        size_t cone_start = start;
+        for (SOCone &sc : cones)
+        {
+            /* Check residuals and quit if they're negative */
+            const double sres = s(cone_start) * s(cone_start) -
+                                s.segment(cone_start + 1, sc.dim - 1).squaredNorm();
+            const double zres = z(cone_start) * z(cone_start) -
+                                z.segment(cone_start + 1, sc.dim - 1).squaredNorm();
+            if (sres <= 0 or zres <= 0)
+            {
+                return false;
+            }
+
+            /* Normalize variables */
+            const double snorm = std::sqrt(sres);
+            const double znorm = std::sqrt(zres);
+
+            sc.skbar = s.segment(cone_start, sc.dim) / snorm;
+            sc.zkbar = z.segment(cone_start, sc.dim) / znorm;
+
+            sc.eta_square = snorm / znorm;
+            sc.eta = std::sqrt(sc.eta_square);
+
+            /* Normalized Nesterov-Todd scaling point */
+            double gamma = 1. + sc.skbar.dot(sc.zkbar);
+            gamma = std::sqrt(0.5 * gamma);
+
+            const double a = (0.5 / gamma) * (sc.skbar(0) + sc.zkbar(0));
+            sc.q = (0.5 / gamma) * (sc.skbar.tail(sc.dim - 1) -
+                                    sc.zkbar.tail(sc.dim - 1));
+            const double w = sc.q.squaredNorm();
+
+            /* Pre-compute variables needed for KKT matrix (used in KKT scaling) */
+            const double c = (1. + a) + w / (1. + a);
+            const double d = 1. + 2. / (1. + a) + w / std::pow(1. + a, 2);
+
+            const double d1 = std::max(0., 0.5 * (std::pow(a, 2) + w * (1. - std::pow(c, 2) / (1. + w * d))));
+            const double u0_square = std::pow(a, 2) + w - d1;
+
+            const double c2byu02 = (c * c) / u0_square;
+            if (c2byu02 - d <= 0)
+            {
+                return false;
+            }
+
+            sc.d1 = d1;
+            sc.u0 = std::sqrt(u0_square);
+            sc.u1 = std::sqrt(c2byu02);
+            sc.v1 = std::sqrt(c2byu02 - d);
+            sc.a = a;
+            sc.w = w;
+
+            /* Increase offset for next cone */
+            cone_start += sc.dim;
+        }
+        return true;
+    }
+
+    void SOConeGroup::scale(const Eigen::VectorXd &z, Eigen::VectorXd &lambda) const
+    {
+        size_t cone_start = start;
+        for (const SOCone &sc : cones)
+        {
+            /* zeta = q' * z1 */
+            const double zeta = sc.q.dot(z.segment(cone_start + 1, sc.dim - 1));
+
+            /* factor = z0 + zeta / (1 + a); */
+            const double factor = z(cone_start) + zeta / (1. + sc.a);
+
+            /* Write out result */
+            lambda(cone_start) = sc.eta * (sc.a * z(cone_start) + zeta);
+            lambda.segment(cone_start + 1, sc.dim - 1) =
+                sc.eta * (z.segment(cone_start + 1, sc.dim - 1) + factor * sc.q);
+
+            cone_start += sc.dim;
+        }
+    }
+
+    void SOConeGroup::unscale(const Eigen::VectorXd &lambda, Eigen::VectorXd &z) const
+    {
+        size_t cone_start = start;
+        for (const SOCone &sc : cones)
+        {
+            /* zeta = q' * lambda1 */
+            const double zeta = sc.q.dot(lambda.segment(cone_start + 1, sc.dim - 1));
+
+            /* factor = -lambda0 + zeta / (1 + a); */
+            const double factor = -lambda(cone_start) + zeta / (1. + sc.a);
+
+            /* Write out result */
+            z(cone_start) = (sc.a * lambda(cone_start) - zeta) / sc.eta;
+            z.segment(cone_start + 1, sc.dim - 1) =
+                (lambda.segment(cone_start + 1, sc.dim - 1) + factor * sc.q) / sc.eta;
+
+            cone_start += sc.dim;
+        }
+    }
+
+    /**
+     *                                            [ D   v   u  ]
+     * Fast multiplication with V = W^2 = eta^2 * [ v'  1   0  ]
+     *                                            [ u'  0  -1  ]
+     */
+    void SOConeGroup::scale2add(const Eigen::VectorXd &x, Eigen::VectorXd &y) const
+    {
+        size_t cone_start = kkt_start;
+        for (const SOCone &sc : cones)
+        {
+            const size_t i1 = cone_start;
+            const size_t i2 = i1 + 1;
+            const size_t i3 = i2 + sc.dim - 1;
+            const size_t i4 = i3 + 1;
+
+            /* y1 += d1 * x1 + u0 * x4 */
+            y(i1) += sc.eta_square * (sc.d1 * x(i1) + sc.u0 * x(i4));
+
+            /* y2 += x2 + v1 * q * x3 + u1 * q * x4 */
+            const double v1x3_plus_u1x4 = sc.v1 * x(i3) + sc.u1 * x(i4);
+            y.segment(i2, sc.dim - 1) += sc.eta_square * (x.segment(i2, sc.dim - 1) +
+                                                          v1x3_plus_u1x4 * sc.q);
+
+            const double qtx2 = sc.q.dot(x.segment(i2, sc.dim - 1));
+
+            /* y3 += v1 * q' * x2 + x3 */
+            y(i3) += sc.eta_square * (sc.v1 * qtx2 + x(i3));
+
+            /* y4 += u0 * x1 + u1 * q' * x2 - x4 */
+            y(i4) = sc.eta_square * (sc.u0 * x(i1) + sc.u1 * qtx2 - x(i4));
+
+            /* prepare index for next cone */
+            cone_start += sc.dim + 2;
+        }
+    }
+
+    void SOConeGroup::conicProduct(const Eigen::VectorXd &u, const Eigen::VectorXd &v,
+                                   Eigen::VectorXd &w, double &mu) const
+    {
+        size_t cone_start = start;
+        for (const SOCone &sc : cones)
+        {
+            const double u0 = u(cone_start);
+            const double v0 = v(cone_start);
+            w(cone_start) = u.segment(cone_start, sc.dim).dot(v.segment(cone_start, sc.dim));
+            mu += std::abs(w(cone_start));
+            w.segment(cone_start + 1, sc.dim - 1) = u0 * v.segment(cone_start + 1, sc.dim - 1) +
+                                                    v0 * u.segment(cone_start + 1, sc.dim - 1);
+            cone_start += sc.dim;
+        }
+    }
+
+    void SOConeGroup::conicDivision(const Eigen::VectorXd &u, const Eigen::VectorXd &w, Eigen::VectorXd &v) const
+    {
+        size_t cone_start = start;
+        for (const SOCone &sc : cones)
+        {
+            const double u0 = u(cone_start);
+            const double w0 = w(cone_start);
+            const double rho = u0 * u0 - u.segment(cone_start + 1, sc.dim - 1).squaredNorm();
+            const double zeta = u.segment(cone_start + 1, sc.dim - 1).dot(w.segment(cone_start + 1, sc.dim - 1));
+            const double factor = (zeta / u0 - w0) / rho;
+            v(cone_start) = (u0 * w0 - zeta) / rho;
+            v.segment(cone_start + 1, sc.dim - 1) = factor * u.segment(cone_start + 1, sc.dim - 1) +
+                                                    w.segment(cone_start + 1, sc.dim - 1) / u0;
+            cone_start += sc.dim;
+        }
+    }
+
+    void SOConeGroup::stepLength(const Eigen::VectorXd &lambda, const Eigen::VectorXd &ds,
+                                 const Eigen::VectorXd &dz, double &alpha) const
+    {
+        size_t cone_start = start;
+        for (const SOCone &sc : cones)
+        {
+            const size_t k = cone_start;
+            cone_start += sc.dim;
+
+            /* Normalize */
+            const double lknorm2 = std::pow(lambda(k), 2) -
+                                   lambda.segment(k + 1, sc.dim - 1).squaredNorm();
+            if (lknorm2 <= 0.)
+                continue;
+
+            const double lknorm = std::sqrt(lknorm2);
+            const Eigen::VectorXd lkbar = lambda.segment(k, sc.dim) / lknorm;
+
+            const double lknorminv = 1. / lknorm;
+
+            /* Calculate products */
+            const double lkbar_times_dsk = lkbar(0) * ds(k) -
+                                           lkbar.segment(1, sc.dim - 1).dot(ds.segment(k + 1, sc.dim - 1));
+            const double lkbar_times_dzk = lkbar(0) * dz(k) -
+                                           lkbar.segment(1, sc.dim - 1).dot(dz.segment(k + 1, sc.dim - 1));
+
+            /* Now construct rhok and sigmak, the first element is different */
+            double factor;
+
+            Eigen::VectorXd rho(sc.dim);
+            rho(0) = lknorminv * lkbar_times_dsk;
+            factor = (lkbar_times_dsk + ds(k)) / (lkbar(0) + 1.);
+            rho.tail(sc.dim - 1) = lknorminv * (ds.segment(k + 1, sc.dim - 1) -
+                                                factor * lkbar.segment(1, sc.dim - 1));
+            const double rhonorm = rho.tail(sc.dim - 1).norm() - rho(0);
+
+            Eigen::VectorXd sigma(sc.dim);
+            sigma(0) = lknorminv * lkbar_times_dzk;
+            factor = (lkbar_times_dzk + dz(k)) / (lkbar(0) + 1.);
+            sigma.tail(sc.dim - 1) = lknorminv * (dz.segment(k + 1, sc.dim - 1) -
+                                                  factor * lkbar.segment(1, sc.dim - 1));
+            const double sigmanorm = sigma.tail(sc.dim - 1).norm() - sigma(0);
+
+            /* Update alpha */
+            const double conic_step = std::max({0., sigmanorm, rhonorm});
+
+            if (conic_step != 0.)
+            {
+                alpha = std::min(1. / conic_step, alpha);
+            }
+        }
+    }
+
+    void SOConeGroup::maxResidual(const Eigen::VectorXd &r, double &alpha) const
+    {
+        size_t cone_start = start;
+        for (const SOCone &sc : cones)
+        {
+            const double cres = r(cone_start) -
+                                r.segment(cone_start + 1, sc.dim - 1).norm();
+            cone_start += sc.dim;
+
+            if (cres <= 0 and -cres > alpha)
+            {
+                alpha = -cres;
+            }
+        }
+    }
+
+    void SOConeGroup::addIdentity(Eigen::VectorXd &x, double alpha) const
+    {
+        size_t cone_start = start;
+        for (const SOCone &sc : cones)
+        {
+            x(cone_start) += alpha;
+            cone_start += sc.dim;
+        }
+    }
+
+    void SOConeGroup::refinementResidual(const Eigen::VectorXd &bz, const Eigen::VectorXd &Gdx,
+                                         const Eigen::VectorXd &dz, double delta, Eigen::VectorXd &ez) const
+    {
+        size_t ez_index = kkt_start;
+        size_t dz_index = start;
+        for (const SOCone &sc : cones)
+        {
+            ez.segment(ez_index, sc.dim) = bz.segment(ez_index, sc.dim) -
+                                           Gdx.segment(dz_index, sc.dim);
+            ez.segment(ez_index, sc.dim - 1) += delta * dz.segment(dz_index, sc.dim - 1);
+            dz_index += sc.dim;
+            ez_index += sc.dim;
+            ez(ez_index - 1) -= delta * dz(dz_index - 1);
+            ez(ez_index++) = 0.;
+            ez(ez_index++) = 0.;
+        }
+    }
+
+    size_t SOConeGroup::scalingEntries() const
+    {
+        return 3 * n_rows + cones.size();
+    }
+
+    void SOConeGroup::countKKTColumns(int *outer, size_t col) const
+    {
+        size_t kkt_row = kkt_start;
+        for (const SOCone &sc : cones)
+        {
+            const size_t v_col = col + kkt_row + sc.dim;
+            outer[v_col + 1] = sc.dim;
+            outer[v_col + 2] = sc.dim + 1;
+            kkt_row += sc.dim + 2;
+        }
+    }
+
+    /**
+     * The scaling matrix has the following structure:
+     *
+     *    [ 1                * ]
+     *    [   1           *  * ]
+     *    [     .         *  * ]
+     *    [       .       *  * ]       [ D   v   u ]      D: Identity of size conesize
+     *  - [         .     *  * ]  =  - [ u'  1   0 ]      v: Vector of size conesize - 1
+     *    [           1   *  * ]       [ v'  0' -1 ]      u: Vector of size conesize
+     *    [             1 *  * ]
+     *    [   * * * * * * 1    ]
+     *    [ * * * * * * *   -1 ]
+     *
+     * Only the upper triangular part of the expansion columns is filled here,
+     * the diagonal of D is placed with the rows of G.
+     */
+    void SOConeGroup::fillKKTColumns(Eigen::SparseMatrix<double> &K, size_t col) const
+    {
+        const int *outer = K.outerIndexPtr();
+        int *inner = K.innerIndexPtr();
+        double *values = K.valuePtr();
+
+        size_t kkt_row = kkt_start;
+        for (const SOCone &sc : cones)
+        {
+            const size_t first = col + kkt_row;
+            const size_t v_col = first + sc.dim;
+            const size_t u_col = v_col + 1;
+
+            /* -v and -1 on diagonal */
+            int k = outer[v_col];
+            for (size_t i = 1; i < sc.dim; i++, k++)
+            {
+                inner[k] = first + i;
+                values[k] = 0.;
+            }
+            inner[k] = v_col;
+            values[k] = -1.;
+
+            /* -u and 1 on diagonal */
+            k = outer[u_col];
+            for (size_t i = 0; i < sc.dim; i++, k++)
+            {
+                inner[k] = first + i;
+                values[k] = 0.;
+            }
+            inner[k] = u_col;
+            values[k] = 1.;
+
+            kkt_row += sc.dim + 2;
+        }
+    }
+
+    void SOConeGroup::cacheScalings(Eigen::SparseMatrix<double> &K, size_t col, std::vector<double *> &ptrs) const
+    {
+        const int *outer = K.outerIndexPtr();
+        double *values = K.valuePtr();
+        auto diagonal = [&](size_t col) { return &values[outer[col + 1] - 1]; };
+
+        size_t diag_idx = col + kkt_start;
+        for (const SOCone &sc : cones)
+        {
+            /* D */
+            for (size_t k = 0; k < sc.dim; k++)
+            {
+                ptrs.push_back(diagonal(diag_idx));
+                diag_idx++;
+            }
+
+            /* diagonal */
+            ptrs.push_back(diagonal(diag_idx));
+
+            /* v */
+            for (size_t k = 1; k < sc.dim; k++)
+            {
+                ptrs.push_back(&values[outer[diag_idx] + k - 1]);
+            }
+            diag_idx++;
+
+            /* diagonal */
+            ptrs.push_back(diagonal(diag_idx));
+
+            /* u */
+            for (size_t k = 0; k < sc.dim; k++)
+            {
+                ptrs.push_back(&values[outer[diag_idx] + k]);
+            }
+            diag_idx++;
+        }
+    }
+
+    void SOConeGroup::updateKKTScalings(double *const *&ptr, double delta) const
+    {
+        for (const SOCone &sc : cones)
+        {
+            /* D */
+            **ptr++ = -sc.eta_square * sc.d1 - delta;
+
+            for (size_t k = 1; k < sc.dim; k++)
+            {
+                **ptr++ = -sc.eta_square - delta;
+            }
+
+            /* diagonal */
+            **ptr++ = -sc.eta_square;
+
+            /* v */
+            for (size_t k = 1; k < sc.dim; k++)
+            {
+                **ptr++ = -sc.eta_square * sc.v1 * sc.q(k - 1);
+            }
+
+            /* diagonal */
+            **ptr++ = sc.eta_square + delta;
+
+            /* u */
+            **ptr++ = -sc.eta_square * sc.u0;
+            for (size_t k = 1; k < sc.dim; k++)
+            {
+                **ptr++ = -sc.eta_square * sc.u1 * sc.q(k - 1);
+            }
+        }
+    }
+
+    void SOConeGroup::resetKKTScalings(double *const *&ptr) const
+    {
+        for (const SOCone &sc : cones)
+        {
+            /* D */
+            for (size_t k = 0; k < sc.dim; k++)
+            {
+                **ptr++ = -1.;
+            }
+
+            /* -1 on diagonal */
+            **ptr++ = -1.;
+
+            /* -v */
+            for (size_t k = 1; k < sc.dim; k++)
+            {
+                **ptr++ = 0.;
+            }
+
+            /* 1 on diagonal */
+            **ptr++ = 1.;
+
+            /* -u */
+            for (size_t k = 0; k < sc.dim; k++)
+            {
+                **ptr++ = 0.;
+            }
+        }
+    }
+
+    /* ========================== Projection ========================== */
+
+    void projectToCone(size_t n_lc, const std::vector<SOCone> &so_cones, Eigen::VectorXd &x)
+    {
+        /* LP cone */
+        x.head(n_lc) = x.head(n_lc).cwiseMax(0.);
+
+        /* SO cone */
+        size_t cone_start = n_lc;
+        for (const SOCone &sc : so_cones)
+        {
+            const double t = x(cone_start);
+            const double vnorm = x.segment(cone_start + 1, sc.dim - 1).norm();
+
+            if (vnorm <= t)
+            {
+                /* Already in the cone */
+            }
+            else if (vnorm <= -t)
+            {
+                /* In the polar cone, project to the origin */
+                x.segment(cone_start, sc.dim).setZero();
+            }
+            else
+            {
+                /* Project onto the boundary */
+                const double factor = 0.5 * (t + vnorm);
+                x(cone_start) = factor;
+                x.segment(cone_start + 1, sc.dim - 1) *= factor / vnorm;
+            }
+
+            cone_start += sc.dim;
+        }
+    }
+
+} // namespace EiCOS
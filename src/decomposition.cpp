@@ -0,0 +1,377 @@
+#include "eicos.hpp"
+
+#include <numeric>
+#include "parallel.hpp"
+#include "printing.hpp"
+
+namespace EiCOS
+{
+
+    /**
+     * Finds the connected components of the graph that links each variable
+     * to the constraints it appears in. Rows of a second order cone always
+     * belong to the same component.
+     *
+     * Constraints without variables and variables without constraints are
+     * attached to the first component, so that every block is a valid problem.
+     */
+    void Solver::findComponents()
+    {
+        components.clear();
+
+        if (n_var == 0)
+        {
+            return;
+        }
+
+        /* Union-find over the variables */
+        std::vector<int> parent(n_var);
+        std::iota(parent.begin(), parent.end(), 0);
+        auto find = [&parent](int i) {
+            while (parent[i] != i)
+            {
+                parent[i] = parent[parent[i]];
+                i = parent[i];
+            }
+            return i;
+        };
+        auto unite = [&](int i, int j) {
+            i = find(i);
+            j = find(j);
+            parent[std::max(i, j)] = std::min(i, j);
+        };
+
+        /* Returns the first variable in the rows, or -1 if they are empty */
+        auto uniteRows = [&](const SparseRows &rows, const Eigen::SparseMatrix<double> &M, size_t start, size_t count) {
+            int first = -1;
+            for (size_t row = start; row < start + count; row++)
+            {
+                for (SparseRows::InnerIterator it(rows, M, row); it; ++it)
+                {
+                    if (first < 0)
+                    {
+                        first = it.col();
+                    }
+                    unite(first, it.col());
+                }
+            }
+            return first;
+        };
+
+        std::vector<int> eq_var(n_eq);
+        for (size_t row = 0; row < n_eq; row++)
+        {
+            eq_var[row] = uniteRows(A_csr, A, row, 1);
+        }
+        std::vector<int> lc_var(n_lc);
+        for (size_t row = 0; row < n_lc; row++)
+        {
+            lc_var[row] = uniteRows(G_csr, G, row, 1);
+        }
+        std::vector<int> sc_var(n_sc);
+        size_t cone_start = n_lc;
+        for (size_t i = 0; i < n_sc; i++)
+        {
+            sc_var[i] = uniteRows(G_csr, G, cone_start, so_cones[i].dim);
+            cone_start += so_cones[i].dim;
+        }
+
+        /* Number the components in the order of their smallest variable */
+        std::vector<int> component_of(n_var, -1);
+        int n_components = 0;
+        for (size_t i = 0; i < n_var; i++)
+        {
+            const int root = find(i);
+            if (component_of[root] < 0)
+            {
+                component_of[root] = n_components++;
+            }
+            component_of[i] = component_of[root];
+        }
+
+        if (n_components <= 1)
+        {
+            return;
+        }
+
+        components.resize(n_components);
+        auto componentOf = [&component_of](int var) {
+            return var < 0 ? 0 : component_of[var];
+        };
+        for (size_t row = 0; row < n_eq; row++)
+        {
+            components[componentOf(eq_var[row])].eq_rows.push_back(row);
+        }
+        for (size_t row = 0; row < n_lc; row++)
+        {
+            components[componentOf(lc_var[row])].ineq_rows.push_back(row);
+        }
+        cone_start = n_lc;
+        for (size_t i = 0; i < n_sc; i++)
+        {
+            Component &component = components[componentOf(sc_var[i])];
+            for (size_t k = 0; k < so_cones[i].dim; k++)
+            {
+                component.ineq_rows.push_back(cone_start + k);
+            }
+            component.cone_dims.push_back(so_cones[i].dim);
+            cone_start += so_cones[i].dim;
+        }
+
+        /* Merge unconstrained variables into the first component */
+        std::vector<int> target(n_components);
+        std::iota(target.begin(), target.end(), 0);
+        for (int k = 1; k < n_components; k++)
+        {
+            if (components[k].eq_rows.empty() and components[k].ineq_rows.empty())
+            {
+                target[k] = 0;
+            }
+        }
+        for (size_t i = 0; i < n_var; i++)
+        {
+            components[target[component_of[i]]].vars.push_back(i);
+        }
+        components.erase(std::remove_if(components.begin(), components.end(),
+                                        [](const Component &component) { return component.vars.empty(); }),
+                         components.end());
+
+        if (components.size() <= 1)
+        {
+            components.clear();
+        }
+
+        print_dbg("Independent blocks:    {}\n", components.size());
+    }
+
+    /**
+     * Extracts the block of M with the given rows and columns, the block is
+     * known to contain all non-zeros of these columns.
+     */
+    static Eigen::SparseMatrix<double> extractBlock(const Eigen::SparseMatrix<double> &M,
+                                                    const std::vector<int> &rows,
+                                                    const std::vector<int> &cols)
+    {
+        std::vector<int> local_row(M.rows(), -1);
+        for (size_t k = 0; k < rows.size(); k++)
+        {
+            local_row[rows[k]] = k;
+        }
+
+        std::vector<Eigen::Triplet<double>> triplets;
+        for (size_t k = 0; k < cols.size(); k++)
+        {
+            for (Eigen::SparseMatrix<double>::InnerIterator it(M, cols[k]); it; ++it)
+            {
+                assert(local_row[it.row()] >= 0);
+                triplets.emplace_back(local_row[it.row()], k, it.value());
+            }
+        }
+
+        Eigen::SparseMatrix<double> block(rows.size(), cols.size());
+        block.setFromTriplets(triplets.begin(), triplets.end());
+        return block;
+    }
+
+    template <typename T>
+    static T gather(const T &v, const std::vector<int> &indices)
+    {
+        T result(indices.size());
+        for (size_t k = 0; k < indices.size(); k++)
+        {
+            result(k) = v(indices[k]);
+        }
+        return result;
+    }
+
+    template <typename T>
+    static void scatter(const T &v, const std::vector<int> &indices, T &result)
+    {
+        for (size_t k = 0; k < indices.size(); k++)
+        {
+            result(indices[k]) = v(k);
+        }
+    }
+
+    /**
+     * Copies the settings that can be changed after construction to a block solver.
+     * The metrics are left out: the decomposed solve is reported once, by this solver.
+     */
+    void Solver::syncSubSettings(Solver &sub_solver) const
+    {
+        Settings &sub_settings = sub_solver.settings;
+        sub_settings.verbose = settings.verbose;
+        sub_settings.fixed_iters = settings.fixed_iters;
+        sub_settings.fixed_nitref = settings.fixed_nitref;
+        sub_settings.log_sink = settings.log_sink;
+    }
+
+    /**
+     * Creates one solver per block, or passes new data to the existing ones.
+     * The blocks are cut out of the equilibrated problem, which is equivalent.
+     */
+    void Solver::setupSubproblems()
+    {
+        const bool create = sub_solvers.empty();
+        sub_solvers.resize(components.size());
+
+        parallelFor(components.size(), [&](size_t k) {
+            const Component &component = components[k];
+
+            const Eigen::SparseMatrix<double> G_sub = extractBlock(G, component.ineq_rows, component.vars);
+            const Eigen::SparseMatrix<double> A_sub = extractBlock(A, component.eq_rows, component.vars);
+            const Eigen::VectorXd c_sub = gather(c, component.vars);
+            const Eigen::VectorXd h_sub = gather(h, component.ineq_rows);
+            const Eigen::VectorXd b_sub = gather(b, component.eq_rows);
+
+            if (create)
+            {
+                const Eigen::VectorXi q_sub = Eigen::Map<const Eigen::VectorXi>(component.cone_dims.data(),
+                                                                               component.cone_dims.size());
+                sub_solvers[k] = std::make_unique<Solver>(G_sub, A_sub, c_sub, h_sub, b_sub, q_sub);
+                sub_solvers[k]->thread_pool = thread_pool;
+            }
+            else
+            {
+                sub_solvers[k]->updateData(G_sub, A_sub, c_sub, h_sub, b_sub);
+            }
+        });
+    }
+
+    /**
+     * Solves the independent blocks in parallel and combines their results.
+     */
+    exitcode Solver::solveDecomposed()
+    {
+        if (sub_solvers.empty())
+        {
+            setupSubproblems();
+        }
+
+        const size_t n_blocks = components.size();
+
+        if (warm_start)
+        {
+            for (size_t k = 0; k < n_blocks; k++)
+            {
+                const Component &component = components[k];
+                sub_solvers[k]->setInitialPoint(gather(w.x, component.vars),
+                                                gather(w.y, component.eq_rows),
+                                                gather(w.z, component.ineq_rows),
+                                                gather(w.s, component.ineq_rows));
+            }
+            warm_start = false;
+        }
+
+        /* The settings may have changed since the blocks were set up */
+        std::vector<exitcode> codes(n_blocks);
+        parallelFor(n_blocks, [&](size_t k) {
+            syncSubSettings(*sub_solvers[k]);
+            codes[k] = sub_solvers[k]->solve(settings.verbose);
+        });
+
+        /* The combined status is the most severe one of the blocks */
+        const std::vector<exitcode> severity = {exitcode::primal_infeasible,
+                                                exitcode::dual_infeasible,
+                                                exitcode::close_to_primal_infeasible,
+                                                exitcode::close_to_dual_infeasible,
+                                                exitcode::fatal,
+                                                exitcode::outcone,
+                                                exitcode::numerics,
+                                                exitcode::maxit,
+                                                exitcode::not_converged_yet,
+                                                exitcode::close_to_optimal,
+                                                exitcode::optimal};
+        exitcode code = exitcode::optimal;
+        for (const exitcode candidate : severity)
+        {
+            if (std::find(codes.begin(), codes.end(), candidate) != codes.end())
+            {
+                code = candidate;
+                break;
+            }
+        }
+        const bool primal_certificate = code == exitcode::primal_infeasible or
+                                        code == exitcode::close_to_primal_infeasible;
+        const bool dual_certificate = code == exitcode::dual_infeasible or
+                                      code == exitcode::close_to_dual_infeasible;
+
+        /* Combine the results, a certificate of infeasibility is only taken from the blocks that found it */
+        size_t max_iter = 0;
+        w.x.setZero();
+        w.y.setZero();
+        w.z.setZero();
+        w.s.setZero();
+        for (size_t k = 0; k < n_blocks; k++)
+        {
+            const Component &component = components[k];
+            const Solver &sub_solver = *sub_solvers[k];
+
+            if (not primal_certificate or codes[k] == code)
+            {
+                scatter(sub_solver.dualEquality(), component.eq_rows, w.y);
+                scatter(sub_solver.dualConic(), component.ineq_rows, w.z);
+            }
+            if (not dual_certificate or codes[k] == code)
+            {
+                scatter(sub_solver.solution(), component.vars, w.x);
+                scatter(sub_solver.slack(), component.ineq_rows, w.s);
+            }
+
+            if (sub_solver.getInfo().iter >= sub_solvers[max_iter]->getInfo().iter)
+            {
+                max_iter = k;
+            }
+        }
+        w.tau = 1.;
+        w.kap = 0.;
+        backscale();
+
+        /* Statistics of the slowest block, with costs and residuals of the whole problem */
+        w.i = sub_solvers[max_iter]->getInfo();
+        w.i.pcost = 0.;
+        w.i.dcost = 0.;
+        w.i.gap = 0.;
+        w.i.pres = 0.;
+        w.i.dres = 0.;
+        for (const std::unique_ptr<Solver> &sub_solver : sub_solvers)
+        {
+            /* The work of the blocks adds up, their times are summed over the threads */
+            const SolveStatistics &sub_statistics = sub_solver->getStatistics();
+            statistics.factor_time += sub_statistics.factor_time;
+            statistics.factorizations += sub_statistics.factorizations;
+            statistics.refinement_steps += sub_statistics.refinement_steps;
+            statistics.fallbacks += sub_statistics.fallbacks;
+            statistics.regularized_pivots += sub_statistics.regularized_pivots;
+
+            const Information &info = sub_solver->getInfo();
+            w.i.pcost += info.pcost;
+            w.i.dcost += info.dcost;
+            w.i.gap += info.gap;
+            w.i.pres = std::max(w.i.pres, info.pres);
+            w.i.dres = std::max(w.i.dres, info.dres);
+            w.i.pinf = w.i.pinf or info.pinf;
+            w.i.dinf = w.i.dinf or info.dinf;
+        }
+        if (w.i.pcost < 0.)
+        {
+            w.i.relgap = w.i.gap / -w.i.pcost;
+        }
+        else if (w.i.dcost > 0.)
+        {
+            w.i.relgap = w.i.gap / w.i.dcost;
+        }
+        else
+        {
+            w.i.relgap.reset();
+        }
+
+        if (settings.verbose)
+        {
+            logMessage(settings, format("Solved {} independent blocks, pcost = {:+.3e}.\n", n_blocks, w.i.pcost));
+        }
+
+        return code;
+    }
+
+} // namespace EiCOS
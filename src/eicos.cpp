@@ -1,7 +1,12 @@
 #include "eicos.hpp"
 
 #include <chrono>
+#include <thread>
 #include <Eigen/SparseCholesky>
+#include "equilibration.hpp"
+#include "kernels.hpp"
+#include "parallel.hpp"
+#include "solution_cache.hpp"
 #include "printing.hpp"
 
 namespace EiCOS
@@ -83,9 +88,10 @@ namespace EiCOS
                    const Eigen::VectorXd &c,
                    const Eigen::VectorXd &h,
                    const Eigen::VectorXd &b,
-                   const Eigen::VectorXi &soc_dims)
+                   const Eigen::VectorXi &soc_dims,
+                   const SetupCallback &progress)
     {
-        build(G, A, c, h, b, soc_dims);
+        build(G, A, c, h, b, soc_dims, progress);
     }
 
     Solver::Solver(int n, int m, int p, int /* l */, int ncones, int *q,
@@ -119,6 +125,93 @@ namespace EiCOS
         build(G_, A_, c_, h_, b_, q_);
     }
 
+    Solver::Solver(const LinearOperator &G,
+                   const LinearOperator &A,
+                   const Eigen::VectorXd &c,
+                   const Eigen::VectorXd &h,
+                   const Eigen::VectorXd &b,
+                   const Eigen::VectorXi &soc_dims)
+    {
+        assert(not(c.hasNaN() or h.hasNaN() or b.hasNaN()));
+        assert(G.apply and G.apply_transpose);
+        assert(A.rows == 0 or (A.apply and A.apply_transpose));
+
+        matrix_free = true;
+        G_op = G;
+        A_op = A;
+        this->c = c;
+        this->h = h;
+        this->b = b;
+
+        n_var = c.size();
+        n_eq = A.rows;
+        n_ineq = G.rows;
+
+        setupCones(soc_dims);
+
+        /* The operators are opaque, so the problem is not equilibrated */
+        x_equil.setOnes(n_var);
+        A_equil.setOnes(n_eq);
+        G_equil.setOnes(n_ineq);
+        equibrilated = false;
+    }
+
+    void Solver::setThreadPool(std::shared_ptr<ThreadPool> pool)
+    {
+        thread_pool = pool;
+        for (std::unique_ptr<Solver> &sub_solver : sub_solvers)
+        {
+            sub_solver->setThreadPool(pool);
+        }
+
+        /* The partitions of the products follow the size of the pool */
+        if (not matrix_free)
+        {
+            partitionProducts();
+        }
+    }
+
+    void Solver::setSolutionCache(std::shared_ptr<SolutionCache> cache)
+    {
+        solution_cache = cache;
+    }
+
+    std::shared_ptr<SolutionCache> Solver::solutionCache() const
+    {
+        return solution_cache;
+    }
+
+    /**
+     * Hash of everything a solve depends on: the dimensions, the cones, the
+     * patterns and values of the (equilibrated) data with its scaling, and the
+     * settings that change the iterations.
+     */
+    SolutionKey Solver::solutionKey() const
+    {
+        SolutionKey key;
+        key.add(n_var);
+        key.add(n_eq);
+        key.add(n_lc);
+        for (const SOCone &sc : so_cones)
+        {
+            key.add(sc.dim);
+        }
+        for (const Eigen::SparseMatrix<double> *M : {&G, &A})
+        {
+            key.add(M->outerIndexPtr(), M->cols() + 1);
+            key.add(M->innerIndexPtr(), M->nonZeros());
+            key.add(M->valuePtr(), M->nonZeros());
+        }
+        for (const Eigen::VectorXd *v : {&c, &h, &b, &x_equil, &A_equil, &G_equil})
+        {
+            key.add(v->data(), v->size());
+        }
+        key.add(settings.fixed_iters);
+        key.add(settings.fixed_nitref);
+        key.add(settings.decompose);
+        return key.finish();
+    }
+
     Settings &Solver::getSettings()
     {
         return settings;
@@ -129,17 +222,44 @@ namespace EiCOS
         return w.i;
     }
 
+    const SolveStatistics &Solver::getStatistics() const
+    {
+        return statistics;
+    }
+
+    /**
+     * The setup runs in stages that are parallel inside, and the symbolic
+     * analysis of K runs in the background while the data is equilibrated.
+     * K is assembled from the unequilibrated values, which are replaced once
+     * the analysis is done.
+     */
     void Solver::build(const Eigen::SparseMatrix<double> &G,
                        const Eigen::SparseMatrix<double> &A,
                        const Eigen::VectorXd &c,
                        const Eigen::VectorXd &h,
                        const Eigen::VectorXd &b,
-                       const Eigen::VectorXi &soc_dims)
+                       const Eigen::VectorXi &soc_dims,
+                       const SetupCallback &progress)
     {
         assert(not(c.hasNaN() or h.hasNaN() or b.hasNaN()));
 
+        const ThreadPool::Scope pool_scope(thread_pool.get());
+        ThreadPool &pool = ThreadPool::current();
+
+        const size_t n_stages = 5;
+        size_t stage = 0;
+        auto proceed = [&](const char *name) {
+            setup_cancelled = progress and not progress(name, double(stage++) / n_stages);
+            return not setup_cancelled;
+        };
+
+        if (not proceed("copy"))
+            return;
+
         this->G = G;
         this->A = A;
+        this->G.makeCompressed();
+        this->A.makeCompressed();
         this->c = c;
         this->h = h;
         this->b = b;
@@ -152,6 +272,93 @@ namespace EiCOS
         n_var = c.size();
         n_eq = A.rows();
         n_ineq = G.rows();
+
+        setupCones(soc_dims);
+
+        if (not proceed("row index"))
+            return;
+
+        const size_t n_threads = threadParts(G.nonZeros() + A.nonZeros()) > 1 ? pool.size() : 1;
+        G_csr.setup(this->G, n_threads);
+        A_csr.setup(this->A, n_threads);
+
+        if (not proceed("KKT assembly"))
+            return;
+
+        setupKKT();
+
+        /* A tuning profile of the structure decides how the products are split */
+        const std::optional<TuningProfile> profile = TuningProfiles::global().find(structureFingerprint());
+        if (profile)
+        {
+            threaded_products = profile->threaded_products;
+        }
+
+        /*
+         * Sparse systems are analyzed in the background, on the CPUs of the pool, unless it runs inline.
+         * The analysis gets its own thread rather than a task of the pool: the pool runs one loop
+         * at a time, so while a worker held the analysis the loops of the equilibration would run
+         * inline on the calling thread.
+         */
+        kkt_analyzed = false;
+        std::thread analysis;
+        if (pool.size() == 1)
+        {
+            analyzeKKT();
+        }
+        else
+        {
+            analysis = std::thread([this, cpus = pool.cpus()] {
+                if (not cpus.empty())
+                {
+                    setThreadAffinity(cpus);
+                }
+                analyzeKKT();
+            });
+        }
+        auto joinAnalysis = [&]() {
+            if (analysis.joinable())
+            {
+                analysis.join();
+            }
+        };
+
+        if (not proceed("equilibration"))
+        {
+            joinAnalysis();
+            return;
+        }
+
+        setEquilibration();
+
+        if (not proceed("partitioning"))
+        {
+            joinAnalysis();
+            return;
+        }
+
+        partitionProducts();
+        findComponents();
+
+        joinAnalysis();
+        updateKKTAG();
+
+        proceed("done");
+    }
+
+    /**
+     * Number of parallel ranges for work on a matrix, small matrices are handled by one thread.
+     * A tuning profile overrides the size threshold.
+     */
+    size_t Solver::threadParts(size_t nnz) const
+    {
+        const bool threaded = threaded_products.value_or(nnz >= settings.spmv_nnz);
+        const size_t n_threads = (thread_pool ? *thread_pool : ThreadPool::current()).size();
+        return threaded and n_threads > 1 ? 4 * n_threads : 1;
+    }
+
+    void Solver::setupCones(const Eigen::VectorXi &soc_dims)
+    {
         n_lc = n_ineq - soc_dims.sum();
         n_sc = soc_dims.size();
 
@@ -177,13 +384,6 @@ namespace EiCOS
         allocate();
 
         printSummary();
-
-        setEquilibration();
-
-        Gt = this->G.transpose();
-        At = this->A.transpose();
-
-        setupKKT();
     }
 
     void Solver::printSummary()
@@ -194,6 +394,7 @@ namespace EiCOS
         print_dbg("    Primal variables:  {}\n", n_var);
         print_dbg("Equality constraints:  {}\n", n_eq);
         print_dbg("     Conic variables:  {}\n", n_ineq);
+        print_dbg("             Kernels:  {}\n", cpuDispatchLevel());
         print_dbg("- - - - - - - - - - - - - - -\n");
         print_dbg("  Size of LP cone:     {}\n", n_lc);
         print_dbg("  Number of SOCs:      {}\n", n_sc);
@@ -211,17 +412,12 @@ namespace EiCOS
         // Allocate work struct
         w.allocate(n_var, n_eq, n_ineq);
 
-        // Set up LP cone
-        lp_cone.v.resize(n_lc);
-        lp_cone.w.resize(n_lc);
-
-        // Set up second-order cone
-        for (SOCone &sc : so_cones)
-        {
-            sc.q.resize(sc.dim - 1);
-            sc.skbar.resize(sc.dim);
-            sc.zkbar.resize(sc.dim);
-        }
+        // Set up the cones
+        size_t KKT_ptr_size = 0;
+        forEachConeGroup([&](auto &cones) {
+            cones.allocate();
+            KKT_ptr_size += cones.scalingEntries();
+        });
 
         W_times_dzaff.resize(n_ineq);
         dsaff_by_W.resize(n_ineq);
@@ -236,16 +432,7 @@ namespace EiCOS
 
         K.reserve(dim_K);
 
-        Gt.reserve(G.nonZeros());
-        At.reserve(A.nonZeros());
-
-        size_t KKT_ptr_size = n_lc;
-        for (const SOCone &sc : so_cones)
-        {
-            KKT_ptr_size += 3 * sc.dim + 1;
-        }
         KKT_V_ptr.reserve(KKT_ptr_size);
-        KKT_AG_ptr.reserve(A.nonZeros() + G.nonZeros());
     }
 
     const Eigen::VectorXd &Solver::solution() const
@@ -253,113 +440,111 @@ namespace EiCOS
         return w.x;
     }
 
-    void maxRows(Eigen::VectorXd &e, const Eigen::SparseMatrix<double> m)
+    const Eigen::VectorXd &Solver::dualEquality() const
+    {
+        return w.y;
+    }
+
+    const Eigen::VectorXd &Solver::dualConic() const
+    {
+        return w.z;
+    }
+
+    const Eigen::VectorXd &Solver::slack() const
+    {
+        return w.s;
+    }
+
+    void Solver::setInitialPoint(const Eigen::VectorXd &x,
+                                 const Eigen::VectorXd &y,
+                                 const Eigen::VectorXd &z,
+                                 const Eigen::VectorXd &s)
+    {
+        assert(size_t(x.size()) == n_var and size_t(y.size()) == n_eq);
+        assert(size_t(z.size()) == n_ineq and size_t(s.size()) == n_ineq);
+
+        /* Transform into the equilibrated problem, the inverse of backscale() */
+        w.x = gatherInternal(x, var_order).cwiseProduct(x_equil);
+        w.y = gatherInternal(y, eq_order).cwiseProduct(A_equil);
+        w.z = gatherInternal(z, ineq_order).cwiseProduct(G_equil);
+        w.s = gatherInternal(s, ineq_order).cwiseQuotient(G_equil);
+
+        warm_start = true;
+    }
+
+    /**
+     * Splits the rows of the problem matrices for multithreaded products.
+     * Small matrices are multiplied by a single thread.
+     */
+    void Solver::partitionProducts()
+    {
+        auto n_parts = [this](const Eigen::SparseMatrix<double> &M) { return threadParts(M.nonZeros()); };
+        G_rows = partitionRows(G_csr, n_parts(G));
+        Gt_rows = partitionRows(G, n_parts(G));
+        A_rows = partitionRows(A_csr, n_parts(A));
+        At_rows = partitionRows(A, n_parts(A));
+    }
+
+    void Solver::productG(const Eigen::VectorXd &x, Eigen::VectorXd &y, double alpha) const
     {
-        for (int j = 0; j < m.cols(); j++)
+        if (matrix_free)
         {
-            for (Eigen::SparseMatrix<double>::InnerIterator it(m, j); it; ++it)
-            {
-                e(it.row()) = std::max(std::fabs(it.value()), e(it.row()));
-            }
+            Eigen::VectorXd tmp(n_ineq);
+            G_op.apply(x, tmp);
+            y += alpha * tmp;
+        }
+        else
+        {
+            multiplyRows(G_csr, G, G_rows, x, y, alpha);
         }
     }
 
-    void maxCols(Eigen::VectorXd &e, const Eigen::SparseMatrix<double> m)
+    void Solver::productGt(const Eigen::VectorXd &x, Eigen::VectorXd &y, double alpha) const
     {
-        for (int j = 0; j < m.cols(); j++)
+        if (matrix_free)
         {
-            for (Eigen::SparseMatrix<double>::InnerIterator it(m, j); it; ++it)
-            {
-                e(j) = std::max(std::fabs(it.value()), e(j));
-            }
+            Eigen::VectorXd tmp(n_var);
+            G_op.apply_transpose(x, tmp);
+            y += alpha * tmp;
+        }
+        else
+        {
+            multiplyRows(G, Gt_rows, x, y, alpha);
         }
     }
 
-    void equilibrateRows(const Eigen::VectorXd &e, Eigen::SparseMatrix<double> &m)
+    void Solver::productA(const Eigen::VectorXd &x, Eigen::VectorXd &y, double alpha) const
     {
-        for (int j = 0; j < m.cols(); j++)
+        if (matrix_free)
         {
-            /* equilibrate the rows of a matrix */
-            for (Eigen::SparseMatrix<double>::InnerIterator it(m, j); it; ++it)
-            {
-                it.valueRef() /= e(it.row());
-            }
+            Eigen::VectorXd tmp(n_eq);
+            A_op.apply(x, tmp);
+            y += alpha * tmp;
+        }
+        else
+        {
+            multiplyRows(A_csr, A, A_rows, x, y, alpha);
         }
     }
 
-    void equilibrateCols(const Eigen::VectorXd &e, Eigen::SparseMatrix<double> &m)
+    void Solver::productAt(const Eigen::VectorXd &x, Eigen::VectorXd &y, double alpha) const
     {
-        for (int j = 0; j < m.cols(); j++)
+        if (matrix_free)
         {
-            /* equilibrate the columns of a matrix */
-            for (Eigen::SparseMatrix<double>::InnerIterator it(m, j); it; ++it)
-            {
-                it.valueRef() /= e(j);
-            }
+            Eigen::VectorXd tmp(n_var);
+            A_op.apply_transpose(x, tmp);
+            y += alpha * tmp;
+        }
+        else
+        {
+            multiplyRows(A, At_rows, x, y, alpha);
         }
     }
 
     void Solver::setEquilibration()
     {
-        x_equil.resize(n_var);
-        A_equil.resize(n_eq);
-        G_equil.resize(n_ineq);
-
-        Eigen::VectorXd x_tmp(n_var);
-        Eigen::VectorXd A_tmp(n_eq);
-        Eigen::VectorXd G_tmp(n_ineq);
-
-        /* Initialize equilibration vector to 1 */
-        x_equil.setOnes();
-        A_equil.setOnes();
-        G_equil.setOnes();
-
-        /* Iterative equilibration */
-        for (size_t iter = 0; iter < settings.equil_iters; iter++)
-        {
-            /* Each iteration updates A and G */
-
-            /* Zero out the temp vectors */
-            x_tmp.setZero();
-            A_tmp.setZero();
-            G_tmp.setZero();
-
-            /* Compute norm across columns of A, G */
-            maxCols(x_tmp, A);
-            maxCols(x_tmp, G);
-
-            /* Compute norm across rows of A */
-            maxRows(A_tmp, A);
-
-            /* Compute norm across rows of G */
-            maxRows(G_tmp, G);
-
-            /* Now collapse cones together by using total over the group */
-            size_t ind = n_lc;
-            for (const SOCone &sc : so_cones)
-            {
-                const double total = G_tmp.segment(ind, sc.dim).sum();
-                G_tmp.segment(ind, sc.dim).setConstant(total);
-                ind += sc.dim;
-            }
-
-            /* Take the square root */
-            auto sqrt_op = [](const double a) { return std::fabs(a) < 1e-6 ? 1. : std::sqrt(a); };
-            x_tmp = x_tmp.unaryExpr(sqrt_op);
-            A_tmp = A_tmp.unaryExpr(sqrt_op);
-            G_tmp = G_tmp.unaryExpr(sqrt_op);
-
-            /* Equilibrate the matrices */
-            equilibrateRows(A_tmp, A);
-            equilibrateRows(G_tmp, G);
-            equilibrateCols(x_tmp, A);
-            equilibrateCols(x_tmp, G);
-
-            /* Update the equilibration matrix */
-            x_equil = x_equil.cwiseProduct(x_tmp);
-            A_equil = A_equil.cwiseProduct(A_tmp);
-            G_equil = G_equil.cwiseProduct(G_tmp);
-        }
+        equilibrate(A, G, A_csr, G_csr, threadParts(A.nonZeros() + G.nonZeros()),
+                    n_var, n_lc, so_cones, settings.equil_iters, x_equil, A_equil, G_equil);
 
         /* Equilibrate the c vector */
         c = c.cwiseQuotient(x_equil);
@@ -373,19 +558,6 @@ namespace EiCOS
         equibrilated = true;
     }
 
-    void restore(const Eigen::VectorXd &d, const Eigen::VectorXd &e,
-                 Eigen::SparseMatrix<double> &m)
-    {
-        assert(not m.IsRowMajor);
-        for (int col = 0; col < m.cols(); ++col)
-        {
-            for (Eigen::SparseMatrix<double>::InnerIterator it(m, col); it; ++it)
-            {
-                it.valueRef() *= d(it.row()) * e(it.col());
-            }
-        }
-    }
-
     void Solver::unsetEquilibration()
     {
         restore(A_equil, x_equil, A);
@@ -412,100 +584,42 @@ namespace EiCOS
                                 const Eigen::VectorXd &z,
                                 Eigen::VectorXd &lambda)
     {
-        /* LP cone */
-        lp_cone.v = s.head(n_lc).cwiseQuotient(z.head(n_lc));
-        lp_cone.w = lp_cone.v.cwiseSqrt();
-
-        /* SO cone */
-        size_t cone_start = n_lc;
-        for (SOCone &sc : so_cones)
-        {
-            /* Check residuals and quit if they're negative */
-            const double sres = s(cone_start) * s(cone_start) -
-                                s.segment(cone_start + 1, sc.dim - 1).squaredNorm();
-            const double zres = z(cone_start) * z(cone_start) -
-                                z.segment(cone_start + 1, sc.dim - 1).squaredNorm();
-            if (sres <= 0 or zres <= 0)
-            {
-                return false;
-            }
-
-            /* Normalize variables */
-            const double snorm = std::sqrt(sres);
-            const double znorm = std::sqrt(zres);
-
-            sc.skbar = s.segment(cone_start, sc.dim) / snorm;
-            sc.zkbar = z.segment(cone_start, sc.dim) / znorm;
-
-            sc.eta_square = snorm / znorm;
-            sc.eta = std::sqrt(sc.eta_square);
-
-            /* Normalized Nesterov-Todd scaling point */
-            double gamma = 1. + sc.skbar.dot(sc.zkbar);
-            gamma = std::sqrt(0.5 * gamma);
-
-            const double a = (0.5 / gamma) * (sc.skbar(0) + sc.zkbar(0));
-            sc.q = (0.5 / gamma) * (sc.skbar.tail(sc.dim - 1) -
-                                    sc.zkbar.tail(sc.dim - 1));
-            const double w = sc.q.squaredNorm();
-
-            /* Pre-compute variables needed for KKT matrix (used in KKT scaling) */
-            const double c = (1. + a) + w / (1. + a);
-            const double d = 1. + 2. / (1. + a) + w / std::pow(1. + a, 2);
-
-            const double d1 = std::max(0., 0.5 * (std::pow(a, 2) + w * (1. - std::pow(c, 2) / (1. + w * d))));
-            const double u0_square = std::pow(a, 2) + w - d1;
-
-            const double c2byu02 = (c * c) / u0_square;
-            if (c2byu02 - d <= 0)
-            {
-                return false;
-            }
-
-            sc.d1 = d1;
-            sc.u0 = std::sqrt(u0_square);
-            sc.u1 = std::sqrt(c2byu02);
-            sc.v1 = std::sqrt(c2byu02 - d);
-            sc.a = a;
-            sc.w = w;
-
-            /* Increase offset for next cone */
-            cone_start += sc.dim;
+        bool in_cone = true;
+        forEachConeGroup([&](auto &cones) {
+            in_cone = in_cone and cones.updateScalings(s, z);
+        });
+        if (not in_cone)
+        {
+            return false;
         }
+
         /* lambda = W * z */
         scale(z, lambda);
 
         return true;
     }
 
+
     /**
      * Fast multiplication by scaling matrix.
      * Returns lambda = W * z
      */
     void Solver::scale(const Eigen::VectorXd &z, Eigen::VectorXd &lambda)
     {
-        /* LP cone */
-        lambda.head(n_lc) = lp_cone.w.cwiseProduct(z.head(n_lc));
-
-        /* SO cone */
-        size_t cone_start = n_lc;
-        for (const SOCone &sc : so_cones)
-        {
-            /* zeta = q' * z1 */
-            const double zeta = sc.q.dot(z.segment(cone_start + 1, sc.dim - 1));
-
-            /* factor = z0 + zeta / (1 + a); */
-            const double factor = z(cone_start) + zeta / (1. + sc.a);
+        forEachConeGroup([&](auto &cones) { cones.scale(z, lambda); });
+    }
 
-            /* Write out result */
-            lambda(cone_start) = sc.eta * (sc.a * z(cone_start) + zeta);
-            lambda.segment(cone_start + 1, sc.dim - 1) =
-                sc.eta * (z.segment(cone_start + 1, sc.dim - 1) + factor * sc.q);
 
-            cone_start += sc.dim;
-        }
+    /**
+     * Fast multiplication by inverse scaling matrix.
+     * Returns z = W \ lambda
+     */
+    void Solver::unscale(const Eigen::VectorXd &lambda, Eigen::VectorXd &z)
+    {
+        forEachConeGroup([&](auto &cones) { cones.unscale(lambda, z); });
     }
 
+
     /**
      * This function is reponsible for checking the exit/convergence conditions.
      * If one of the exit conditions is met, The solver displays an exit message and returns
@@ -524,6 +638,13 @@ namespace EiCOS
      * This should not be an exitflag that is ever returned to the outside world.
      */
     exitcode Solver::checkExitConditions(bool reduced_accuracy)
+    {
+        return EiCOS::checkExitConditions(settings, w.i, w.cx, w.by, w.hz, w.tau, w.kap, reduced_accuracy);
+    }
+
+    exitcode checkExitConditions(const Settings &settings, Information &info,
+                                 double cx, double by, double hz, double tau, double kap,
+                                 bool reduced_accuracy)
     {
         double feastol;
         double abstol;
@@ -546,26 +667,26 @@ namespace EiCOS
         }
 
         /* Optimal? */
-        if ((-w.cx > 0. or -w.by - w.hz >= -abstol) and
-            (w.i.pres < feastol and w.i.dres < feastol) and
-            (w.i.gap < abstol or w.i.relgap < reltol))
+        if ((-cx > 0. or -by - hz >= -abstol) and
+            (info.pres < feastol and info.dres < feastol) and
+            (info.gap < abstol or info.relgap < reltol))
         {
             if (settings.verbose)
             {
                 if (reduced_accuracy)
                 {
-                    print("Close to optimal (within feastol={:3.1e}, reltol={:3.1e}, abstol={:3.1e}).\n",
-                          std::max(w.i.dres, w.i.pres), w.i.relgap.value_or(0.), w.i.gap);
+                    logMessage(settings, format("Close to optimal (within feastol={:3.1e}, reltol={:3.1e}, abstol={:3.1e}).\n",
+                                                std::max(info.dres, info.pres), info.relgap.value_or(0.), info.gap));
                 }
                 else
                 {
-                    print("Optimal (within feastol={:3.1e}, reltol={:3.1e}, abstol={:3.1e}).\n",
-                          std::max(w.i.dres, w.i.pres), w.i.relgap.value_or(0.), w.i.gap);
+                    logMessage(settings, format("Optimal (within feastol={:3.1e}, reltol={:3.1e}, abstol={:3.1e}).\n",
+                                                std::max(info.dres, info.pres), info.relgap.value_or(0.), info.gap));
                 }
             }
 
-            w.i.pinf = false;
-            w.i.dinf = false;
+            info.pinf = false;
+            info.dinf = false;
 
             if (reduced_accuracy)
             {
@@ -578,24 +699,24 @@ namespace EiCOS
         }
 
         /* Dual infeasible? */
-        else if ((w.i.dinfres.has_value()) and
-                 (w.i.dinfres.value() < feastol) and
-                 (w.tau < w.kap))
+        else if ((info.dinfres.has_value()) and
+                 (info.dinfres.value() < feastol) and
+                 (tau < kap))
         {
             if (settings.verbose)
             {
                 if (reduced_accuracy)
                 {
-                    print("Close to unbounded (within feastol={:3.1e}).\n", w.i.dinfres.value());
+                    logMessage(settings, format("Close to unbounded (within feastol={:3.1e}).\n", info.dinfres.value()));
                 }
                 else
                 {
-                    print("Unbounded (within feastol={:3.1e}).\n", w.i.dinfres.value());
+                    logMessage(settings, format("Unbounded (within feastol={:3.1e}).\n", info.dinfres.value()));
                 }
             }
 
-            w.i.pinf = false;
-            w.i.dinf = true;
+            info.pinf = false;
+            info.dinf = true;
 
             if (reduced_accuracy)
             {
@@ -608,20 +729,23 @@ namespace EiCOS
         }
 
         /* Primal infeasible? */
-        else if (((w.i.pinfres.has_value() and w.i.pinfres < feastol) and (w.tau < w.kap)) or
-                 (w.tau < feastol and w.kap < feastol and w.i.pinfres < feastol))
+        else if (((info.pinfres.has_value() and info.pinfres < feastol) and (tau < kap)) or
+                 (tau < feastol and kap < feastol and info.pinfres < feastol))
         {
-            if (reduced_accuracy)
-            {
-                print("Close to primal infeasible (within feastol={:3.1e}).\n", w.i.pinfres.value());
-            }
-            else
+            if (settings.verbose)
             {
-                print("Primal infeasible (within feastol={:3.1e}).\n", w.i.pinfres.value());
+                if (reduced_accuracy)
+                {
+                    logMessage(settings, format("Close to primal infeasible (within feastol={:3.1e}).\n", info.pinfres.value()));
+                }
+                else
+                {
+                    logMessage(settings, format("Primal infeasible (within feastol={:3.1e}).\n", info.pinfres.value()));
+                }
             }
 
-            w.i.pinf = true;
-            w.i.dinf = false;
+            info.pinf = true;
+            info.dinf = false;
 
             if (reduced_accuracy)
             {
@@ -650,47 +774,82 @@ namespace EiCOS
          * rt = kappa + c' * x + b' * y + h' * z
          */
 
-        /* rx = -A' * y - G' * z - tau * c */
-        rx = -Gt * w.z;
+        /* Sparse products first, everything else is fused into one pass per block */
+        rx.setZero();
+        productGt(w.z, rx, -1.);
+        ry.setZero();
         if (n_eq > 0)
         {
-            rx -= At * w.y;
+            productAt(w.y, rx, -1.);
+            productA(w.x, ry);
         }
-        hresx = rx.norm();
-        rx -= w.tau * c;
+        rz = w.s;
+        productG(w.x, rz);
 
-        /* ry = A * x - tau * b */
-        if (n_eq > 0)
+        /* rx = hrx - tau * c, with ||hrx||, ||rx||, c' * x and ||x|| */
+        double hresx_sq = 0., rx_sq = 0., cx = 0., nx_sq = 0.;
+        for (size_t i = 0; i < n_var; i++)
         {
-            ry = A * w.x;
-            hresy = ry.norm();
-            ry -= w.tau * b;
+            const double hr = rx(i);
+            const double r = hr - w.tau * c(i);
+            rx(i) = r;
+            hresx_sq += hr * hr;
+            rx_sq += r * r;
+            cx += c(i) * w.x(i);
+            nx_sq += w.x(i) * w.x(i);
         }
-        else
+
+        /* ry = hry - tau * b, with ||hry||, ||ry||, b' * y and ||y|| */
+        double hresy_sq = 0., ry_sq = 0., by = 0., ny_sq = 0.;
+        for (size_t i = 0; i < n_eq; i++)
+        {
+            const double hr = ry(i);
+            const double r = hr - w.tau * b(i);
+            ry(i) = r;
+            hresy_sq += hr * hr;
+            ry_sq += r * r;
+            by += b(i) * w.y(i);
+            ny_sq += w.y(i) * w.y(i);
+        }
+
+        /* rz = hrz - tau * h, with ||hrz||, ||rz||, h' * z, ||z||, ||s|| and s' * z */
+        double hresz_sq = 0., rz_sq = 0., hz = 0., nz_sq = 0., ns_sq = 0., sz = 0.;
+        for (size_t i = 0; i < n_ineq; i++)
         {
-            hresy = 0.;
+            const double hr = rz(i);
+            const double r = hr - w.tau * h(i);
+            rz(i) = r;
+            hresz_sq += hr * hr;
+            rz_sq += r * r;
+            hz += h(i) * w.z(i);
+            nz_sq += w.z(i) * w.z(i);
+            ns_sq += w.s(i) * w.s(i);
+            sz += w.s(i) * w.z(i);
         }
 
-        /* rz = s + G * x - tau * h */
-        rz = w.s + G * w.x;
-        hresz = rz.norm();
-        rz -= w.tau * h;
+        hresx = std::sqrt(hresx_sq);
+        hresy = std::sqrt(hresy_sq);
+        hresz = std::sqrt(hresz_sq);
+        nrx = std::sqrt(rx_sq);
+        nry = std::sqrt(ry_sq);
+        nrz = std::sqrt(rz_sq);
 
         /* rt = kappa + c' * x + b' * y + h' * z; */
-        w.cx = c.dot(w.x);
-        w.by = n_eq > 0 ? b.dot(w.y) : 0.;
-        w.hz = h.dot(w.z);
+        w.cx = cx;
+        w.by = by;
+        w.hz = hz;
         rt = w.kap + w.cx + w.by + w.hz;
 
-        nx = w.x.norm();
-        ny = w.y.norm();
-        nz = w.z.norm();
-        ns = w.s.norm();
+        nx = std::sqrt(nx_sq);
+        ny = std::sqrt(ny_sq);
+        nz = std::sqrt(nz_sq);
+        ns = std::sqrt(ns_sq);
+        gap = sz;
     }
 
     void Solver::updateStatistics()
     {
-        w.i.gap = w.s.dot(w.z);
+        w.i.gap = gap;
         w.i.mu = (w.i.gap + w.kap * w.tau) / ((n_lc + n_sc) + 1);
         w.i.kapovert = w.kap / w.tau;
         w.i.pcost = w.cx / w.tau;
@@ -711,10 +870,10 @@ namespace EiCOS
         }
 
         /* Residuals */
-        const double nry = n_eq > 0 ? ry.norm() / std::max(resy0 + nx, 1.) : 0.;
-        const double nrz = rz.norm() / std::max(resz0 + nx + ns, 1.);
-        w.i.pres = std::max(nry, nrz) / w.tau;
-        w.i.dres = rx.norm() / std::max(resx0 + ny + nz, 1.) / w.tau;
+        const double pres_y = n_eq > 0 ? nry / std::max(resy0 + nx, 1.) : 0.;
+        const double pres_z = nrz / std::max(resz0 + nx + ns, 1.);
+        w.i.pres = std::max(pres_y, pres_z) / w.tau;
+        w.i.dres = nrx / std::max(resx0 + ny + nz, 1.) / w.tau;
 
         /* Infeasibility measures */
         if ((w.hz + w.by) / std::max(ny + nz, 1.) < -settings.reltol)
@@ -732,127 +891,162 @@ namespace EiCOS
 
         if (settings.verbose)
         {
-            const std::string line =
-                format("{:2d}  {:+5.3e}  {:+5.3e}  {:+2.0e}  {:2.0e}  {:2.0e}  {:2.0e}  {:2.0e}",
-                       w.i.iter, w.i.pcost, w.i.dcost, w.i.gap, w.i.pres, w.i.dres, w.i.kapovert, w.i.mu);
-
-            if (w.i.iter == 0)
-            {
-                print("It     pcost       dcost      gap   pres   dres    k/t    mu     step   sigma     IR\n");
-                print("{}    ---    ---   {:2d}/{:2d}  -\n", line, w.i.nitref1, w.i.nitref2);
-            }
-            else
-            {
-                print("{}  {:6.4f}  {:2.0e}  {:2d}/{:2d}/{:2d}\n",
-                      line,
-                      w.i.step, w.i.sigma,
-                      w.i.nitref1,
-                      w.i.nitref2,
-                      w.i.nitref3);
-            }
+            logIteration(settings, w.i);
         }
     }
 
-    /**
-     * Scales a conic variable such that it lies strictly in the cone.
-     * If it is already in the cone, r is simply copied to s.
-     * Otherwise s = r + (1 + alpha) * e where alpha is the biggest residual.
-     */
-    void Solver::bringToCone(const Eigen::VectorXd &r, Eigen::VectorXd &s)
+    std::string formatIteration(const Information &info)
     {
-        double alpha = -settings.gamma;
-
-        /* ===== 1. Find maximum residual ===== */
+        const std::string line =
+            format("{:2d}  {:+5.3e}  {:+5.3e}  {:+2.0e}  {:2.0e}  {:2.0e}  {:2.0e}  {:2.0e}",
+                   info.iter, info.pcost, info.dcost, info.gap, info.pres, info.dres, info.kapovert, info.mu);
 
-        /* LP cone */
-        for (size_t i = 0; i < n_lc; i++)
+        if (info.iter == 0)
         {
-            if (r(i) <= 0 and -r(i) > alpha)
-            {
-                alpha = -r(i);
-            }
+            return format("It     pcost       dcost      gap   pres   dres    k/t    mu     step   sigma     IR\n") +
+                   format("{}    ---    ---   {:2d}/{:2d}  -\n", line, info.nitref1, info.nitref2);
         }
-
-        /* SO cone */
-        size_t cone_start = n_lc;
-        for (const SOCone &sc : so_cones)
+        else
         {
-            const double cres = r(cone_start) -
-                                r.segment(cone_start + 1, sc.dim - 1).norm();
-            cone_start += sc.dim;
-
-            if (cres <= 0 and -cres > alpha)
-            {
-                alpha = -cres;
-            }
+            return format("{}  {:6.4f}  {:2.0e}  {:2d}/{:2d}/{:2d}\n",
+                          line,
+                          info.step, info.sigma,
+                          info.nitref1,
+                          info.nitref2,
+                          info.nitref3);
         }
+    }
 
-        /* ===== 2. Compute s = r + (1 + alpha) * e ===== */
-
-        alpha += 1.;
-
-        /* LP cone */
-        s = r;
-        s.head(n_lc).array() += alpha;
-
-        /* SO cone */
-        cone_start = n_lc;
-        for (const SOCone &sc : so_cones)
+    void logIteration(const Settings &settings, const Information &info)
+    {
+        if (settings.log_sink)
+        {
+            settings.log_sink->iteration(info);
+        }
+        else
         {
-            s(cone_start) += alpha;
-            cone_start += sc.dim;
+            print("{}", formatIteration(info));
         }
     }
 
-    void Solver::resetKKTScalings()
+    void logMessage(const Settings &settings, const std::string &text)
     {
-        size_t ptr_i = 0;
-
-        /* LP cone */
-        for (size_t k = 0; k < n_lc; k++)
+        if (settings.log_sink)
         {
-            *KKT_V_ptr[ptr_i++] = -1.;
+            settings.log_sink->message(text);
         }
-
-        /* SO cone */
-        for (const SOCone &sc : so_cones)
+        else
         {
-            /* D */
-            for (size_t k = 0; k < sc.dim; k++)
-            {
-                *KKT_V_ptr[ptr_i++] = -1.;
-            }
+            print("{}", text);
+        }
+    }
 
-            /* -1 on diagonal */
-            *KKT_V_ptr[ptr_i++] = -1.;
+    /**
+     * Scales a conic variable such that it lies strictly in the cone.
+     * If it is already in the cone, r is simply copied to s.
+     * Otherwise s = r + (1 + alpha) * e where alpha is the biggest residual.
+     */
+    void Solver::bringToCone(const Eigen::VectorXd &r, Eigen::VectorXd &s)
+    {
+        double alpha = -settings.gamma;
+
+        /* ===== 1. Find maximum residual ===== */
+        forEachConeGroup([&](auto &cones) { cones.maxResidual(r, alpha); });
+
+        /* ===== 2. Compute s = r + (1 + alpha) * e ===== */
+        alpha += 1.;
+        s = r;
+        forEachConeGroup([&](auto &cones) { cones.addIdentity(s, alpha); });
+    }
+
+
+    void Solver::resetKKTScalings()
+    {
+        double *const *ptr = KKT_V_ptr.data();
+        forEachConeGroup([&](auto &cones) { cones.resetKKTScalings(ptr); });
+        assert(ptr == KKT_V_ptr.data() + KKT_V_ptr.size());
+    }
 
-            /* -v */
-            for (size_t k = 1; k < sc.dim; k++)
-            {
-                *KKT_V_ptr[ptr_i++] = 0.;
-            }
 
-            /* 1 on diagonal */
-            *KKT_V_ptr[ptr_i++] = 1.;
+    /* Reports the solve, or the cache hit, to the metrics registry of the settings, if there is one */
+    exitcode Solver::solve(bool verbose)
+    {
+        statistics = SolveStatistics();
+        const auto t0 = std::chrono::steady_clock::now();
+
+        /*
+         * The data of matrix-free problems is not known, a pending initial point changes
+         * the iterates and a cancelled setup has no data, so these are always solved.
+         */
+        const bool cached = solution_cache and not(matrix_free or warm_start or setup_cancelled);
+        std::optional<SolutionKey> key;
+        std::shared_ptr<const CachedSolution> solution;
+        if (cached)
+        {
+            key = solutionKey();
+            solution = solution_cache->find(*key);
+        }
 
-            /* -u */
-            *KKT_V_ptr[ptr_i++] = 0.;
-            for (size_t k = 1; k < sc.dim; k++)
+        exitcode code;
+        if (solution)
+        {
+            settings.verbose = verbose;
+            w.x = solution->x;
+            w.y = solution->y;
+            w.z = solution->z;
+            w.s = solution->s;
+            w.i = solution->info;
+            code = solution->code;
+            if (verbose)
             {
-                *KKT_V_ptr[ptr_i++] = 0.;
+                logMessage(settings, "Solution taken from the cache.\n");
             }
         }
-        assert(ptr_i == KKT_V_ptr.size());
+        else
+        {
+            code = solveInteriorPoint(verbose);
+            if (cached and code != exitcode::interrupted and code != exitcode::fatal)
+            {
+                solution_cache->insert(*key, CachedSolution{code, w.i, w.x, w.y, w.z, w.s});
+            }
+        }
+
+        statistics.solve_time = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+        if (settings.metrics and solution)
+        {
+            settings.metrics->recordCacheHit();
+        }
+        else if (settings.metrics)
+        {
+            settings.metrics->record(code, w.i, statistics);
+        }
+        return code;
     }
 
-    exitcode Solver::solve(bool verbose)
+    exitcode Solver::solveInteriorPoint(bool verbose)
     {
+        const ThreadPool::Scope pool_scope(thread_pool.get());
+
         auto t0 = std::chrono::high_resolution_clock::now();
 
         settings.verbose = verbose;
         exitcode code = exitcode::fatal;
+        const bool fixed = settings.fixed_iters > 0;
+
+        if (setup_cancelled)
+        {
+            return exitcode::interrupted;
+        }
 
-        resetKKTScalings();
+        if (settings.decompose and not components.empty())
+        {
+            return solveDecomposed();
+        }
+
+        if (not matrix_free)
+        {
+            resetKKTScalings();
+        }
 
         /**
          * Set up first right hand side
@@ -864,15 +1058,7 @@ namespace EiCOS
          */
         rhs1.setZero();
         rhs1.segment(n_var, n_eq) = b;
-        rhs1.segment(n_var + n_eq, n_lc) = h.head(n_lc);
-        size_t h_index = n_lc;
-        size_t rhs1_index = n_var + n_eq + n_lc;
-        for (const SOCone &sc : so_cones)
-        {
-            rhs1.segment(rhs1_index, sc.dim) = h.segment(h_index, sc.dim);
-            h_index += sc.dim;
-            rhs1_index += sc.dim + 2;
-        }
+        forEachConeGroup([&](auto &cones) { cones.expand(h, rhs1.tail(dim_K - n_var - n_eq)); });
 
         /**
          * Set up second right hand side
@@ -893,83 +1079,104 @@ namespace EiCOS
         resy0 = std::max(1., scale_ry);
         resz0 = std::max(1., scale_rz);
 
-        /* Perform symbolic decomposition */
-        ldlt.analyzePattern(K);
-
-        /* Do LDLT factorization */
-        ldlt.factorize(K);
-        if (ldlt.info() != Eigen::Success)
+        if (not matrix_free)
         {
-            print_dbg("Failed to factorize matrix while initializing!\n");
-            return exitcode::fatal;
-        }
+            /* Perform symbolic decomposition, unless it was done during the setup */
+            if (not(kkt_kernel or arrow_ldlt or kkt_analyzed))
+            {
+                analyzeKKT();
+            }
 
-        /**
-         * Primal Variables:
-         * 
-         *  Solve 
-         * 
-         *  xhat = arg min ||Gx - h||_2^2  such that A * x = b
-         *  r = h - G * xhat
-         * 
-         * Equivalent to
-         *
-         * [ 0   A'  G' ] [ xhat ]     [ 0 ]
-         * [ A   0   0  ] [  y   ]  =  [ b ]
-         * [ G   0  -I  ] [ -r   ]     [ h ]
-         *
-         *        (  r                       if alphap < 0
-         * shat = < 
-         *        (  r + (1 + alphap) * e    otherwise
-         * 
-         * where alphap = inf{ alpha | r + alpha * e >= 0 }
-         */
+            /* Do LDLT factorization */
+            if (not factorizeKKT())
+            {
+                print_dbg("Failed to factorize matrix while initializing!\n");
+                return exitcode::fatal;
+            }
+        }
 
-        /* Solve for RHS [0; b; h] */
         Eigen::VectorXd dx1(n_var);
         Eigen::VectorXd dy1(n_eq);
         Eigen::VectorXd dz1(n_ineq);
-        print_dbg("Solving for RHS1.\n");
-        w.i.nitref1 = solveKKT(rhs1, dx1, dy1, dz1, true);
+        Eigen::VectorXd dx2(n_var);
+        Eigen::VectorXd dy2(n_eq);
+        Eigen::VectorXd dz2(n_ineq);
 
-        /* Copy out initial value of x */
-        w.x = dx1;
+        if (warm_start)
+        {
+            /* Start from the given point, moved strictly into the cone */
+            const Eigen::VectorXd s0 = w.s;
+            const Eigen::VectorXd z0 = w.z;
+            bringToCone(s0, w.s);
+            bringToCone(z0, w.z);
 
-        /* Copy out -r and bring to cone */
-        bringToCone(-dz1, w.s);
+            w.i.nitref1 = 0;
+            w.i.nitref2 = 0;
+            warm_start = false;
+        }
+        else
+        {
+            /**
+             * Primal Variables:
+             * 
+             *  Solve 
+             * 
+             *  xhat = arg min ||Gx - h||_2^2  such that A * x = b
+             *  r = h - G * xhat
+             * 
+             * Equivalent to
+             *
+             * [ 0   A'  G' ] [ xhat ]     [ 0 ]
+             * [ A   0   0  ] [  y   ]  =  [ b ]
+             * [ G   0  -I  ] [ -r   ]     [ h ]
+             *
+             *        (  r                       if alphap < 0
+             * shat = < 
+             *        (  r + (1 + alphap) * e    otherwise
+             * 
+             * where alphap = inf{ alpha | r + alpha * e >= 0 }
+             */
 
-        /**
-         * Dual Variables:
-         * 
-         * Solve 
-         * 
-         * (yhat, zbar) = arg min ||z||_2^2 such that G'*z + A'*y + c = 0
-         *
-         * Equivalent to
-         *
-         * [ 0   A'  G' ] [  x   ]     [ -c ]
-         * [ A   0   0  ] [ yhat ]  =  [  0 ]
-         * [ G   0  -I  ] [ zbar ]     [  0 ]
-         *     
-         *        (  zbar                       if alphad < 0
-         * zhat = < 
-         *        (  zbar + (1 + alphad) * e    otherwise
-         * 
-         * where alphad = inf{ alpha | zbar + alpha * e >= 0 }
-         */
+            /* Solve for RHS [0; b; h] */
+            print_dbg("Solving for RHS1.\n");
+            w.i.nitref1 = solveKKT(rhs1, dx1, dy1, dz1, true);
 
-        /* Solve for RHS [-c; 0; 0] */
-        Eigen::VectorXd dx2(n_var);
-        Eigen::VectorXd dy2(n_eq);
-        Eigen::VectorXd dz2(n_ineq);
-        print_dbg("Solving for RHS2.\n");
-        w.i.nitref2 = solveKKT(rhs2, dx2, dy2, dz2, true);
+            /* Copy out initial value of x */
+            w.x = dx1;
+
+            /* Copy out -r and bring to cone */
+            bringToCone(-dz1, w.s);
 
-        /* Copy out initial value of y */
-        w.y = dy2;
+            /**
+             * Dual Variables:
+             * 
+             * Solve 
+             * 
+             * (yhat, zbar) = arg min ||z||_2^2 such that G'*z + A'*y + c = 0
+             *
+             * Equivalent to
+             *
+             * [ 0   A'  G' ] [  x   ]     [ -c ]
+             * [ A   0   0  ] [ yhat ]  =  [  0 ]
+             * [ G   0  -I  ] [ zbar ]     [  0 ]
+             *     
+             *        (  zbar                       if alphad < 0
+             * zhat = < 
+             *        (  zbar + (1 + alphad) * e    otherwise
+             * 
+             * where alphad = inf{ alpha | zbar + alpha * e >= 0 }
+             */
 
-        /* Bring variable to cone */
-        bringToCone(dz2, w.z);
+            /* Solve for RHS [-c; 0; 0] */
+            print_dbg("Solving for RHS2.\n");
+            w.i.nitref2 = solveKKT(rhs2, dx2, dy2, dz2, true);
+
+            /* Copy out initial value of y */
+            w.y = dy2;
+
+            /* Bring variable to cone */
+            bringToCone(dz2, w.z);
+        }
 
         /**
          * Modify first right hand side
@@ -987,9 +1194,11 @@ namespace EiCOS
         w.i.step_aff = 0.;
         w.i.pinf = false;
         w.i.dinf = false;
-        w.i.iter_max = settings.iter_max;
+        w.i.iter_max = fixed ? settings.fixed_iters : settings.iter_max;
 
         double pres_prev = std::numeric_limits<double>::max();
+        bool converged = false;
+        bool factorization_failed = false;
 
         /* Main interior point loop */
         for (w.i.iter = 0; w.i.iter <= w.i.iter_max; w.i.iter++)
@@ -999,190 +1208,223 @@ namespace EiCOS
             updateStatistics();
 
             /**
-             *  SAFEGUARD: Backtrack to best previously seen iterate if
-             *
-             * - the update was bad such that the primal residual PRES has increased by a factor of SAFEGUARD, or
-             * - the gap became negative
-             *
-             * If the safeguard is activated, the solver tests if reduced precision has been reached, and reports
-             * accordingly. If not even reduced precision is reached, return the flag numerics.
+             * With a fixed number of iterations every solve does the same work. The first
+             * iterate that meets the exit conditions is kept, the iterations go on anyway.
              */
-            if (w.i.iter > 0 and
-                (w.i.pres > settings.safeguard * pres_prev or w.i.gap < 0.))
+            if (fixed)
             {
-                if (settings.verbose)
-                {
-                    print("Unreliable search direction detected, recovering best iterate ({}) and stopping.\n",
-                          w_best.i.iter);
-                }
-
-                /* Restore best iterate */
-                w = w_best;
-
-                /* Determine whether we have reached at least reduced accuracy */
-                code = checkExitConditions(true);
-
-                /* If not, exit anyways */
-                if (code == exitcode::not_converged_yet)
+                if (not converged)
                 {
-                    code = exitcode::numerics;
-
-                    if (settings.verbose)
+                    code = checkExitConditions(false);
+                    if (code != exitcode::not_converged_yet)
                     {
-                        print("\nNUMERICAL PROBLEMS (reached feastol={:3.1e}, reltol={:3.1e}, abstol={:3.1e}).",
-                              std::max(w.i.dres, w.i.pres), w.i.relgap.value_or(0.), w.i.gap);
+                        w_best = w;
+                        converged = true;
                     }
-                    break;
                 }
-                else
+                if (w.i.iter == w.i.iter_max)
                 {
                     break;
                 }
             }
-
-            pres_prev = w.i.pres;
-
-            /* Check termination criteria to full precision and exit if necessary */
-            code = checkExitConditions(false);
-
-            if (code == exitcode::not_converged_yet)
+            else
             {
                 /**
-                 * Full precision has not been reached yet. Check for two more cases of exit:
-                 *  (i) min step size, in which case we assume we won't make progress any more, and
-                 * (ii) maximum number of iterations reached
-                 * If these two are not fulfilled, another iteration will be made.
+                 *  SAFEGUARD: Backtrack to best previously seen iterate if
+                 *
+                 * - the update was bad such that the primal residual PRES has increased by a factor of SAFEGUARD, or
+                 * - the gap became negative
+                 *
+                 * If the safeguard is activated, the solver tests if reduced precision has been reached, and reports
+                 * accordingly. If not even reduced precision is reached, return the flag numerics.
                  */
-
-                /* Did the line search cock up? (zero step length) */
-                if (w.i.iter > 0 and w.i.step == settings.stepmin * settings.gamma)
+                if (w.i.iter > 0 and
+                    (w.i.pres > settings.safeguard * pres_prev or w.i.gap < 0.))
                 {
                     if (settings.verbose)
                     {
-                        print("No further progress possible, recovering best iterate ({}) and stopping.", w_best.i.iter);
+                        logMessage(settings, format("Unreliable search direction detected, recovering best iterate ({}) and stopping.\n",
+                                                    w_best.i.iter));
                     }
 
                     /* Restore best iterate */
                     w = w_best;
+                    statistics.fallbacks++;
 
-                    /* Determine whether we have reached reduced precision */
+                    /* Determine whether we have reached at least reduced accuracy */
                     code = checkExitConditions(true);
 
+                    /* If not, exit anyways */
                     if (code == exitcode::not_converged_yet)
                     {
                         code = exitcode::numerics;
+
                         if (settings.verbose)
                         {
-                            print("\nNUMERICAL PROBLEMS (reached feastol={:3.1e}, reltol={:3.1e}, abstol={:3.1e}).",
-                                  std::max(w.i.dres, w.i.pres), w.i.relgap.value_or(0.), w.i.gap);
+                            logMessage(settings, format("\nNUMERICAL PROBLEMS (reached feastol={:3.1e}, reltol={:3.1e}, abstol={:3.1e}).",
+                                                        std::max(w.i.dres, w.i.pres), w.i.relgap.value_or(0.), w.i.gap));
                         }
-                    }
-                    break;
-                }
-                /* maxit reached? */
-                else if (w.i.iter == w.i.iter_max)
-                {
-                    if (settings.verbose)
-                        print("\nMaximum number of iterations reached, ");
-
-                    /* Determine whether current iterate is better than what we had so far */
-                    if (w.i.isBetterThan(w_best.i))
-                    {
-                        if (settings.verbose)
-                            print("stopping.\n");
+                        break;
                     }
                     else
                     {
-                        if (settings.verbose)
-                            print("recovering best iterate ({}) and stopping.\n", w_best.i.iter);
-                        w = w_best;
+                        break;
                     }
+                }
 
-                    /* Determine whether we have reached reduced precision */
-                    code = checkExitConditions(true);
+                pres_prev = w.i.pres;
 
-                    if (code == exitcode::not_converged_yet)
-                    {
-                        code = exitcode::maxit;
-                    }
-                    break;
-                }
-                /* Stuck on NAN? */
-                else if (std::isnan(w.i.pcost))
-                {
-                    if (settings.verbose)
-                        print("\nReached NaN dead end, ");
+                /* Check termination criteria to full precision and exit if necessary */
+                code = checkExitConditions(false);
 
-                    /* Determine whether current iterate is better than what we had so far */
-                    if (w.i.iter == 0 or w.i.isBetterThan(w_best.i))
+                if (code == exitcode::not_converged_yet)
+                {
+                    /**
+                     * Full precision has not been reached yet. Check for two more cases of exit:
+                     *  (i) min step size, in which case we assume we won't make progress any more, and
+                     * (ii) maximum number of iterations reached
+                     * If these two are not fulfilled, another iteration will be made.
+                     */
+
+                    /* Did the line search cock up? (zero step length) */
+                    if (w.i.iter > 0 and w.i.step == settings.stepmin * settings.gamma)
                     {
                         if (settings.verbose)
-                            print("stopping.\n");
+                        {
+                            logMessage(settings, format("No further progress possible, recovering best iterate ({}) and stopping.", w_best.i.iter));
+                        }
+
+                        /* Restore best iterate */
+                        w = w_best;
+                        statistics.fallbacks++;
+
+                        /* Determine whether we have reached reduced precision */
+                        code = checkExitConditions(true);
+
+                        if (code == exitcode::not_converged_yet)
+                        {
+                            code = exitcode::numerics;
+                            if (settings.verbose)
+                            {
+                                logMessage(settings, format("\nNUMERICAL PROBLEMS (reached feastol={:3.1e}, reltol={:3.1e}, abstol={:3.1e}).",
+                                                            std::max(w.i.dres, w.i.pres), w.i.relgap.value_or(0.), w.i.gap));
+                            }
+                        }
+                        break;
                     }
-                    else
+                    /* maxit reached? */
+                    else if (w.i.iter == w.i.iter_max)
                     {
                         if (settings.verbose)
-                            print("recovering best iterate ({}) and stopping.\n", w_best.i.iter);
-                        w = w_best;
+                            logMessage(settings, format("\nMaximum number of iterations reached, "));
+
+                        /* Determine whether current iterate is better than what we had so far */
+                        if (w.i.isBetterThan(w_best.i))
+                        {
+                            if (settings.verbose)
+                                logMessage(settings, format("stopping.\n"));
+                        }
+                        else
+                        {
+                            if (settings.verbose)
+                                logMessage(settings, format("recovering best iterate ({}) and stopping.\n", w_best.i.iter));
+                            w = w_best;
+                            statistics.fallbacks++;
+                        }
 
                         /* Determine whether we have reached reduced precision */
                         code = checkExitConditions(true);
+
                         if (code == exitcode::not_converged_yet)
                         {
-                            code = exitcode::numerics;
-                            print("stopping without convergence.\n");
+                            code = exitcode::maxit;
+                        }
+                        break;
+                    }
+                    /* Stuck on NAN? */
+                    else if (std::isnan(w.i.pcost))
+                    {
+                        if (settings.verbose)
+                            logMessage(settings, format("\nReached NaN dead end, "));
+
+                        /* Determine whether current iterate is better than what we had so far */
+                        if (w.i.iter == 0 or w.i.isBetterThan(w_best.i))
+                        {
+                            if (settings.verbose)
+                                logMessage(settings, format("stopping.\n"));
                         }
+                        else
+                        {
+                            if (settings.verbose)
+                                logMessage(settings, format("recovering best iterate ({}) and stopping.\n", w_best.i.iter));
+                            w = w_best;
+                            statistics.fallbacks++;
+
+                            /* Determine whether we have reached reduced precision */
+                            code = checkExitConditions(true);
+                            if (code == exitcode::not_converged_yet)
+                            {
+                                code = exitcode::numerics;
+                                if (settings.verbose)
+                                    logMessage(settings, format("stopping without convergence.\n"));
+                            }
+                        }
+                        break;
                     }
+                }
+                else
+                {
+                    /* Full precision has been reached, stop solver */
                     break;
                 }
-            }
-            else
-            {
-                /* Full precision has been reached, stop solver */
-                break;
-            }
 
-            /**
-             * SAFEGUARD:
-             * Check whether current iterate is worth keeping as the best solution so far,
-             * before doing another iteration
-             */
-            if (w.i.iter == 0)
-            {
-                /* We're at the first iterate, so there's nothing to compare yet */
-                w_best = w;
-            }
-            else if (w.i.isBetterThan(w_best.i))
-            {
-                w_best = w;
+                /**
+                 * SAFEGUARD:
+                 * Check whether current iterate is worth keeping as the best solution so far,
+                 * before doing another iteration
+                 */
+                if (w.i.iter == 0)
+                {
+                    /* We're at the first iterate, so there's nothing to compare yet */
+                    w_best = w;
+                }
+                else if (w.i.isBetterThan(w_best.i))
+                {
+                    w_best = w;
+                }
             }
 
             updateScalings(w.s, w.z, w.lambda);
 
-            updateKKTScalings();
-
-            ldlt.factorize(K);
-
-            if (ldlt.info() != Eigen::Success)
+            if (not matrix_free)
             {
-                print_dbg("Failed to factorize matrix after update!\n");
-                return exitcode::fatal;
+                updateKKTScalings();
+
+                if (not factorizeKKT())
+                {
+                    print_dbg("Failed to factorize matrix after update!\n");
+                    if (not fixed)
+                    {
+                        return exitcode::fatal;
+                    }
+                    factorization_failed = true;
+                }
             }
 
             /* Solve for RHS1, which is used later also in combined direction */
             solveKKT(rhs1, dx1, dy1, dz1, false);
 
+            /* dtau_denom = kap / tau - (c' * x1 + b * y1 + h' * z1); */
+            const double dtau_denom = w.kap / w.tau - cdx - bdy - hdz;
+
             /* Affine Search Direction (predictor, need dsaff and dzaff only) */
             RHSaffine();
 
             print_dbg("Solving for affine search direction.\n");
             solveKKT(rhs2, dx2, dy2, dz2, false);
 
-            /* dtau_denom = kap / tau - (c' * x1 + b * y1 + h' * z1); */
-            const double dtau_denom = w.kap / w.tau - c.dot(dx1) - b.dot(dy1) - h.dot(dz1);
-
             /* dtauaff = (dt + c' * x2 + b * y2 + h' * z2) / dtau_denom; */
-            const double dtauaff = (rt - w.kap + c.dot(dx2) + b.dot(dy2) + h.dot(dz2)) / dtau_denom;
+            const double dtauaff = (rt - w.kap + cdx + bdy + hdz) / dtau_denom;
 
             /* dzaff = dz2 + dtau_aff * dz1 */
             /* Let dz2   = dzaff, use this in the linesearch for unsymmetric cones */
@@ -1209,13 +1451,13 @@ namespace EiCOS
             /* Combined search direction */
             RHScombined();
             print_dbg("Solving for combined search direction.\n");
-            w.i.nitref3 = solveKKT(rhs2, dx2, dy2, dz2, 0);
+            w.i.nitref3 = solveKKT(rhs2, dx2, dy2, dz2, false);
 
             /* bkap = kap * tau + dkapaff * dtauaff - sigma * w.i.mu; */
             const double bkap = w.kap * w.tau + dkapaff * dtauaff - sigma * w.i.mu;
 
             /* dtau = ((1 - sigma) * rt - bkap / tau + c' * x2 + by2 + h' * z2) / dtau_denom; */
-            const double dtau = ((1. - sigma) * rt - bkap / w.tau + c.dot(dx2) + b.dot(dy2) + h.dot(dz2)) / dtau_denom;
+            const double dtau = ((1. - sigma) * rt - bkap / w.tau + cdx + bdy + hdz) / dtau_denom;
 
             /**
              * dx = x2 + dtau * x1
@@ -1252,11 +1494,27 @@ namespace EiCOS
             w.tau += w.i.step * dtau;
         }
 
+        if (fixed)
+        {
+            if (converged)
+            {
+                w = w_best;
+            }
+            else
+            {
+                code = checkExitConditions(true);
+                if (code == exitcode::not_converged_yet)
+                {
+                    code = factorization_failed ? exitcode::numerics : exitcode::maxit;
+                }
+            }
+        }
+
         /* Scale variables back */
         backscale();
 
         if (settings.verbose)
-            print("Runtime: {}ms\n", std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - t0).count());
+            logMessage(settings, format("Runtime: {}ms\n", std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - t0).count()));
 
         return code;
     }
@@ -1267,13 +1525,14 @@ namespace EiCOS
      * y = y / tau
      * z = z / tau
      * s = s / tau
+     * and returns them in the order of the user data.
      */
     void Solver::backscale()
     {
-        w.x = w.x.cwiseQuotient(x_equil * w.tau);
-        w.y = w.y.cwiseQuotient(A_equil * w.tau);
-        w.z = w.z.cwiseQuotient(G_equil * w.tau);
-        w.s = w.s.cwiseProduct(G_equil / w.tau);
+        w.x = scatterUser(w.x.cwiseQuotient(x_equil * w.tau), var_order);
+        w.y = scatterUser(w.y.cwiseQuotient(A_equil * w.tau), eq_order);
+        w.z = scatterUser(w.z.cwiseQuotient(G_equil * w.tau), ineq_order);
+        w.s = scatterUser(w.s.cwiseProduct(G_equil / w.tau), ineq_order);
     }
 
     /**
@@ -1289,16 +1548,8 @@ namespace EiCOS
         conicProduct(dsaff_by_W, W_times_dzaff, ds2);
 
         const double sigmamu = w.i.sigma * w.i.mu;
-        ds1.head(n_lc) += ds2.head(n_lc);
-        ds1.head(n_lc).array() -= sigmamu;
-
-        size_t k = n_lc;
-        for (const SOCone &sc : so_cones)
-        {
-            ds1(k) -= sigmamu;
-            ds1.segment(k, sc.dim) += ds2.segment(k, sc.dim);
-            k += sc.dim;
-        }
+        forEachConeGroup([&](auto &cones) { cones.addIdentity(ds1, -sigmamu); });
+        ds1 += ds2;
 
         /* dz = -(1 - sigma) * rz + W * (lambda \ ds) */
         conicDivision(w.lambda, ds1, dsaff_by_W);
@@ -1308,20 +1559,8 @@ namespace EiCOS
         const double one_minus_sigma = 1. - w.i.sigma;
 
         rhs2.head(n_var + n_eq) *= one_minus_sigma;
-        rhs2.segment(n_var + n_eq, n_lc) = -one_minus_sigma * rz.head(n_lc) +
-                                           ds1.head(n_lc);
-        size_t rhs_index = n_var + n_eq + n_lc;
-        k = n_lc;
-        for (const SOCone &sc : so_cones)
-        {
-            rhs2.segment(rhs_index, sc.dim) = -one_minus_sigma * rz.segment(k, sc.dim) +
-                                              ds1.segment(k, sc.dim);
-            k += sc.dim;
-
-            rhs_index += sc.dim;
-            rhs2(rhs_index++) = 0.;
-            rhs2(rhs_index++) = 0.;
-        }
+        ds1 = -one_minus_sigma * rz + ds1;
+        forEachConeGroup([&](auto &cones) { cones.expand(ds1, rhs2.tail(dim_K - n_var - n_eq)); });
     }
 
     /**
@@ -1331,25 +1570,10 @@ namespace EiCOS
                                const Eigen::VectorXd &w,
                                Eigen::VectorXd &v)
     {
-        /* LP cone */
-        v.head(n_lc) = w.head(n_lc).cwiseQuotient(u.head(n_lc));
-
-        /* SO cone */
-        size_t cone_start = n_lc;
-        for (const SOCone &sc : so_cones)
-        {
-            const double u0 = u(cone_start);
-            const double w0 = w(cone_start);
-            const double rho = u0 * u0 - u.segment(cone_start + 1, sc.dim - 1).squaredNorm();
-            const double zeta = u.segment(cone_start + 1, sc.dim - 1).dot(w.segment(cone_start + 1, sc.dim - 1));
-            const double factor = (zeta / u0 - w0) / rho;
-            v(cone_start) = (u0 * w0 - zeta) / rho;
-            v.segment(cone_start + 1, sc.dim - 1) = factor * u.segment(cone_start + 1, sc.dim - 1) +
-                                                    w.segment(cone_start + 1, sc.dim - 1) / u0;
-            cone_start += sc.dim;
-        }
+        forEachConeGroup([&](auto &cones) { cones.conicDivision(u, w, v); });
     }
 
+
     /**
      * Conic product, implements the "o" operator, w = u o v
      * and returns e' * w (where e is the conic 1-vector)
@@ -1358,48 +1582,18 @@ namespace EiCOS
                                 const Eigen::VectorXd &v,
                                 Eigen::VectorXd &w)
     {
-        /* LP cone */
-        w.head(n_lc) = u.head(n_lc).cwiseProduct(v.head(n_lc));
-        double mu = w.head(n_lc).lpNorm<1>();
-
-        /* SO cone */
-        size_t cone_start = n_lc;
-        for (const SOCone &sc : so_cones)
-        {
-            const double u0 = u(cone_start);
-            const double v0 = v(cone_start);
-            w(cone_start) = u.segment(cone_start, sc.dim).dot(v.segment(cone_start, sc.dim));
-            mu += std::abs(w(cone_start));
-            w.segment(cone_start + 1, sc.dim - 1) = u0 * v.segment(cone_start + 1, sc.dim - 1) +
-                                                    v0 * u.segment(cone_start + 1, sc.dim - 1);
-            cone_start += sc.dim;
-        }
+        double mu = 0.;
+        forEachConeGroup([&](auto &cones) { cones.conicProduct(u, v, w, mu); });
         return mu;
     }
 
+
     double Solver::lineSearch(Eigen::VectorXd &lambda, Eigen::VectorXd &ds, Eigen::VectorXd &dz,
                               double tau, double dtau, double kap, double dkap)
     {
-        /* LP cone */
-        double alpha;
-        if (n_lc > 0)
-        {
-            const double rhomin = (ds.head(n_lc).cwiseQuotient(lambda.head(n_lc))).minCoeff();
-            const double sigmamin = (dz.head(n_lc).cwiseQuotient(lambda.head(n_lc))).minCoeff();
-            const double eps = 1e-13;
-            if (-sigmamin > -rhomin)
-            {
-                alpha = sigmamin < 0. ? 1. / (-sigmamin) : 1. / eps;
-            }
-            else
-            {
-                alpha = rhomin < 0. ? 1. / (-rhomin) : 1. / eps;
-            }
-        }
-        else
-        {
-            alpha = 10.;
-        }
+        /* Largest step that keeps every cone, 10 if none is blocking */
+        double alpha = 10.;
+        forEachConeGroup([&](auto &cones) { cones.stepLength(lambda, ds, dz, alpha); });
 
         /* tau and kappa */
         const double minus_tau_by_dtau = -tau / dtau;
@@ -1413,59 +1607,84 @@ namespace EiCOS
             alpha = minus_kap_by_dkap;
         }
 
-        /* SO cone */
-        size_t cone_start = n_lc;
-        for (const SOCone &sc : so_cones)
-        {
-            /* Normalize */
-            const double lknorm2 = std::pow(lambda(cone_start), 2) -
-                                   lambda.segment(cone_start + 1, sc.dim - 1).squaredNorm();
-            if (lknorm2 <= 0.)
-                continue;
-
-            const double lknorm = std::sqrt(lknorm2);
-            const Eigen::VectorXd lkbar = lambda.segment(cone_start, sc.dim) / lknorm;
+        /* Saturate between stepmin and stepmax */
+        alpha = std::clamp(alpha, settings.stepmin, settings.stepmax);
 
-            const double lknorminv = 1. / lknorm;
+        return alpha;
+    }
 
-            /* Calculate products */
-            const double lkbar_times_dsk = lkbar(0) * ds(cone_start) -
-                                           lkbar.segment(1, sc.dim - 1).dot(ds.segment(cone_start + 1, sc.dim - 1));
-            const double lkbar_times_dzk = lkbar(0) * dz(cone_start) -
-                                           lkbar.segment(1, sc.dim - 1).dot(dz.segment(cone_start + 1, sc.dim - 1));
+    uint64_t Solver::structureFingerprint() const
+    {
+        std::vector<size_t> cone_dims;
+        for (const SOCone &sc : so_cones)
+        {
+            cone_dims.push_back(sc.dim);
+        }
+        return kktFingerprint(K, n_var, n_eq, n_lc, cone_dims);
+    }
 
-            /* Now construct rhok and sigmak, the first element is different */
-            double factor;
+    /**
+     * Symbolic analysis of K, taken from the cache if a problem
+     * with the same structure has been analyzed before.
+     */
+    void Solver::analyzeKKT()
+    {
+        const uint64_t fingerprint = structureFingerprint();
 
-            Eigen::VectorXd rho(sc.dim);
-            rho(0) = lknorminv * lkbar_times_dsk;
-            factor = (lkbar_times_dsk + ds(cone_start)) / (lkbar(0) + 1.);
-            rho.tail(sc.dim - 1) = lknorminv * (ds.segment(cone_start + 1, sc.dim - 1) -
-                                                factor * lkbar.segment(1, sc.dim - 1));
-            const double rhonorm = rho.tail(sc.dim - 1).norm() - rho(0);
+        SymbolicCache &cache = SymbolicCache::global();
+        if (const auto analysis = cache.find(fingerprint, K.rows()))
+        {
+            ldlt.setSymbolic(K, *analysis);
+        }
+        else
+        {
+            ldlt.analyzePattern(K);
+            cache.insert(fingerprint, ldlt.symbolic());
+        }
+        kkt_analyzed = true;
+    }
 
-            Eigen::VectorXd sigma(sc.dim);
-            sigma(0) = lknorminv * lkbar_times_dzk;
-            factor = (lkbar_times_dzk + dz(cone_start)) / (lkbar(0) + 1.);
-            sigma.tail(sc.dim - 1) = lknorminv * (dz.segment(cone_start + 1, sc.dim - 1) -
-                                                  factor * lkbar.segment(1, sc.dim - 1));
-            const double sigmanorm = sigma.tail(sc.dim - 1).norm() - sigma(0);
+    /**
+     * Numeric factorization of K, with the generated kernel or the block structure if one is set.
+     */
+    bool Solver::factorizeKKT()
+    {
+        const auto t0 = std::chrono::steady_clock::now();
 
-            /* Update alpha */
-            const double conic_step = std::max({0., sigmanorm, rhonorm});
+        bool success;
+        if (kkt_kernel)
+        {
+            success = kkt_kernel->factor(K.valuePtr());
+        }
+        else if (arrow_ldlt)
+        {
+            success = arrow_ldlt->factorize(K);
+        }
+        else
+        {
+            statistics.regularized_pivots += ldlt.factorizeRegularized(K, K_signs, settings.eps, settings.delta);
+            success = ldlt.info() == Eigen::Success;
+        }
 
-            if (conic_step != 0.)
-            {
-                alpha = std::min(1. / conic_step, alpha);
-            }
+        statistics.factorizations++;
+        statistics.factor_time += std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+        return success;
+    }
 
-            cone_start += sc.dim;
+    Eigen::VectorXd Solver::solveFactorized(const Eigen::VectorXd &rhs) const
+    {
+        if (kkt_kernel)
+        {
+            Eigen::VectorXd x = rhs;
+            kkt_kernel->solve(x.data());
+            return x;
+        }
+        if (arrow_ldlt)
+        {
+            return arrow_ldlt->solve(rhs);
         }
 
-        /* Saturate between stepmin and stepmax */
-        alpha = std::clamp(alpha, settings.stepmin, settings.stepmax);
-
-        return alpha;
+        return ldlt.solve(rhs);
     }
 
     size_t Solver::solveKKT(const Eigen::VectorXd &rhs, // dim_K
@@ -1474,14 +1693,23 @@ namespace EiCOS
                             Eigen::VectorXd &dz,        // n_ineq
                             bool initialize)
     {
-        Eigen::VectorXd x = ldlt.solve(rhs);
+        if (matrix_free)
+        {
+            const size_t k_ref = solveNormalEquations(rhs, dx, dy, dz, initialize);
+            cdx = c.dot(dx);
+            bdy = b.dot(dy);
+            hdz = h.dot(dz);
+            return k_ref;
+        }
+
+        Eigen::VectorXd x = solveFactorized(rhs);
 
         const double error_threshold = (1. + rhs.lpNorm<Eigen::Infinity>()) * settings.linsysacc;
 
         double nerr_prev = std::numeric_limits<double>::max(); // Previous refinement error
         Eigen::VectorXd dx_ref(dim_K);                         // Refinement vector
 
-        const size_t mtilde = n_ineq + 2 * so_cones.size(); // Size of expanded cone block
+        const size_t mtilde = dim_K - n_var - n_eq; // Size of expanded cone block
 
         const Eigen::VectorXd &bx = rhs.head(n_var);
         const Eigen::VectorXd &by = rhs.segment(n_var, n_eq);
@@ -1490,32 +1718,26 @@ namespace EiCOS
         print_dbg("IR: it  ||ex||   ||ey||   ||ez|| (threshold: {:2.3e})\n", error_threshold);
         print_dbg("    --------------------------------------------------\n");
 
-        /* Iterative refinement */
+        /* Iterative refinement, a fixed number of steps with fixed_iters */
+        const bool fixed = settings.fixed_iters > 0;
+        const size_t nitref = fixed ? settings.fixed_nitref : settings.nitref;
         size_t k_ref;
-        for (k_ref = 0; k_ref <= settings.nitref; k_ref++)
+        for (k_ref = 0; k_ref <= nitref; k_ref++)
         {
             /* Copy solution into arrays */
             const Eigen::VectorXd &dx = x.head(n_var);
             const Eigen::VectorXd &dy = x.segment(n_var, n_eq);
-            dz.head(n_lc) = x.segment(n_var + n_eq, n_lc);
-            size_t dz_index = n_lc;
-            size_t x_index = n_var + n_eq + n_lc;
-            for (const SOCone &sc : so_cones)
-            {
-                dz.segment(dz_index, sc.dim) = x.segment(x_index, sc.dim);
-                dz_index += sc.dim;
-                x_index += sc.dim + 2;
-            }
-            assert(dz_index == n_ineq and x_index == dim_K);
+            forEachConeGroup([&](auto &cones) { cones.compress(x.tail(mtilde), dz); });
 
             /* Compute error term */
 
             /* Error on dx */
             /* ex = bx - A' * dy - G' * dz */
-            Eigen::VectorXd ex = bx - Gt * dz;
+            Eigen::VectorXd ex = bx;
+            productGt(dz, ex, -1.);
             if (n_eq > 0)
             {
-                ex -= At * dy;
+                productAt(dy, ex, -1.);
             }
             ex -= settings.deltastat * dx;
             const double nex = ex.lpNorm<Eigen::Infinity>();
@@ -1525,35 +1747,20 @@ namespace EiCOS
             Eigen::VectorXd ey = by;
             if (n_eq > 0)
             {
-                ey -= A * dx;
+                productA(dx, ey, -1.);
             }
             ey += settings.deltastat * dy;
             const double ney = ey.lpNorm<Eigen::Infinity>();
 
             /* Error on ez */
             /* ez = bz - G * dx + V * dz_true */
-            Eigen::VectorXd Gdx = G * dx;
+            Eigen::VectorXd Gdx = Eigen::VectorXd::Zero(n_ineq);
+            productG(dx, Gdx);
 
-            /* LP cone */
             Eigen::VectorXd ez(mtilde);
-            ez.head(n_lc) = bz.head(n_lc) - Gdx.head(n_lc) +
-                            settings.deltastat * dz.head(n_lc);
-
-            /* SO cone */
-            size_t ez_index = n_lc;
-            dz_index = n_lc;
-            for (const SOCone &sc : so_cones)
-            {
-                ez.segment(ez_index, sc.dim) = bz.segment(ez_index, sc.dim) -
-                                               Gdx.segment(dz_index, sc.dim);
-                ez.segment(ez_index, sc.dim - 1) += settings.deltastat * dz.segment(dz_index, sc.dim - 1);
-                dz_index += sc.dim;
-                ez_index += sc.dim;
-                ez(ez_index - 1) -= settings.deltastat * dz(dz_index - 1);
-                ez(ez_index++) = 0.;
-                ez(ez_index++) = 0.;
-            }
-            assert(ez_index == mtilde and dz_index == n_ineq);
+            forEachConeGroup([&](auto &cones) {
+                cones.refinementResidual(bz, Gdx, dz, settings.deltastat, ez);
+            });
 
             const Eigen::VectorXd &dz_true = x.tail(mtilde);
             if (initialize)
@@ -1575,47 +1782,64 @@ namespace EiCOS
                 nerr = std::max(nerr, ney);
             }
 
-            /* Check whether refinement brought decrease */
-            if (k_ref > 0 and nerr > nerr_prev)
+            if (fixed)
             {
-                /* If not, undo and quit */
-                x -= dx_ref;
-                k_ref--;
-                break;
+                if (k_ref == nitref)
+                {
+                    break;
+                }
             }
-
-            /* Check whether to stop refining */
-            if (k_ref == settings.nitref or
-                (nerr < error_threshold) or
-                (k_ref > 0 and nerr_prev < settings.irerrfact * nerr))
+            else
             {
-                break;
+                /* Check whether refinement brought decrease */
+                if (k_ref > 0 and nerr > nerr_prev)
+                {
+                    /* If not, undo and quit */
+                    x -= dx_ref;
+                    k_ref--;
+                    break;
+                }
+
+                /* Check whether to stop refining */
+                if (k_ref == nitref or
+                    (nerr < error_threshold) or
+                    (k_ref > 0 and nerr_prev < settings.irerrfact * nerr))
+                {
+                    break;
+                }
             }
             nerr_prev = nerr;
 
             /* Solve for refinement */
             Eigen::VectorXd e(dim_K);
             e << ex, ey, ez;
-            dx_ref = ldlt.solve(e);
+            dx_ref = solveFactorized(e);
 
             /* Add refinement to x */
             x += dx_ref;
         }
 
-        /* Copy solution into arrays */
-        dx = x.head(n_var);
-        dy = x.segment(n_var, n_eq);
-        dz.head(n_lc) = x.segment(n_var + n_eq, n_lc);
-        size_t dz_index = n_lc;
-        size_t x_index = n_var + n_eq + n_lc;
-        for (const SOCone &sc : so_cones)
+        /* Copy solution into arrays, with c' * dx, b' * dy and h' * dz on the way */
+        cdx = 0.;
+        bdy = 0.;
+        hdz = 0.;
+        for (size_t i = 0; i < n_var; i++)
+        {
+            dx(i) = x(i);
+            cdx += c(i) * dx(i);
+        }
+        for (size_t i = 0; i < n_eq; i++)
         {
-            dz.segment(dz_index, sc.dim) = x.segment(x_index, sc.dim);
-            dz_index += sc.dim;
-            x_index += sc.dim + 2;
+            dy(i) = x(n_var + i);
+            bdy += b(i) * dy(i);
+        }
+        forEachConeGroup([&](auto &cones) { cones.compress(x.tail(mtilde), dz); });
+        for (size_t i = 0; i < n_ineq; i++)
+        {
+            hdz += h(i) * dz(i);
         }
-        assert(dz_index == n_ineq and x_index == dim_K);
 
+        statistics.refinement_steps += k_ref;
         return k_ref;
     }
 
@@ -1628,39 +1852,10 @@ namespace EiCOS
      */
     void Solver::scale2add(const Eigen::VectorXd &x, Eigen::VectorXd &y)
     {
-        /* LP cone */
-        y.head(n_lc) += lp_cone.v.cwiseProduct(x.head(n_lc));
-
-        /* SO cone */
-        size_t cone_start = n_lc;
-        for (const SOCone &sc : so_cones)
-        {
-            const size_t i1 = cone_start;
-            const size_t i2 = i1 + 1;
-            const size_t i3 = i2 + sc.dim - 1;
-            const size_t i4 = i3 + 1;
-
-            /* y1 += d1 * x1 + u0 * x4 */
-            y(i1) += sc.eta_square * (sc.d1 * x(i1) + sc.u0 * x(i4));
-
-            /* y2 += x2 + v1 * q * x3 + u1 * q * x4 */
-            const double v1x3_plus_u1x4 = sc.v1 * x(i3) + sc.u1 * x(i4);
-            y.segment(i2, sc.dim - 1) += sc.eta_square * (x.segment(i2, sc.dim - 1) +
-                                                          v1x3_plus_u1x4 * sc.q);
-
-            const double qtx2 = sc.q.dot(x.segment(i2, sc.dim - 1));
-
-            /* y3 += v1 * q' * x2 + x3 */
-            y(i3) += sc.eta_square * (sc.v1 * qtx2 + x(i3));
-
-            /* y4 += u0 * x1 + u1 * q' * x2 - x4 */
-            y(i4) = sc.eta_square * (sc.u0 * x(i1) + sc.u1 * qtx2 - x(i4));
-
-            /* prepare index for next cone */
-            cone_start += sc.dim + 2;
-        }
+        forEachConeGroup([&](auto &cones) { cones.scale2add(x, y); });
     }
 
+
     /**
      * Prepares the affine RHS for KKT system.
      * Given the special way we store the KKT matrix (sparse representation
@@ -1669,68 +1864,27 @@ namespace EiCOS
      */
     void Solver::RHSaffine()
     {
-        /* LP cone */
         rhs2.head(n_var + n_eq) << rx, -ry;
 
-        /* SO cone */
-        rhs2.segment(n_var + n_eq, n_lc) = w.s.head(n_lc) - rz.head(n_lc);
-        size_t rhs_index = n_var + n_eq + n_lc;
-        size_t rz_index = n_lc;
-        for (const SOCone &sc : so_cones)
-        {
-            rhs2.segment(rhs_index, sc.dim) =
-                w.s.segment(rz_index, sc.dim) - rz.segment(rz_index, sc.dim);
-            rz_index += sc.dim;
-
-            rhs_index += sc.dim;
-            rhs2.segment(rhs_index, 2).setZero();
-            rhs_index += 2;
-        }
+        /* Cones */
+        const Eigen::VectorXd s_minus_rz = w.s - rz;
+        forEachConeGroup([&](auto &cones) { cones.expand(s_minus_rz, rhs2.tail(dim_K - n_var - n_eq)); });
     }
 
     void Solver::updateKKTScalings()
     {
-        size_t ptr_i = 0;
-
-        /* LP cone */
-        for (size_t k = 0; k < n_lc; k++)
-        {
-            *KKT_V_ptr[ptr_i++] = -lp_cone.v(k) - settings.deltastat;
-        }
-
-        /* SO cone */
-        for (const SOCone &sc : so_cones)
-        {
-            /* D */
-            *KKT_V_ptr[ptr_i++] = -sc.eta_square * sc.d1 - settings.deltastat;
-
-            for (size_t k = 1; k < sc.dim; k++)
-            {
-                *KKT_V_ptr[ptr_i++] = -sc.eta_square - settings.deltastat;
-            }
-
-            /* diagonal */
-            *KKT_V_ptr[ptr_i++] = -sc.eta_square;
-
-            /* v */
-            for (size_t k = 1; k < sc.dim; k++)
-            {
-                *KKT_V_ptr[ptr_i++] = -sc.eta_square * sc.v1 * sc.q(k - 1);
-            }
-
-            /* diagonal */
-            *KKT_V_ptr[ptr_i++] = sc.eta_square + settings.deltastat;
-
-            /* u */
-            *KKT_V_ptr[ptr_i++] = -sc.eta_square * sc.u0;
-            for (size_t k = 1; k < sc.dim; k++)
-            {
-                *KKT_V_ptr[ptr_i++] = -sc.eta_square * sc.u1 * sc.q(k - 1);
-            }
-        }
-        assert(ptr_i == KKT_V_ptr.size());
+        double *const *ptr = KKT_V_ptr.data();
+        forEachConeGroup([&](auto &cones) { cones.updateKKTScalings(ptr, settings.deltastat); });
+        assert(ptr == KKT_V_ptr.data() + KKT_V_ptr.size());
     }
 
+
+    /**
+     * The columns of K are assembled directly in compressed form. The number of
+     * entries of every column is known from the row indices of A and G, so the
+     * entries are placed by a counting sort and the rows of A and G are copied
+     * in parallel. The diagonal is the last entry of every column.
+     */
     void Solver::setupKKT()
     {
         /**
@@ -1747,142 +1901,94 @@ namespace EiCOS
         K.resize(dim_K, dim_K);
 
         /* Number of non-zeros in KKT matrix */
-        size_t K_nonzeros = At.nonZeros() + Gt.nonZeros();
+        size_t K_nonzeros = A.nonZeros() + G.nonZeros();
         /* Static regularization */
         K_nonzeros += n_var + n_eq;
-        /* Linear part of scaling block V */
-        K_nonzeros += n_lc;
-        for (const SOCone &sc : so_cones)
-        {
-            /* SOC part of scaling block V */
-            K_nonzeros += 3 * sc.dim + 1;
-        }
-        K.reserve(K_nonzeros);
+        /* Scaling block V */
+        forEachConeGroup([&](auto &cones) { K_nonzeros += cones.scalingEntries(); });
 
-        std::vector<Eigen::Triplet<double>> K_triplets;
-        K_triplets.reserve(K_nonzeros);
+        /* Column of K for every row of G, each cone is followed by its expansion columns */
+        std::vector<int> G_row_col(n_ineq);
+        forEachConeGroup([&](auto &cones) { cones.mapRows(n_var + n_eq, G_row_col); });
 
-        /* I (1,1) Static regularization */
-        for (size_t k = 0; k < n_var; k++)
+        /* Count the entries of every column */
+        int *outer = K.outerIndexPtr();
+        std::fill(outer, outer + dim_K + 1, 0);
+        for (size_t col = 0; col < n_var; col++)
         {
-            K_triplets.emplace_back(k, k, settings.deltastat);
+            outer[col + 1] = 1;
         }
-        /* I (2,2) Static regularization */
-        for (size_t k = n_var; k < n_var + n_eq; k++)
+        for (size_t row = 0; row < n_eq; row++)
         {
-            K_triplets.emplace_back(k, k, -settings.deltastat);
+            outer[n_var + row + 1] = A_csr.outerIndexPtr()[row + 1] - A_csr.outerIndexPtr()[row] + 1;
         }
-
-        size_t col_K = n_var;
-
-        /* A' (1,2) */
-        for (int col = 0; col < At.cols(); col++)
+        for (size_t row = 0; row < n_ineq; row++)
         {
-            for (Eigen::SparseMatrix<double>::InnerIterator it(At, col); it; ++it)
-            {
-                K_triplets.emplace_back(it.row(), A.cols() + col, it.value());
-            }
-            col_K++;
+            outer[G_row_col[row] + 1] = G_csr.outerIndexPtr()[row + 1] - G_csr.outerIndexPtr()[row] + 1;
+        }
+        forEachConeGroup([&](auto &cones) { cones.countKKTColumns(outer, n_var + n_eq); });
+        for (size_t col = 0; col < dim_K; col++)
+        {
+            outer[col + 1] += outer[col];
         }
+        assert(size_t(outer[dim_K]) == K_nonzeros);
 
-        /* G' (1,3) */
+        K.resizeNonZeros(K_nonzeros);
+        int *inner = K.innerIndexPtr();
+        double *values = K.valuePtr();
+
+        /* I (1,1) Static regularization */
+        for (size_t col = 0; col < n_var; col++)
         {
-            size_t col_Gt = 0;
+            inner[outer[col]] = col;
+            values[outer[col]] = settings.deltastat;
+        }
 
-            /* Linear block */
-            for (size_t col = 0; col < n_lc; col++)
+        /**
+         * A' (1,2) with the static regularization of (2,2) and G' (1,3) with the
+         * first identity blocks of -V. The pointers for fast updates of A and G
+         * follow the order of the rows.
+         */
+        KKT_AG_ptr.resize(A.nonZeros() + G.nonZeros());
+        auto copyRow = [&](const SparseRows &rows, const Eigen::SparseMatrix<double> &M,
+                           size_t row, size_t col, double diagonal, size_t ptr_i) {
+            int k = outer[col];
+            for (SparseRows::InnerIterator it(rows, M, row); it; ++it)
             {
-                for (Eigen::SparseMatrix<double>::InnerIterator it(Gt, col_Gt); it; ++it)
-                {
-                    K_triplets.emplace_back(it.row(), col_K, it.value());
-                }
-                col_Gt++;
-                col_K++;
+                inner[k] = it.col();
+                values[k] = it.value();
+                KKT_AG_ptr[ptr_i++] = &values[k];
+                k++;
             }
-
-            /* SOC blocks */
-            for (const SOCone &sc : so_cones)
+            inner[k] = col;
+            values[k] = diagonal;
+        };
+        const size_t n_parts = threadParts(K_nonzeros);
+        const RowPartition A_parts = partitionRows(A_csr, n_parts);
+        const RowPartition G_parts = partitionRows(G_csr, n_parts);
+        parallelFor(A_parts.size() - 1, [&](size_t part) {
+            for (Eigen::Index row = A_parts[part]; row < A_parts[part + 1]; row++)
             {
-                for (size_t col = 0; col < sc.dim; col++)
-                {
-                    for (Eigen::SparseMatrix<double>::InnerIterator it(Gt, col_Gt); it; ++it)
-                    {
-                        K_triplets.emplace_back(it.row(), col_K, it.value());
-                    }
-                    col_Gt++;
-                    col_K++;
-                }
-                col_K += 2;
+                copyRow(A_csr, A, row, n_var + row, -settings.deltastat, A_csr.outerIndexPtr()[row]);
             }
-            assert(col_K == size_t(K.cols()));
-            assert(col_Gt == size_t(Gt.cols()));
-        }
-
-        /* -V (3,3) */
-        {
-            size_t diag_idx = n_var + n_eq;
-
-            /* First identity block */
-            for (size_t k = 0; k < n_lc; k++)
+        });
+        parallelFor(G_parts.size() - 1, [&](size_t part) {
+            for (Eigen::Index row = G_parts[part]; row < G_parts[part + 1]; row++)
             {
-                K_triplets.emplace_back(diag_idx, diag_idx, -1.);
-                diag_idx++;
+                copyRow(G_csr, G, row, G_row_col[row], -1., A.nonZeros() + G_csr.outerIndexPtr()[row]);
             }
+        });
 
-            /* SOC blocks */
-            /**
-             * The scaling matrix has the following structure:
-             *
-             *    [ 1                * ]
-             *    [   1           *  * ]
-             *    [     .         *  * ]      
-             *    [       .       *  * ]       [ D   v   u ]      D: Identity of size conesize       
-             *  - [         .     *  * ]  =  - [ u'  1   0 ]      v: Vector of size conesize - 1      
-             *    [           1   *  * ]       [ v'  0' -1 ]      u: Vector of size conesize    
-             *    [             1 *  * ]
-             *    [   * * * * * * 1    ]
-             *    [ * * * * * * *   -1 ]
-             *
-             *  Only the upper triangular part is constructed here.
-             */
-            for (const SOCone &sc : so_cones)
-            {
-                /* D */
-                for (size_t k = 0; k < sc.dim; k++)
-                {
-                    K_triplets.emplace_back(diag_idx, diag_idx, -1.);
-                    diag_idx++;
-                }
+        /* Expansion columns of the cones */
+        forEachConeGroup([&](auto &cones) { cones.fillKKTColumns(K, n_var + n_eq); });
 
-                /* -1 on diagonal */
-                K_triplets.emplace_back(diag_idx, diag_idx, -1.);
-
-                /* -v */
-                for (size_t k = 1; k < sc.dim; k++)
-                {
-                    K_triplets.emplace_back(diag_idx - sc.dim + k, diag_idx, 0.);
-                }
-                diag_idx++;
-
-                /* 1 on diagonal */
-                K_triplets.emplace_back(diag_idx, diag_idx, 1.);
-
-                /* -u */
-                for (size_t k = 0; k < sc.dim; k++)
-                {
-                    K_triplets.emplace_back(diag_idx - sc.dim - 1 + k, diag_idx, 0.);
-                }
-                diag_idx++;
-            }
-            assert(diag_idx == dim_K);
+        /* Signs of the pivots, those of the diagonal before the first scaling, the last entry of every column */
+        K_signs.resize(dim_K);
+        for (size_t col = 0; col < dim_K; col++)
+        {
+            K_signs[col] = values[outer[col + 1] - 1] > 0. ? 1 : -1;
         }
 
-        assert(size_t(K_triplets.size()) == K_nonzeros);
-
-        K.setFromTriplets(K_triplets.begin(), K_triplets.end());
-
-        assert(size_t(K.nonZeros()) == K_nonzeros);
-
         print_dbg("Dimension of KKT matrix: {}\n", dim_K);
         print_dbg("Non-zeros in KKT matrix: {}\n", K.nonZeros());
 
@@ -1890,141 +1996,35 @@ namespace EiCOS
     }
 
     /**
-     * Save pointers for fast access
+     * Save pointers to the scaling block for fast access,
+     * the diagonal is the last entry of every column
      */
     void Solver::cacheIndices()
     {
-        /* A AND G MATRICES */
-
-        size_t col_K = n_var;
-
-        /* A' (1,2) */
-        for (int col = 0; col < At.cols(); col++)
-        {
-            for (Eigen::SparseMatrix<double>::InnerIterator it(At, col); it; ++it)
-            {
-                KKT_AG_ptr.push_back(&K.coeffRef(it.row(), col_K));
-            }
-            col_K++;
-        }
-
-        /* G' (1,3) */
-        {
-            size_t col_Gt = 0;
-
-            /* Linear block */
-            for (size_t col = 0; col < n_lc; col++)
-            {
-                for (Eigen::SparseMatrix<double>::InnerIterator it(Gt, col_Gt); it; ++it)
-                {
-                    KKT_AG_ptr.push_back(&K.coeffRef(it.row(), col_K));
-                }
-                col_Gt++;
-                col_K++;
-            }
-
-            /* SOC blocks */
-            for (const SOCone &sc : so_cones)
-            {
-                for (size_t col = 0; col < sc.dim; col++)
-                {
-                    for (Eigen::SparseMatrix<double>::InnerIterator it(Gt, col_Gt); it; ++it)
-                    {
-                        KKT_AG_ptr.push_back(&K.coeffRef(it.row(), col_K));
-                    }
-                    col_Gt++;
-                    col_K++;
-                }
-                col_K += 2;
-            }
-            assert(col_K == size_t(K.cols()));
-            assert(col_Gt == size_t(Gt.cols()));
-        }
-
-        /* SCALING AND RESIDUALS -V (3,3) */
-
-        /* LP cone */
-        size_t diag_idx = n_var + n_eq;
-        for (size_t k = 0; k < n_lc; k++)
-        {
-            KKT_V_ptr.push_back(&K.coeffRef(diag_idx, diag_idx));
-            diag_idx++;
-        }
-
-        /* SO cone */
-        for (const SOCone &sc : so_cones)
-        {
-            /* D */
-            KKT_V_ptr.push_back(&K.coeffRef(diag_idx, diag_idx));
-            diag_idx++;
-            for (size_t k = 1; k < sc.dim; k++)
-            {
-                KKT_V_ptr.push_back(&K.coeffRef(diag_idx, diag_idx));
-                diag_idx++;
-            }
-
-            /* diagonal */
-            KKT_V_ptr.push_back(&K.coeffRef(diag_idx, diag_idx));
-
-            /* v */
-            for (size_t k = 1; k < sc.dim; k++)
-            {
-                KKT_V_ptr.push_back(&K.coeffRef(diag_idx - sc.dim + k, diag_idx));
-            }
-            diag_idx++;
-
-            /* diagonal */
-            KKT_V_ptr.push_back(&K.coeffRef(diag_idx, diag_idx));
-
-            /* u */
-            KKT_V_ptr.push_back(&K.coeffRef(diag_idx - sc.dim - 1, diag_idx));
-            for (size_t k = 1; k < sc.dim; k++)
-            {
-                KKT_V_ptr.push_back(&K.coeffRef(diag_idx - sc.dim - 1 + k, diag_idx));
-            }
-            diag_idx++;
-        }
-        assert(diag_idx == dim_K);
+        KKT_V_ptr.clear();
+        forEachConeGroup([&](auto &cones) { cones.cacheScalings(K, n_var + n_eq, KKT_V_ptr); });
     }
 
+
     void Solver::updateKKTAG()
     {
         size_t ptr_i = 0;
 
         /* A' (1,2) */
-        for (int col = 0; col < At.cols(); col++)
+        for (size_t row = 0; row < n_eq; row++)
         {
-            for (Eigen::SparseMatrix<double>::InnerIterator it(At, col); it; ++it)
+            for (SparseRows::InnerIterator it(A_csr, A, row); it; ++it)
             {
                 *KKT_AG_ptr[ptr_i++] = it.value();
             }
         }
 
         /* G' (1,3) */
+        for (size_t row = 0; row < n_ineq; row++)
         {
-            size_t col_Gt = 0;
-
-            /* Linear block */
-            for (size_t col = 0; col < n_lc; col++)
-            {
-                for (Eigen::SparseMatrix<double>::InnerIterator it(Gt, col_Gt); it; ++it)
-                {
-                    *KKT_AG_ptr[ptr_i++] = it.value();
-                }
-                col_Gt++;
-            }
-
-            /* SOC blocks */
-            for (const SOCone &sc : so_cones)
+            for (SparseRows::InnerIterator it(G_csr, G, row); it; ++it)
             {
-                for (size_t col = 0; col < sc.dim; col++)
-                {
-                    for (Eigen::SparseMatrix<double>::InnerIterator it(Gt, col_Gt); it; ++it)
-                    {
-                        *KKT_AG_ptr[ptr_i++] = it.value();
-                    }
-                    col_Gt++;
-                }
+                *KKT_AG_ptr[ptr_i++] = it.value();
             }
         }
     }
@@ -2035,50 +2035,54 @@ namespace EiCOS
                             const Eigen::VectorXd &h,
                             const Eigen::VectorXd &b)
     {
-        std::copy(G.valuePtr(), G.valuePtr() + G.nonZeros(), this->G.valuePtr());
-        std::copy(A.valuePtr(), A.valuePtr() + A.nonZeros(), this->A.valuePtr());
+        const ThreadPool::Scope pool_scope(thread_pool.get());
 
-        this->c = c;
-        this->h = h;
-        this->b = b;
+        copyValues(G.valuePtr(), A.valuePtr());
 
-        setEquilibration();
+        this->c = gatherInternal(c, var_order);
+        this->h = gatherInternal(h, ineq_order);
+        this->b = gatherInternal(b, eq_order);
 
-        Gt = this->G.transpose();
-        At = this->A.transpose();
+        setEquilibration();
 
         updateKKTAG();
+
+        if (not sub_solvers.empty())
+        {
+            setupSubproblems();
+        }
     }
 
     void Solver::updateData(double *Gpr, double *Apr,
                             double *c, double *h, double *b)
     {
+        const ThreadPool::Scope pool_scope(thread_pool.get());
+
         if (equibrilated)
             unsetEquilibration();
 
+        copyValues(Gpr, Apr);
         if (Gpr)
         {
-            for (int i = 0; i < G.nonZeros(); i++)
-                G.valuePtr()[i] = Gpr[i];
-            this->h = Eigen::Map<Eigen::VectorXd>(h, n_ineq);
+            this->h = gatherInternal(Eigen::Map<Eigen::VectorXd>(h, n_ineq), ineq_order);
         }
         if (Apr)
         {
-            for (int i = 0; i < A.nonZeros(); i++)
-                A.valuePtr()[i] = Apr[i];
-            this->b = Eigen::Map<Eigen::VectorXd>(b, n_eq);
+            this->b = gatherInternal(Eigen::Map<Eigen::VectorXd>(b, n_eq), eq_order);
         }
         if (c)
         {
-            this->c = Eigen::Map<Eigen::VectorXd>(c, n_var);
+            this->c = gatherInternal(Eigen::Map<Eigen::VectorXd>(c, n_var), var_order);
         }
 
         setEquilibration();
 
-        Gt = this->G.transpose();
-        At = this->A.transpose();
-
         updateKKTAG();
+
+        if (not sub_solvers.empty())
+        {
+            setupSubproblems();
+        }
     }
 
     // void Solver::saveProblemData(const std::string &path)
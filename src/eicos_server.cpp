@@ -0,0 +1,42 @@
+#include "server.hpp"
+
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+/**
+ * eicos_server [socket path] [idle solvers per structure]
+ *
+ * Serves until SIGINT or SIGTERM.
+ */
+int main(int argc, char *argv[])
+{
+    const std::string socket_path = argc > 1 ? argv[1] : "/tmp/eicos.sock";
+    const size_t max_idle = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 4;
+
+    /* Blocked before any thread starts, so that only sigwait sees them */
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGINT);
+    sigaddset(&signals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+
+    EiCOS::SolverServer server(socket_path, max_idle);
+    if (not server.listening())
+    {
+        std::fprintf(stderr, "eicos_server: cannot listen on %s\n", socket_path.c_str());
+        return 1;
+    }
+    std::printf("eicos_server: listening on %s\n", socket_path.c_str());
+    std::fflush(stdout);
+
+    std::thread accepting([&server] { server.run(); });
+    int signal;
+    sigwait(&signals, &signal);
+    server.stop();
+    accepting.join();
+
+    std::printf("eicos_server: %zu structures, %zu solvers created\n", server.structures(), server.solversCreated());
+    return 0;
+}
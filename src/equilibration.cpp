@@ -0,0 +1,142 @@
+#include "equilibration.hpp"
+
+#include "kernels.hpp"
+#include "parallel.hpp"
+
+namespace EiCOS
+{
+
+    /* The columns and rows of a partition range are independent, so the results do not depend on it */
+
+    void maxRows(Eigen::VectorXd &e, const Eigen::SparseMatrix<double> &m,
+                 const SparseRows &rows, const RowPartition &row_parts)
+    {
+        parallelFor(row_parts.size() - 1, [&](size_t part) {
+            maxAbsRangesGather(rows.outerIndexPtr(), rows.positionPtr(), m.valuePtr(), e.data(),
+                               row_parts[part], row_parts[part + 1]);
+        });
+    }
+
+    void maxCols(Eigen::VectorXd &e, const Eigen::SparseMatrix<double> &m, const RowPartition &col_parts)
+    {
+        parallelFor(col_parts.size() - 1, [&](size_t part) {
+            maxAbsRanges(m.outerIndexPtr(), m.valuePtr(), e.data(), col_parts[part], col_parts[part + 1]);
+        });
+    }
+
+    void equilibrateRows(const Eigen::VectorXd &e, Eigen::SparseMatrix<double> &m, const RowPartition &col_parts)
+    {
+        /* equilibrate the rows of a matrix */
+        parallelFor(col_parts.size() - 1, [&](size_t part) {
+            divideByIndex(m.outerIndexPtr(), m.innerIndexPtr(), e.data(), m.valuePtr(),
+                          col_parts[part], col_parts[part + 1]);
+        });
+    }
+
+    void equilibrateCols(const Eigen::VectorXd &e, Eigen::SparseMatrix<double> &m, const RowPartition &col_parts)
+    {
+        /* equilibrate the columns of a matrix */
+        parallelFor(col_parts.size() - 1, [&](size_t part) {
+            divideByColumn(m.outerIndexPtr(), e.data(), m.valuePtr(), col_parts[part], col_parts[part + 1]);
+        });
+    }
+
+    void equilibrate(Eigen::SparseMatrix<double> &A,
+                     Eigen::SparseMatrix<double> &G,
+                     const SparseRows &A_rows,
+                     const SparseRows &G_rows,
+                     size_t n_parts,
+                     size_t n_var,
+                     size_t n_lc,
+                     const std::vector<SOCone> &so_cones,
+                     size_t iterations,
+                     Eigen::VectorXd &x_equil,
+                     Eigen::VectorXd &A_equil,
+                     Eigen::VectorXd &G_equil)
+    {
+        assert(A.isCompressed() and G.isCompressed());
+
+        const size_t n_eq = A.rows();
+        const size_t n_ineq = G.rows();
+
+        x_equil.resize(n_var);
+        A_equil.resize(n_eq);
+        G_equil.resize(n_ineq);
+
+        Eigen::VectorXd x_tmp(n_var);
+        Eigen::VectorXd A_tmp(n_eq);
+        Eigen::VectorXd G_tmp(n_ineq);
+
+        /* Ranges of columns and rows with about the same number of non-zeros */
+        const RowPartition A_col_parts = partitionRows(A, n_parts);
+        const RowPartition G_col_parts = partitionRows(G, n_parts);
+        const RowPartition A_row_parts = partitionRows(A_rows, n_parts);
+        const RowPartition G_row_parts = partitionRows(G_rows, n_parts);
+
+        /* Initialize equilibration vector to 1 */
+        x_equil.setOnes();
+        A_equil.setOnes();
+        G_equil.setOnes();
+
+        /* Iterative equilibration */
+        for (size_t iter = 0; iter < iterations; iter++)
+        {
+            /* Each iteration updates A and G */
+
+            /* Zero out the temp vectors */
+            x_tmp.setZero();
+            A_tmp.setZero();
+            G_tmp.setZero();
+
+            /* Compute norm across columns of A, G */
+            maxCols(x_tmp, A, A_col_parts);
+            maxCols(x_tmp, G, G_col_parts);
+
+            /* Compute norm across rows of A */
+            maxRows(A_tmp, A, A_rows, A_row_parts);
+
+            /* Compute norm across rows of G */
+            maxRows(G_tmp, G, G_rows, G_row_parts);
+
+            /* Now collapse cones together by using total over the group */
+            size_t ind = n_lc;
+            for (const SOCone &sc : so_cones)
+            {
+                const double total = G_tmp.segment(ind, sc.dim).sum();
+                G_tmp.segment(ind, sc.dim).setConstant(total);
+                ind += sc.dim;
+            }
+
+            /* Take the square root */
+            auto sqrt_op = [](const double a) { return std::fabs(a) < 1e-6 ? 1. : std::sqrt(a); };
+            x_tmp = x_tmp.unaryExpr(sqrt_op);
+            A_tmp = A_tmp.unaryExpr(sqrt_op);
+            G_tmp = G_tmp.unaryExpr(sqrt_op);
+
+            /* Equilibrate the matrices */
+            equilibrateRows(A_tmp, A, A_col_parts);
+            equilibrateRows(G_tmp, G, G_col_parts);
+            equilibrateCols(x_tmp, A, A_col_parts);
+            equilibrateCols(x_tmp, G, G_col_parts);
+
+            /* Update the equilibration matrix */
+            x_equil = x_equil.cwiseProduct(x_tmp);
+            A_equil = A_equil.cwiseProduct(A_tmp);
+            G_equil = G_equil.cwiseProduct(G_tmp);
+        }
+    }
+
+    void restore(const Eigen::VectorXd &d, const Eigen::VectorXd &e,
+                 Eigen::SparseMatrix<double> &m)
+    {
+        assert(not m.IsRowMajor);
+        for (int col = 0; col < m.cols(); ++col)
+        {
+            for (Eigen::SparseMatrix<double>::InnerIterator it(m, col); it; ++it)
+            {
+                it.valueRef() *= d(it.row()) * e(it.col());
+            }
+        }
+    }
+
+} // namespace EiCOS
@@ -0,0 +1,81 @@
+#include "file_io.hpp"
+
+#include <cstdio>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <atomic>
+#include <fstream>
+#include <functional>
+#include <thread>
+#endif
+
+namespace EiCOS
+{
+
+#if defined(__unix__) || defined(__APPLE__)
+
+    /* mkstemp creates the temporary file exclusively, with a name nobody else holds */
+    bool writeFileAtomic(const std::string &path, const std::string &data)
+    {
+        std::string tmp_path = path + ".tmpXXXXXX";
+        const int fd = mkstemp(&tmp_path[0]);
+        if (fd < 0)
+        {
+            return false;
+        }
+
+        bool ok = fchmod(fd, 0644) == 0;
+        const char *bytes = data.data();
+        size_t size = data.size();
+        while (ok and size > 0)
+        {
+            const ssize_t written = write(fd, bytes, size);
+            ok = written > 0;
+            if (ok)
+            {
+                bytes += written;
+                size -= written;
+            }
+        }
+        ok = close(fd) == 0 and ok;
+
+        if (not ok or std::rename(tmp_path.c_str(), path.c_str()) != 0)
+        {
+            std::remove(tmp_path.c_str());
+            return false;
+        }
+        return true;
+    }
+
+#else
+
+    /* Without mkstemp, the name is unique in the process by the thread and a counter */
+    bool writeFileAtomic(const std::string &path, const std::string &data)
+    {
+        static std::atomic<unsigned long long> counter{0};
+        const std::string tmp_path = path + ".tmp" + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id())) +
+                                     "-" + std::to_string(counter++);
+        {
+            std::ofstream out(tmp_path, std::ios::binary);
+            out << data;
+            if (not out)
+            {
+                std::remove(tmp_path.c_str());
+                return false;
+            }
+        }
+        std::remove(path.c_str()); // rename does not replace files here
+        if (std::rename(tmp_path.c_str(), path.c_str()) != 0)
+        {
+            std::remove(tmp_path.c_str());
+            return false;
+        }
+        return true;
+    }
+
+#endif
+
+} // namespace EiCOS
@@ -0,0 +1,161 @@
+#include "kernels.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+/**
+ * Function multiversioning: the compiler emits one clone per instruction set
+ * and an ifunc resolver that picks the clone for the CPU at load time.
+ */
+#if defined(EICOS_CPU_DISPATCH) && EICOS_CPU_DISPATCH && defined(__x86_64__) && defined(__GNUC__) && defined(__has_attribute)
+#if __has_attribute(target_clones)
+#define EICOS_MULTIVERSION __attribute__((target_clones("avx512f", "avx2", "sse4.2", "default")))
+#endif
+#endif
+
+#ifndef EICOS_MULTIVERSION
+#define EICOS_MULTIVERSION
+#endif
+
+namespace EiCOS
+{
+
+    const char *cpuDispatchLevel()
+    {
+#if defined(EICOS_CPU_DISPATCH) && EICOS_CPU_DISPATCH && defined(__x86_64__) && defined(__GNUC__)
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f"))
+            return "avx512f";
+        if (__builtin_cpu_supports("avx2"))
+            return "avx2";
+        if (__builtin_cpu_supports("sse4.2"))
+            return "sse4.2";
+#endif
+        return "default";
+    }
+
+    /* ========================== Products ========================== */
+
+    EICOS_MULTIVERSION
+    void accumulateRows(const int *row_start, const int *col, const double *value,
+                        const double *x, double *y, double alpha, ptrdiff_t begin, ptrdiff_t end)
+    {
+        for (ptrdiff_t row = begin; row < end; row++)
+        {
+            double sum = y[row];
+            for (int k = row_start[row]; k < row_start[row + 1]; k++)
+            {
+                sum += value[k] * (alpha * x[col[k]]);
+            }
+            y[row] = sum;
+        }
+    }
+
+    EICOS_MULTIVERSION
+    void accumulateRowsGather(const int *row_start, const int *col, const int *position, const double *value,
+                              const double *x, double *y, double alpha, ptrdiff_t begin, ptrdiff_t end)
+    {
+        for (ptrdiff_t row = begin; row < end; row++)
+        {
+            double sum = y[row];
+            for (int k = row_start[row]; k < row_start[row + 1]; k++)
+            {
+                sum += value[position[k]] * (alpha * x[col[k]]);
+            }
+            y[row] = sum;
+        }
+    }
+
+    /* ========================== Elementwise ========================== */
+
+    EICOS_MULTIVERSION
+    void multiplyElements(size_t n, const double *a, const double *b, double *out)
+    {
+        for (size_t i = 0; i < n; i++)
+        {
+            out[i] = a[i] * b[i];
+        }
+    }
+
+    EICOS_MULTIVERSION
+    void divideElements(size_t n, const double *a, const double *b, double *out)
+    {
+        for (size_t i = 0; i < n; i++)
+        {
+            out[i] = a[i] / b[i];
+        }
+    }
+
+    EICOS_MULTIVERSION
+    void sqrtElements(size_t n, const double *a, double *out)
+    {
+        for (size_t i = 0; i < n; i++)
+        {
+            out[i] = std::sqrt(a[i]);
+        }
+    }
+
+    EICOS_MULTIVERSION
+    void addProductElements(size_t n, const double *a, const double *b, double *y)
+    {
+        for (size_t i = 0; i < n; i++)
+        {
+            y[i] += a[i] * b[i];
+        }
+    }
+
+    /* ========================== Equilibration ========================== */
+
+    EICOS_MULTIVERSION
+    void maxAbsRanges(const int *start, const double *value, double *e, ptrdiff_t begin, ptrdiff_t end)
+    {
+        for (ptrdiff_t j = begin; j < end; j++)
+        {
+            double e_j = e[j];
+            for (int k = start[j]; k < start[j + 1]; k++)
+            {
+                e_j = std::max(std::fabs(value[k]), e_j);
+            }
+            e[j] = e_j;
+        }
+    }
+
+    EICOS_MULTIVERSION
+    void maxAbsRangesGather(const int *start, const int *position, const double *value,
+                            double *e, ptrdiff_t begin, ptrdiff_t end)
+    {
+        for (ptrdiff_t j = begin; j < end; j++)
+        {
+            double e_j = e[j];
+            for (int k = start[j]; k < start[j + 1]; k++)
+            {
+                e_j = std::max(std::fabs(value[position[k]]), e_j);
+            }
+            e[j] = e_j;
+        }
+    }
+
+    EICOS_MULTIVERSION
+    void divideByIndex(const int *start, const int *index, const double *e, double *__restrict value,
+                       ptrdiff_t begin, ptrdiff_t end)
+    {
+        for (int k = start[begin]; k < start[end]; k++)
+        {
+            value[k] /= e[index[k]];
+        }
+    }
+
+    EICOS_MULTIVERSION
+    void divideByColumn(const int *start, const double *e, double *value, ptrdiff_t begin, ptrdiff_t end)
+    {
+        for (ptrdiff_t j = begin; j < end; j++)
+        {
+            const double e_j = e[j];
+            for (int k = start[j]; k < start[j + 1]; k++)
+            {
+                value[k] /= e_j;
+            }
+        }
+    }
+
+} // namespace EiCOS
@@ -0,0 +1,187 @@
+#include "log_sink.hpp"
+
+#include "eicos.hpp"
+
+#include <cstring>
+
+namespace EiCOS
+{
+
+    struct AsyncLogSink::Record
+    {
+        bool is_iteration;
+        Information info;
+        char text[256]; // messages are truncated to fit
+    };
+
+    /* Vyukov's bounded queue: the sequence tells whether a slot is free or filled for the position */
+    struct AsyncLogSink::Slot
+    {
+        std::atomic<size_t> sequence;
+        Record record;
+    };
+
+    AsyncLogSink::AsyncLogSink(std::FILE *out, size_t capacity)
+        : out(out)
+    {
+        size_t size = 2;
+        while (size < capacity)
+        {
+            size *= 2;
+        }
+        slots.reset(new Slot[size]);
+        mask = size - 1;
+        for (size_t i = 0; i < size; i++)
+        {
+            slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        writer = std::thread([this] { write(); });
+    }
+
+    AsyncLogSink::~AsyncLogSink()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        ready.notify_one();
+        writer.join();
+    }
+
+    void AsyncLogSink::iteration(const Information &info)
+    {
+        Record record;
+        record.is_iteration = true;
+        record.info = info;
+        record.text[0] = '\0';
+        push(record);
+    }
+
+    void AsyncLogSink::message(const std::string &text)
+    {
+        Record record;
+        record.is_iteration = false;
+        const size_t length = std::min(text.size(), sizeof(record.text) - 1);
+        std::memcpy(record.text, text.data(), length);
+        record.text[length] = '\0';
+        push(record);
+    }
+
+    bool AsyncLogSink::push(const Record &record)
+    {
+        size_t pos = head.load(std::memory_order_relaxed);
+        Slot *slot;
+        while (true)
+        {
+            slot = &slots[pos & mask];
+            const size_t sequence = slot->sequence.load(std::memory_order_acquire);
+            const std::ptrdiff_t diff = std::ptrdiff_t(sequence) - std::ptrdiff_t(pos);
+            if (diff == 0)
+            {
+                if (head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                n_dropped++;
+                return false;
+            }
+            else
+            {
+                pos = head.load(std::memory_order_relaxed);
+            }
+        }
+
+        slot->record = record;
+        slot->sequence.store(pos + 1, std::memory_order_release);
+        n_pushed++;
+
+        /* Pairs with the fence of the writer: either it sees the record or we see it waiting */
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiting.load(std::memory_order_relaxed))
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ready.notify_one();
+        }
+        return true;
+    }
+
+    /* Only the writer thread pops */
+    bool AsyncLogSink::pop(Record &record)
+    {
+        const size_t pos = tail.load(std::memory_order_relaxed);
+        Slot &slot = slots[pos & mask];
+        if (slot.sequence.load(std::memory_order_acquire) != pos + 1)
+        {
+            return false;
+        }
+
+        record = slot.record;
+        slot.sequence.store(pos + mask + 1, std::memory_order_release);
+        tail.store(pos + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    bool AsyncLogSink::queued() const
+    {
+        const size_t pos = tail.load(std::memory_order_relaxed);
+        return slots[pos & mask].sequence.load(std::memory_order_acquire) == pos + 1;
+    }
+
+    void AsyncLogSink::write()
+    {
+        Record record;
+        while (true)
+        {
+            /* Read stop before draining, so nothing logged before the destructor is lost */
+            const bool stopping = stop.load();
+
+            size_t n_records = 0;
+            while (pop(record))
+            {
+                const std::string text = record.is_iteration ? formatIteration(record.info) : std::string(record.text);
+                std::fputs(text.c_str(), out);
+                n_records++;
+            }
+            if (n_records > 0)
+            {
+                std::fflush(out);
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    n_written += n_records;
+                }
+                written.notify_all();
+            }
+
+            if (stopping)
+            {
+                return;
+            }
+            if (n_records == 0)
+            {
+                /* Announces the wait before the last look at the queue, see push */
+                std::unique_lock<std::mutex> lock(mutex);
+                waiting.store(true, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                ready.wait(lock, [this] { return stop.load() or queued(); });
+                waiting.store(false, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void AsyncLogSink::flush()
+    {
+        const size_t target = n_pushed.load();
+        std::unique_lock<std::mutex> lock(mutex);
+        written.wait(lock, [this, target] { return n_written.load() >= target; });
+    }
+
+    size_t AsyncLogSink::dropped() const
+    {
+        return n_dropped.load();
+    }
+
+} // namespace EiCOS
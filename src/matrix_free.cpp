@@ -0,0 +1,244 @@
+#include "eicos.hpp"
+
+#include "printing.hpp"
+
+namespace EiCOS
+{
+
+    /**
+     * Applies the inverse of the squared scaling V = W^2 to x.
+     * While initializing, the scaling is the identity.
+     */
+    void Solver::scaleSquaredInverse(const Eigen::VectorXd &x, Eigen::VectorXd &y, bool initialize)
+    {
+        if (initialize)
+        {
+            y = x;
+            return;
+        }
+
+        Eigen::VectorXd tmp(n_ineq);
+        y.resize(n_ineq);
+        unscale(x, tmp);
+        unscale(tmp, y);
+    }
+
+    /**
+     * Multiplication with the normal matrix that remains after eliminating dz and dy
+     * from the regularized KKT system:
+     *
+     *   y = (deltastat * I + G' * V^-1 * G + A' * A / cg_eqreg) * x
+     */
+    void Solver::applyNormalMatrix(const Eigen::VectorXd &x, Eigen::VectorXd &y, bool initialize)
+    {
+        Eigen::VectorXd Gx = Eigen::VectorXd::Zero(n_ineq);
+        Eigen::VectorXd VGx;
+        productG(x, Gx);
+        scaleSquaredInverse(Gx, VGx, initialize);
+        y = settings.deltastat * x;
+        productGt(VGx, y);
+
+        if (n_eq > 0)
+        {
+            Eigen::VectorXd Ax = Eigen::VectorXd::Zero(n_eq);
+            productA(x, Ax);
+            productAt(Ax, y, 1. / settings.cg_eqreg);
+        }
+    }
+
+    /**
+     * Solves the KKT system without forming it, for the case where G and A are
+     * only available as linear operators.
+     *
+     *  [ deltastat * I  A'            G' ] [ dx ]   [ bx ]
+     *  [ A             -deltastat * I 0  ] [ dy ] = [ by ]
+     *  [ G              0            -V  ] [ dz ]   [ bz ]
+     *
+     * dz and dy are eliminated, the equality constraints with the (larger) penalty
+     * cg_eqreg, and the resulting normal equations are solved with Jacobi-preconditioned
+     * conjugate gradients. The error introduced by the penalty is removed by iterative
+     * refinement against the system above.
+     *
+     * With fixed_iters, every solve runs fixed_nitref refinement steps of cg_maxit
+     * conjugate gradient iterations each. Iterations after convergence leave the
+     * solution unchanged.
+     *
+     * The right hand side is given in the expanded layout of the KKT matrix, the
+     * solution is returned in the compressed layout, just like solveKKT.
+     */
+    size_t Solver::solveNormalEquations(const Eigen::VectorXd &rhs, // dim_K
+                                        Eigen::VectorXd &dx,        // n_var
+                                        Eigen::VectorXd &dy,        // n_eq
+                                        Eigen::VectorXd &dz,        // n_ineq
+                                        bool initialize)
+    {
+        /* Gather right hand side, the entries of the SOC expansion are not needed */
+        const Eigen::VectorXd bx = rhs.head(n_var);
+        const Eigen::VectorXd by = rhs.segment(n_var, n_eq);
+        Eigen::VectorXd bz(n_ineq);
+        bz.head(n_lc) = rhs.segment(n_var + n_eq, n_lc);
+        size_t bz_index = n_lc;
+        size_t rhs_index = n_var + n_eq + n_lc;
+        for (const SOCone &sc : so_cones)
+        {
+            bz.segment(bz_index, sc.dim) = rhs.segment(rhs_index, sc.dim);
+            bz_index += sc.dim;
+            rhs_index += sc.dim + 2;
+        }
+        assert(bz_index == n_ineq and rhs_index == dim_K);
+
+        /* Jacobi preconditioner, diag(G' * V^-1 * G) is approximated with the diagonal of V^-1 */
+        Eigen::VectorXd precond = Eigen::VectorXd::Constant(n_var, settings.deltastat);
+        if (G_op.apply_transpose_squared and (n_eq == 0 or A_op.apply_transpose_squared))
+        {
+            Eigen::VectorXd v_inv(n_ineq);
+            if (initialize)
+            {
+                v_inv.setOnes();
+            }
+            else
+            {
+                v_inv.head(n_lc) = lp_cone.v.cwiseInverse();
+                size_t cone_start = n_lc;
+                for (const SOCone &sc : so_cones)
+                {
+                    /* Squared row norms of W \ I */
+                    const double d = 1. + 2. / (1. + sc.a) + sc.w / std::pow(1. + sc.a, 2);
+                    v_inv(cone_start) = sc.a * sc.a + sc.w;
+                    v_inv.segment(cone_start + 1, sc.dim - 1) =
+                        (1. + d * sc.q.array().square()).matrix();
+                    v_inv.segment(cone_start, sc.dim) /= sc.eta_square;
+                    cone_start += sc.dim;
+                }
+            }
+
+            Eigen::VectorXd tmp(n_var);
+            G_op.apply_transpose_squared(v_inv, tmp);
+            precond += tmp;
+            if (n_eq > 0)
+            {
+                A_op.apply_transpose_squared(Eigen::VectorXd::Ones(n_eq), tmp);
+                precond += tmp / settings.cg_eqreg;
+            }
+        }
+        else
+        {
+            precond.setOnes();
+        }
+
+        const double error_threshold = (1. + rhs.lpNorm<Eigen::Infinity>()) * settings.linsysacc;
+
+        dx.setZero(n_var);
+        dy.setZero(n_eq);
+        dz.setZero(n_ineq);
+
+        /* Residuals of the regularized KKT system */
+        Eigen::VectorXd ex = bx;
+        Eigen::VectorXd ey = by;
+        Eigen::VectorXd ez = bz;
+
+        Eigen::VectorXd ddx(n_var), ddy, ddz, r, tmp_z(n_ineq), Vdz(n_ineq);
+        Eigen::VectorXd res, pres, p, Ap;
+
+        double nerr_prev = std::numeric_limits<double>::max();
+
+        /* Iterative refinement, a fixed number of steps with fixed_iters */
+        const bool fixed = settings.fixed_iters > 0;
+        const size_t nitref = fixed ? settings.fixed_nitref : settings.nitref;
+        size_t k_ref;
+        for (k_ref = 0; k_ref <= nitref; k_ref++)
+        {
+            /* r = ex + G' * V^-1 * ez + A' * ey / cg_eqreg */
+            scaleSquaredInverse(ez, tmp_z, initialize);
+            r = ex;
+            productGt(tmp_z, r);
+            if (n_eq > 0)
+            {
+                productAt(ey, r, 1. / settings.cg_eqreg);
+            }
+
+            /* Preconditioned conjugate gradients on the normal equations */
+            ddx.setZero();
+            res = r;
+            pres = res.cwiseQuotient(precond);
+            p = pres;
+            double rho = res.dot(pres);
+            const double cg_threshold = settings.cg_tol * r.norm();
+            size_t k_cg;
+            for (k_cg = 0; k_cg < settings.cg_maxit and (fixed or res.norm() > cg_threshold); k_cg++)
+            {
+                /* The guards only act once the residual is zero, which ends the loop without fixed_iters */
+                applyNormalMatrix(p, Ap, initialize);
+                const double pAp = p.dot(Ap);
+                const double alpha = pAp > 0. ? rho / pAp : 0.;
+                ddx += alpha * p;
+                res -= alpha * Ap;
+                pres = res.cwiseQuotient(precond);
+                const double rho_new = res.dot(pres);
+                p = pres + (rho > 0. ? rho_new / rho : 0.) * p;
+                rho = rho_new;
+            }
+            print_dbg("CG: {} iterations, residual {:.1e}\n", k_cg, res.norm());
+
+            /* Recover ddy = (A * ddx - ey) / cg_eqreg and ddz = V \ (G * ddx - ez) */
+            if (n_eq > 0)
+            {
+                ddy = -ey;
+                productA(ddx, ddy);
+                dy += ddy / settings.cg_eqreg;
+            }
+            tmp_z = -ez;
+            productG(ddx, tmp_z);
+            scaleSquaredInverse(tmp_z, ddz, initialize);
+            dx += ddx;
+            dz += ddz;
+
+            /* ex = bx - deltastat * dx - A' * dy - G' * dz */
+            ex = bx - settings.deltastat * dx;
+            productGt(dz, ex, -1.);
+            if (n_eq > 0)
+            {
+                productAt(dy, ex, -1.);
+            }
+
+            /* ey = by - A * dx + deltastat * dy */
+            if (n_eq > 0)
+            {
+                ey = by + settings.deltastat * dy;
+                productA(dx, ey, -1.);
+            }
+
+            /* ez = bz - G * dx + V * dz */
+            ez = bz;
+            productG(dx, ez, -1.);
+            if (initialize)
+            {
+                ez += dz;
+            }
+            else
+            {
+                scale(dz, tmp_z);
+                scale(tmp_z, Vdz);
+                ez += Vdz;
+            }
+
+            double nerr = std::max(ex.lpNorm<Eigen::Infinity>(), ez.lpNorm<Eigen::Infinity>());
+            if (n_eq > 0)
+            {
+                nerr = std::max(nerr, ey.lpNorm<Eigen::Infinity>());
+            }
+            print_dbg("     {}   {:.1g} \n", k_ref, nerr);
+
+            /* Stop refining if converged or stalled */
+            if (k_ref == nitref or
+                (not fixed and (nerr < error_threshold or nerr_prev < settings.irerrfact * nerr)))
+            {
+                break;
+            }
+            nerr_prev = nerr;
+        }
+
+        return k_ref;
+    }
+
+} // namespace EiCOS
@@ -0,0 +1,255 @@
+#include "metrics.hpp"
+
+#include "eicos.hpp"
+#include "file_io.hpp"
+
+#include <cmath>
+#include <sstream>
+
+namespace EiCOS
+{
+
+    namespace
+    {
+
+        const std::array<exitcode, 12> codes = {exitcode::optimal,
+                                                exitcode::primal_infeasible,
+                                                exitcode::dual_infeasible,
+                                                exitcode::maxit,
+                                                exitcode::numerics,
+                                                exitcode::outcone,
+                                                exitcode::interrupted,
+                                                exitcode::fatal,
+                                                exitcode::close_to_optimal,
+                                                exitcode::close_to_primal_infeasible,
+                                                exitcode::close_to_dual_infeasible,
+                                                exitcode::not_converged_yet};
+
+        const std::array<const char *, 12> code_names = {"optimal",
+                                                         "primal_infeasible",
+                                                         "dual_infeasible",
+                                                         "maxit",
+                                                         "numerics",
+                                                         "outcone",
+                                                         "interrupted",
+                                                         "fatal",
+                                                         "close_to_optimal",
+                                                         "close_to_primal_infeasible",
+                                                         "close_to_dual_infeasible",
+                                                         "not_converged_yet"};
+
+        const std::array<double, 11> time_bounds = {1e-5, 1e-4, 5e-4, 1e-3, 5e-3, 1e-2, 5e-2, 0.1, 0.5, 1., 5.};
+
+        /* Plain counter of the exports */
+        struct Counter
+        {
+            const char *name;
+            const char *help;
+            uint64_t value;
+        };
+
+    } // namespace
+
+    template <size_t N>
+    void Metrics::Histogram<N>::add(double value)
+    {
+        size_t bucket = 0;
+        while (bucket < N and value > bounds[bucket])
+        {
+            bucket++;
+        }
+        counts[bucket].fetch_add(1, std::memory_order_relaxed);
+        sum.fetch_add(uint64_t(std::llround(std::max(value, 0.) / unit)), std::memory_order_relaxed);
+    }
+
+    Metrics::Metrics()
+        : start(std::chrono::steady_clock::now()),
+          iterations({5., 10., 15., 20., 25., 30., 40., 50., 75., 100.}, 1.),
+          solve_time(time_bounds, 1e-9),
+          factor_time(time_bounds, 1e-9)
+    {
+    }
+
+    void Metrics::record(exitcode code, const Information &info, const SolveStatistics &statistics)
+    {
+        n_solves.fetch_add(1, std::memory_order_relaxed);
+        for (size_t k = 0; k < n_codes; k++)
+        {
+            if (codes[k] == code)
+            {
+                exit_codes[k].fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        iterations.add(info.iter);
+        solve_time.add(statistics.solve_time);
+        if (statistics.factorizations > 0)
+        {
+            factor_time.add(statistics.factor_time / statistics.factorizations);
+        }
+        factorizations.fetch_add(statistics.factorizations, std::memory_order_relaxed);
+        refinement_steps.fetch_add(statistics.refinement_steps, std::memory_order_relaxed);
+        fallbacks.fetch_add(statistics.fallbacks, std::memory_order_relaxed);
+        regularized_pivots.fetch_add(statistics.regularized_pivots, std::memory_order_relaxed);
+    }
+
+    void Metrics::recordCacheHit()
+    {
+        n_cache_hits.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    uint64_t Metrics::solves() const
+    {
+        return n_solves.load(std::memory_order_relaxed);
+    }
+
+    uint64_t Metrics::cacheHits() const
+    {
+        return n_cache_hits.load(std::memory_order_relaxed);
+    }
+
+    std::string Metrics::text(Format format) const
+    {
+        const uint64_t solves = n_solves.load(std::memory_order_relaxed);
+        const double uptime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        const std::array<Counter, 6> counters = {
+            Counter{"solves", "Solves since the registry was created", solves},
+            Counter{"cache_hits", "Results taken from a solution cache without solving", n_cache_hits.load(std::memory_order_relaxed)},
+            Counter{"factorizations", "Numeric factorizations of the KKT matrix", factorizations.load(std::memory_order_relaxed)},
+            Counter{"refinement_steps", "Iterative refinement steps", refinement_steps.load(std::memory_order_relaxed)},
+            Counter{"fallbacks", "Restores of the best iterate after a failed step", fallbacks.load(std::memory_order_relaxed)},
+            Counter{"regularized_pivots", "Pivots replaced by the dynamic regularization", regularized_pivots.load(std::memory_order_relaxed)}};
+
+        std::ostringstream out;
+        out.precision(9);
+
+        if (format == Format::prometheus)
+        {
+            for (const Counter &counter : counters)
+            {
+                out << "# HELP eicos_" << counter.name << "_total " << counter.help << ".\n"
+                    << "# TYPE eicos_" << counter.name << "_total counter\n"
+                    << "eicos_" << counter.name << "_total " << counter.value << "\n";
+            }
+
+            out << "# HELP eicos_solves_per_second Mean rate of solves since the registry was created.\n"
+                << "# TYPE eicos_solves_per_second gauge\n"
+                << "eicos_solves_per_second " << (uptime > 0. ? solves / uptime : 0.) << "\n";
+
+            out << "# HELP eicos_exit_codes_total Solves by exit code.\n"
+                << "# TYPE eicos_exit_codes_total counter\n";
+            for (size_t k = 0; k < n_codes; k++)
+            {
+                out << "eicos_exit_codes_total{code=\"" << code_names[k] << "\"} "
+                    << exit_codes[k].load(std::memory_order_relaxed) << "\n";
+            }
+
+            auto histogram = [&](const char *name, const char *help, const auto &h) {
+                out << "# HELP eicos_" << name << " " << help << ".\n"
+                    << "# TYPE eicos_" << name << " histogram\n";
+                uint64_t cumulative = 0;
+                for (size_t b = 0; b < h.counts.size(); b++)
+                {
+                    cumulative += h.counts[b].load(std::memory_order_relaxed);
+                    out << "eicos_" << name << "_bucket{le=\"";
+                    if (b < h.bounds.size())
+                    {
+                        out << h.bounds[b];
+                    }
+                    else
+                    {
+                        out << "+Inf";
+                    }
+                    out << "\"} " << cumulative << "\n";
+                }
+                out << "eicos_" << name << "_sum " << h.sum.load(std::memory_order_relaxed) * h.unit << "\n"
+                    << "eicos_" << name << "_count " << cumulative << "\n";
+            };
+            histogram("iterations", "Interior point iterations per solve", iterations);
+            histogram("solve_seconds", "Time per solve", solve_time);
+            histogram("factorization_seconds", "Mean time per factorization of a solve", factor_time);
+        }
+        else
+        {
+            out << "{";
+            for (const Counter &counter : counters)
+            {
+                out << "\"" << counter.name << "\":" << counter.value << ",";
+            }
+            out << "\"solves_per_second\":" << (uptime > 0. ? solves / uptime : 0.) << ",";
+
+            out << "\"exit_codes\":{";
+            for (size_t k = 0; k < n_codes; k++)
+            {
+                out << (k > 0 ? "," : "") << "\"" << code_names[k] << "\":" << exit_codes[k].load(std::memory_order_relaxed);
+            }
+            out << "}";
+
+            auto histogram = [&](const char *name, const auto &h) {
+                out << ",\"" << name << "\":{\"bounds\":[";
+                for (size_t b = 0; b < h.bounds.size(); b++)
+                {
+                    out << (b > 0 ? "," : "") << h.bounds[b];
+                }
+                out << "],\"counts\":[";
+                uint64_t count = 0;
+                for (size_t b = 0; b < h.counts.size(); b++)
+                {
+                    const uint64_t n = h.counts[b].load(std::memory_order_relaxed);
+                    out << (b > 0 ? "," : "") << n;
+                    count += n;
+                }
+                out << "],\"sum\":" << h.sum.load(std::memory_order_relaxed) * h.unit << ",\"count\":" << count << "}";
+            };
+            histogram("iterations", iterations);
+            histogram("solve_seconds", solve_time);
+            histogram("factorization_seconds", factor_time);
+            out << "}\n";
+        }
+
+        return out.str();
+    }
+
+    bool Metrics::writeFile(const std::string &path, Format format) const
+    {
+        return writeFileAtomic(path, text(format));
+    }
+
+    MetricsExporter::MetricsExporter(std::shared_ptr<const Metrics> metrics, Metrics::Format format,
+                                     std::chrono::milliseconds period, Callback callback)
+        : metrics(std::move(metrics)), format(format), period(period), callback(std::move(callback))
+    {
+        thread = std::thread([this] { run(); });
+    }
+
+    MetricsExporter::MetricsExporter(std::shared_ptr<const Metrics> metrics, Metrics::Format format,
+                                     std::chrono::milliseconds period, const std::string &path)
+        : MetricsExporter(std::move(metrics), format, period, [path](const std::string &text) { writeFileAtomic(path, text); })
+    {
+    }
+
+    MetricsExporter::~MetricsExporter()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        wake.notify_one();
+        thread.join();
+    }
+
+    void MetricsExporter::run()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true)
+        {
+            const bool stopping = wake.wait_for(lock, period, [this] { return stop; });
+            callback(metrics->text(format));
+            if (stopping)
+            {
+                return;
+            }
+        }
+    }
+
+} // namespace EiCOS
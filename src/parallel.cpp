@@ -0,0 +1,210 @@
+#include "parallel.hpp"
+
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace EiCOS
+{
+
+    namespace
+    {
+
+        thread_local ThreadPool *scope_pool = nullptr;  // pool of the innermost Scope
+        thread_local ThreadPool *worker_pool = nullptr; // pool this thread works for
+
+    } // namespace
+
+    ThreadPool::ThreadPool(size_t n_threads, const std::vector<int> &cpus)
+        : cpu_list(cpus)
+    {
+        if (n_threads == 0)
+        {
+            n_threads = cpus.empty() ? std::max(1u, std::thread::hardware_concurrency()) : cpus.size();
+        }
+
+        workers.reserve(n_threads - 1);
+        for (size_t t = 0; t < n_threads - 1; t++)
+        {
+            workers.emplace_back([this, t] { work(t); });
+        }
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        wake.notify_all();
+        for (std::thread &worker : workers)
+        {
+            worker.join();
+        }
+    }
+
+    size_t ThreadPool::size() const
+    {
+        return workers.size() + 1;
+    }
+
+    const std::vector<int> &ThreadPool::cpus() const
+    {
+        return cpu_list;
+    }
+
+    ThreadPool &ThreadPool::global()
+    {
+        static ThreadPool pool;
+        return pool;
+    }
+
+    ThreadPool &ThreadPool::current()
+    {
+        if (scope_pool)
+        {
+            return *scope_pool;
+        }
+        if (worker_pool)
+        {
+            return *worker_pool;
+        }
+        return global();
+    }
+
+    ThreadPool::Scope::Scope(ThreadPool *pool)
+        : previous(scope_pool), active(pool != nullptr)
+    {
+        if (active)
+        {
+            scope_pool = pool;
+        }
+    }
+
+    ThreadPool::Scope::~Scope()
+    {
+        if (active)
+        {
+            scope_pool = previous;
+        }
+    }
+
+    void ThreadPool::parallelFor(size_t n, const std::function<void(size_t)> &f)
+    {
+        std::unique_lock<std::mutex> loop_lock(loop_mutex, std::defer_lock);
+        if (workers.empty() or n <= 1 or worker_pool == this or not loop_lock.try_lock())
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                f(i);
+            }
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            loop = &f;
+            loop_size = n;
+            next = 0;
+            running = workers.size();
+            generation++;
+        }
+        wake.notify_all();
+
+        runLoop();
+
+        std::unique_lock<std::mutex> lock(mutex);
+        done.wait(lock, [this] { return running == 0; });
+        loop = nullptr;
+    }
+
+    void ThreadPool::runLoop()
+    {
+        for (size_t i = next++; i < loop_size; i = next++)
+        {
+            (*loop)(i);
+        }
+    }
+
+    void ThreadPool::work(size_t worker)
+    {
+        if (not cpu_list.empty())
+        {
+            setThreadAffinity({cpu_list[(worker + 1) % cpu_list.size()]});
+        }
+        worker_pool = this;
+
+        size_t seen = 0;
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true)
+        {
+            wake.wait(lock, [&] { return stop or generation != seen; });
+            if (stop)
+            {
+                return;
+            }
+            seen = generation;
+
+            lock.unlock();
+            runLoop();
+            lock.lock();
+
+            if (--running == 0)
+            {
+                done.notify_one();
+            }
+        }
+    }
+
+    bool setThreadAffinity(const std::vector<int> &cpus)
+    {
+#ifdef __linux__
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (const int cpu : cpus)
+        {
+            if (cpu < 0 or cpu >= CPU_SETSIZE)
+            {
+                return false;
+            }
+            CPU_SET(cpu, &set);
+        }
+        return not cpus.empty() and pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+        (void)cpus;
+        return false;
+#endif
+    }
+
+    /* Reads the list of the node from sysfs, e.g. "0-3,8-11" */
+    std::vector<int> numaNodeCpus(int node)
+    {
+        std::vector<int> cpus;
+        std::ifstream in("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+        std::string list;
+        if (node < 0 or not std::getline(in, list))
+        {
+            return cpus;
+        }
+
+        std::istringstream ranges(list);
+        std::string range;
+        while (std::getline(ranges, range, ','))
+        {
+            const size_t dash = range.find('-');
+            const int first = std::stoi(range.substr(0, dash));
+            const int last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+            for (int cpu = first; cpu <= last; cpu++)
+            {
+                cpus.push_back(cpu);
+            }
+        }
+        return cpus;
+    }
+
+} // namespace EiCOS
@@ -0,0 +1,880 @@
+#include "problem_io.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace EiCOS
+{
+
+    namespace
+    {
+
+        const char magic[8] = {'E', 'I', 'C', 'O', 'S', 'P', 'R', 'B'};
+        const uint32_t version = 1;
+        const double inf = std::numeric_limits<double>::infinity();
+
+        using SparseRow = std::vector<std::pair<int, double>>;
+
+        /* Rows of G and A with their right hand sides, collected in order */
+        struct Assembly
+        {
+            std::vector<Eigen::Triplet<double>> G_entries, A_entries;
+            std::vector<double> h, b;
+            std::vector<int> soc_dims;
+
+            void inequality(const SparseRow &row, double scale, double rhs)
+            {
+                for (const auto &entry : row)
+                {
+                    G_entries.emplace_back(h.size(), entry.first, scale * entry.second);
+                }
+                h.push_back(rhs);
+            }
+
+            void equality(const SparseRow &row, double rhs)
+            {
+                for (const auto &entry : row)
+                {
+                    A_entries.emplace_back(b.size(), entry.first, entry.second);
+                }
+                b.push_back(rhs);
+            }
+
+            void finish(int n, Problem &problem) const
+            {
+                problem.G.resize(h.size(), n);
+                problem.G.setFromTriplets(G_entries.begin(), G_entries.end());
+                problem.A.resize(b.size(), n);
+                problem.A.setFromTriplets(A_entries.begin(), A_entries.end());
+                problem.h = Eigen::Map<const Eigen::VectorXd>(h.data(), h.size());
+                problem.b = Eigen::Map<const Eigen::VectorXd>(b.data(), b.size());
+                problem.soc_dims = Eigen::Map<const Eigen::VectorXi>(soc_dims.data(), soc_dims.size());
+            }
+        };
+
+        bool parseNumber(const std::string &token, double &value)
+        {
+            char *end;
+            value = std::strtod(token.c_str(), &end);
+            return not token.empty() and *end == '\0';
+        }
+
+        bool parseInt(const std::string &token, int &value)
+        {
+            char *end;
+            const long parsed = std::strtol(token.c_str(), &end, 10);
+            value = int(parsed);
+            return not token.empty() and *end == '\0' and parsed == value;
+        }
+
+        std::vector<std::string> tokens(const std::string &line)
+        {
+            std::istringstream stream(line);
+            std::vector<std::string> result;
+            std::string token;
+            while (stream >> token)
+            {
+                result.push_back(token);
+            }
+            return result;
+        }
+
+        template <typename T>
+        bool readValues(std::istream &in, T *values, size_t count)
+        {
+            in.read(reinterpret_cast<char *>(values), count * sizeof(T));
+            return bool(in);
+        }
+
+        /* Grows the vector chunk by chunk, so a corrupt count ends with the stream instead of allocating up front */
+        template <typename T>
+        bool readVector(std::istream &in, std::vector<T> &values, size_t count)
+        {
+            const size_t chunk = size_t(1) << 16;
+            values.clear();
+            while (values.size() < count)
+            {
+                const size_t offset = values.size();
+                values.resize(offset + std::min(chunk, count - offset));
+                if (not readValues(in, values.data() + offset, values.size() - offset))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        bool readMatrix(std::istream &in, int rows, int cols, Eigen::SparseMatrix<double> &matrix, std::string &error)
+        {
+            std::vector<int32_t> jc;
+            if (not readVector(in, jc, size_t(cols) + 1))
+            {
+                error = "truncated column pointers";
+                return false;
+            }
+            if (jc.front() != 0 or jc.back() < 0)
+            {
+                error = "invalid column pointers";
+                return false;
+            }
+            std::vector<int32_t> ir;
+            std::vector<double> pr;
+            if (not readVector(in, ir, jc.back()) or not readVector(in, pr, jc.back()))
+            {
+                error = "truncated matrix";
+                return false;
+            }
+
+            std::vector<Eigen::Triplet<double>> entries;
+            entries.reserve(ir.size());
+            for (int col = 0; col < cols; col++)
+            {
+                if (jc[col] > jc[col + 1])
+                {
+                    error = "invalid column pointers";
+                    return false;
+                }
+                for (int k = jc[col]; k < jc[col + 1]; k++)
+                {
+                    if (ir[k] < 0 or ir[k] >= rows)
+                    {
+                        error = "row index out of range";
+                        return false;
+                    }
+                    entries.emplace_back(ir[k], col, pr[k]);
+                }
+            }
+            matrix.resize(rows, cols);
+            matrix.setFromTriplets(entries.begin(), entries.end());
+            return true;
+        }
+
+        void writeMatrix(std::ostream &out, const Eigen::SparseMatrix<double> &matrix)
+        {
+            Eigen::SparseMatrix<double> compressed = matrix;
+            compressed.makeCompressed();
+            out.write(reinterpret_cast<const char *>(compressed.outerIndexPtr()), (compressed.cols() + 1) * sizeof(int32_t));
+            out.write(reinterpret_cast<const char *>(compressed.innerIndexPtr()), compressed.nonZeros() * sizeof(int32_t));
+            out.write(reinterpret_cast<const char *>(compressed.valuePtr()), compressed.nonZeros() * sizeof(double));
+        }
+
+        bool readBinary(std::istream &in, Problem &problem, std::string &error)
+        {
+            char file_magic[8];
+            uint32_t file_version;
+            int32_t dims[4];
+            if (not readValues(in, file_magic, 8) or not readValues(in, &file_version, 1) or not readValues(in, dims, 4))
+            {
+                error = "truncated header";
+                return false;
+            }
+            if (std::memcmp(file_magic, magic, sizeof(magic)) != 0 or file_version != version)
+            {
+                error = "not an EiCOS problem of version " + std::to_string(version);
+                return false;
+            }
+            const int n = dims[0], m = dims[1], p = dims[2], ncones = dims[3];
+            if (n < 0 or m < 0 or p < 0 or ncones < 0 or ncones > m)
+            {
+                error = "invalid dimensions";
+                return false;
+            }
+
+            std::vector<int32_t> soc_dims;
+            if (not readVector(in, soc_dims, ncones) or
+                not readMatrix(in, m, n, problem.G, error) or
+                not readMatrix(in, p, n, problem.A, error))
+            {
+                error = error.empty() ? "truncated cone dimensions" : error;
+                return false;
+            }
+            int64_t cone_rows = 0;
+            for (const int32_t dim : soc_dims)
+            {
+                if (dim <= 0)
+                {
+                    error = "invalid cone dimensions";
+                    return false;
+                }
+                cone_rows += dim;
+            }
+            if (cone_rows > m)
+            {
+                error = "invalid cone dimensions";
+                return false;
+            }
+            problem.soc_dims = Eigen::Map<const Eigen::VectorXi>(soc_dims.data(), ncones);
+
+            std::vector<double> c, h, b;
+            uint8_t maximize;
+            uint32_t length;
+            if (not readVector(in, c, n) or
+                not readVector(in, h, m) or
+                not readVector(in, b, p) or
+                not readValues(in, &maximize, 1) or
+                not readValues(in, &problem.objective_offset, 1) or
+                not readValues(in, &length, 1))
+            {
+                error = "truncated vectors";
+                return false;
+            }
+            problem.c = Eigen::Map<const Eigen::VectorXd>(c.data(), n);
+            problem.h = Eigen::Map<const Eigen::VectorXd>(h.data(), m);
+            problem.b = Eigen::Map<const Eigen::VectorXd>(b.data(), p);
+            problem.maximize = maximize != 0;
+            if (length > 4096)
+            {
+                error = "invalid name";
+                return false;
+            }
+            problem.name.resize(length);
+            if (not readValues(in, &problem.name[0], length))
+            {
+                error = "truncated name";
+                return false;
+            }
+            return true;
+        }
+
+        /* Bounds of a row or column, lo == up for equalities */
+        struct Bounds
+        {
+            double lo, up;
+        };
+
+        /**
+         * Reads up to ENDATA. Lines that start with a blank are data lines of the
+         * current section, so names must not contain blanks, as in free MPS.
+         */
+        bool readMPS(std::istream &in, Problem &problem, std::string &error)
+        {
+            std::string objective;
+            std::vector<char> row_types;
+            std::vector<SparseRow> rows;
+            std::vector<double> rhs, ranges;
+            std::vector<bool> has_range;
+            std::unordered_map<std::string, int> row_index, col_index;
+            std::unordered_set<std::string> free_rows; // objective rows after the first, their entries are skipped
+            std::vector<double> c;
+            std::vector<Bounds> col_bounds;
+            double objective_rhs = 0.;
+
+            std::string section, line;
+            bool any_content = false, ended = false;
+            size_t line_number = 0;
+            auto fail = [&](const std::string &what) {
+                error = "line " + std::to_string(line_number) + ": " + what;
+                return false;
+            };
+
+            while (not ended and std::getline(in, line))
+            {
+                line_number++;
+                const std::vector<std::string> t = tokens(line);
+                if (t.empty() or t[0][0] == '*')
+                {
+                    continue;
+                }
+                any_content = true;
+
+                if (not std::isspace(static_cast<unsigned char>(line[0])))
+                {
+                    section = t[0];
+                    if (section == "NAME")
+                    {
+                        problem.name = t.size() > 1 ? t[1] : "";
+                    }
+                    else if (section == "OBJSENSE" and t.size() > 1)
+                    {
+                        problem.maximize = t[1] == "MAX" or t[1] == "MAXIMIZE";
+                    }
+                    else if (section == "ENDATA")
+                    {
+                        ended = true;
+                    }
+                    else if (section != "OBJSENSE" and section != "ROWS" and section != "COLUMNS" and
+                             section != "RHS" and section != "RANGES" and section != "BOUNDS")
+                    {
+                        return fail("unsupported section " + section);
+                    }
+                    continue;
+                }
+
+                if (section == "OBJSENSE")
+                {
+                    problem.maximize = t[0] == "MAX" or t[0] == "MAXIMIZE";
+                }
+                else if (section == "ROWS")
+                {
+                    if (t.size() < 2 or t[0].size() != 1 or std::strchr("NELG", t[0][0]) == nullptr)
+                    {
+                        return fail("invalid row");
+                    }
+                    if (t[0][0] == 'N' and not objective.empty())
+                    {
+                        free_rows.insert(t[1]); // further objective rows are dropped
+                        continue;
+                    }
+                    if (t[0][0] == 'N')
+                    {
+                        objective = t[1];
+                        continue;
+                    }
+                    row_index[t[1]] = rows.size();
+                    row_types.push_back(t[0][0]);
+                    rows.emplace_back();
+                    rhs.push_back(0.);
+                    ranges.push_back(0.);
+                    has_range.push_back(false);
+                }
+                else if (section == "COLUMNS")
+                {
+                    if (t.size() >= 2 and t[1] == "'MARKER'")
+                    {
+                        continue;
+                    }
+                    if (t.size() != 3 and t.size() != 5)
+                    {
+                        return fail("invalid column entry");
+                    }
+                    auto col = col_index.find(t[0]);
+                    if (col == col_index.end())
+                    {
+                        col = col_index.emplace(t[0], c.size()).first;
+                        c.push_back(0.);
+                        col_bounds.push_back({0., inf});
+                    }
+                    for (size_t k = 1; k + 1 < t.size(); k += 2)
+                    {
+                        double value;
+                        if (not parseNumber(t[k + 1], value))
+                        {
+                            return fail("invalid number " + t[k + 1]);
+                        }
+                        if (t[k] == objective)
+                        {
+                            c[col->second] += value;
+                            continue;
+                        }
+                        if (free_rows.count(t[k]))
+                        {
+                            continue;
+                        }
+                        const auto row = row_index.find(t[k]);
+                        if (row == row_index.end())
+                        {
+                            return fail("unknown row " + t[k]);
+                        }
+                        rows[row->second].emplace_back(col->second, value);
+                    }
+                }
+                else if (section == "RHS" or section == "RANGES")
+                {
+                    /* The name of the vector is optional */
+                    for (size_t k = t.size() % 2; k + 1 < t.size(); k += 2)
+                    {
+                        double value;
+                        if (not parseNumber(t[k + 1], value))
+                        {
+                            return fail("invalid number " + t[k + 1]);
+                        }
+                        if (t[k] == objective and section == "RHS")
+                        {
+                            objective_rhs = value;
+                            continue;
+                        }
+                        if (free_rows.count(t[k]))
+                        {
+                            continue;
+                        }
+                        const auto row = row_index.find(t[k]);
+                        if (row == row_index.end())
+                        {
+                            return fail("unknown row " + t[k]);
+                        }
+                        if (section == "RHS")
+                        {
+                            rhs[row->second] = value;
+                        }
+                        else
+                        {
+                            ranges[row->second] = value;
+                            has_range[row->second] = true;
+                        }
+                    }
+                }
+                else if (section == "BOUNDS")
+                {
+                    const std::string &type = t[0];
+                    const bool has_value = type == "UP" or type == "LO" or type == "FX" or type == "LI" or type == "UI";
+                    if (not has_value and type != "FR" and type != "MI" and type != "PL" and type != "BV")
+                    {
+                        return fail("unsupported bound type " + type);
+                    }
+                    /* The name of the bound vector is optional */
+                    const size_t expected = has_value ? 3 : 2;
+                    if (t.size() != expected and t.size() != expected + 1)
+                    {
+                        return fail("invalid bound");
+                    }
+                    const size_t name_at = t.size() - (has_value ? 2 : 1);
+                    const auto col = col_index.find(t[name_at]);
+                    if (col == col_index.end())
+                    {
+                        return fail("unknown column " + t[name_at]);
+                    }
+                    double value = 0.;
+                    if (has_value and not parseNumber(t.back(), value))
+                    {
+                        return fail("invalid number " + t.back());
+                    }
+
+                    Bounds &bounds = col_bounds[col->second];
+                    if (type == "UP" or type == "UI")
+                    {
+                        /* A negative upper bound on a variable without lower bound makes it unbounded below */
+                        if (value < 0. and bounds.lo == 0.)
+                        {
+                            bounds.lo = -inf;
+                        }
+                        bounds.up = value;
+                    }
+                    else if (type == "LO" or type == "LI")
+                    {
+                        bounds.lo = value;
+                    }
+                    else if (type == "FX")
+                    {
+                        bounds = {value, value};
+                    }
+                    else if (type == "FR")
+                    {
+                        bounds = {-inf, inf};
+                    }
+                    else if (type == "MI")
+                    {
+                        bounds.lo = -inf;
+                    }
+                    else if (type == "PL")
+                    {
+                        bounds.up = inf;
+                    }
+                    else
+                    {
+                        bounds = {0., 1.};
+                    }
+                }
+                else
+                {
+                    return fail("data outside of a section");
+                }
+            }
+
+            if (not any_content)
+            {
+                return false;
+            }
+            if (not ended)
+            {
+                return fail("missing ENDATA");
+            }
+
+            const int n = c.size();
+            Assembly assembly;
+            for (size_t i = 0; i < rows.size(); i++)
+            {
+                Bounds bounds = {rhs[i], rhs[i]};
+                const double range = std::abs(ranges[i]);
+                if (row_types[i] == 'E' and has_range[i])
+                {
+                    (ranges[i] > 0. ? bounds.up : bounds.lo) += ranges[i];
+                }
+                else if (row_types[i] == 'L')
+                {
+                    bounds.lo = has_range[i] ? rhs[i] - range : -inf;
+                }
+                else if (row_types[i] == 'G')
+                {
+                    bounds.up = has_range[i] ? rhs[i] + range : inf;
+                }
+
+                if (bounds.lo == bounds.up)
+                {
+                    assembly.equality(rows[i], bounds.lo);
+                    continue;
+                }
+                if (bounds.up < inf)
+                {
+                    assembly.inequality(rows[i], 1., bounds.up);
+                }
+                if (bounds.lo > -inf)
+                {
+                    assembly.inequality(rows[i], -1., -bounds.lo);
+                }
+            }
+            for (int j = 0; j < n; j++)
+            {
+                const Bounds &bounds = col_bounds[j];
+                const SparseRow unit = {{j, 1.}};
+                if (bounds.lo == bounds.up)
+                {
+                    assembly.equality(unit, bounds.lo);
+                    continue;
+                }
+                if (bounds.up < inf)
+                {
+                    assembly.inequality(unit, 1., bounds.up);
+                }
+                if (bounds.lo > -inf)
+                {
+                    assembly.inequality(unit, -1., -bounds.lo);
+                }
+            }
+            assembly.finish(n, problem);
+
+            problem.c = Eigen::Map<const Eigen::VectorXd>(c.data(), n);
+            if (problem.maximize)
+            {
+                problem.c = -problem.c;
+            }
+            problem.objective_offset = -objective_rhs;
+            return true;
+        }
+
+        /* A cone of CBF, over consecutive variables or constraint rows */
+        struct Cone
+        {
+            std::string type;
+            int dim;
+        };
+
+        bool readCones(const std::vector<std::string> &t, std::vector<Cone> &cones, int size, std::string &error)
+        {
+            Cone cone;
+            if (t.size() != 2 or not parseInt(t[1], cone.dim) or cone.dim <= 0)
+            {
+                error = "invalid cone";
+                return false;
+            }
+            cone.type = t[0];
+            if (cone.type != "F" and cone.type != "L+" and cone.type != "L-" and cone.type != "L=" and cone.type != "Q")
+            {
+                error = "unsupported cone " + cone.type;
+                return false;
+            }
+            cones.push_back(cone);
+            int total = 0;
+            for (const Cone &c : cones)
+            {
+                total += c.dim;
+            }
+            if (total > size)
+            {
+                error = "cones larger than their space";
+                return false;
+            }
+            return true;
+        }
+
+        /**
+         * Reads the whole stream. Variables x in their cones and constraints A x + b
+         * in their cones become rows of G and A; all linear rows come first, then the
+         * second order cones in the order of the file.
+         */
+        bool readCBF(std::istream &in, Problem &problem, std::string &error)
+        {
+            std::vector<std::vector<std::string>> lines;
+            std::string line;
+            while (std::getline(in, line))
+            {
+                std::vector<std::string> t = tokens(line.substr(0, line.find('#')));
+                if (not t.empty())
+                {
+                    lines.push_back(std::move(t));
+                }
+            }
+            if (lines.empty())
+            {
+                return false;
+            }
+
+            int n = -1, m = 0;
+            std::vector<Cone> var_cones, con_cones;
+            std::vector<double> c;
+            std::vector<SparseRow> rows;
+            std::vector<double> b;
+
+            size_t k = 0;
+            auto next = [&](size_t count) -> const std::vector<std::string> * {
+                if (k >= lines.size() or lines[k].size() != count)
+                {
+                    error = "malformed " + lines[k - 1][0];
+                    return nullptr;
+                }
+                return &lines[k++];
+            };
+            auto count = [&](int &value) {
+                const std::vector<std::string> *t = next(1);
+                return t and parseInt((*t)[0], value) and value >= 0;
+            };
+
+            while (k < lines.size())
+            {
+                const std::string keyword = lines[k++][0];
+                if (keyword == "VER" or keyword == "OBJSENSE")
+                {
+                    const std::vector<std::string> *t = next(1);
+                    if (not t)
+                    {
+                        return false;
+                    }
+                    if (keyword == "OBJSENSE")
+                    {
+                        problem.maximize = (*t)[0] == "MAX";
+                    }
+                }
+                else if (keyword == "VAR" or keyword == "CON")
+                {
+                    const std::vector<std::string> *t = next(2);
+                    int size, n_cones;
+                    if (not t or not parseInt((*t)[0], size) or not parseInt((*t)[1], n_cones) or size < 0 or n_cones < 0)
+                    {
+                        error = "malformed " + keyword;
+                        return false;
+                    }
+                    std::vector<Cone> &cones = keyword == "VAR" ? var_cones : con_cones;
+                    for (int i = 0; i < n_cones; i++)
+                    {
+                        if (k >= lines.size() or not readCones(lines[k++], cones, size, error))
+                        {
+                            return false;
+                        }
+                    }
+                    int total = 0;
+                    for (const Cone &cone : cones)
+                    {
+                        total += cone.dim;
+                    }
+                    if (total != size)
+                    {
+                        error = "cones do not cover the " + keyword + " space";
+                        return false;
+                    }
+                    if (keyword == "VAR")
+                    {
+                        n = size;
+                        c.assign(n, 0.);
+                    }
+                    else
+                    {
+                        m = size;
+                        rows.assign(m, SparseRow());
+                        b.assign(m, 0.);
+                    }
+                }
+                else if (keyword == "INT")
+                {
+                    int n_int;
+                    if (not count(n_int))
+                    {
+                        return false;
+                    }
+                    k += n_int; // read as the relaxation
+                }
+                else if (keyword == "OBJACOORD" or keyword == "ACOORD" or keyword == "BCOORD")
+                {
+                    int n_entries;
+                    if (not count(n_entries))
+                    {
+                        return false;
+                    }
+                    const size_t width = keyword == "ACOORD" ? 3 : 2;
+                    for (int e = 0; e < n_entries; e++)
+                    {
+                        const std::vector<std::string> *t = next(width);
+                        int index[2] = {0, 0};
+                        double value;
+                        if (not t or not parseInt((*t)[0], index[0]) or
+                            (width == 3 and not parseInt((*t)[1], index[1])) or
+                            not parseNumber(t->back(), value))
+                        {
+                            error = "malformed " + keyword;
+                            return false;
+                        }
+                        const bool in_range = keyword == "OBJACOORD" ? index[0] >= 0 and index[0] < n
+                                                                     : index[0] >= 0 and index[0] < m and
+                                                                           index[1] >= 0 and index[1] < n;
+                        if (not in_range)
+                        {
+                            error = keyword + " index out of range";
+                            return false;
+                        }
+                        if (keyword == "OBJACOORD")
+                        {
+                            c[index[0]] += value;
+                        }
+                        else if (keyword == "ACOORD")
+                        {
+                            rows[index[0]].emplace_back(index[1], value);
+                        }
+                        else
+                        {
+                            b[index[0]] += value;
+                        }
+                    }
+                }
+                else if (keyword == "OBJBCOORD")
+                {
+                    const std::vector<std::string> *t = next(1);
+                    if (not t or not parseNumber((*t)[0], problem.objective_offset))
+                    {
+                        error = "malformed OBJBCOORD";
+                        return false;
+                    }
+                }
+                else
+                {
+                    error = "unsupported keyword " + keyword;
+                    return false;
+                }
+            }
+            if (n < 0)
+            {
+                error = "missing VAR";
+                return false;
+            }
+
+            Assembly assembly;
+            for (const bool second_order : {false, true})
+            {
+                int start = 0;
+                for (const Cone &cone : var_cones)
+                {
+                    for (int j = start; j < start + cone.dim; j++)
+                    {
+                        const SparseRow unit = {{j, 1.}};
+                        if (cone.type == "L=" and not second_order)
+                        {
+                            assembly.equality(unit, 0.);
+                        }
+                        else if ((cone.type == "L+" and not second_order) or (cone.type == "Q" and second_order))
+                        {
+                            assembly.inequality(unit, -1., 0.);
+                        }
+                        else if (cone.type == "L-" and not second_order)
+                        {
+                            assembly.inequality(unit, 1., 0.);
+                        }
+                    }
+                    if (cone.type == "Q" and second_order)
+                    {
+                        assembly.soc_dims.push_back(cone.dim);
+                    }
+                    start += cone.dim;
+                }
+
+                start = 0;
+                for (const Cone &cone : con_cones)
+                {
+                    for (int i = start; i < start + cone.dim; i++)
+                    {
+                        if (cone.type == "L=" and not second_order)
+                        {
+                            assembly.equality(rows[i], -b[i]);
+                        }
+                        else if ((cone.type == "L+" and not second_order) or (cone.type == "Q" and second_order))
+                        {
+                            assembly.inequality(rows[i], -1., b[i]);
+                        }
+                        else if (cone.type == "L-" and not second_order)
+                        {
+                            assembly.inequality(rows[i], 1., -b[i]);
+                        }
+                    }
+                    if (cone.type == "Q" and second_order)
+                    {
+                        assembly.soc_dims.push_back(cone.dim);
+                    }
+                    start += cone.dim;
+                }
+            }
+            assembly.finish(n, problem);
+
+            problem.c = Eigen::Map<const Eigen::VectorXd>(c.data(), n);
+            if (problem.maximize)
+            {
+                problem.c = -problem.c;
+            }
+            return true;
+        }
+
+    } // namespace
+
+    ProblemFormat problemFormat(const std::string &path)
+    {
+        const size_t dot = path.rfind('.');
+        const std::string extension = dot == std::string::npos ? "" : path.substr(dot);
+        if (extension == ".mps" or extension == ".MPS")
+        {
+            return ProblemFormat::mps;
+        }
+        if (extension == ".cbf" or extension == ".CBF")
+        {
+            return ProblemFormat::cbf;
+        }
+        return ProblemFormat::binary;
+    }
+
+    bool readProblem(std::istream &in, ProblemFormat format, Problem &problem, std::string &error)
+    {
+        problem = Problem();
+        error.clear();
+        if (format == ProblemFormat::binary)
+        {
+            return in.peek() != std::char_traits<char>::eof() and readBinary(in, problem, error);
+        }
+        if (format == ProblemFormat::mps)
+        {
+            return readMPS(in, problem, error);
+        }
+        return readCBF(in, problem, error);
+    }
+
+    bool writeProblem(std::ostream &out, const Problem &problem)
+    {
+        const int32_t dims[4] = {int32_t(problem.c.size()), int32_t(problem.h.size()),
+                                 int32_t(problem.b.size()), int32_t(problem.soc_dims.size())};
+        const uint8_t maximize = problem.maximize;
+        const uint32_t length = problem.name.size();
+
+        out.write(magic, sizeof(magic));
+        out.write(reinterpret_cast<const char *>(&version), sizeof(version));
+        out.write(reinterpret_cast<const char *>(dims), sizeof(dims));
+        out.write(reinterpret_cast<const char *>(problem.soc_dims.data()), dims[3] * sizeof(int32_t));
+        writeMatrix(out, problem.G);
+        writeMatrix(out, problem.A);
+        out.write(reinterpret_cast<const char *>(problem.c.data()), dims[0] * sizeof(double));
+        out.write(reinterpret_cast<const char *>(problem.h.data()), dims[1] * sizeof(double));
+        out.write(reinterpret_cast<const char *>(problem.b.data()), dims[2] * sizeof(double));
+        out.write(reinterpret_cast<const char *>(&maximize), sizeof(maximize));
+        out.write(reinterpret_cast<const char *>(&problem.objective_offset), sizeof(problem.objective_offset));
+        out.write(reinterpret_cast<const char *>(&length), sizeof(length));
+        out.write(problem.name.data(), length);
+        return bool(out);
+    }
+
+    double objectiveValue(const Problem &problem, double pcost)
+    {
+        return (problem.maximize ? -pcost : pcost) + problem.objective_offset;
+    }
+
+} // namespace EiCOS
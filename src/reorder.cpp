@@ -0,0 +1,314 @@
+#include "eicos.hpp"
+
+#include <numeric>
+#include "printing.hpp"
+
+namespace EiCOS
+{
+
+    namespace
+    {
+
+        /**
+         * Reverse Cuthill-McKee ordering of a graph given by its adjacency lists.
+         * Every connected component starts at a vertex of minimum degree.
+         */
+        std::vector<int> reverseCuthillMcKee(const std::vector<std::vector<int>> &adjacency)
+        {
+            const int n = adjacency.size();
+
+            std::vector<int> by_degree(n);
+            std::iota(by_degree.begin(), by_degree.end(), 0);
+            std::stable_sort(by_degree.begin(), by_degree.end(), [&](int i, int j) {
+                return adjacency[i].size() < adjacency[j].size();
+            });
+
+            std::vector<int> order;
+            order.reserve(n);
+            std::vector<char> visited(n, false);
+            for (const int start : by_degree)
+            {
+                if (visited[start])
+                {
+                    continue;
+                }
+                visited[start] = true;
+                order.push_back(start);
+
+                /* Breadth first search, neighbours in the order of increasing degree */
+                for (size_t k = order.size() - 1; k < order.size(); k++)
+                {
+                    const size_t first = order.size();
+                    for (const int j : adjacency[order[k]])
+                    {
+                        if (not visited[j])
+                        {
+                            visited[j] = true;
+                            order.push_back(j);
+                        }
+                    }
+                    std::stable_sort(order.begin() + first, order.end(), [&](int i, int j) {
+                        return adjacency[i].size() < adjacency[j].size();
+                    });
+                }
+            }
+
+            std::reverse(order.begin(), order.end());
+            return order;
+        }
+
+        /* Applies a permutation of the rows and columns, the values become their old positions */
+        Eigen::SparseMatrix<double> permutePattern(const Eigen::SparseMatrix<double> &M,
+                                                   const std::vector<int> &row_pos,
+                                                   const std::vector<int> &col_pos)
+        {
+            std::vector<Eigen::Triplet<double>> triplets;
+            triplets.reserve(M.nonZeros());
+            for (int col = 0; col < M.outerSize(); col++)
+            {
+                for (Eigen::SparseMatrix<double>::InnerIterator it(M, col); it; ++it)
+                {
+                    triplets.emplace_back(row_pos[it.row()], col_pos[col], &it.value() - M.valuePtr());
+                }
+            }
+            Eigen::SparseMatrix<double> P(M.rows(), M.cols());
+            P.setFromTriplets(triplets.begin(), triplets.end());
+            return P;
+        }
+
+        std::vector<int> inverse(const std::vector<int> &order)
+        {
+            std::vector<int> pos(order.size());
+            for (size_t i = 0; i < order.size(); i++)
+            {
+                pos[order[i]] = i;
+            }
+            return pos;
+        }
+
+    } // namespace
+
+    /**
+     * Orders the variables by reverse Cuthill-McKee on the graph that links the
+     * variables of each constraint, so that the columns touched by a row end up
+     * close together. Linear and equality rows follow their first variable, cones
+     * are sorted by dimension and then by their first variable.
+     *
+     * Rows with more than a few times the average number of entries are left out
+     * of the graph, they would link most variables and hide the local structure.
+     */
+    void Solver::reorder()
+    {
+        assert(not matrix_free and not kkt_kernel and not arrow_ldlt);
+
+        if (equibrilated)
+        {
+            unsetEquilibration();
+        }
+
+        if (var_order.empty())
+        {
+            var_order.resize(n_var);
+            eq_order.resize(n_eq);
+            ineq_order.resize(n_ineq);
+            G_src.resize(G.nonZeros());
+            A_src.resize(A.nonZeros());
+            std::iota(var_order.begin(), var_order.end(), 0);
+            std::iota(eq_order.begin(), eq_order.end(), 0);
+            std::iota(ineq_order.begin(), ineq_order.end(), 0);
+            std::iota(G_src.begin(), G_src.end(), 0);
+            std::iota(A_src.begin(), A_src.end(), 0);
+        }
+
+        /* Variables of each linear row, equality row and cone */
+        std::vector<std::vector<int>> constraints;
+        auto addConstraint = [&](const SparseRows &rows, const Eigen::SparseMatrix<double> &M, size_t start, size_t count) {
+            std::vector<int> vars;
+            for (size_t row = start; row < start + count; row++)
+            {
+                for (SparseRows::InnerIterator it(rows, M, row); it; ++it)
+                {
+                    vars.push_back(it.col());
+                }
+            }
+            std::sort(vars.begin(), vars.end());
+            vars.erase(std::unique(vars.begin(), vars.end()), vars.end());
+            constraints.push_back(std::move(vars));
+        };
+        for (size_t row = 0; row < n_lc; row++)
+        {
+            addConstraint(G_csr, G, row, 1);
+        }
+        size_t cone_start = n_lc;
+        for (const SOCone &sc : so_cones)
+        {
+            addConstraint(G_csr, G, cone_start, sc.dim);
+            cone_start += sc.dim;
+        }
+        for (size_t row = 0; row < n_eq; row++)
+        {
+            addConstraint(A_csr, A, row, 1);
+        }
+
+        const size_t nnz = G.nonZeros() + A.nonZeros();
+        const size_t dense_limit = std::max<size_t>(16, 4 * nnz / std::max<size_t>(1, constraints.size()));
+        std::vector<std::vector<int>> adjacency(n_var);
+        for (const std::vector<int> &vars : constraints)
+        {
+            if (vars.size() > dense_limit)
+            {
+                continue;
+            }
+            for (const int i : vars)
+            {
+                adjacency[i].insert(adjacency[i].end(), vars.begin(), vars.end());
+            }
+        }
+        for (size_t i = 0; i < n_var; i++)
+        {
+            std::vector<int> &neighbours = adjacency[i];
+            std::sort(neighbours.begin(), neighbours.end());
+            neighbours.erase(std::unique(neighbours.begin(), neighbours.end()), neighbours.end());
+            neighbours.erase(std::remove(neighbours.begin(), neighbours.end(), int(i)), neighbours.end());
+        }
+
+        const std::vector<int> var_perm = reverseCuthillMcKee(adjacency);
+        const std::vector<int> var_pos = inverse(var_perm);
+
+        /* Position of the first variable of each constraint, empty constraints go last */
+        std::vector<int> first(constraints.size());
+        for (size_t k = 0; k < constraints.size(); k++)
+        {
+            first[k] = n_var;
+            for (const int i : constraints[k])
+            {
+                first[k] = std::min(first[k], var_pos[i]);
+            }
+        }
+        auto byFirst = [&](size_t offset) {
+            return [&first, offset](int i, int j) { return first[offset + i] < first[offset + j]; };
+        };
+
+        std::vector<int> lc_perm(n_lc), cone_perm(n_sc), eq_perm(n_eq);
+        std::iota(lc_perm.begin(), lc_perm.end(), 0);
+        std::iota(cone_perm.begin(), cone_perm.end(), 0);
+        std::iota(eq_perm.begin(), eq_perm.end(), 0);
+        std::stable_sort(lc_perm.begin(), lc_perm.end(), byFirst(0));
+        std::stable_sort(eq_perm.begin(), eq_perm.end(), byFirst(n_lc + n_sc));
+        std::stable_sort(cone_perm.begin(), cone_perm.end(), [&](int i, int j) {
+            if (so_cones[i].dim != so_cones[j].dim)
+            {
+                return so_cones[i].dim < so_cones[j].dim;
+            }
+            return first[n_lc + i] < first[n_lc + j];
+        });
+
+        /* Rows of G: linear rows, then the cones as a whole */
+        std::vector<size_t> cone_starts(n_sc);
+        cone_start = n_lc;
+        for (size_t k = 0; k < n_sc; k++)
+        {
+            cone_starts[k] = cone_start;
+            cone_start += so_cones[k].dim;
+        }
+        std::vector<int> ineq_perm(lc_perm);
+        Eigen::VectorXi soc_dims(n_sc);
+        for (size_t k = 0; k < n_sc; k++)
+        {
+            const SOCone &sc = so_cones[cone_perm[k]];
+            for (size_t i = 0; i < sc.dim; i++)
+            {
+                ineq_perm.push_back(cone_starts[cone_perm[k]] + i);
+            }
+            soc_dims(k) = sc.dim;
+        }
+
+        /* Permute the problem, the new values refer to the user data through the old ones */
+        const Eigen::SparseMatrix<double> G_pos = permutePattern(G, inverse(ineq_perm), var_pos);
+        const Eigen::SparseMatrix<double> A_pos = permutePattern(A, inverse(eq_perm), var_pos);
+        Eigen::SparseMatrix<double> G_new = G_pos, A_new = A_pos;
+        std::vector<int> G_src_new(G_pos.nonZeros()), A_src_new(A_pos.nonZeros());
+        for (Eigen::Index k = 0; k < G_pos.nonZeros(); k++)
+        {
+            const int old = G_pos.valuePtr()[k];
+            G_new.valuePtr()[k] = G.valuePtr()[old];
+            G_src_new[k] = G_src[old];
+        }
+        for (Eigen::Index k = 0; k < A_pos.nonZeros(); k++)
+        {
+            const int old = A_pos.valuePtr()[k];
+            A_new.valuePtr()[k] = A.valuePtr()[old];
+            A_src_new[k] = A_src[old];
+        }
+        G_src.swap(G_src_new);
+        A_src.swap(A_src_new);
+
+        auto compose = [](std::vector<int> &order, const std::vector<int> &perm) {
+            std::vector<int> composed(perm.size());
+            for (size_t i = 0; i < perm.size(); i++)
+            {
+                composed[i] = order[perm[i]];
+            }
+            order.swap(composed);
+        };
+        compose(var_order, var_perm);
+        compose(eq_order, eq_perm);
+        compose(ineq_order, ineq_perm);
+
+        const Eigen::VectorXd c_new = gatherInternal(c, var_perm);
+        const Eigen::VectorXd h_new = gatherInternal(h, ineq_perm);
+        const Eigen::VectorXd b_new = gatherInternal(b, eq_perm);
+
+        print_dbg("Reordered {} variables, {} rows and {} cones\n", n_var, n_eq + n_lc, n_sc);
+
+        sub_solvers.clear();
+        build(G_new, A_new, c_new, h_new, b_new, soc_dims);
+    }
+
+    Eigen::VectorXd Solver::gatherInternal(const Eigen::VectorXd &v, const std::vector<int> &order)
+    {
+        if (order.empty())
+        {
+            return v;
+        }
+        Eigen::VectorXd internal(order.size());
+        for (size_t i = 0; i < order.size(); i++)
+        {
+            internal(i) = v(order[i]);
+        }
+        return internal;
+    }
+
+    Eigen::VectorXd Solver::scatterUser(const Eigen::VectorXd &v, const std::vector<int> &order)
+    {
+        if (order.empty())
+        {
+            return v;
+        }
+        Eigen::VectorXd user(order.size());
+        for (size_t i = 0; i < order.size(); i++)
+        {
+            user(order[i]) = v(i);
+        }
+        return user;
+    }
+
+    void Solver::copyValues(const double *Gpr, const double *Apr)
+    {
+        if (Gpr)
+        {
+            for (Eigen::Index k = 0; k < G.nonZeros(); k++)
+            {
+                G.valuePtr()[k] = Gpr[G_src.empty() ? k : G_src[k]];
+            }
+        }
+        if (Apr)
+        {
+            for (Eigen::Index k = 0; k < A.nonZeros(); k++)
+            {
+                A.valuePtr()[k] = Apr[A_src.empty() ? k : A_src[k]];
+            }
+        }
+    }
+
+} // namespace EiCOS
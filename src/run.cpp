@@ -1,53 +1,359 @@
 #include "eicos.hpp"
 #include "data_MPC01.hpp"
-#include "timing.hpp"
+#include "problem_io.hpp"
 
-#include "printing.hpp"
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <vector>
 
-int main()
+/**
+ * eicos_test_problem [-j jobs] [-f binary|mps|cbf] [-s] [file ...]
+ *
+ * Solves the problems of the files and writes one JSON line per problem to stdout,
+ * with the exit code, the statistics of the solve and the times of setup and solve.
+ * Binary files may hold any number of problems, "-" reads stdin. Without files, the
+ * built-in MPC01 problem is solved.
+ *
+ *   -j  problems solved at the same time, 0 for one per hardware thread (default 1)
+ *   -f  format of all files, instead of the one of the extension
+ *   -s  adds x, y, z and s to the output
+ */
+namespace
 {
-    double t0 = tic();
 
-    Eigen::SparseMatrix<double> G_;
-    Eigen::SparseMatrix<double> A_;
-    Eigen::VectorXd c_;
-    Eigen::VectorXd h_;
-    Eigen::VectorXd b_;
-    Eigen::VectorXi q_;
+    const char *usage = "usage: eicos_test_problem [-j jobs] [-f binary|mps|cbf] [-s] [file ...]\n";
 
-    if (Gpr and Gjc and Gir)
+    const char *statusName(EiCOS::exitcode code)
     {
-        G_ = Eigen::Map<Eigen::SparseMatrix<double>>(m, n, Gjc[n], Gjc, Gir, Gpr);
-        q_ = Eigen::Map<Eigen::VectorXi>(q, ncones);
-        h_ = Eigen::Map<Eigen::VectorXd>(h, m);
+        switch (code)
+        {
+        case EiCOS::exitcode::optimal:
+            return "optimal";
+        case EiCOS::exitcode::primal_infeasible:
+            return "primal_infeasible";
+        case EiCOS::exitcode::dual_infeasible:
+            return "dual_infeasible";
+        case EiCOS::exitcode::maxit:
+            return "maxit";
+        case EiCOS::exitcode::numerics:
+            return "numerics";
+        case EiCOS::exitcode::outcone:
+            return "outcone";
+        case EiCOS::exitcode::interrupted:
+            return "interrupted";
+        case EiCOS::exitcode::close_to_optimal:
+            return "close_to_optimal";
+        case EiCOS::exitcode::close_to_primal_infeasible:
+            return "close_to_primal_infeasible";
+        case EiCOS::exitcode::close_to_dual_infeasible:
+            return "close_to_dual_infeasible";
+        case EiCOS::exitcode::not_converged_yet:
+            return "not_converged_yet";
+        default:
+            return "fatal";
+        }
     }
-    if (Apr and Ajc and Air)
+
+    /* JSON has no literals for infinities and NaN */
+    void appendNumber(std::string &out, double value)
+    {
+        if (not std::isfinite(value))
+        {
+            out += "null";
+            return;
+        }
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "%.17g", value);
+        out += buffer;
+    }
+
+    void appendString(std::string &out, const std::string &text)
+    {
+        out += '"';
+        for (const char ch : text)
+        {
+            if (ch == '"' or ch == '\\')
+            {
+                out += '\\';
+                out += ch;
+            }
+            else if (static_cast<unsigned char>(ch) < 0x20)
+            {
+                char buffer[8];
+                std::snprintf(buffer, sizeof(buffer), "\\u%04x", ch);
+                out += buffer;
+            }
+            else
+            {
+                out += ch;
+            }
+        }
+        out += '"';
+    }
+
+    void appendField(std::string &out, const char *key, double value)
+    {
+        out += ",\"";
+        out += key;
+        out += "\":";
+        appendNumber(out, value);
+    }
+
+    void appendVector(std::string &out, const char *key, const Eigen::VectorXd &v)
     {
-        A_ = Eigen::Map<Eigen::SparseMatrix<double>>(p, n, Ajc[n], Ajc, Air, Apr);
-        b_ = Eigen::Map<Eigen::VectorXd>(b, p);
+        out += ",\"";
+        out += key;
+        out += "\":[";
+        for (Eigen::Index i = 0; i < v.size(); i++)
+        {
+            if (i > 0)
+            {
+                out += ',';
+            }
+            appendNumber(out, v(i));
+        }
+        out += ']';
     }
-    if (c)
+
+    EiCOS::Problem builtinProblem()
     {
-        c_ = Eigen::Map<Eigen::VectorXd>(c, n);
+        EiCOS::Problem problem;
+        problem.name = "MPC01";
+        problem.G.resize(0, n);
+        problem.A.resize(0, n);
+        if (Gpr and Gjc and Gir)
+        {
+            problem.G = Eigen::Map<Eigen::SparseMatrix<double>>(m, n, Gjc[n], Gjc, Gir, Gpr);
+            problem.soc_dims = Eigen::Map<Eigen::VectorXi>(q, ncones);
+            problem.h = Eigen::Map<Eigen::VectorXd>(h, m);
+        }
+        if (Apr and Ajc and Air)
+        {
+            problem.A = Eigen::Map<Eigen::SparseMatrix<double>>(p, n, Ajc[n], Ajc, Air, Apr);
+            problem.b = Eigen::Map<Eigen::VectorXd>(b, p);
+        }
+        problem.c = Eigen::Map<Eigen::VectorXd>(c, n);
+        return problem;
     }
 
-    EiCOS::Solver solver(G_, A_, c_, h_, b_, q_);
-    EiCOS::exitcode exitcode;
+    /**
+     * Hands out the problems of the files in order, to any number of threads.
+     * A file that cannot be read gives one error, the rest of it is skipped.
+     */
+    class Input
+    {
+    public:
+        Input(const std::vector<std::string> &paths, const EiCOS::ProblemFormat *format)
+            : paths(paths), format(format) {}
+
+        // false when all files are read, otherwise a problem or an error
+        bool next(EiCOS::Problem &problem, size_t &index, std::string &source, std::string &error)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            error.clear();
+            while (current < paths.size())
+            {
+                const std::string &path = paths[current];
+                const EiCOS::ProblemFormat file_format = format ? *format : EiCOS::problemFormat(path);
+                if (not in)
+                {
+                    if (path == "-")
+                    {
+                        in = &std::cin;
+                    }
+                    else
+                    {
+                        file.open(path, std::ios::binary);
+                        in = &file;
+                    }
+                    if (not *in)
+                    {
+                        error = "cannot open file";
+                    }
+                }
+
+                source = path;
+                if (error.empty() and EiCOS::readProblem(*in, file_format, problem, error))
+                {
+                    if (file_format != EiCOS::ProblemFormat::binary)
+                    {
+                        closeFile(); // one problem per file, CBF reads up to the end
+                    }
+                    index = n_read++;
+                    return true;
+                }
 
-    print("Time for setup:    {:.3}ms\n", toc(t0));
+                closeFile();
+                if (not error.empty())
+                {
+                    index = n_read++;
+                    return true;
+                }
+            }
+            return false;
+        }
 
-    t0 = tic();
-    exitcode = solver.solve();
-    print("Time for solve:    {:.3}ms\n", toc(t0));
+    private:
+        void closeFile()
+        {
+            if (in == &file)
+            {
+                file.close();
+                file.clear();
+            }
+            in = nullptr;
+            current++;
+        }
 
-    // // test data update
-    t0 = tic();
-    solver.updateData(G_, A_, c_, h_, b_);
-    print("Time for update:    {:.3}ms\n", toc(t0));
+        std::mutex mutex;
+        const std::vector<std::string> paths;
+        const EiCOS::ProblemFormat *format;
+        size_t current = 0;
+        std::istream *in = nullptr;
+        std::ifstream file;
+        size_t n_read = 0;
+    };
 
-    t0 = tic();
-    exitcode = solver.solve();
-    print("Time for solve:    {:.3}ms\n", toc(t0));
+    std::string solveProblem(const EiCOS::Problem &problem, size_t index, bool with_solution)
+    {
+        const auto t0 = std::chrono::steady_clock::now();
+        EiCOS::Solver solver(problem.G, problem.A, problem.c, problem.h, problem.b, problem.soc_dims);
+        const double setup_time = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+        const EiCOS::exitcode code = solver.solve();
+
+        const EiCOS::Information &info = solver.getInfo();
+        const EiCOS::SolveStatistics &statistics = solver.getStatistics();
+
+        std::string line = "{\"index\":" + std::to_string(index) + ",\"name\":";
+        appendString(line, problem.name);
+        line += ",\"status\":\"" + std::string(statusName(code)) + "\",\"exitcode\":" + std::to_string(int(code));
+        line += ",\"iterations\":" + std::to_string(info.iter);
+        appendField(line, "objective", EiCOS::objectiveValue(problem, info.pcost));
+        appendField(line, "pcost", info.pcost);
+        appendField(line, "dcost", info.dcost);
+        appendField(line, "pres", info.pres);
+        appendField(line, "dres", info.dres);
+        appendField(line, "gap", info.gap);
+        appendField(line, "setup_ms", setup_time);
+        appendField(line, "solve_ms", statistics.solve_time * 1e3);
+        appendField(line, "factor_ms", statistics.factor_time * 1e3);
+        line += ",\"factorizations\":" + std::to_string(statistics.factorizations);
+        line += ",\"refinement_steps\":" + std::to_string(statistics.refinement_steps);
+        if (with_solution)
+        {
+            appendVector(line, "x", solver.solution());
+            appendVector(line, "y", solver.dualEquality());
+            appendVector(line, "z", solver.dualConic());
+            appendVector(line, "s", solver.slack());
+        }
+        return line + "}\n";
+    }
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    size_t jobs = 1;
+    bool with_solution = false;
+    EiCOS::ProblemFormat format;
+    const EiCOS::ProblemFormat *forced_format = nullptr;
+    std::vector<std::string> paths;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const std::string arg = argv[i];
+        if (arg == "-j" and i + 1 < argc)
+        {
+            jobs = std::strtoul(argv[++i], nullptr, 10);
+        }
+        else if (arg == "-f" and i + 1 < argc)
+        {
+            const std::string name = argv[++i];
+            if (name != "binary" and name != "mps" and name != "cbf")
+            {
+                std::fputs(usage, stderr);
+                return 2;
+            }
+            format = name == "mps" ? EiCOS::ProblemFormat::mps : name == "cbf" ? EiCOS::ProblemFormat::cbf
+                                                                                : EiCOS::ProblemFormat::binary;
+            forced_format = &format;
+        }
+        else if (arg == "-s")
+        {
+            with_solution = true;
+        }
+        else if (arg.size() > 1 and arg[0] == '-')
+        {
+            std::fputs(usage, stderr);
+            return 2;
+        }
+        else
+        {
+            paths.push_back(arg);
+        }
+    }
+
+    if (paths.empty())
+    {
+        std::fputs(solveProblem(builtinProblem(), 0, with_solution).c_str(), stdout);
+        return 0;
+    }
+
+    Input input(paths, forced_format);
+    std::mutex output;
+    std::atomic<bool> failed{false};
+
+    /* With several jobs, each one solves whole problems on a pool of its own thread */
+    auto work = [&](size_t) {
+        EiCOS::ThreadPool single(1);
+        const EiCOS::ThreadPool::Scope scope(jobs == 1 ? nullptr : &single);
+        EiCOS::Problem problem;
+        size_t index;
+        std::string source, error;
+        while (input.next(problem, index, source, error))
+        {
+            std::string line;
+            if (error.empty())
+            {
+                if (problem.name.empty())
+                {
+                    problem.name = source;
+                }
+                line = solveProblem(problem, index, with_solution);
+            }
+            else
+            {
+                line = "{\"index\":" + std::to_string(index) + ",\"name\":";
+                appendString(line, source);
+                line += ",\"error\":";
+                appendString(line, error);
+                line += "}\n";
+                failed = true;
+            }
+
+            std::lock_guard<std::mutex> lock(output);
+            std::fputs(line.c_str(), stdout);
+            std::fflush(stdout);
+        }
+    };
+
+    if (jobs == 1)
+    {
+        work(0);
+    }
+    else
+    {
+        EiCOS::ThreadPool pool(jobs);
+        pool.parallelFor(pool.size(), work);
+    }
 
-    assert("Solution not optimal!" && exitcode == EiCOS::exitcode::optimal);
-}
\ No newline at end of file
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,879 @@
+#include "server.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <type_traits>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace EiCOS
+{
+
+    namespace
+    {
+
+        static_assert(std::is_trivially_copyable<Information>::value, "Information is sent as raw bytes");
+
+        enum class MessageType : uint32_t
+        {
+            hello = 1,
+            setup = 2,
+            solve = 3
+        };
+
+        struct Header
+        {
+            MessageType type;
+            uint32_t reserved;
+            uint64_t size;
+        };
+
+        bool writeAll(int fd, const void *data, size_t size)
+        {
+            const char *bytes = static_cast<const char *>(data);
+            while (size > 0)
+            {
+                const ssize_t written = send(fd, bytes, size, MSG_NOSIGNAL);
+                if (written < 0 and errno == EINTR)
+                {
+                    continue;
+                }
+                if (written <= 0)
+                {
+                    return false;
+                }
+                bytes += written;
+                size -= written;
+            }
+            return true;
+        }
+
+        bool readAll(int fd, void *data, size_t size)
+        {
+            char *bytes = static_cast<char *>(data);
+            while (size > 0)
+            {
+                const ssize_t n_read = recv(fd, bytes, size, 0);
+                if (n_read < 0 and errno == EINTR)
+                {
+                    continue;
+                }
+                if (n_read <= 0)
+                {
+                    return false;
+                }
+                bytes += n_read;
+                size -= n_read;
+            }
+            return true;
+        }
+
+        /* Sends the first byte with the descriptor attached, the rest follows as usual */
+        bool writeWithDescriptor(int fd, const void *data, size_t size, int passed_fd)
+        {
+            char control[CMSG_SPACE(sizeof(int))] = {};
+            iovec io = {const_cast<void *>(data), 1};
+            msghdr message = {};
+            message.msg_iov = &io;
+            message.msg_iovlen = 1;
+            message.msg_control = control;
+            message.msg_controllen = sizeof(control);
+            cmsghdr *cmsg = CMSG_FIRSTHDR(&message);
+            cmsg->cmsg_level = SOL_SOCKET;
+            cmsg->cmsg_type = SCM_RIGHTS;
+            cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+            std::memcpy(CMSG_DATA(cmsg), &passed_fd, sizeof(int));
+
+            ssize_t written;
+            do
+            {
+                written = sendmsg(fd, &message, MSG_NOSIGNAL);
+            } while (written < 0 and errno == EINTR);
+            return written == 1 and writeAll(fd, static_cast<const char *>(data) + 1, size - 1);
+        }
+
+        /* Keeps the first descriptor that arrives with the data, further ones are closed */
+        bool readWithDescriptor(int fd, void *data, size_t size, int &passed_fd)
+        {
+            char *bytes = static_cast<char *>(data);
+            while (size > 0)
+            {
+                char control[CMSG_SPACE(sizeof(int))];
+                iovec io = {bytes, size};
+                msghdr message = {};
+                message.msg_iov = &io;
+                message.msg_iovlen = 1;
+                message.msg_control = control;
+                message.msg_controllen = sizeof(control);
+                const ssize_t n_read = recvmsg(fd, &message, MSG_CMSG_CLOEXEC);
+                if (n_read < 0 and errno == EINTR)
+                {
+                    continue;
+                }
+                if (n_read <= 0)
+                {
+                    return false;
+                }
+                for (cmsghdr *cmsg = CMSG_FIRSTHDR(&message); cmsg; cmsg = CMSG_NXTHDR(&message, cmsg))
+                {
+                    if (cmsg->cmsg_level == SOL_SOCKET and cmsg->cmsg_type == SCM_RIGHTS)
+                    {
+                        int received;
+                        std::memcpy(&received, CMSG_DATA(cmsg), sizeof(int));
+                        if (passed_fd < 0)
+                        {
+                            passed_fd = received;
+                        }
+                        else
+                        {
+                            close(received);
+                        }
+                    }
+                }
+                bytes += n_read;
+                size -= n_read;
+            }
+            return true;
+        }
+
+        bool sendMessage(int fd, MessageType type, const std::vector<char> &payload, int passed_fd = -1)
+        {
+            const Header header = {type, 0, payload.size()};
+            const bool sent = passed_fd < 0 ? writeAll(fd, &header, sizeof(header))
+                                            : writeWithDescriptor(fd, &header, sizeof(header), passed_fd);
+            return sent and writeAll(fd, payload.data(), payload.size());
+        }
+
+        /* Payloads are limited, so a broken peer cannot make us allocate without bound */
+        bool receiveMessage(int fd, Header &header, std::vector<char> &payload)
+        {
+            const uint64_t max_payload = uint64_t(1) << 34;
+            if (not readAll(fd, &header, sizeof(header)) or header.size > max_payload)
+            {
+                return false;
+            }
+            payload.resize(header.size);
+            return readAll(fd, payload.data(), payload.size());
+        }
+
+        /* Same, a descriptor passed with the header is returned in passed_fd, else it is -1 */
+        bool receiveMessage(int fd, Header &header, std::vector<char> &payload, int &passed_fd)
+        {
+            const uint64_t max_payload = uint64_t(1) << 34;
+            passed_fd = -1;
+            if (not readWithDescriptor(fd, &header, sizeof(header), passed_fd) or header.size > max_payload)
+            {
+                return false;
+            }
+            payload.resize(header.size);
+            return readAll(fd, payload.data(), payload.size());
+        }
+
+        /**
+         * Maps the value slots passed by a client, read-only. The memory must be sealed
+         * against shrinking, so the client cannot cut it under the mapping, and it must
+         * hold all slots.
+         */
+        const double *mapSlots(int memory_fd, size_t bytes)
+        {
+            struct stat status;
+            const int seals = fcntl(memory_fd, F_GET_SEALS);
+            if (seals < 0 or not(seals & F_SEAL_SHRINK) or
+                fstat(memory_fd, &status) != 0 or status.st_size < 0 or size_t(status.st_size) < bytes)
+            {
+                return nullptr;
+            }
+            void *memory = mmap(nullptr, bytes, PROT_READ, MAP_SHARED, memory_fd, 0);
+            return memory == MAP_FAILED ? nullptr : static_cast<const double *>(memory);
+        }
+
+        template <typename T>
+        void append(std::vector<char> &payload, const T *values, size_t count)
+        {
+            if (count == 0)
+            {
+                return;
+            }
+            const char *bytes = reinterpret_cast<const char *>(values);
+            payload.insert(payload.end(), bytes, bytes + count * sizeof(T));
+        }
+
+        class Reader
+        {
+        public:
+            explicit Reader(const std::vector<char> &payload)
+                : position(payload.data()), end(payload.data() + payload.size()) {}
+
+            template <typename T>
+            bool read(T *values, size_t count)
+            {
+                const size_t size = count * sizeof(T);
+                if (size_t(end - position) < size)
+                {
+                    return false;
+                }
+                std::memcpy(values, position, size);
+                position += size;
+                return true;
+            }
+
+            template <typename T>
+            bool read(std::vector<T> &values, size_t count)
+            {
+                if (size_t(end - position) < count * sizeof(T))
+                {
+                    return false;
+                }
+                values.resize(count);
+                return read(values.data(), count);
+            }
+
+        private:
+            const char *position;
+            const char *end;
+        };
+
+        /* FNV-1a of the integer part of a setup message */
+        uint64_t structureId(const std::vector<const std::vector<int> *> &parts)
+        {
+            uint64_t hash = 0xcbf29ce484222325;
+            for (const std::vector<int> *part : parts)
+            {
+                for (const int value : *part)
+                {
+                    for (int byte = 0; byte < 4; byte++)
+                    {
+                        hash ^= (uint32_t(value) >> (8 * byte)) & 0xff;
+                        hash *= 0x100000001b3;
+                    }
+                }
+                hash ^= 0xff;
+                hash *= 0x100000001b3;
+            }
+            return hash == 0 ? 1 : hash;
+        }
+
+        /* Compressed columns with rows in range and strictly increasing within each column */
+        bool validPattern(const std::vector<int> &jc, const std::vector<int> &ir, int rows)
+        {
+            if (jc.front() != 0 or size_t(jc.back()) != ir.size())
+            {
+                return false;
+            }
+            for (size_t col = 0; col + 1 < jc.size(); col++)
+            {
+                if (jc[col] > jc[col + 1])
+                {
+                    return false;
+                }
+                for (int k = jc[col]; k < jc[col + 1]; k++)
+                {
+                    if (ir[k] < 0 or ir[k] >= rows or (k > jc[col] and ir[k] <= ir[k - 1]))
+                    {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+        bool finiteValues(const std::vector<double> &values)
+        {
+            return std::all_of(values.begin(), values.end(), [](double value) { return std::isfinite(value); });
+        }
+
+    } // namespace
+
+    struct SolverServer::Structure
+    {
+        int n, m, p, l;
+        std::vector<int> q, Gjc, Gir, Ajc, Air;
+
+        std::mutex mutex;
+        std::vector<std::unique_ptr<Solver>> idle;
+
+        size_t valueCount() const { return Gir.size() + Air.size() + n + m + p; }
+
+        bool samePattern(const Structure &other) const
+        {
+            return n == other.n and m == other.m and p == other.p and l == other.l and q == other.q and
+                   Gjc == other.Gjc and Gir == other.Gir and Ajc == other.Ajc and Air == other.Air;
+        }
+
+        /**
+         * Solves with the values Gpr, Apr, c, h, b, on an idle solver if there is one.
+         * The values are checked after they have been copied, as the client can still
+         * write to its slots, and non-finite ones are rejected without a solver.
+         */
+        std::unique_ptr<Solver> solve(const double *values, exitcode &code, std::atomic<size_t> &n_created)
+        {
+            const double *Gpr = values;
+            const double *Apr = Gpr + Gir.size();
+            const Eigen::SparseMatrix<double> G = Eigen::Map<const Eigen::SparseMatrix<double>>(m, n, Gir.size(), Gjc.data(), Gir.data(), Gpr);
+            const Eigen::SparseMatrix<double> A = Eigen::Map<const Eigen::SparseMatrix<double>>(p, n, Air.size(), Ajc.data(), Air.data(), Apr);
+            const Eigen::VectorXd c = Eigen::Map<const Eigen::VectorXd>(Apr + Air.size(), n);
+            const Eigen::VectorXd h = Eigen::Map<const Eigen::VectorXd>(Apr + Air.size() + n, m);
+            const Eigen::VectorXd b = Eigen::Map<const Eigen::VectorXd>(Apr + Air.size() + n + m, p);
+            if (not(G.coeffs().allFinite() and A.coeffs().allFinite() and c.allFinite() and h.allFinite() and b.allFinite()))
+            {
+                code = exitcode::fatal;
+                return nullptr;
+            }
+
+            std::unique_ptr<Solver> solver;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (not idle.empty())
+                {
+                    solver = std::move(idle.back());
+                    idle.pop_back();
+                }
+            }
+
+            if (solver)
+            {
+                solver->updateData(G, A, c, h, b);
+            }
+            else
+            {
+                solver = std::make_unique<Solver>(G, A, c, h, b, Eigen::Map<const Eigen::VectorXi>(q.data(), q.size()));
+                n_created++;
+            }
+            code = solver->solve();
+            return solver;
+        }
+
+        void release(std::unique_ptr<Solver> solver, size_t max_idle)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (idle.size() < max_idle)
+            {
+                idle.push_back(std::move(solver));
+            }
+        }
+    };
+
+    SolverServer::SolverServer(const std::string &socket_path, size_t max_idle)
+        : socket_path(socket_path), max_idle(max_idle)
+    {
+        sockaddr_un address = {};
+        address.sun_family = AF_UNIX;
+        if (socket_path.size() >= sizeof(address.sun_path))
+        {
+            return;
+        }
+        std::strcpy(address.sun_path, socket_path.c_str());
+
+        listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        unlink(socket_path.c_str());
+        if (listen_fd < 0 or
+            bind(listen_fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0 or
+            listen(listen_fd, 64) != 0)
+        {
+            if (listen_fd >= 0)
+            {
+                close(listen_fd);
+            }
+            listen_fd = -1;
+        }
+    }
+
+    SolverServer::~SolverServer()
+    {
+        stop();
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            clients_done.wait(lock, [this] { return client_threads.empty(); });
+        }
+        joinFinished();
+        if (listen_fd >= 0)
+        {
+            close(listen_fd);
+            unlink(socket_path.c_str());
+        }
+    }
+
+    bool SolverServer::listening() const
+    {
+        return listen_fd >= 0;
+    }
+
+    void SolverServer::run()
+    {
+        while (listen_fd >= 0 and not stopping)
+        {
+            const int fd = accept(listen_fd, nullptr, nullptr);
+            if (fd < 0)
+            {
+                if (errno == EINTR and not stopping)
+                {
+                    continue;
+                }
+                return;
+            }
+
+            joinFinished();
+
+            std::lock_guard<std::mutex> lock(mutex);
+            if (stopping)
+            {
+                close(fd);
+                return;
+            }
+            const uint64_t connection = n_connections++;
+            client_fds.insert(fd);
+            client_threads.emplace(connection, std::thread([this, fd, connection] { serve(fd, connection); }));
+        }
+    }
+
+    /* Threads of closed connections have ended or are about to, so the joins do not wait */
+    void SolverServer::joinFinished()
+    {
+        std::vector<std::thread> finished;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            finished.swap(finished_threads);
+        }
+        for (std::thread &thread : finished)
+        {
+            thread.join();
+        }
+    }
+
+    /* Wakes up accept and the reads of the connections */
+    void SolverServer::stop()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+        if (listen_fd >= 0)
+        {
+            shutdown(listen_fd, SHUT_RDWR);
+        }
+        for (const int fd : client_fds)
+        {
+            shutdown(fd, SHUT_RDWR);
+        }
+    }
+
+    size_t SolverServer::structures() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return structure_map.size();
+    }
+
+    size_t SolverServer::solversCreated() const
+    {
+        return n_created;
+    }
+
+    std::shared_ptr<SolverServer::Structure> SolverServer::findStructure(uint64_t id) const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        const auto entry = structure_map.find(id);
+        return entry == structure_map.end() ? nullptr : entry->second;
+    }
+
+    /**
+     * Parses and checks a setup message. A new structure gets a warm solver for the
+     * values of the message, a known one is only looked up. The id is a hash of the
+     * pattern, so a structure is only reused if its whole pattern matches.
+     */
+    std::shared_ptr<SolverServer::Structure> SolverServer::registerStructure(const std::vector<char> &payload, uint64_t &id)
+    {
+        auto structure = std::make_shared<Structure>();
+        Reader reader(payload);
+        int dims[5];
+        if (not reader.read(dims, 5))
+        {
+            return nullptr;
+        }
+        structure->n = dims[0];
+        structure->m = dims[1];
+        structure->p = dims[2];
+        structure->l = dims[3];
+        const int ncones = dims[4];
+        if (structure->n < 0 or structure->m < 0 or structure->p < 0 or structure->l < 0 or ncones < 0 or
+            not reader.read(structure->q, ncones) or
+            not reader.read(structure->Gjc, structure->n + 1) or
+            not reader.read(structure->Gir, std::max(structure->Gjc.back(), 0)) or
+            not reader.read(structure->Ajc, structure->n + 1) or
+            not reader.read(structure->Air, std::max(structure->Ajc.back(), 0)))
+        {
+            return nullptr;
+        }
+
+        int cone_rows = structure->l;
+        for (const int dim : structure->q)
+        {
+            cone_rows += dim;
+            if (dim <= 0)
+            {
+                return nullptr;
+            }
+        }
+        if (cone_rows != structure->m or
+            not validPattern(structure->Gjc, structure->Gir, structure->m) or
+            not validPattern(structure->Ajc, structure->Air, structure->p))
+        {
+            return nullptr;
+        }
+
+        const std::vector<int> dim_list(dims, dims + 5);
+        id = structureId({&dim_list, &structure->q, &structure->Gjc, &structure->Gir, &structure->Ajc, &structure->Air});
+
+        std::vector<double> values;
+        if (not reader.read(values, structure->valueCount()) or not finiteValues(values))
+        {
+            return nullptr;
+        }
+
+        /* Structures whose ids collide take the next free id */
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            for (auto entry = structure_map.find(id); entry != structure_map.end(); entry = structure_map.find(id))
+            {
+                if (entry->second->samePattern(*structure))
+                {
+                    return entry->second;
+                }
+                id = id + 1 == 0 ? 1 : id + 1;
+            }
+            structure_map.emplace(id, structure);
+        }
+
+        exitcode code;
+        structure->release(structure->solve(values.data(), code, n_created), max_idle);
+        return structure;
+    }
+
+    void SolverServer::serve(int fd, uint64_t connection)
+    {
+        const double *slots = nullptr;
+        size_t slot_size = 0, n_slots = 0;
+
+        Header header;
+        std::vector<char> payload;
+        int memory_fd;
+        while (receiveMessage(fd, header, payload, memory_fd))
+        {
+            std::vector<char> reply;
+            Reader reader(payload);
+
+            if (header.type == MessageType::hello)
+            {
+                /* The value slots of the client come as a descriptor with the message */
+                uint64_t sizes[2];
+                bool ok = slots == nullptr and memory_fd >= 0 and reader.read(sizes, 2) and
+                          sizes[0] > 0 and sizes[1] > 0 and sizes[0] <= (uint64_t(1) << 32) / sizes[1];
+                if (ok)
+                {
+                    slots = mapSlots(memory_fd, sizes[0] * sizes[1] * sizeof(double));
+                    ok = slots != nullptr;
+                    if (ok)
+                    {
+                        slot_size = sizes[0];
+                        n_slots = sizes[1];
+                    }
+                }
+                const uint32_t status = ok;
+                append(reply, &status, 1);
+            }
+            else if (header.type == MessageType::setup)
+            {
+                uint64_t id = 0;
+                if (not registerStructure(payload, id))
+                {
+                    id = 0;
+                }
+                append(reply, &id, 1);
+            }
+            else if (header.type == MessageType::solve)
+            {
+                uint64_t request[2];
+                std::shared_ptr<Structure> structure;
+                if (reader.read(request, 2))
+                {
+                    structure = findStructure(request[0]);
+                }
+
+                if (structure and slots and request[1] < n_slots and structure->valueCount() <= slot_size)
+                {
+                    exitcode code;
+                    std::unique_ptr<Solver> solver = structure->solve(slots + request[1] * slot_size, code, n_created);
+                    const int32_t code_value = int32_t(code);
+                    append(reply, &code_value, 1);
+                    if (solver)
+                    {
+                        append(reply, &solver->getInfo(), 1);
+                        for (const Eigen::VectorXd *v : {&solver->solution(), &solver->dualEquality(),
+                                                         &solver->dualConic(), &solver->slack()})
+                        {
+                            append(reply, v->data(), v->size());
+                        }
+                        structure->release(std::move(solver), max_idle);
+                    }
+                }
+                else
+                {
+                    const int32_t code_value = int32_t(exitcode::fatal);
+                    append(reply, &code_value, 1);
+                }
+            }
+            else
+            {
+                break;
+            }
+            if (memory_fd >= 0)
+            {
+                close(memory_fd);
+                memory_fd = -1;
+            }
+
+            if (not sendMessage(fd, header.type, reply))
+            {
+                break;
+            }
+        }
+
+        if (memory_fd >= 0)
+        {
+            close(memory_fd);
+        }
+        if (slots)
+        {
+            munmap(const_cast<double *>(slots), slot_size * n_slots * sizeof(double));
+        }
+        /* The thread hands itself over to be joined */
+        std::lock_guard<std::mutex> lock(mutex);
+        client_fds.erase(fd);
+        close(fd);
+        const auto thread = client_threads.find(connection);
+        finished_threads.push_back(std::move(thread->second));
+        client_threads.erase(thread);
+        clients_done.notify_all();
+    }
+
+    ServerClient::ServerClient(const std::string &socket_path, size_t slot_size, size_t n_slots)
+        : slot_size(slot_size), n_slots(n_slots)
+    {
+        sockaddr_un address = {};
+        address.sun_family = AF_UNIX;
+        if (socket_path.size() >= sizeof(address.sun_path) or slot_size == 0 or n_slots == 0)
+        {
+            return;
+        }
+        std::strcpy(address.sun_path, socket_path.c_str());
+
+        fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd < 0 or connect(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0)
+        {
+            if (fd >= 0)
+            {
+                close(fd);
+            }
+            fd = -1;
+            return;
+        }
+
+        /* The ring of value slots, an anonymous file sealed at its size and passed to the server */
+        const size_t bytes = slot_size * n_slots * sizeof(double);
+        const int memory_fd = memfd_create("eicos-slots", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+        void *memory = MAP_FAILED;
+        if (memory_fd >= 0 and ftruncate(memory_fd, bytes) == 0 and
+            fcntl(memory_fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL) == 0)
+        {
+            memory = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, memory_fd, 0);
+        }
+
+        std::vector<char> payload;
+        const uint64_t sizes[2] = {slot_size, n_slots};
+        append(payload, sizes, 2);
+
+        Header header;
+        std::vector<char> reply;
+        uint32_t status = 0;
+        const bool ok = memory != MAP_FAILED and
+                        sendMessage(fd, MessageType::hello, payload, memory_fd) and
+                        receiveMessage(fd, header, reply) and
+                        Reader(reply).read(&status, 1) and status == 1;
+        if (memory_fd >= 0)
+        {
+            close(memory_fd);
+        }
+
+        if (ok)
+        {
+            slots = static_cast<double *>(memory);
+        }
+        else
+        {
+            if (memory != MAP_FAILED)
+            {
+                munmap(memory, bytes);
+            }
+            close(fd);
+            fd = -1;
+        }
+    }
+
+    ServerClient::~ServerClient()
+    {
+        if (slots)
+        {
+            munmap(slots, slot_size * n_slots * sizeof(double));
+        }
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+    }
+
+    bool ServerClient::connected() const
+    {
+        return fd >= 0;
+    }
+
+    uint64_t ServerClient::setup(int n, int m, int p, int l, int ncones, const int *q,
+                                 const double *Gpr, const int *Gjc, const int *Gir,
+                                 const double *Apr, const int *Ajc, const int *Air,
+                                 const double *c, const double *h, const double *b)
+    {
+        if (fd < 0 or not in_flight.empty())
+        {
+            return 0;
+        }
+
+        /* Missing matrices are sent as empty columns */
+        const std::vector<int> no_entries(n + 1, 0);
+        if (not(Gjc and Gir))
+        {
+            Gjc = no_entries.data();
+        }
+        if (not(Ajc and Air))
+        {
+            Ajc = no_entries.data();
+        }
+        const size_t G_nnz = Gjc[n], A_nnz = Ajc[n];
+
+        std::vector<char> payload;
+        const int dims[5] = {n, m, p, l, ncones};
+        append(payload, dims, 5);
+        append(payload, q, ncones);
+        append(payload, Gjc, n + 1);
+        append(payload, Gir, G_nnz);
+        append(payload, Ajc, n + 1);
+        append(payload, Air, A_nnz);
+        append(payload, Gpr, G_nnz);
+        append(payload, Apr, A_nnz);
+        append(payload, c, n);
+        append(payload, h, m);
+        append(payload, b, p);
+
+        Header header;
+        std::vector<char> reply;
+        uint64_t id = 0;
+        if (not(sendMessage(fd, MessageType::setup, payload) and
+                receiveMessage(fd, header, reply) and
+                Reader(reply).read(&id, 1)))
+        {
+            return 0;
+        }
+        if (id != 0)
+        {
+            dimensions[id] = Dimensions{n, m, p, G_nnz, A_nnz};
+        }
+        return id;
+    }
+
+    bool ServerClient::submit(uint64_t structure,
+                              const double *Gpr, const double *Apr,
+                              const double *c, const double *h, const double *b)
+    {
+        const auto entry = dimensions.find(structure);
+        if (fd < 0 or entry == dimensions.end() or in_flight.size() == n_slots)
+        {
+            return false;
+        }
+        const Dimensions &dims = entry->second;
+        if (dims.G_nnz + dims.A_nnz + dims.n + dims.m + dims.p > slot_size)
+        {
+            return false;
+        }
+
+        /* Slots are handed out in turn and the results come in order, so this slot is free */
+        double *slot = slots + next_slot * slot_size;
+        const std::pair<const double *, size_t> parts[] = {{Gpr, dims.G_nnz}, {Apr, dims.A_nnz}, {c, dims.n}, {h, dims.m}, {b, dims.p}};
+        for (const auto &part : parts)
+        {
+            if (part.second > 0)
+            {
+                std::memcpy(slot, part.first, part.second * sizeof(double));
+            }
+            slot += part.second;
+        }
+
+        std::vector<char> payload;
+        const uint64_t request[2] = {structure, next_slot};
+        append(payload, request, 2);
+        if (not sendMessage(fd, MessageType::solve, payload))
+        {
+            return false;
+        }
+        next_slot = (next_slot + 1) % n_slots;
+        in_flight.push_back(structure);
+        return true;
+    }
+
+    bool ServerClient::receive(ServerResult &result)
+    {
+        if (fd < 0 or in_flight.empty())
+        {
+            return false;
+        }
+        const Dimensions dims = dimensions[in_flight.front()];
+        in_flight.pop_front();
+
+        Header header;
+        std::vector<char> reply;
+        if (not receiveMessage(fd, header, reply))
+        {
+            return false;
+        }
+
+        Reader reader(reply);
+        int32_t code_value;
+        if (not reader.read(&code_value, 1))
+        {
+            return false;
+        }
+        result.code = exitcode(code_value);
+        if (reply.size() == sizeof(code_value))
+        {
+            return true;
+        }
+
+        result.x.resize(dims.n);
+        result.y.resize(dims.p);
+        result.z.resize(dims.m);
+        result.s.resize(dims.m);
+        return reader.read(&result.info, 1) and
+               reader.read(result.x.data(), dims.n) and reader.read(result.y.data(), dims.p) and
+               reader.read(result.z.data(), dims.m) and reader.read(result.s.data(), dims.m);
+    }
+
+    bool ServerClient::solve(uint64_t structure,
+                             const double *Gpr, const double *Apr,
+                             const double *c, const double *h, const double *b,
+                             ServerResult &result)
+    {
+        return submit(structure, Gpr, Apr, c, h, b) and receive(result);
+    }
+
+} // namespace EiCOS
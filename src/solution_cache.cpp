@@ -0,0 +1,153 @@
+#include "solution_cache.hpp"
+
+#include <cstring>
+
+namespace EiCOS
+{
+
+    namespace
+    {
+
+        uint64_t rotate(uint64_t x, int bits)
+        {
+            return (x << bits) | (x >> (64 - bits));
+        }
+
+        /* Finalizer of MurmurHash3 */
+        uint64_t mix(uint64_t x)
+        {
+            x ^= x >> 33;
+            x *= 0xff51afd7ed558ccd;
+            x ^= x >> 33;
+            x *= 0xc4ceb9fe1a85ec53;
+            x ^= x >> 33;
+            return x;
+        }
+
+    } // namespace
+
+    void SolutionKey::add(uint64_t word)
+    {
+        lane1 = rotate((lane1 ^ word) * 0x9e3779b97f4a7c15, 29);
+        lane2 = rotate((lane2 + word) * 0xc2b2ae3d27d4eb4f, 31) ^ lane1;
+    }
+
+    void SolutionKey::add(const double *values, size_t count)
+    {
+        add(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            uint64_t word;
+            std::memcpy(&word, &values[i], sizeof(word));
+            add(word);
+        }
+    }
+
+    void SolutionKey::add(const int *values, size_t count)
+    {
+        add(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            add(uint64_t(uint32_t(values[i])));
+        }
+    }
+
+    SolutionKey SolutionKey::finish() const
+    {
+        SolutionKey key;
+        key.lane1 = mix(lane1);
+        key.lane2 = mix(lane2 ^ lane1);
+        return key;
+    }
+
+    SolutionCache::SolutionCache(size_t capacity)
+        : capacity(capacity)
+    {
+    }
+
+    std::shared_ptr<const CachedSolution> SolutionCache::find(const SolutionKey &key)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        const auto entry = index.find(key);
+        if (entry == index.end())
+        {
+            n_misses++;
+            return nullptr;
+        }
+        n_hits++;
+        entries.splice(entries.begin(), entries, entry->second);
+        return entry->second->second;
+    }
+
+    void SolutionCache::insert(const SolutionKey &key, CachedSolution solution)
+    {
+        const size_t size = entryBytes(solution);
+        auto stored = std::make_shared<const CachedSolution>(std::move(solution));
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (size > capacity or index.count(key))
+        {
+            return;
+        }
+        evict(capacity - size);
+        entries.emplace_front(key, std::move(stored));
+        index.emplace(key, entries.begin());
+        n_bytes += size;
+    }
+
+    void SolutionCache::setCapacity(size_t capacity)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        this->capacity = capacity;
+        evict(capacity);
+    }
+
+    void SolutionCache::clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        evict(0);
+    }
+
+    size_t SolutionCache::size() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return entries.size();
+    }
+
+    size_t SolutionCache::bytes() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return n_bytes;
+    }
+
+    size_t SolutionCache::hits() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return n_hits;
+    }
+
+    size_t SolutionCache::misses() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return n_misses;
+    }
+
+    size_t SolutionCache::entryBytes(const CachedSolution &solution)
+    {
+        const size_t values = solution.x.size() + solution.y.size() + solution.z.size() + solution.s.size();
+        return sizeof(CachedSolution) + sizeof(Entry) + values * sizeof(double);
+    }
+
+    /* Drops the least recently used results until the rest fits */
+    void SolutionCache::evict(size_t capacity)
+    {
+        while (n_bytes > capacity)
+        {
+            n_bytes -= entryBytes(*entries.back().second);
+            index.erase(entries.back().first);
+            entries.pop_back();
+        }
+    }
+
+} // namespace EiCOS
@@ -0,0 +1,68 @@
+#include "sparse_rows.hpp"
+
+#include "parallel.hpp"
+
+namespace EiCOS
+{
+
+    /**
+     * Counting sort of the entries by row. The columns are split into n_parts
+     * ranges that are counted and placed in parallel; the ranges, and the columns
+     * within them, are visited in ascending order, so the entries of every row
+     * end up sorted by column. Each range needs its own row counts.
+     */
+    void SparseRows::setup(const Eigen::SparseMatrix<double> &M, size_t n_parts)
+    {
+        assert(M.isCompressed());
+
+        const Eigen::Index n_rows = M.rows();
+        const int *outer = M.outerIndexPtr();
+        const int *inner = M.innerIndexPtr();
+
+        n_parts = std::max<size_t>(1, std::min<size_t>(n_parts, M.cols()));
+        std::vector<Eigen::Index> col_start(n_parts + 1);
+        for (size_t part = 0; part <= n_parts; part++)
+        {
+            col_start[part] = M.cols() * part / n_parts;
+        }
+
+        /* Entries of each row in each range */
+        std::vector<std::vector<int>> next(n_parts, std::vector<int>(n_rows, 0));
+        parallelFor(n_parts, [&](size_t part) {
+            for (int k = outer[col_start[part]]; k < outer[col_start[part + 1]]; k++)
+            {
+                next[part][inner[k]]++;
+            }
+        });
+
+        /* First entry of each row in each range */
+        row_start.resize(n_rows + 1);
+        int entry = 0;
+        for (Eigen::Index row = 0; row < n_rows; row++)
+        {
+            row_start[row] = entry;
+            for (size_t part = 0; part < n_parts; part++)
+            {
+                const int count = next[part][row];
+                next[part][row] = entry;
+                entry += count;
+            }
+        }
+        row_start[n_rows] = entry;
+
+        cols.resize(M.nonZeros());
+        positions.resize(M.nonZeros());
+        parallelFor(n_parts, [&](size_t part) {
+            for (Eigen::Index col = col_start[part]; col < col_start[part + 1]; col++)
+            {
+                for (int k = outer[col]; k < outer[col + 1]; k++)
+                {
+                    const int entry = next[part][inner[k]]++;
+                    cols[entry] = col;
+                    positions[entry] = k;
+                }
+            }
+        });
+    }
+
+} // namespace EiCOS
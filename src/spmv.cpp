@@ -0,0 +1,99 @@
+#include "spmv.hpp"
+
+#include "kernels.hpp"
+#include "parallel.hpp"
+
+namespace EiCOS
+{
+
+    namespace
+    {
+
+        RowPartition balanceRows(const int *row_start, Eigen::Index n_rows, size_t n_parts)
+        {
+            const Eigen::Index nnz = row_start[n_rows];
+
+            n_parts = std::max<size_t>(1, std::min<size_t>(n_parts, n_rows));
+
+            RowPartition partition;
+            partition.push_back(0);
+            for (size_t k = 1; k < n_parts; k++)
+            {
+                const Eigen::Index target = nnz * k / n_parts;
+                const Eigen::Index row = std::lower_bound(row_start, row_start + n_rows, target) - row_start;
+                if (row > partition.back())
+                {
+                    partition.push_back(row);
+                }
+            }
+            if (partition.back() < n_rows or partition.size() == 1)
+            {
+                partition.push_back(n_rows);
+            }
+
+            return partition;
+        }
+
+    } // namespace
+
+    /**
+     * Balances the ranges by non-zeros rather than by rows, so that a few long
+     * rows (e.g. of a dense coupling constraint) do not stall one thread.
+     */
+    RowPartition partitionRows(const Eigen::SparseMatrix<double> &Mt, size_t n_parts)
+    {
+        assert(Mt.isCompressed());
+        return balanceRows(Mt.outerIndexPtr(), Mt.outerSize(), n_parts);
+    }
+
+    RowPartition partitionRows(const SparseRows &rows, size_t n_parts)
+    {
+        return balanceRows(rows.outerIndexPtr(), rows.rows(), n_parts);
+    }
+
+    /**
+     * The terms of each row are accumulated in the same order as Eigen's
+     * column major product, so the result does not depend on the partition.
+     */
+    void multiplyRows(const Eigen::SparseMatrix<double> &Mt,
+                      const RowPartition &partition,
+                      const Eigen::VectorXd &x,
+                      Eigen::VectorXd &y,
+                      double alpha)
+    {
+        assert(y.size() == Mt.outerSize() and x.size() == Mt.innerSize());
+
+        const auto *row_start = Mt.outerIndexPtr();
+        const auto *col = Mt.innerIndexPtr();
+        const double *value = Mt.valuePtr();
+
+        parallelFor(partition.size() - 1, [&](size_t part) {
+            accumulateRows(row_start, col, value, x.data(), y.data(), alpha, partition[part], partition[part + 1]);
+        });
+    }
+
+    /**
+     * Same order of the terms as above, the values are gathered from the
+     * column major storage through the positions of the index.
+     */
+    void multiplyRows(const SparseRows &rows,
+                      const Eigen::SparseMatrix<double> &M,
+                      const RowPartition &partition,
+                      const Eigen::VectorXd &x,
+                      Eigen::VectorXd &y,
+                      double alpha)
+    {
+        assert(y.size() == rows.rows() and x.size() == M.cols());
+
+        const int *row_start = rows.outerIndexPtr();
+        const int *col = rows.colPtr();
+        const int *position = rows.positionPtr();
+        const double *value = M.valuePtr();
+
+        parallelFor(partition.size() - 1, [&](size_t part) {
+            accumulateRowsGather(row_start, col, position, value, x.data(), y.data(), alpha,
+                                 partition[part], partition[part + 1]);
+        });
+    }
+
+} // namespace EiCOS
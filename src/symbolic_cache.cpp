@@ -0,0 +1,382 @@
+#include "symbolic_cache.hpp"
+
+#include "file_io.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+namespace EiCOS
+{
+
+    SymbolicAnalysis SymbolicLDLT::symbolic() const
+    {
+        assert(m_analysisIsOk);
+
+        SymbolicAnalysis analysis;
+        analysis.permutation = m_Pinv.indices();
+        return analysis;
+    }
+
+    /**
+     * Does what analyzePattern does after the ordering: permutes the upper
+     * triangle of a and computes the elimination tree and the column counts
+     * of L from it, so they always match the matrix to factor.
+     */
+    void SymbolicLDLT::setSymbolic(const Eigen::SparseMatrix<double> &a, const SymbolicAnalysis &analysis)
+    {
+        assert(a.rows() == a.cols() and analysis.permutation.size() == a.rows());
+
+        m_Pinv.indices() = analysis.permutation;
+        if (m_Pinv.size() > 0)
+            m_P = m_Pinv.inverse();
+        else
+            m_P.resize(0);
+
+        CholMatrixType ap(a.rows(), a.cols());
+        ap.selfadjointView<Eigen::Upper>() = a.selfadjointView<Eigen::Upper>().twistedBy(m_P);
+        analyzePattern_preordered(ap, true);
+    }
+
+    /**
+     * The up-looking factorization of Eigen's SimplicialLDLT, in the same order
+     * of operations, with the dynamic regularization of ECOS: a pivot that does
+     * not have the sign expected for its row of K, or is within eps of zero, is
+     * replaced by delta with that sign, so the factorization never breaks down.
+     */
+    size_t SymbolicLDLT::factorizeRegularized(const Eigen::SparseMatrix<double> &a, const Eigen::VectorXi &signs,
+                                              double eps, double delta)
+    {
+        assert(m_analysisIsOk and a.rows() == a.cols() and signs.size() == a.rows());
+
+        const int size = a.rows();
+        CholMatrixType ap(size, size);
+        Eigen::VectorXi permuted_signs(size);
+        if (m_P.size() > 0)
+        {
+            ap.selfadjointView<Eigen::Upper>() = a.selfadjointView<Eigen::Upper>().twistedBy(m_P);
+            for (int i = 0; i < size; i++)
+            {
+                permuted_signs[m_P.indices()[i]] = signs[i];
+            }
+        }
+        else
+        {
+            ap = a;
+            permuted_signs = signs;
+        }
+
+        const int *Lp = m_matrix.outerIndexPtr();
+        int *Li = m_matrix.innerIndexPtr();
+        double *Lx = m_matrix.valuePtr();
+        std::vector<double> y(size, 0.);
+        std::vector<int> pattern(size), tags(size);
+        m_diag.resize(size);
+
+        size_t regularized = 0;
+        for (int k = 0; k < size; k++)
+        {
+            /* Pattern of row k of L, in topological order */
+            y[k] = 0.;
+            int top = size;
+            tags[k] = k;
+            m_nonZerosPerCol[k] = 0;
+            for (CholMatrixType::InnerIterator it(ap, k); it; ++it)
+            {
+                int i = it.index();
+                if (i <= k)
+                {
+                    y[i] += it.value();
+                    int len;
+                    for (len = 0; tags[i] != k; i = m_parent[i])
+                    {
+                        pattern[len++] = i;
+                        tags[i] = k;
+                    }
+                    while (len > 0)
+                    {
+                        pattern[--top] = pattern[--len];
+                    }
+                }
+            }
+
+            /* Values of row k of L, by a sparse triangular solve */
+            double d = y[k];
+            y[k] = 0.;
+            for (; top < size; top++)
+            {
+                const int i = pattern[top];
+                const double yi = y[i];
+                y[i] = 0.;
+
+                const double l_ki = yi / m_diag[i];
+                const int p2 = Lp[i] + m_nonZerosPerCol[i];
+                int p;
+                for (p = Lp[i]; p < p2; p++)
+                {
+                    y[Li[p]] -= Lx[p] * yi;
+                }
+                d -= l_ki * yi;
+                Li[p] = k;
+                Lx[p] = l_ki;
+                m_nonZerosPerCol[i]++;
+            }
+
+            if (permuted_signs[k] * d <= eps)
+            {
+                d = permuted_signs[k] * delta;
+                regularized++;
+            }
+            m_diag[k] = d;
+        }
+
+        m_info = Eigen::Success;
+        m_factorizationIsOk = true;
+        return regularized;
+    }
+
+    namespace
+    {
+
+        /* FNV-1a */
+        class Hash
+        {
+        public:
+            void add(uint64_t value)
+            {
+                for (int byte = 0; byte < 8; byte++)
+                {
+                    hash ^= (value >> (8 * byte)) & 0xff;
+                    hash *= 0x100000001b3;
+                }
+            }
+            uint64_t value() const { return hash; }
+
+        private:
+            uint64_t hash = 0xcbf29ce484222325;
+        };
+
+        const char magic[8] = {'E', 'I', 'C', 'O', 'S', 'S', 'Y', 'M'};
+        const uint32_t version = 2;
+
+        /* An analysis of a matrix of dimension dim: the ordering is a permutation */
+        bool validAnalysis(const SymbolicAnalysis &analysis, Eigen::Index dim)
+        {
+            if (analysis.permutation.size() != dim)
+            {
+                return false;
+            }
+
+            std::vector<bool> seen(dim, false);
+            for (Eigen::Index i = 0; i < dim; i++)
+            {
+                const int index = analysis.permutation[i];
+                if (index < 0 or index >= dim or seen[index])
+                {
+                    return false;
+                }
+                seen[index] = true;
+            }
+            return true;
+        }
+
+    } // namespace
+
+    uint64_t kktFingerprint(const Eigen::SparseMatrix<double> &K,
+                            size_t n_var,
+                            size_t n_eq,
+                            size_t n_lc,
+                            const std::vector<size_t> &cone_dims)
+    {
+        assert(K.isCompressed());
+
+        Hash hash;
+        hash.add(n_var);
+        hash.add(n_eq);
+        hash.add(n_lc);
+        hash.add(cone_dims.size());
+        for (const size_t dim : cone_dims)
+        {
+            hash.add(dim);
+        }
+        hash.add(K.cols());
+        for (Eigen::Index col = 0; col <= K.cols(); col++)
+        {
+            hash.add(K.outerIndexPtr()[col]);
+        }
+        for (Eigen::Index k = 0; k < K.nonZeros(); k++)
+        {
+            hash.add(K.innerIndexPtr()[k]);
+        }
+        return hash.value();
+    }
+
+    SymbolicCache &SymbolicCache::global()
+    {
+        static SymbolicCache cache;
+        return cache;
+    }
+
+    /* An entry of another dimension is looked up in the files, and replaced by the next insert */
+    std::shared_ptr<const SymbolicAnalysis> SymbolicCache::find(uint64_t fingerprint, Eigen::Index dim)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+
+        const auto entry = entries.find(fingerprint);
+        if (entry != entries.end() and entry->second->permutation.size() == dim)
+        {
+            n_hits++;
+            return entry->second;
+        }
+
+        const std::string path = directory.empty() ? std::string() : filePath(fingerprint);
+        lock.unlock();
+        std::shared_ptr<const SymbolicAnalysis> analysis = load(path, fingerprint, dim);
+        lock.lock();
+
+        if (analysis)
+        {
+            n_hits++;
+            remember(fingerprint, analysis);
+        }
+        else
+        {
+            n_misses++;
+        }
+        return analysis;
+    }
+
+    void SymbolicCache::insert(uint64_t fingerprint, const SymbolicAnalysis &analysis)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+
+        remember(fingerprint, std::make_shared<const SymbolicAnalysis>(analysis));
+        const std::string path = directory.empty() ? std::string() : filePath(fingerprint);
+        lock.unlock();
+
+        store(path, fingerprint, analysis);
+    }
+
+    /* Replaces the entry of the fingerprint in place, if there is one */
+    void SymbolicCache::remember(uint64_t fingerprint, std::shared_ptr<const SymbolicAnalysis> analysis)
+    {
+        if (capacity == 0)
+        {
+            return;
+        }
+        const auto entry = entries.find(fingerprint);
+        if (entry != entries.end())
+        {
+            entry->second = std::move(analysis);
+            return;
+        }
+        while (entries.size() >= capacity)
+        {
+            entries.erase(insertion_order.front());
+            insertion_order.pop_front();
+        }
+        entries.emplace(fingerprint, std::move(analysis));
+        insertion_order.push_back(fingerprint);
+    }
+
+    void SymbolicCache::setCapacity(size_t capacity)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        this->capacity = capacity;
+        while (entries.size() > capacity)
+        {
+            entries.erase(insertion_order.front());
+            insertion_order.pop_front();
+        }
+    }
+
+    void SymbolicCache::setDirectory(const std::string &path)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        directory = path;
+    }
+
+    void SymbolicCache::clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        entries.clear();
+        insertion_order.clear();
+    }
+
+    size_t SymbolicCache::size() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return entries.size();
+    }
+
+    size_t SymbolicCache::hits() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return n_hits;
+    }
+
+    size_t SymbolicCache::misses() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return n_misses;
+    }
+
+    std::string SymbolicCache::filePath(uint64_t fingerprint) const
+    {
+        char name[32];
+        std::snprintf(name, sizeof(name), "%016llx.sym", static_cast<unsigned long long>(fingerprint));
+        return directory + "/" + name;
+    }
+
+    /* Files that do not exist, do not match or hold no valid analysis are ignored */
+    std::shared_ptr<const SymbolicAnalysis> SymbolicCache::load(const std::string &path, uint64_t fingerprint, Eigen::Index dim)
+    {
+        if (path.empty())
+        {
+            return nullptr;
+        }
+
+        std::ifstream in(path, std::ios::binary);
+        char file_magic[8];
+        uint32_t file_version;
+        uint64_t file_fingerprint;
+        int32_t file_dim;
+        in.read(file_magic, sizeof(file_magic));
+        in.read(reinterpret_cast<char *>(&file_version), sizeof(file_version));
+        in.read(reinterpret_cast<char *>(&file_fingerprint), sizeof(file_fingerprint));
+        in.read(reinterpret_cast<char *>(&file_dim), sizeof(file_dim));
+        if (not in or std::memcmp(file_magic, magic, sizeof(magic)) != 0 or
+            file_version != version or file_fingerprint != fingerprint or file_dim != dim)
+        {
+            return nullptr;
+        }
+
+        auto analysis = std::make_shared<SymbolicAnalysis>();
+        analysis->permutation.resize(dim);
+        in.read(reinterpret_cast<char *>(analysis->permutation.data()), dim * sizeof(int32_t));
+        if (not in or not validAnalysis(*analysis, dim))
+        {
+            return nullptr;
+        }
+        return analysis;
+    }
+
+    /* Replaced atomically, so that other processes never read a partial file */
+    void SymbolicCache::store(const std::string &path, uint64_t fingerprint, const SymbolicAnalysis &analysis)
+    {
+        if (path.empty())
+        {
+            return;
+        }
+
+        const int32_t dim = analysis.permutation.size();
+        std::string data(magic, sizeof(magic));
+        data.append(reinterpret_cast<const char *>(&version), sizeof(version));
+        data.append(reinterpret_cast<const char *>(&fingerprint), sizeof(fingerprint));
+        data.append(reinterpret_cast<const char *>(&dim), sizeof(dim));
+        data.append(reinterpret_cast<const char *>(analysis.permutation.data()), dim * sizeof(int32_t));
+        writeFileAtomic(path, data);
+    }
+
+} // namespace EiCOS
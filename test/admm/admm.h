@@ -0,0 +1,61 @@
+#include "ecos.h"
+#include "minunit.h"
+#include "admm.hpp"
+
+static bool admm_handoff(idxint n, idxint m, idxint p, idxint ncones, idxint *q,
+                         pfloat *Gpr, idxint *Gjc, idxint *Gir,
+                         pfloat *Apr, idxint *Ajc, idxint *Air,
+                         pfloat *c, pfloat *h, pfloat *b)
+{
+    Eigen::SparseMatrix<double> G = Eigen::Map<Eigen::SparseMatrix<double>>(m, n, Gjc[n], Gjc, Gir, Gpr);
+    Eigen::SparseMatrix<double> A;
+    Eigen::VectorXd b_;
+    if (p > 0)
+    {
+        A = Eigen::Map<Eigen::SparseMatrix<double>>(p, n, Ajc[n], Ajc, Air, Apr);
+        b_ = Eigen::Map<Eigen::VectorXd>(b, p);
+    }
+    const Eigen::VectorXd c_ = Eigen::Map<Eigen::VectorXd>(c, n);
+    const Eigen::VectorXd h_ = Eigen::Map<Eigen::VectorXd>(h, m);
+    const Eigen::VectorXi q_ = ncones > 0 ? Eigen::VectorXi(Eigen::Map<Eigen::VectorXi>(q, ncones))
+                                          : Eigen::VectorXi();
+
+    /* Reference */
+    EiCOS::Solver reference(G, A, c_, h_, b_, q_);
+    const EiCOS::exitcode reference_code = reference.solve();
+    const double pcost = c_.dot(reference.solution());
+
+    /* First-order solution */
+    EiCOS::ADMMSolver admm(G, A, c_, h_, b_, q_);
+    const EiCOS::exitcode admm_code = admm.solve();
+    const double pcost_admm = c_.dot(admm.solution());
+
+    /* Polish with the interior point method */
+    EiCOS::Solver polish(G, A, c_, h_, b_, q_);
+    admm.warmStart(polish);
+    const EiCOS::exitcode polish_code = polish.solve();
+    const double pcost_polish = c_.dot(polish.solution());
+
+    return reference_code == EiCOS::exitcode::optimal and
+           admm_code == EiCOS::exitcode::close_to_optimal and
+           polish_code == EiCOS::exitcode::optimal and
+           std::abs(pcost - pcost_admm) < 1e-2 * (1. + std::abs(pcost)) and
+           std::abs(pcost - pcost_polish) < 1e-6 * (1. + std::abs(pcost));
+}
+
+static char *test_admm()
+{
+    mu_assert("admm: update_data problem not solved or polished",
+              admm_handoff(udd_n, udd_m, udd_p, udd_ncones, udd_q,
+                           udd_G1pr, udd_Gjc, udd_Gir,
+                           udd_A1pr, udd_Ajc, udd_Air,
+                           udd_c1, udd_h1, udd_b1));
+
+    mu_assert("admm: MPC01 not solved or polished",
+              admm_handoff(MPC01_n, MPC01_m, MPC01_p, MPC01_ncones, MPC01_q,
+                           MPC01_Gpr, MPC01_Gjc, MPC01_Gir,
+                           MPC01_Apr, MPC01_Ajc, MPC01_Air,
+                           MPC01_c, MPC01_h, MPC01_b));
+
+    return 0;
+}
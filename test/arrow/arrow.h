@@ -0,0 +1,82 @@
+#include "ecos.h"
+#include "minunit.h"
+
+/**
+ * Two copies of the update_data LP and the SOC problem of githubIssue98,
+ * coupled by a variable t that relaxes one linear row of every block and
+ * by a linear constraint on the first variables of both LPs.
+ */
+static char *test_arrow()
+{
+    const int n_lp = udd_n, m_lp = udd_m, p_lp = udd_p;
+    const int n_soc = 5, l_soc = 6, m_soc = 11;
+
+    const Eigen::SparseMatrix<double> G_lp = Eigen::Map<Eigen::SparseMatrix<double>>(m_lp, n_lp, udd_Gjc[n_lp], udd_Gjc, udd_Gir, udd_G1pr);
+    const Eigen::SparseMatrix<double> A_lp = Eigen::Map<Eigen::SparseMatrix<double>>(p_lp, n_lp, udd_Ajc[n_lp], udd_Ajc, udd_Air, udd_A1pr);
+    const Eigen::SparseMatrix<double> G_soc = Eigen::Map<Eigen::SparseMatrix<double>>(m_soc, n_soc, Gp[n_soc], Gp, Gi, Gx);
+
+    /* Variables: [lp 1, lp 2, soc, t], linear rows: [lp 1, lp 2, soc, coupling], then the cone */
+    const int n = 2 * n_lp + n_soc + 1;
+    const int l = 2 * m_lp + l_soc + 2;
+    const int m = l + m_soc - l_soc;
+    const int p = 2 * p_lp;
+    const int t = n - 1;
+
+    std::vector<Eigen::Triplet<double>> G_triplets, A_triplets;
+    for (int k = 0; k < 2; k++)
+    {
+        for (int col = 0; col < n_lp; col++)
+        {
+            for (Eigen::SparseMatrix<double>::InnerIterator it(G_lp, col); it; ++it)
+                G_triplets.emplace_back(k * m_lp + it.row(), k * n_lp + col, it.value());
+            for (Eigen::SparseMatrix<double>::InnerIterator it(A_lp, col); it; ++it)
+                A_triplets.emplace_back(k * p_lp + it.row(), k * n_lp + col, it.value());
+        }
+        G_triplets.emplace_back(k * m_lp, t, -0.1);
+    }
+    for (int col = 0; col < n_soc; col++)
+    {
+        for (Eigen::SparseMatrix<double>::InnerIterator it(G_soc, col); it; ++it)
+        {
+            const int row = it.row() < l_soc ? 2 * m_lp + it.row() : l + it.row() - l_soc;
+            G_triplets.emplace_back(row, 2 * n_lp + col, it.value());
+        }
+    }
+    G_triplets.emplace_back(2 * m_lp, t, -0.1);
+    G_triplets.emplace_back(l - 2, t, -1.);
+    G_triplets.emplace_back(l - 1, 0, 1.);
+    G_triplets.emplace_back(l - 1, n_lp, 1.);
+
+    Eigen::SparseMatrix<double> G(m, n), A(p, n);
+    G.setFromTriplets(G_triplets.begin(), G_triplets.end());
+    A.setFromTriplets(A_triplets.begin(), A_triplets.end());
+
+    Eigen::VectorXd c_(n), h_(m), b_(p);
+    c_ << Eigen::Map<Eigen::VectorXd>(udd_c1, n_lp), Eigen::Map<Eigen::VectorXd>(udd_c1, n_lp),
+        Eigen::Map<Eigen::VectorXd>(c, n_soc), 1.;
+    h_ << Eigen::Map<Eigen::VectorXd>(udd_h1, m_lp), Eigen::Map<Eigen::VectorXd>(udd_h1, m_lp),
+        Eigen::Map<Eigen::VectorXd>(h, l_soc), 1., 100.,
+        Eigen::Map<Eigen::VectorXd>(h + l_soc, m_soc - l_soc);
+    b_ << Eigen::Map<Eigen::VectorXd>(udd_b1, p_lp), Eigen::Map<Eigen::VectorXd>(udd_b1, p_lp);
+    const Eigen::VectorXi q_ = Eigen::Map<Eigen::VectorXi>(q, 1);
+
+    Eigen::VectorXi var_blocks(n);
+    var_blocks << Eigen::VectorXi::Constant(n_lp, 0), Eigen::VectorXi::Constant(n_lp, 1),
+        Eigen::VectorXi::Constant(n_soc, 2), -1;
+
+    EiCOS::Solver solver(G, A, c_, h_, b_, q_);
+    EiCOS::Solver arrow_solver(G, A, c_, h_, b_, q_);
+    arrow_solver.setBlockStructure(var_blocks);
+
+    const EiCOS::exitcode code = solver.solve();
+    const EiCOS::exitcode arrow_code = arrow_solver.solve();
+
+    mu_assert("arrow: coupled problem not solved",
+              code == EiCOS::exitcode::optimal and arrow_code == EiCOS::exitcode::optimal);
+    mu_assert("arrow: block factorization does not match sparse solver",
+              solver.getInfo().iter == arrow_solver.getInfo().iter and
+                  std::abs(solver.getInfo().pcost - arrow_solver.getInfo().pcost) <
+                      1e-8 * (1. + std::abs(solver.getInfo().pcost)));
+
+    return 0;
+}
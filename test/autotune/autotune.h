@@ -0,0 +1,46 @@
+#include "ecos.h"
+#include "minunit.h"
+
+#include <filesystem>
+
+static char *test_autotune()
+{
+    const Eigen::SparseMatrix<double> G = Eigen::Map<Eigen::SparseMatrix<double>>(40, 20, udd_Gjc[20], udd_Gjc, udd_Gir, udd_G1pr);
+    const Eigen::SparseMatrix<double> A = Eigen::Map<Eigen::SparseMatrix<double>>(5, 20, udd_Ajc[20], udd_Ajc, udd_Air, udd_A1pr);
+    const Eigen::VectorXd c = Eigen::Map<Eigen::VectorXd>(udd_c1, 20);
+    const Eigen::VectorXd h = Eigen::Map<Eigen::VectorXd>(udd_h1, 40);
+    const Eigen::VectorXd b = Eigen::Map<Eigen::VectorXd>(udd_b1, 5);
+    const Eigen::VectorXi q(0);
+
+    EiCOS::TuningProfiles &profiles = EiCOS::TuningProfiles::global();
+    profiles.clear();
+
+    EiCOS::Solver reference(G, A, c, h, b, q);
+    mu_assert("autotune: reference solve failed", reference.solve() == EiCOS::exitcode::optimal);
+
+    const std::filesystem::path directory = std::filesystem::temp_directory_path() / "eicos_autotune_test";
+    std::filesystem::create_directories(directory);
+    profiles.setDirectory(directory.string());
+
+    EiCOS::Solver solver(G, A, c, h, b, q);
+    const EiCOS::TuningProfile profile = solver.tune(2);
+    mu_assert("autotune: no time measured", profile.solve_time > 0.);
+    mu_assert("autotune: no profile stored", profiles.size() == 1 and not std::filesystem::is_empty(directory));
+    mu_assert("autotune: tuned solve differs",
+              solver.solve() == EiCOS::exitcode::optimal and
+                  (solver.solution() - reference.solution()).lpNorm<Eigen::Infinity>() < 1e-8);
+
+    /* A new solver with the same structure loads the profile from the file */
+    profiles.clear();
+    EiCOS::Solver loaded(G, A, c, h, b, q);
+    mu_assert("autotune: profile not loaded", profiles.size() == 1);
+    mu_assert("autotune: solve with loaded profile failed",
+              loaded.solve() == EiCOS::exitcode::optimal and
+                  (loaded.solution() - reference.solution()).lpNorm<Eigen::Infinity>() < 1e-8);
+
+    profiles.setDirectory("");
+    profiles.clear();
+    std::filesystem::remove_all(directory);
+
+    return 0;
+}
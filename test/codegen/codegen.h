@@ -0,0 +1,67 @@
+#include "ecos.h"
+#include "minunit.h"
+
+/* Generated with Solver::generateKKTSolver from the problems below */
+#include "codegen/kkt_update_data.hpp"
+#include "codegen/kkt_issue98.hpp"
+
+static bool codegen_compare(const EiCOS::KKTKernel &kernel,
+                            idxint n, idxint m, idxint p, idxint ncones, idxint *q,
+                            pfloat *Gpr, idxint *Gjc, idxint *Gir,
+                            pfloat *Apr, idxint *Ajc, idxint *Air,
+                            pfloat *c, pfloat *h, pfloat *b)
+{
+    Eigen::SparseMatrix<double> G = Eigen::Map<Eigen::SparseMatrix<double>>(m, n, Gjc[n], Gjc, Gir, Gpr);
+    Eigen::SparseMatrix<double> A;
+    Eigen::VectorXd b_;
+    if (p > 0)
+    {
+        A = Eigen::Map<Eigen::SparseMatrix<double>>(p, n, Ajc[n], Ajc, Air, Apr);
+        b_ = Eigen::Map<Eigen::VectorXd>(b, p);
+    }
+    const Eigen::VectorXd c_ = Eigen::Map<Eigen::VectorXd>(c, n);
+    const Eigen::VectorXd h_ = Eigen::Map<Eigen::VectorXd>(h, m);
+    const Eigen::VectorXi q_ = ncones > 0 ? Eigen::VectorXi(Eigen::Map<Eigen::VectorXi>(q, ncones))
+                                          : Eigen::VectorXi();
+
+    EiCOS::Solver sparse_solver(G, A, c_, h_, b_, q_);
+    EiCOS::Solver generated_solver(G, A, c_, h_, b_, q_);
+    generated_solver.setKKTKernel(kernel);
+
+    const EiCOS::exitcode sparse_code = sparse_solver.solve();
+    const EiCOS::exitcode generated_code = generated_solver.solve();
+
+    return sparse_code == generated_code and
+           sparse_solver.getInfo().iter == generated_solver.getInfo().iter and
+           (sparse_solver.solution() - generated_solver.solution()).lpNorm<Eigen::Infinity>() <
+               1e-8 * (1. + sparse_solver.solution().lpNorm<Eigen::Infinity>());
+}
+
+static char *test_codegen()
+{
+    EiCOS::KKTKernel udd_kernel;
+    udd_kernel.factor = kkt_update_data::factor;
+    udd_kernel.solve = kkt_update_data::solve;
+    udd_kernel.dim = kkt_update_data::dim;
+    udd_kernel.nnz = kkt_update_data::nnz;
+
+    mu_assert("codegen: update_data problem does not match sparse solver",
+              codegen_compare(udd_kernel, udd_n, udd_m, udd_p, udd_ncones, udd_q,
+                              udd_G1pr, udd_Gjc, udd_Gir,
+                              udd_A1pr, udd_Ajc, udd_Air,
+                              udd_c1, udd_h1, udd_b1));
+
+    EiCOS::KKTKernel soc_kernel;
+    soc_kernel.factor = kkt_issue98::factor;
+    soc_kernel.solve = kkt_issue98::solve;
+    soc_kernel.dim = kkt_issue98::dim;
+    soc_kernel.nnz = kkt_issue98::nnz;
+
+    mu_assert("codegen: githubIssue98 does not match sparse solver",
+              codegen_compare(soc_kernel, 5, 11, 0, 1, q,
+                              Gx, Gp, Gi,
+                              NULL, NULL, NULL,
+                              c, h, NULL));
+
+    return 0;
+}
@@ -0,0 +1,272 @@
+// Generated by EiCOS::Solver::generateKKTSolver, do not edit.
+// Solves K * x = b for one fixed sparsity pattern with a static LDL' factorization.
+
+#pragma once
+
+#include <cmath>
+
+namespace kkt_issue98
+{
+
+    constexpr int dim = 18;
+    constexpr int nnz = 44; // non-zeros in the upper triangle of K
+    constexpr int nnz_L = 36; // non-zeros in the strict lower triangle of L
+
+    inline double L[nnz_L > 0 ? nnz_L : 1];
+    inline double D[dim];
+    inline double D_inv[dim];
+    inline double work[dim];
+
+    /* Factors K, Kx holds the values of the upper triangle in column major order */
+    inline bool factor(const double *Kx)
+    {
+        D[0] = Kx[22];
+        D_inv[0] = 1. / D[0];
+        L[0] = Kx[21] * D_inv[0];
+        L[1] = Kx[20] * D_inv[0];
+        D[1] = Kx[19];
+        D_inv[1] = 1. / D[1];
+        L[2] = Kx[18] * D_inv[1];
+        L[3] = Kx[17] * D_inv[1];
+        D[2] = Kx[16];
+        D_inv[2] = 1. / D[2];
+        L[4] = Kx[15] * D_inv[2];
+        L[5] = Kx[14] * D_inv[2];
+        const double t3_0 = L[0] * D[0];
+        const double t3_1 = L[2] * D[1];
+        const double t3_2 = L[4] * D[2];
+        D[3] = Kx[3] - L[0] * t3_0 - L[2] * t3_1 - L[4] * t3_2;
+        D_inv[3] = 1. / D[3];
+        L[6] = (-L[1] * t3_0 - L[3] * t3_1 - L[5] * t3_2) * D_inv[3];
+        L[7] = Kx[31] * D_inv[3];
+        const double t4_0 = L[1] * D[0];
+        const double t4_1 = L[3] * D[1];
+        const double t4_2 = L[5] * D[2];
+        const double t4_3 = L[6] * D[3];
+        D[4] = Kx[2] - L[1] * t4_0 - L[3] * t4_1 - L[5] * t4_2 - L[6] * t4_3;
+        D_inv[4] = 1. / D[4];
+        L[8] = (-L[7] * t4_3) * D_inv[4];
+        L[9] = Kx[29] * D_inv[4];
+        D[5] = Kx[4];
+        D_inv[5] = 1. / D[5];
+        L[10] = Kx[23] * D_inv[5];
+        const double t6_5 = L[10] * D[5];
+        D[6] = Kx[24] - L[10] * t6_5;
+        D_inv[6] = 1. / D[6];
+        L[11] = Kx[38] * D_inv[6];
+        const double t7_3 = L[7] * D[3];
+        const double t7_4 = L[8] * D[4];
+        D[7] = Kx[32] - L[7] * t7_3 - L[8] * t7_4;
+        D_inv[7] = 1. / D[7];
+        L[12] = (-L[9] * t7_4) * D_inv[7];
+        L[13] = Kx[42] * D_inv[7];
+        L[14] = Kx[36] * D_inv[7];
+        const double t8_4 = L[9] * D[4];
+        const double t8_7 = L[12] * D[7];
+        D[8] = Kx[30] - L[9] * t8_4 - L[12] * t8_7;
+        D_inv[8] = 1. / D[8];
+        L[15] = (Kx[41] - L[13] * t8_7) * D_inv[8];
+        L[16] = (Kx[35] - L[14] * t8_7) * D_inv[8];
+        const double t9_6 = L[11] * D[6];
+        const double t9_7 = L[13] * D[7];
+        const double t9_8 = L[15] * D[8];
+        D[9] = Kx[43] - L[11] * t9_6 - L[13] * t9_7 - L[15] * t9_8;
+        D_inv[9] = 1. / D[9];
+        L[17] = (-L[14] * t9_7 - L[16] * t9_8) * D_inv[9];
+        L[18] = Kx[39] * D_inv[9];
+        L[19] = Kx[40] * D_inv[9];
+        const double t10_7 = L[14] * D[7];
+        const double t10_8 = L[16] * D[8];
+        const double t10_9 = L[17] * D[9];
+        D[10] = Kx[37] - L[14] * t10_7 - L[16] * t10_8 - L[17] * t10_9;
+        D_inv[10] = 1. / D[10];
+        L[20] = (Kx[33] - L[18] * t10_9) * D_inv[10];
+        L[21] = (Kx[34] - L[19] * t10_9) * D_inv[10];
+        const double t11_9 = L[18] * D[9];
+        const double t11_10 = L[20] * D[10];
+        D[11] = Kx[26] - L[18] * t11_9 - L[20] * t11_10;
+        D_inv[11] = 1. / D[11];
+        L[22] = (-L[19] * t11_9 - L[21] * t11_10) * D_inv[11];
+        L[23] = Kx[25] * D_inv[11];
+        const double t12_9 = L[19] * D[9];
+        const double t12_10 = L[21] * D[10];
+        const double t12_11 = L[22] * D[11];
+        D[12] = Kx[28] - L[19] * t12_9 - L[21] * t12_10 - L[22] * t12_11;
+        D_inv[12] = 1. / D[12];
+        L[24] = (-L[23] * t12_11) * D_inv[12];
+        L[25] = Kx[27] * D_inv[12];
+        const double t13_11 = L[23] * D[11];
+        const double t13_12 = L[24] * D[12];
+        D[13] = Kx[0] - L[23] * t13_11 - L[24] * t13_12;
+        D_inv[13] = 1. / D[13];
+        L[26] = Kx[5] * D_inv[13];
+        L[27] = Kx[8] * D_inv[13];
+        L[28] = Kx[11] * D_inv[13];
+        L[29] = (-L[25] * t13_12) * D_inv[13];
+        const double t14_13 = L[26] * D[13];
+        D[14] = Kx[7] - L[26] * t14_13;
+        D_inv[14] = 1. / D[14];
+        L[30] = (-L[27] * t14_13) * D_inv[14];
+        L[31] = (-L[28] * t14_13) * D_inv[14];
+        L[32] = (Kx[6] - L[29] * t14_13) * D_inv[14];
+        const double t15_13 = L[27] * D[13];
+        const double t15_14 = L[30] * D[14];
+        D[15] = Kx[10] - L[27] * t15_13 - L[30] * t15_14;
+        D_inv[15] = 1. / D[15];
+        L[33] = (-L[28] * t15_13 - L[31] * t15_14) * D_inv[15];
+        L[34] = (Kx[9] - L[29] * t15_13 - L[32] * t15_14) * D_inv[15];
+        const double t16_13 = L[28] * D[13];
+        const double t16_14 = L[31] * D[14];
+        const double t16_15 = L[33] * D[15];
+        D[16] = Kx[13] - L[28] * t16_13 - L[31] * t16_14 - L[33] * t16_15;
+        D_inv[16] = 1. / D[16];
+        L[35] = (Kx[12] - L[29] * t16_13 - L[32] * t16_14 - L[34] * t16_15) * D_inv[16];
+        const double t17_12 = L[25] * D[12];
+        const double t17_13 = L[29] * D[13];
+        const double t17_14 = L[32] * D[14];
+        const double t17_15 = L[34] * D[15];
+        const double t17_16 = L[35] * D[16];
+        D[17] = Kx[1] - L[25] * t17_12 - L[29] * t17_13 - L[32] * t17_14 - L[34] * t17_15 - L[35] * t17_16;
+        D_inv[17] = 1. / D[17];
+        for (int k = 0; k < dim; k++)
+        {
+            if (not std::isfinite(D_inv[k]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /* Overwrites x = b with the solution of K * x = b, requires a previous factor() */
+    inline void solve(double *x)
+    {
+        work[0] = x[10];
+        work[1] = x[9];
+        work[2] = x[8];
+        work[3] = x[3];
+        work[4] = x[2];
+        work[5] = x[4];
+        work[6] = x[11];
+        work[7] = x[15];
+        work[8] = x[14];
+        work[9] = x[17];
+        work[10] = x[16];
+        work[11] = x[12];
+        work[12] = x[13];
+        work[13] = x[0];
+        work[14] = x[5];
+        work[15] = x[6];
+        work[16] = x[7];
+        work[17] = x[1];
+        work[3] -= L[0] * work[0];
+        work[3] -= L[2] * work[1];
+        work[3] -= L[4] * work[2];
+        work[4] -= L[1] * work[0];
+        work[4] -= L[3] * work[1];
+        work[4] -= L[5] * work[2];
+        work[4] -= L[6] * work[3];
+        work[6] -= L[10] * work[5];
+        work[7] -= L[7] * work[3];
+        work[7] -= L[8] * work[4];
+        work[8] -= L[9] * work[4];
+        work[8] -= L[12] * work[7];
+        work[9] -= L[11] * work[6];
+        work[9] -= L[13] * work[7];
+        work[9] -= L[15] * work[8];
+        work[10] -= L[14] * work[7];
+        work[10] -= L[16] * work[8];
+        work[10] -= L[17] * work[9];
+        work[11] -= L[18] * work[9];
+        work[11] -= L[20] * work[10];
+        work[12] -= L[19] * work[9];
+        work[12] -= L[21] * work[10];
+        work[12] -= L[22] * work[11];
+        work[13] -= L[23] * work[11];
+        work[13] -= L[24] * work[12];
+        work[14] -= L[26] * work[13];
+        work[15] -= L[27] * work[13];
+        work[15] -= L[30] * work[14];
+        work[16] -= L[28] * work[13];
+        work[16] -= L[31] * work[14];
+        work[16] -= L[33] * work[15];
+        work[17] -= L[25] * work[12];
+        work[17] -= L[29] * work[13];
+        work[17] -= L[32] * work[14];
+        work[17] -= L[34] * work[15];
+        work[17] -= L[35] * work[16];
+        work[0] *= D_inv[0];
+        work[1] *= D_inv[1];
+        work[2] *= D_inv[2];
+        work[3] *= D_inv[3];
+        work[4] *= D_inv[4];
+        work[5] *= D_inv[5];
+        work[6] *= D_inv[6];
+        work[7] *= D_inv[7];
+        work[8] *= D_inv[8];
+        work[9] *= D_inv[9];
+        work[10] *= D_inv[10];
+        work[11] *= D_inv[11];
+        work[12] *= D_inv[12];
+        work[13] *= D_inv[13];
+        work[14] *= D_inv[14];
+        work[15] *= D_inv[15];
+        work[16] *= D_inv[16];
+        work[17] *= D_inv[17];
+        work[16] -= L[35] * work[17];
+        work[15] -= L[33] * work[16];
+        work[15] -= L[34] * work[17];
+        work[14] -= L[30] * work[15];
+        work[14] -= L[31] * work[16];
+        work[14] -= L[32] * work[17];
+        work[13] -= L[26] * work[14];
+        work[13] -= L[27] * work[15];
+        work[13] -= L[28] * work[16];
+        work[13] -= L[29] * work[17];
+        work[12] -= L[24] * work[13];
+        work[12] -= L[25] * work[17];
+        work[11] -= L[22] * work[12];
+        work[11] -= L[23] * work[13];
+        work[10] -= L[20] * work[11];
+        work[10] -= L[21] * work[12];
+        work[9] -= L[17] * work[10];
+        work[9] -= L[18] * work[11];
+        work[9] -= L[19] * work[12];
+        work[8] -= L[15] * work[9];
+        work[8] -= L[16] * work[10];
+        work[7] -= L[12] * work[8];
+        work[7] -= L[13] * work[9];
+        work[7] -= L[14] * work[10];
+        work[6] -= L[11] * work[9];
+        work[5] -= L[10] * work[6];
+        work[4] -= L[8] * work[7];
+        work[4] -= L[9] * work[8];
+        work[3] -= L[6] * work[4];
+        work[3] -= L[7] * work[7];
+        work[2] -= L[4] * work[3];
+        work[2] -= L[5] * work[4];
+        work[1] -= L[2] * work[3];
+        work[1] -= L[3] * work[4];
+        work[0] -= L[0] * work[3];
+        work[0] -= L[1] * work[4];
+        x[10] = work[0];
+        x[9] = work[1];
+        x[8] = work[2];
+        x[3] = work[3];
+        x[2] = work[4];
+        x[4] = work[5];
+        x[11] = work[6];
+        x[15] = work[7];
+        x[14] = work[8];
+        x[17] = work[9];
+        x[16] = work[10];
+        x[12] = work[11];
+        x[13] = work[12];
+        x[0] = work[13];
+        x[5] = work[14];
+        x[6] = work[15];
+        x[7] = work[16];
+        x[1] = work[17];
+    }
+
+} // namespace kkt_issue98
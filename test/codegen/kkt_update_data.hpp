@@ -0,0 +1,3047 @@
+// Generated by EiCOS::Solver::generateKKTSolver, do not edit.
+// Solves K * x = b for one fixed sparsity pattern with a static LDL' factorization.
+
+#pragma once
+
+#include <cmath>
+
+namespace kkt_update_data
+{
+
+    constexpr int dim = 65;
+    constexpr int nnz = 546; // non-zeros in the upper triangle of K
+    constexpr int nnz_L = 671; // non-zeros in the strict lower triangle of L
+
+    inline double L[nnz_L > 0 ? nnz_L : 1];
+    inline double D[dim];
+    inline double D_inv[dim];
+    inline double work[dim];
+
+    /* Factors K, Kx holds the values of the upper triangle in column major order */
+    inline bool factor(const double *Kx)
+    {
+        D[0] = Kx[33];
+        D_inv[0] = 1. / D[0];
+        L[0] = Kx[20] * D_inv[0];
+        L[1] = Kx[21] * D_inv[0];
+        L[2] = Kx[22] * D_inv[0];
+        L[3] = Kx[23] * D_inv[0];
+        L[4] = Kx[24] * D_inv[0];
+        L[5] = Kx[25] * D_inv[0];
+        L[6] = Kx[26] * D_inv[0];
+        L[7] = Kx[27] * D_inv[0];
+        L[8] = Kx[28] * D_inv[0];
+        L[9] = Kx[29] * D_inv[0];
+        L[10] = Kx[30] * D_inv[0];
+        L[11] = Kx[31] * D_inv[0];
+        L[12] = Kx[32] * D_inv[0];
+        D[1] = Kx[43];
+        D_inv[1] = 1. / D[1];
+        L[13] = Kx[34] * D_inv[1];
+        L[14] = Kx[35] * D_inv[1];
+        L[15] = Kx[36] * D_inv[1];
+        L[16] = Kx[37] * D_inv[1];
+        L[17] = Kx[38] * D_inv[1];
+        L[18] = Kx[39] * D_inv[1];
+        L[19] = Kx[40] * D_inv[1];
+        L[20] = Kx[41] * D_inv[1];
+        L[21] = Kx[42] * D_inv[1];
+        D[2] = Kx[51];
+        D_inv[2] = 1. / D[2];
+        L[22] = Kx[44] * D_inv[2];
+        L[23] = Kx[45] * D_inv[2];
+        L[24] = Kx[46] * D_inv[2];
+        L[25] = Kx[47] * D_inv[2];
+        L[26] = Kx[48] * D_inv[2];
+        L[27] = Kx[49] * D_inv[2];
+        L[28] = Kx[50] * D_inv[2];
+        D[3] = Kx[61];
+        D_inv[3] = 1. / D[3];
+        L[29] = Kx[52] * D_inv[3];
+        L[30] = Kx[53] * D_inv[3];
+        L[31] = Kx[54] * D_inv[3];
+        L[32] = Kx[55] * D_inv[3];
+        L[33] = Kx[56] * D_inv[3];
+        L[34] = Kx[57] * D_inv[3];
+        L[35] = Kx[58] * D_inv[3];
+        L[36] = Kx[59] * D_inv[3];
+        L[37] = Kx[60] * D_inv[3];
+        D[4] = Kx[72];
+        D_inv[4] = 1. / D[4];
+        L[38] = Kx[62] * D_inv[4];
+        L[39] = Kx[63] * D_inv[4];
+        L[40] = Kx[64] * D_inv[4];
+        L[41] = Kx[65] * D_inv[4];
+        L[42] = Kx[66] * D_inv[4];
+        L[43] = Kx[67] * D_inv[4];
+        L[44] = Kx[68] * D_inv[4];
+        L[45] = Kx[69] * D_inv[4];
+        L[46] = Kx[70] * D_inv[4];
+        L[47] = Kx[71] * D_inv[4];
+        D[5] = Kx[331];
+        D_inv[5] = 1. / D[5];
+        L[48] = Kx[324] * D_inv[5];
+        L[49] = Kx[325] * D_inv[5];
+        L[50] = Kx[326] * D_inv[5];
+        L[51] = Kx[327] * D_inv[5];
+        L[52] = Kx[328] * D_inv[5];
+        L[53] = Kx[329] * D_inv[5];
+        L[54] = Kx[330] * D_inv[5];
+        D[6] = Kx[84];
+        D_inv[6] = 1. / D[6];
+        L[55] = Kx[73] * D_inv[6];
+        L[56] = Kx[74] * D_inv[6];
+        L[57] = Kx[75] * D_inv[6];
+        L[58] = Kx[76] * D_inv[6];
+        L[59] = Kx[77] * D_inv[6];
+        L[60] = Kx[78] * D_inv[6];
+        L[61] = Kx[79] * D_inv[6];
+        L[62] = Kx[80] * D_inv[6];
+        L[63] = Kx[81] * D_inv[6];
+        L[64] = Kx[82] * D_inv[6];
+        L[65] = Kx[83] * D_inv[6];
+        D[7] = Kx[98];
+        D_inv[7] = 1. / D[7];
+        L[66] = Kx[85] * D_inv[7];
+        L[67] = Kx[86] * D_inv[7];
+        L[68] = Kx[87] * D_inv[7];
+        L[69] = Kx[88] * D_inv[7];
+        L[70] = Kx[89] * D_inv[7];
+        L[71] = Kx[90] * D_inv[7];
+        L[72] = Kx[91] * D_inv[7];
+        L[73] = Kx[92] * D_inv[7];
+        L[74] = Kx[93] * D_inv[7];
+        L[75] = Kx[94] * D_inv[7];
+        L[76] = Kx[95] * D_inv[7];
+        L[77] = Kx[96] * D_inv[7];
+        L[78] = Kx[97] * D_inv[7];
+        D[8] = Kx[112];
+        D_inv[8] = 1. / D[8];
+        L[79] = Kx[99] * D_inv[8];
+        L[80] = Kx[100] * D_inv[8];
+        L[81] = Kx[101] * D_inv[8];
+        L[82] = Kx[102] * D_inv[8];
+        L[83] = Kx[103] * D_inv[8];
+        L[84] = Kx[104] * D_inv[8];
+        L[85] = Kx[105] * D_inv[8];
+        L[86] = Kx[106] * D_inv[8];
+        L[87] = Kx[107] * D_inv[8];
+        L[88] = Kx[108] * D_inv[8];
+        L[89] = Kx[109] * D_inv[8];
+        L[90] = Kx[110] * D_inv[8];
+        L[91] = Kx[111] * D_inv[8];
+        D[9] = Kx[126];
+        D_inv[9] = 1. / D[9];
+        L[92] = Kx[113] * D_inv[9];
+        L[93] = Kx[114] * D_inv[9];
+        L[94] = Kx[115] * D_inv[9];
+        L[95] = Kx[116] * D_inv[9];
+        L[96] = Kx[117] * D_inv[9];
+        L[97] = Kx[118] * D_inv[9];
+        L[98] = Kx[119] * D_inv[9];
+        L[99] = Kx[120] * D_inv[9];
+        L[100] = Kx[121] * D_inv[9];
+        L[101] = Kx[122] * D_inv[9];
+        L[102] = Kx[123] * D_inv[9];
+        L[103] = Kx[124] * D_inv[9];
+        L[104] = Kx[125] * D_inv[9];
+        D[10] = Kx[136];
+        D_inv[10] = 1. / D[10];
+        L[105] = Kx[127] * D_inv[10];
+        L[106] = Kx[128] * D_inv[10];
+        L[107] = Kx[129] * D_inv[10];
+        L[108] = Kx[130] * D_inv[10];
+        L[109] = Kx[131] * D_inv[10];
+        L[110] = Kx[132] * D_inv[10];
+        L[111] = Kx[133] * D_inv[10];
+        L[112] = Kx[134] * D_inv[10];
+        L[113] = Kx[135] * D_inv[10];
+        D[11] = Kx[147];
+        D_inv[11] = 1. / D[11];
+        L[114] = Kx[137] * D_inv[11];
+        L[115] = Kx[138] * D_inv[11];
+        L[116] = Kx[139] * D_inv[11];
+        L[117] = Kx[140] * D_inv[11];
+        L[118] = Kx[141] * D_inv[11];
+        L[119] = Kx[142] * D_inv[11];
+        L[120] = Kx[143] * D_inv[11];
+        L[121] = Kx[144] * D_inv[11];
+        L[122] = Kx[145] * D_inv[11];
+        L[123] = Kx[146] * D_inv[11];
+        D[12] = Kx[160];
+        D_inv[12] = 1. / D[12];
+        L[124] = Kx[148] * D_inv[12];
+        L[125] = Kx[149] * D_inv[12];
+        L[126] = Kx[150] * D_inv[12];
+        L[127] = Kx[151] * D_inv[12];
+        L[128] = Kx[152] * D_inv[12];
+        L[129] = Kx[153] * D_inv[12];
+        L[130] = Kx[154] * D_inv[12];
+        L[131] = Kx[155] * D_inv[12];
+        L[132] = Kx[156] * D_inv[12];
+        L[133] = Kx[157] * D_inv[12];
+        L[134] = Kx[158] * D_inv[12];
+        L[135] = Kx[159] * D_inv[12];
+        D[13] = Kx[174];
+        D_inv[13] = 1. / D[13];
+        L[136] = Kx[161] * D_inv[13];
+        L[137] = Kx[162] * D_inv[13];
+        L[138] = Kx[163] * D_inv[13];
+        L[139] = Kx[164] * D_inv[13];
+        L[140] = Kx[165] * D_inv[13];
+        L[141] = Kx[166] * D_inv[13];
+        L[142] = Kx[167] * D_inv[13];
+        L[143] = Kx[168] * D_inv[13];
+        L[144] = Kx[169] * D_inv[13];
+        L[145] = Kx[170] * D_inv[13];
+        L[146] = Kx[171] * D_inv[13];
+        L[147] = Kx[172] * D_inv[13];
+        L[148] = Kx[173] * D_inv[13];
+        D[14] = Kx[185];
+        D_inv[14] = 1. / D[14];
+        L[149] = Kx[175] * D_inv[14];
+        L[150] = Kx[176] * D_inv[14];
+        L[151] = Kx[177] * D_inv[14];
+        L[152] = Kx[178] * D_inv[14];
+        L[153] = Kx[179] * D_inv[14];
+        L[154] = Kx[180] * D_inv[14];
+        L[155] = Kx[181] * D_inv[14];
+        L[156] = Kx[182] * D_inv[14];
+        L[157] = Kx[183] * D_inv[14];
+        L[158] = Kx[184] * D_inv[14];
+        D[15] = Kx[200];
+        D_inv[15] = 1. / D[15];
+        L[159] = Kx[186] * D_inv[15];
+        L[160] = Kx[187] * D_inv[15];
+        L[161] = Kx[188] * D_inv[15];
+        L[162] = Kx[189] * D_inv[15];
+        L[163] = Kx[190] * D_inv[15];
+        L[164] = Kx[191] * D_inv[15];
+        L[165] = Kx[192] * D_inv[15];
+        L[166] = Kx[193] * D_inv[15];
+        L[167] = Kx[194] * D_inv[15];
+        L[168] = Kx[195] * D_inv[15];
+        L[169] = Kx[196] * D_inv[15];
+        L[170] = Kx[197] * D_inv[15];
+        L[171] = Kx[198] * D_inv[15];
+        L[172] = Kx[199] * D_inv[15];
+        D[16] = Kx[210];
+        D_inv[16] = 1. / D[16];
+        L[173] = Kx[201] * D_inv[16];
+        L[174] = Kx[202] * D_inv[16];
+        L[175] = Kx[203] * D_inv[16];
+        L[176] = Kx[204] * D_inv[16];
+        L[177] = Kx[205] * D_inv[16];
+        L[178] = Kx[206] * D_inv[16];
+        L[179] = Kx[207] * D_inv[16];
+        L[180] = Kx[208] * D_inv[16];
+        L[181] = Kx[209] * D_inv[16];
+        D[17] = Kx[221];
+        D_inv[17] = 1. / D[17];
+        L[182] = Kx[211] * D_inv[17];
+        L[183] = Kx[212] * D_inv[17];
+        L[184] = Kx[213] * D_inv[17];
+        L[185] = Kx[214] * D_inv[17];
+        L[186] = Kx[215] * D_inv[17];
+        L[187] = Kx[216] * D_inv[17];
+        L[188] = Kx[217] * D_inv[17];
+        L[189] = Kx[218] * D_inv[17];
+        L[190] = Kx[219] * D_inv[17];
+        L[191] = Kx[220] * D_inv[17];
+        D[18] = Kx[234];
+        D_inv[18] = 1. / D[18];
+        L[192] = Kx[222] * D_inv[18];
+        L[193] = Kx[223] * D_inv[18];
+        L[194] = Kx[224] * D_inv[18];
+        L[195] = Kx[225] * D_inv[18];
+        L[196] = Kx[226] * D_inv[18];
+        L[197] = Kx[227] * D_inv[18];
+        L[198] = Kx[228] * D_inv[18];
+        L[199] = Kx[229] * D_inv[18];
+        L[200] = Kx[230] * D_inv[18];
+        L[201] = Kx[231] * D_inv[18];
+        L[202] = Kx[232] * D_inv[18];
+        L[203] = Kx[233] * D_inv[18];
+        D[19] = Kx[241];
+        D_inv[19] = 1. / D[19];
+        L[204] = Kx[235] * D_inv[19];
+        L[205] = Kx[236] * D_inv[19];
+        L[206] = Kx[237] * D_inv[19];
+        L[207] = Kx[238] * D_inv[19];
+        L[208] = Kx[239] * D_inv[19];
+        L[209] = Kx[240] * D_inv[19];
+        D[20] = Kx[255];
+        D_inv[20] = 1. / D[20];
+        L[210] = Kx[242] * D_inv[20];
+        L[211] = Kx[243] * D_inv[20];
+        L[212] = Kx[244] * D_inv[20];
+        L[213] = Kx[245] * D_inv[20];
+        L[214] = Kx[246] * D_inv[20];
+        L[215] = Kx[247] * D_inv[20];
+        L[216] = Kx[248] * D_inv[20];
+        L[217] = Kx[249] * D_inv[20];
+        L[218] = Kx[250] * D_inv[20];
+        L[219] = Kx[251] * D_inv[20];
+        L[220] = Kx[252] * D_inv[20];
+        L[221] = Kx[253] * D_inv[20];
+        L[222] = Kx[254] * D_inv[20];
+        D[21] = Kx[269];
+        D_inv[21] = 1. / D[21];
+        L[223] = Kx[256] * D_inv[21];
+        L[224] = Kx[257] * D_inv[21];
+        L[225] = Kx[258] * D_inv[21];
+        L[226] = Kx[259] * D_inv[21];
+        L[227] = Kx[260] * D_inv[21];
+        L[228] = Kx[261] * D_inv[21];
+        L[229] = Kx[262] * D_inv[21];
+        L[230] = Kx[263] * D_inv[21];
+        L[231] = Kx[264] * D_inv[21];
+        L[232] = Kx[265] * D_inv[21];
+        L[233] = Kx[266] * D_inv[21];
+        L[234] = Kx[267] * D_inv[21];
+        L[235] = Kx[268] * D_inv[21];
+        D[22] = Kx[279];
+        D_inv[22] = 1. / D[22];
+        L[236] = Kx[270] * D_inv[22];
+        L[237] = Kx[271] * D_inv[22];
+        L[238] = Kx[272] * D_inv[22];
+        L[239] = Kx[273] * D_inv[22];
+        L[240] = Kx[274] * D_inv[22];
+        L[241] = Kx[275] * D_inv[22];
+        L[242] = Kx[276] * D_inv[22];
+        L[243] = Kx[277] * D_inv[22];
+        L[244] = Kx[278] * D_inv[22];
+        D[23] = Kx[293];
+        D_inv[23] = 1. / D[23];
+        L[245] = Kx[280] * D_inv[23];
+        L[246] = Kx[281] * D_inv[23];
+        L[247] = Kx[282] * D_inv[23];
+        L[248] = Kx[283] * D_inv[23];
+        L[249] = Kx[284] * D_inv[23];
+        L[250] = Kx[285] * D_inv[23];
+        L[251] = Kx[286] * D_inv[23];
+        L[252] = Kx[287] * D_inv[23];
+        L[253] = Kx[288] * D_inv[23];
+        L[254] = Kx[289] * D_inv[23];
+        L[255] = Kx[290] * D_inv[23];
+        L[256] = Kx[291] * D_inv[23];
+        L[257] = Kx[292] * D_inv[23];
+        D[24] = Kx[307];
+        D_inv[24] = 1. / D[24];
+        L[258] = Kx[294] * D_inv[24];
+        L[259] = Kx[295] * D_inv[24];
+        L[260] = Kx[296] * D_inv[24];
+        L[261] = Kx[297] * D_inv[24];
+        L[262] = Kx[298] * D_inv[24];
+        L[263] = Kx[299] * D_inv[24];
+        L[264] = Kx[300] * D_inv[24];
+        L[265] = Kx[301] * D_inv[24];
+        L[266] = Kx[302] * D_inv[24];
+        L[267] = Kx[303] * D_inv[24];
+        L[268] = Kx[304] * D_inv[24];
+        L[269] = Kx[305] * D_inv[24];
+        L[270] = Kx[306] * D_inv[24];
+        D[25] = Kx[323];
+        D_inv[25] = 1. / D[25];
+        L[271] = Kx[308] * D_inv[25];
+        L[272] = Kx[309] * D_inv[25];
+        L[273] = Kx[310] * D_inv[25];
+        L[274] = Kx[311] * D_inv[25];
+        L[275] = Kx[312] * D_inv[25];
+        L[276] = Kx[313] * D_inv[25];
+        L[277] = Kx[314] * D_inv[25];
+        L[278] = Kx[315] * D_inv[25];
+        L[279] = Kx[316] * D_inv[25];
+        L[280] = Kx[317] * D_inv[25];
+        L[281] = Kx[318] * D_inv[25];
+        L[282] = Kx[319] * D_inv[25];
+        L[283] = Kx[320] * D_inv[25];
+        L[284] = Kx[321] * D_inv[25];
+        L[285] = Kx[322] * D_inv[25];
+        D[26] = Kx[344];
+        D_inv[26] = 1. / D[26];
+        L[286] = Kx[332] * D_inv[26];
+        L[287] = Kx[333] * D_inv[26];
+        L[288] = Kx[334] * D_inv[26];
+        L[289] = Kx[335] * D_inv[26];
+        L[290] = Kx[336] * D_inv[26];
+        L[291] = Kx[337] * D_inv[26];
+        L[292] = Kx[338] * D_inv[26];
+        L[293] = Kx[339] * D_inv[26];
+        L[294] = Kx[340] * D_inv[26];
+        L[295] = Kx[341] * D_inv[26];
+        L[296] = Kx[342] * D_inv[26];
+        L[297] = Kx[343] * D_inv[26];
+        D[27] = Kx[355];
+        D_inv[27] = 1. / D[27];
+        L[298] = Kx[345] * D_inv[27];
+        L[299] = Kx[346] * D_inv[27];
+        L[300] = Kx[347] * D_inv[27];
+        L[301] = Kx[348] * D_inv[27];
+        L[302] = Kx[349] * D_inv[27];
+        L[303] = Kx[350] * D_inv[27];
+        L[304] = Kx[351] * D_inv[27];
+        L[305] = Kx[352] * D_inv[27];
+        L[306] = Kx[353] * D_inv[27];
+        L[307] = Kx[354] * D_inv[27];
+        D[28] = Kx[367];
+        D_inv[28] = 1. / D[28];
+        L[308] = Kx[356] * D_inv[28];
+        L[309] = Kx[357] * D_inv[28];
+        L[310] = Kx[358] * D_inv[28];
+        L[311] = Kx[359] * D_inv[28];
+        L[312] = Kx[360] * D_inv[28];
+        L[313] = Kx[361] * D_inv[28];
+        L[314] = Kx[362] * D_inv[28];
+        L[315] = Kx[363] * D_inv[28];
+        L[316] = Kx[364] * D_inv[28];
+        L[317] = Kx[365] * D_inv[28];
+        L[318] = Kx[366] * D_inv[28];
+        D[29] = Kx[377];
+        D_inv[29] = 1. / D[29];
+        L[319] = Kx[368] * D_inv[29];
+        L[320] = Kx[369] * D_inv[29];
+        L[321] = Kx[370] * D_inv[29];
+        L[322] = Kx[371] * D_inv[29];
+        L[323] = Kx[372] * D_inv[29];
+        L[324] = Kx[373] * D_inv[29];
+        L[325] = Kx[374] * D_inv[29];
+        L[326] = Kx[375] * D_inv[29];
+        L[327] = Kx[376] * D_inv[29];
+        D[30] = Kx[389];
+        D_inv[30] = 1. / D[30];
+        L[328] = Kx[378] * D_inv[30];
+        L[329] = Kx[379] * D_inv[30];
+        L[330] = Kx[380] * D_inv[30];
+        L[331] = Kx[381] * D_inv[30];
+        L[332] = Kx[382] * D_inv[30];
+        L[333] = Kx[383] * D_inv[30];
+        L[334] = Kx[384] * D_inv[30];
+        L[335] = Kx[385] * D_inv[30];
+        L[336] = Kx[386] * D_inv[30];
+        L[337] = Kx[387] * D_inv[30];
+        L[338] = Kx[388] * D_inv[30];
+        D[31] = Kx[400];
+        D_inv[31] = 1. / D[31];
+        L[339] = Kx[390] * D_inv[31];
+        L[340] = Kx[391] * D_inv[31];
+        L[341] = Kx[392] * D_inv[31];
+        L[342] = Kx[393] * D_inv[31];
+        L[343] = Kx[394] * D_inv[31];
+        L[344] = Kx[395] * D_inv[31];
+        L[345] = Kx[396] * D_inv[31];
+        L[346] = Kx[397] * D_inv[31];
+        L[347] = Kx[398] * D_inv[31];
+        L[348] = Kx[399] * D_inv[31];
+        D[32] = Kx[411];
+        D_inv[32] = 1. / D[32];
+        L[349] = Kx[401] * D_inv[32];
+        L[350] = Kx[402] * D_inv[32];
+        L[351] = Kx[403] * D_inv[32];
+        L[352] = Kx[404] * D_inv[32];
+        L[353] = Kx[405] * D_inv[32];
+        L[354] = Kx[406] * D_inv[32];
+        L[355] = Kx[407] * D_inv[32];
+        L[356] = Kx[408] * D_inv[32];
+        L[357] = Kx[409] * D_inv[32];
+        L[358] = Kx[410] * D_inv[32];
+        D[33] = Kx[422];
+        D_inv[33] = 1. / D[33];
+        L[359] = Kx[412] * D_inv[33];
+        L[360] = Kx[413] * D_inv[33];
+        L[361] = Kx[414] * D_inv[33];
+        L[362] = Kx[415] * D_inv[33];
+        L[363] = Kx[416] * D_inv[33];
+        L[364] = Kx[417] * D_inv[33];
+        L[365] = Kx[418] * D_inv[33];
+        L[366] = Kx[419] * D_inv[33];
+        L[367] = Kx[420] * D_inv[33];
+        L[368] = Kx[421] * D_inv[33];
+        D[34] = Kx[432];
+        D_inv[34] = 1. / D[34];
+        L[369] = Kx[423] * D_inv[34];
+        L[370] = Kx[424] * D_inv[34];
+        L[371] = Kx[425] * D_inv[34];
+        L[372] = Kx[426] * D_inv[34];
+        L[373] = Kx[427] * D_inv[34];
+        L[374] = Kx[428] * D_inv[34];
+        L[375] = Kx[429] * D_inv[34];
+        L[376] = Kx[430] * D_inv[34];
+        L[377] = Kx[431] * D_inv[34];
+        D[35] = Kx[443];
+        D_inv[35] = 1. / D[35];
+        L[378] = Kx[433] * D_inv[35];
+        L[379] = Kx[434] * D_inv[35];
+        L[380] = Kx[435] * D_inv[35];
+        L[381] = Kx[436] * D_inv[35];
+        L[382] = Kx[437] * D_inv[35];
+        L[383] = Kx[438] * D_inv[35];
+        L[384] = Kx[439] * D_inv[35];
+        L[385] = Kx[440] * D_inv[35];
+        L[386] = Kx[441] * D_inv[35];
+        L[387] = Kx[442] * D_inv[35];
+        D[36] = Kx[456];
+        D_inv[36] = 1. / D[36];
+        L[388] = Kx[444] * D_inv[36];
+        L[389] = Kx[445] * D_inv[36];
+        L[390] = Kx[446] * D_inv[36];
+        L[391] = Kx[447] * D_inv[36];
+        L[392] = Kx[448] * D_inv[36];
+        L[393] = Kx[449] * D_inv[36];
+        L[394] = Kx[450] * D_inv[36];
+        L[395] = Kx[451] * D_inv[36];
+        L[396] = Kx[452] * D_inv[36];
+        L[397] = Kx[453] * D_inv[36];
+        L[398] = Kx[454] * D_inv[36];
+        L[399] = Kx[455] * D_inv[36];
+        D[37] = Kx[468];
+        D_inv[37] = 1. / D[37];
+        L[400] = Kx[457] * D_inv[37];
+        L[401] = Kx[458] * D_inv[37];
+        L[402] = Kx[459] * D_inv[37];
+        L[403] = Kx[460] * D_inv[37];
+        L[404] = Kx[461] * D_inv[37];
+        L[405] = Kx[462] * D_inv[37];
+        L[406] = Kx[463] * D_inv[37];
+        L[407] = Kx[464] * D_inv[37];
+        L[408] = Kx[465] * D_inv[37];
+        L[409] = Kx[466] * D_inv[37];
+        L[410] = Kx[467] * D_inv[37];
+        D[38] = Kx[481];
+        D_inv[38] = 1. / D[38];
+        L[411] = Kx[469] * D_inv[38];
+        L[412] = Kx[470] * D_inv[38];
+        L[413] = Kx[471] * D_inv[38];
+        L[414] = Kx[472] * D_inv[38];
+        L[415] = Kx[473] * D_inv[38];
+        L[416] = Kx[474] * D_inv[38];
+        L[417] = Kx[475] * D_inv[38];
+        L[418] = Kx[476] * D_inv[38];
+        L[419] = Kx[477] * D_inv[38];
+        L[420] = Kx[478] * D_inv[38];
+        L[421] = Kx[479] * D_inv[38];
+        L[422] = Kx[480] * D_inv[38];
+        D[39] = Kx[494];
+        D_inv[39] = 1. / D[39];
+        L[423] = Kx[482] * D_inv[39];
+        L[424] = Kx[483] * D_inv[39];
+        L[425] = Kx[484] * D_inv[39];
+        L[426] = Kx[485] * D_inv[39];
+        L[427] = Kx[486] * D_inv[39];
+        L[428] = Kx[487] * D_inv[39];
+        L[429] = Kx[488] * D_inv[39];
+        L[430] = Kx[489] * D_inv[39];
+        L[431] = Kx[490] * D_inv[39];
+        L[432] = Kx[491] * D_inv[39];
+        L[433] = Kx[492] * D_inv[39];
+        L[434] = Kx[493] * D_inv[39];
+        D[40] = Kx[505];
+        D_inv[40] = 1. / D[40];
+        L[435] = Kx[495] * D_inv[40];
+        L[436] = Kx[496] * D_inv[40];
+        L[437] = Kx[497] * D_inv[40];
+        L[438] = Kx[498] * D_inv[40];
+        L[439] = Kx[499] * D_inv[40];
+        L[440] = Kx[500] * D_inv[40];
+        L[441] = Kx[501] * D_inv[40];
+        L[442] = Kx[502] * D_inv[40];
+        L[443] = Kx[503] * D_inv[40];
+        L[444] = Kx[504] * D_inv[40];
+        D[41] = Kx[514];
+        D_inv[41] = 1. / D[41];
+        L[445] = Kx[506] * D_inv[41];
+        L[446] = Kx[507] * D_inv[41];
+        L[447] = Kx[508] * D_inv[41];
+        L[448] = Kx[509] * D_inv[41];
+        L[449] = Kx[510] * D_inv[41];
+        L[450] = Kx[511] * D_inv[41];
+        L[451] = Kx[512] * D_inv[41];
+        L[452] = Kx[513] * D_inv[41];
+        D[42] = Kx[522];
+        D_inv[42] = 1. / D[42];
+        L[453] = Kx[515] * D_inv[42];
+        L[454] = Kx[516] * D_inv[42];
+        L[455] = Kx[517] * D_inv[42];
+        L[456] = Kx[518] * D_inv[42];
+        L[457] = Kx[519] * D_inv[42];
+        L[458] = Kx[520] * D_inv[42];
+        L[459] = Kx[521] * D_inv[42];
+        D[43] = Kx[533];
+        D_inv[43] = 1. / D[43];
+        L[460] = Kx[523] * D_inv[43];
+        L[461] = Kx[524] * D_inv[43];
+        L[462] = Kx[525] * D_inv[43];
+        L[463] = Kx[526] * D_inv[43];
+        L[464] = Kx[527] * D_inv[43];
+        L[465] = Kx[528] * D_inv[43];
+        L[466] = Kx[529] * D_inv[43];
+        L[467] = Kx[530] * D_inv[43];
+        L[468] = Kx[531] * D_inv[43];
+        L[469] = Kx[532] * D_inv[43];
+        D[44] = Kx[545];
+        D_inv[44] = 1. / D[44];
+        L[470] = Kx[534] * D_inv[44];
+        L[471] = Kx[535] * D_inv[44];
+        L[472] = Kx[536] * D_inv[44];
+        L[473] = Kx[537] * D_inv[44];
+        L[474] = Kx[538] * D_inv[44];
+        L[475] = Kx[539] * D_inv[44];
+        L[476] = Kx[540] * D_inv[44];
+        L[477] = Kx[541] * D_inv[44];
+        L[478] = Kx[542] * D_inv[44];
+        L[479] = Kx[543] * D_inv[44];
+        L[480] = Kx[544] * D_inv[44];
+        const double t45_0 = L[0] * D[0];
+        const double t45_1 = L[13] * D[1];
+        const double t45_2 = L[22] * D[2];
+        const double t45_3 = L[29] * D[3];
+        const double t45_9 = L[92] * D[9];
+        const double t45_11 = L[114] * D[11];
+        const double t45_12 = L[124] * D[12];
+        const double t45_13 = L[136] * D[13];
+        const double t45_14 = L[149] * D[14];
+        const double t45_16 = L[173] * D[16];
+        const double t45_18 = L[192] * D[18];
+        const double t45_20 = L[210] * D[20];
+        const double t45_25 = L[271] * D[25];
+        const double t45_26 = L[286] * D[26];
+        const double t45_27 = L[298] * D[27];
+        const double t45_28 = L[308] * D[28];
+        const double t45_29 = L[319] * D[29];
+        const double t45_32 = L[349] * D[32];
+        const double t45_34 = L[369] * D[34];
+        const double t45_38 = L[411] * D[38];
+        const double t45_39 = L[423] * D[39];
+        const double t45_40 = L[435] * D[40];
+        const double t45_42 = L[453] * D[42];
+        const double t45_43 = L[460] * D[43];
+        D[45] = Kx[0] - L[0] * t45_0 - L[13] * t45_1 - L[22] * t45_2 - L[29] * t45_3 - L[92] * t45_9 - L[114] * t45_11 - L[124] * t45_12 - L[136] * t45_13 - L[149] * t45_14 - L[173] * t45_16 - L[192] * t45_18 - L[210] * t45_20 - L[271] * t45_25 - L[286] * t45_26 - L[298] * t45_27 - L[308] * t45_28 - L[319] * t45_29 - L[349] * t45_32 - L[369] * t45_34 - L[411] * t45_38 - L[423] * t45_39 - L[435] * t45_40 - L[453] * t45_42 - L[460] * t45_43;
+        D_inv[45] = 1. / D[45];
+        L[481] = (-L[1] * t45_0 - L[23] * t45_2 - L[93] * t45_9 - L[115] * t45_11 - L[125] * t45_12 - L[137] * t45_13 - L[150] * t45_14 - L[174] * t45_16 - L[193] * t45_18 - L[272] * t45_25 - L[287] * t45_26 - L[299] * t45_27 - L[320] * t45_29 - L[424] * t45_39 - L[436] * t45_40) * D_inv[45];
+        L[482] = (-L[2] * t45_0 - L[94] * t45_9 - L[116] * t45_11 - L[138] * t45_13 - L[211] * t45_20 - L[273] * t45_25 - L[288] * t45_26 - L[300] * t45_27 - L[321] * t45_29 - L[370] * t45_34 - L[412] * t45_38 - L[425] * t45_39 - L[461] * t45_43) * D_inv[45];
+        L[483] = (-L[3] * t45_0 - L[30] * t45_3 - L[95] * t45_9 - L[126] * t45_12 - L[151] * t45_14 - L[175] * t45_16 - L[212] * t45_20 - L[274] * t45_25 - L[289] * t45_26 - L[322] * t45_29 - L[350] * t45_32 - L[462] * t45_43) * D_inv[45];
+        L[484] = (-L[96] * t45_9 - L[152] * t45_14 - L[176] * t45_16 - L[194] * t45_18 - L[213] * t45_20 - L[309] * t45_28 - L[371] * t45_34 - L[413] * t45_38 - L[437] * t45_40) * D_inv[45];
+        L[485] = (-L[4] * t45_0 - L[117] * t45_11 - L[127] * t45_12 - L[139] * t45_13 - L[153] * t45_14 - L[195] * t45_18 - L[214] * t45_20 - L[275] * t45_25 - L[301] * t45_27 - L[310] * t45_28 - L[323] * t45_29 - L[351] * t45_32 - L[426] * t45_39) * D_inv[45];
+        L[486] = (-L[14] * t45_1 - L[97] * t45_9 - L[140] * t45_13 - L[215] * t45_20 - L[276] * t45_25 - L[290] * t45_26 - L[352] * t45_32 - L[372] * t45_34 - L[414] * t45_38 - L[427] * t45_39 - L[463] * t45_43) * D_inv[45];
+        L[487] = (-L[5] * t45_0 - L[15] * t45_1 - L[31] * t45_3 - L[128] * t45_12 - L[196] * t45_18 - L[277] * t45_25 - L[373] * t45_34 - L[415] * t45_38 - L[438] * t45_40 - L[454] * t45_42 - L[464] * t45_43) * D_inv[45];
+        L[488] = (-L[24] * t45_2 - L[98] * t45_9 - L[129] * t45_12 - L[141] * t45_13 - L[197] * t45_18 - L[216] * t45_20 - L[278] * t45_25 - L[311] * t45_28 - L[324] * t45_29 - L[353] * t45_32 - L[465] * t45_43) * D_inv[45];
+        L[489] = (-L[6] * t45_0 - L[25] * t45_2 - L[99] * t45_9 - L[118] * t45_11 - L[130] * t45_12 - L[177] * t45_16 - L[279] * t45_25 - L[291] * t45_26 - L[416] * t45_38 - L[455] * t45_42) * D_inv[45];
+        L[490] = (-L[16] * t45_1 - L[26] * t45_2 - L[32] * t45_3 - L[119] * t45_11 - L[131] * t45_12 - L[142] * t45_13 - L[154] * t45_14 - L[198] * t45_18 - L[217] * t45_20 - L[292] * t45_26 - L[325] * t45_29 - L[417] * t45_38 - L[428] * t45_39) * D_inv[45];
+        L[491] = (-L[33] * t45_3 - L[100] * t45_9 - L[120] * t45_11 - L[155] * t45_14 - L[178] * t45_16 - L[199] * t45_18 - L[218] * t45_20 - L[280] * t45_25 - L[293] * t45_26 - L[302] * t45_27 - L[312] * t45_28 - L[374] * t45_34 - L[429] * t45_39 - L[439] * t45_40 - L[456] * t45_42 - L[466] * t45_43) * D_inv[45];
+        L[492] = (-L[7] * t45_0 - L[17] * t45_1 - L[34] * t45_3 - L[143] * t45_13 - L[281] * t45_25 - L[294] * t45_26 - L[313] * t45_28 - L[326] * t45_29 - L[354] * t45_32 - L[375] * t45_34 - L[418] * t45_38 - L[430] * t45_39) * D_inv[45];
+        L[493] = (-L[8] * t45_0 - L[35] * t45_3 - L[144] * t45_13 - L[219] * t45_20 - L[314] * t45_28 - L[457] * t45_42) * D_inv[45];
+        L[494] = (-L[9] * t45_0 - L[18] * t45_1 - L[121] * t45_11 - L[132] * t45_12 - L[145] * t45_13 - L[179] * t45_16 - L[200] * t45_18 - L[220] * t45_20 - L[282] * t45_25 - L[295] * t45_26 - L[303] * t45_27 - L[376] * t45_34 - L[419] * t45_38 - L[431] * t45_39 - L[440] * t45_40 - L[467] * t45_43) * D_inv[45];
+        L[495] = (-L[10] * t45_0 - L[19] * t45_1 - L[101] * t45_9 - L[133] * t45_12 - L[146] * t45_13 - L[156] * t45_14 - L[304] * t45_27 - L[355] * t45_32 - L[432] * t45_39 - L[441] * t45_40) * D_inv[45];
+        L[496] = (-L[102] * t45_9 - L[134] * t45_12 - L[157] * t45_14 - L[180] * t45_16 - L[201] * t45_18 - L[283] * t45_25 - L[296] * t45_26 - L[305] * t45_27 - L[315] * t45_28 - L[356] * t45_32 - L[420] * t45_38 - L[442] * t45_40 - L[458] * t45_42 - L[468] * t45_43) * D_inv[45];
+        L[497] = (-L[20] * t45_1 - L[135] * t45_12 - L[147] * t45_13 - L[158] * t45_14 - L[221] * t45_20 - L[297] * t45_26 - L[316] * t45_28 - L[357] * t45_32 - L[421] * t45_38 - L[433] * t45_39 - L[459] * t45_42 - L[469] * t45_43) * D_inv[45];
+        L[498] = (-L[11] * t45_0 - L[27] * t45_2 - L[36] * t45_3 - L[103] * t45_9 - L[122] * t45_11 - L[148] * t45_13 - L[181] * t45_16 - L[202] * t45_18 - L[222] * t45_20 - L[284] * t45_25 - L[306] * t45_27 - L[317] * t45_28 - L[327] * t45_29 - L[443] * t45_40) * D_inv[45];
+        L[499] = (-L[12] * t45_0 - L[21] * t45_1 - L[28] * t45_2 - L[37] * t45_3 - L[104] * t45_9 - L[123] * t45_11 - L[203] * t45_18 - L[285] * t45_25 - L[307] * t45_27 - L[318] * t45_28 - L[358] * t45_32 - L[377] * t45_34 - L[422] * t45_38 - L[434] * t45_39 - L[444] * t45_40) * D_inv[45];
+        const double t46_0 = L[1] * D[0];
+        const double t46_2 = L[23] * D[2];
+        const double t46_4 = L[38] * D[4];
+        const double t46_7 = L[66] * D[7];
+        const double t46_9 = L[93] * D[9];
+        const double t46_11 = L[115] * D[11];
+        const double t46_12 = L[125] * D[12];
+        const double t46_13 = L[137] * D[13];
+        const double t46_14 = L[150] * D[14];
+        const double t46_15 = L[159] * D[15];
+        const double t46_16 = L[174] * D[16];
+        const double t46_18 = L[193] * D[18];
+        const double t46_19 = L[204] * D[19];
+        const double t46_21 = L[223] * D[21];
+        const double t46_23 = L[245] * D[23];
+        const double t46_25 = L[272] * D[25];
+        const double t46_26 = L[287] * D[26];
+        const double t46_27 = L[299] * D[27];
+        const double t46_29 = L[320] * D[29];
+        const double t46_31 = L[339] * D[31];
+        const double t46_33 = L[359] * D[33];
+        const double t46_35 = L[378] * D[35];
+        const double t46_36 = L[388] * D[36];
+        const double t46_39 = L[424] * D[39];
+        const double t46_40 = L[436] * D[40];
+        const double t46_45 = L[481] * D[45];
+        D[46] = Kx[1] - L[1] * t46_0 - L[23] * t46_2 - L[38] * t46_4 - L[66] * t46_7 - L[93] * t46_9 - L[115] * t46_11 - L[125] * t46_12 - L[137] * t46_13 - L[150] * t46_14 - L[159] * t46_15 - L[174] * t46_16 - L[193] * t46_18 - L[204] * t46_19 - L[223] * t46_21 - L[245] * t46_23 - L[272] * t46_25 - L[287] * t46_26 - L[299] * t46_27 - L[320] * t46_29 - L[339] * t46_31 - L[359] * t46_33 - L[378] * t46_35 - L[388] * t46_36 - L[424] * t46_39 - L[436] * t46_40 - L[481] * t46_45;
+        D_inv[46] = 1. / D[46];
+        L[500] = (-L[2] * t46_0 - L[94] * t46_9 - L[116] * t46_11 - L[138] * t46_13 - L[160] * t46_15 - L[205] * t46_19 - L[246] * t46_23 - L[273] * t46_25 - L[288] * t46_26 - L[300] * t46_27 - L[321] * t46_29 - L[360] * t46_33 - L[379] * t46_35 - L[425] * t46_39 - L[482] * t46_45) * D_inv[46];
+        L[501] = (-L[3] * t46_0 - L[67] * t46_7 - L[95] * t46_9 - L[126] * t46_12 - L[151] * t46_14 - L[161] * t46_15 - L[175] * t46_16 - L[247] * t46_23 - L[274] * t46_25 - L[289] * t46_26 - L[322] * t46_29 - L[340] * t46_31 - L[380] * t46_35 - L[389] * t46_36 - L[483] * t46_45) * D_inv[46];
+        L[502] = (-L[39] * t46_4 - L[68] * t46_7 - L[96] * t46_9 - L[152] * t46_14 - L[162] * t46_15 - L[176] * t46_16 - L[194] * t46_18 - L[206] * t46_19 - L[224] * t46_21 - L[248] * t46_23 - L[381] * t46_35 - L[390] * t46_36 - L[437] * t46_40 - L[484] * t46_45) * D_inv[46];
+        L[503] = (-L[4] * t46_0 - L[69] * t46_7 - L[117] * t46_11 - L[127] * t46_12 - L[139] * t46_13 - L[153] * t46_14 - L[195] * t46_18 - L[225] * t46_21 - L[249] * t46_23 - L[275] * t46_25 - L[301] * t46_27 - L[323] * t46_29 - L[341] * t46_31 - L[361] * t46_33 - L[426] * t46_39 - L[485] * t46_45) * D_inv[46];
+        L[504] = (-L[40] * t46_4 - L[97] * t46_9 - L[140] * t46_13 - L[207] * t46_19 - L[226] * t46_21 - L[276] * t46_25 - L[290] * t46_26 - L[362] * t46_33 - L[391] * t46_36 - L[427] * t46_39 - L[486] * t46_45) * D_inv[46];
+        L[505] = (-L[5] * t46_0 - L[41] * t46_4 - L[128] * t46_12 - L[196] * t46_18 - L[208] * t46_19 - L[227] * t46_21 - L[277] * t46_25 - L[342] * t46_31 - L[382] * t46_35 - L[392] * t46_36 - L[438] * t46_40 - L[487] * t46_45) * D_inv[46];
+        L[506] = (-L[24] * t46_2 - L[98] * t46_9 - L[129] * t46_12 - L[141] * t46_13 - L[163] * t46_15 - L[197] * t46_18 - L[278] * t46_25 - L[324] * t46_29 - L[343] * t46_31 - L[383] * t46_35 - L[393] * t46_36 - L[488] * t46_45) * D_inv[46];
+        L[507] = (-L[6] * t46_0 - L[25] * t46_2 - L[42] * t46_4 - L[70] * t46_7 - L[99] * t46_9 - L[118] * t46_11 - L[130] * t46_12 - L[164] * t46_15 - L[177] * t46_16 - L[250] * t46_23 - L[279] * t46_25 - L[291] * t46_26 - L[344] * t46_31 - L[384] * t46_35 - L[394] * t46_36 - L[489] * t46_45) * D_inv[46];
+        L[508] = (-L[26] * t46_2 - L[43] * t46_4 - L[71] * t46_7 - L[119] * t46_11 - L[131] * t46_12 - L[142] * t46_13 - L[154] * t46_14 - L[198] * t46_18 - L[228] * t46_21 - L[251] * t46_23 - L[292] * t46_26 - L[325] * t46_29 - L[385] * t46_35 - L[395] * t46_36 - L[428] * t46_39 - L[490] * t46_45) * D_inv[46];
+        L[509] = (-L[72] * t46_7 - L[100] * t46_9 - L[120] * t46_11 - L[155] * t46_14 - L[165] * t46_15 - L[178] * t46_16 - L[199] * t46_18 - L[229] * t46_21 - L[252] * t46_23 - L[280] * t46_25 - L[293] * t46_26 - L[302] * t46_27 - L[363] * t46_33 - L[396] * t46_36 - L[429] * t46_39 - L[439] * t46_40 - L[491] * t46_45) * D_inv[46];
+        L[510] = (-L[7] * t46_0 - L[73] * t46_7 - L[143] * t46_13 - L[166] * t46_15 - L[209] * t46_19 - L[230] * t46_21 - L[281] * t46_25 - L[294] * t46_26 - L[326] * t46_29 - L[364] * t46_33 - L[430] * t46_39 - L[492] * t46_45) * D_inv[46];
+        L[511] = (-L[8] * t46_0 - L[44] * t46_4 - L[74] * t46_7 - L[144] * t46_13 - L[253] * t46_23 - L[345] * t46_31 - L[365] * t46_33 - L[386] * t46_35 - L[493] * t46_45) * D_inv[46];
+        L[512] = (-L[9] * t46_0 - L[75] * t46_7 - L[121] * t46_11 - L[132] * t46_12 - L[145] * t46_13 - L[167] * t46_15 - L[179] * t46_16 - L[200] * t46_18 - L[254] * t46_23 - L[282] * t46_25 - L[295] * t46_26 - L[303] * t46_27 - L[431] * t46_39 - L[440] * t46_40 - L[494] * t46_45) * D_inv[46];
+        L[513] = (-L[10] * t46_0 - L[101] * t46_9 - L[133] * t46_12 - L[146] * t46_13 - L[156] * t46_14 - L[168] * t46_15 - L[231] * t46_21 - L[304] * t46_27 - L[346] * t46_31 - L[366] * t46_33 - L[432] * t46_39 - L[441] * t46_40 - L[495] * t46_45) * D_inv[46];
+        L[514] = (-L[45] * t46_4 - L[76] * t46_7 - L[102] * t46_9 - L[134] * t46_12 - L[157] * t46_14 - L[169] * t46_15 - L[180] * t46_16 - L[201] * t46_18 - L[232] * t46_21 - L[255] * t46_23 - L[283] * t46_25 - L[296] * t46_26 - L[305] * t46_27 - L[347] * t46_31 - L[397] * t46_36 - L[442] * t46_40 - L[496] * t46_45) * D_inv[46];
+        L[515] = (-L[77] * t46_7 - L[135] * t46_12 - L[147] * t46_13 - L[158] * t46_14 - L[170] * t46_15 - L[233] * t46_21 - L[297] * t46_26 - L[348] * t46_31 - L[398] * t46_36 - L[433] * t46_39 - L[497] * t46_45) * D_inv[46];
+        L[516] = (-L[11] * t46_0 - L[27] * t46_2 - L[46] * t46_4 - L[78] * t46_7 - L[103] * t46_9 - L[122] * t46_11 - L[148] * t46_13 - L[171] * t46_15 - L[181] * t46_16 - L[202] * t46_18 - L[234] * t46_21 - L[256] * t46_23 - L[284] * t46_25 - L[306] * t46_27 - L[327] * t46_29 - L[367] * t46_33 - L[443] * t46_40 - L[498] * t46_45) * D_inv[46];
+        L[517] = (-L[12] * t46_0 - L[28] * t46_2 - L[47] * t46_4 - L[104] * t46_9 - L[123] * t46_11 - L[172] * t46_15 - L[203] * t46_18 - L[235] * t46_21 - L[257] * t46_23 - L[285] * t46_25 - L[307] * t46_27 - L[368] * t46_33 - L[387] * t46_35 - L[399] * t46_36 - L[434] * t46_39 - L[444] * t46_40 - L[499] * t46_45) * D_inv[46];
+        const double t47_0 = L[2] * D[0];
+        const double t47_5 = L[48] * D[5];
+        const double t47_6 = L[55] * D[6];
+        const double t47_9 = L[94] * D[9];
+        const double t47_11 = L[116] * D[11];
+        const double t47_13 = L[138] * D[13];
+        const double t47_15 = L[160] * D[15];
+        const double t47_19 = L[205] * D[19];
+        const double t47_20 = L[211] * D[20];
+        const double t47_23 = L[246] * D[23];
+        const double t47_24 = L[258] * D[24];
+        const double t47_25 = L[273] * D[25];
+        const double t47_26 = L[288] * D[26];
+        const double t47_27 = L[300] * D[27];
+        const double t47_29 = L[321] * D[29];
+        const double t47_33 = L[360] * D[33];
+        const double t47_34 = L[370] * D[34];
+        const double t47_35 = L[379] * D[35];
+        const double t47_37 = L[400] * D[37];
+        const double t47_38 = L[412] * D[38];
+        const double t47_39 = L[425] * D[39];
+        const double t47_41 = L[445] * D[41];
+        const double t47_43 = L[461] * D[43];
+        const double t47_44 = L[470] * D[44];
+        const double t47_45 = L[482] * D[45];
+        const double t47_46 = L[500] * D[46];
+        D[47] = Kx[2] - L[2] * t47_0 - L[48] * t47_5 - L[55] * t47_6 - L[94] * t47_9 - L[116] * t47_11 - L[138] * t47_13 - L[160] * t47_15 - L[205] * t47_19 - L[211] * t47_20 - L[246] * t47_23 - L[258] * t47_24 - L[273] * t47_25 - L[288] * t47_26 - L[300] * t47_27 - L[321] * t47_29 - L[360] * t47_33 - L[370] * t47_34 - L[379] * t47_35 - L[400] * t47_37 - L[412] * t47_38 - L[425] * t47_39 - L[445] * t47_41 - L[461] * t47_43 - L[470] * t47_44 - L[482] * t47_45 - L[500] * t47_46;
+        D_inv[47] = 1. / D[47];
+        L[518] = (-L[3] * t47_0 - L[95] * t47_9 - L[161] * t47_15 - L[212] * t47_20 - L[247] * t47_23 - L[274] * t47_25 - L[289] * t47_26 - L[322] * t47_29 - L[380] * t47_35 - L[446] * t47_41 - L[462] * t47_43 - L[483] * t47_45 - L[501] * t47_46) * D_inv[47];
+        L[519] = (-L[49] * t47_5 - L[56] * t47_6 - L[96] * t47_9 - L[162] * t47_15 - L[206] * t47_19 - L[213] * t47_20 - L[248] * t47_23 - L[259] * t47_24 - L[371] * t47_34 - L[381] * t47_35 - L[413] * t47_38 - L[447] * t47_41 - L[471] * t47_44 - L[484] * t47_45 - L[502] * t47_46) * D_inv[47];
+        L[520] = (-L[4] * t47_0 - L[117] * t47_11 - L[139] * t47_13 - L[214] * t47_20 - L[249] * t47_23 - L[260] * t47_24 - L[275] * t47_25 - L[301] * t47_27 - L[323] * t47_29 - L[361] * t47_33 - L[401] * t47_37 - L[426] * t47_39 - L[448] * t47_41 - L[472] * t47_44 - L[485] * t47_45 - L[503] * t47_46) * D_inv[47];
+        L[521] = (-L[50] * t47_5 - L[57] * t47_6 - L[97] * t47_9 - L[140] * t47_13 - L[207] * t47_19 - L[215] * t47_20 - L[261] * t47_24 - L[276] * t47_25 - L[290] * t47_26 - L[362] * t47_33 - L[372] * t47_34 - L[414] * t47_38 - L[427] * t47_39 - L[463] * t47_43 - L[473] * t47_44 - L[486] * t47_45 - L[504] * t47_46) * D_inv[47];
+        L[522] = (-L[5] * t47_0 - L[208] * t47_19 - L[262] * t47_24 - L[277] * t47_25 - L[373] * t47_34 - L[382] * t47_35 - L[402] * t47_37 - L[415] * t47_38 - L[449] * t47_41 - L[464] * t47_43 - L[487] * t47_45 - L[505] * t47_46) * D_inv[47];
+        L[523] = (-L[58] * t47_6 - L[98] * t47_9 - L[141] * t47_13 - L[163] * t47_15 - L[216] * t47_20 - L[263] * t47_24 - L[278] * t47_25 - L[324] * t47_29 - L[383] * t47_35 - L[450] * t47_41 - L[465] * t47_43 - L[474] * t47_44 - L[488] * t47_45 - L[506] * t47_46) * D_inv[47];
+        L[524] = (-L[6] * t47_0 - L[99] * t47_9 - L[118] * t47_11 - L[164] * t47_15 - L[250] * t47_23 - L[264] * t47_24 - L[279] * t47_25 - L[291] * t47_26 - L[384] * t47_35 - L[403] * t47_37 - L[416] * t47_38 - L[489] * t47_45 - L[507] * t47_46) * D_inv[47];
+        L[525] = (-L[59] * t47_6 - L[119] * t47_11 - L[142] * t47_13 - L[217] * t47_20 - L[251] * t47_23 - L[265] * t47_24 - L[292] * t47_26 - L[325] * t47_29 - L[385] * t47_35 - L[404] * t47_37 - L[417] * t47_38 - L[428] * t47_39 - L[475] * t47_44 - L[490] * t47_45 - L[508] * t47_46) * D_inv[47];
+        L[526] = (-L[100] * t47_9 - L[120] * t47_11 - L[165] * t47_15 - L[218] * t47_20 - L[252] * t47_23 - L[266] * t47_24 - L[280] * t47_25 - L[293] * t47_26 - L[302] * t47_27 - L[363] * t47_33 - L[374] * t47_34 - L[429] * t47_39 - L[466] * t47_43 - L[476] * t47_44 - L[491] * t47_45 - L[509] * t47_46) * D_inv[47];
+        L[527] = (-L[7] * t47_0 - L[51] * t47_5 - L[60] * t47_6 - L[143] * t47_13 - L[166] * t47_15 - L[209] * t47_19 - L[267] * t47_24 - L[281] * t47_25 - L[294] * t47_26 - L[326] * t47_29 - L[364] * t47_33 - L[375] * t47_34 - L[405] * t47_37 - L[418] * t47_38 - L[430] * t47_39 - L[492] * t47_45 - L[510] * t47_46) * D_inv[47];
+        L[528] = (-L[8] * t47_0 - L[52] * t47_5 - L[61] * t47_6 - L[144] * t47_13 - L[219] * t47_20 - L[253] * t47_23 - L[268] * t47_24 - L[365] * t47_33 - L[386] * t47_35 - L[406] * t47_37 - L[477] * t47_44 - L[493] * t47_45 - L[511] * t47_46) * D_inv[47];
+        L[529] = (-L[9] * t47_0 - L[53] * t47_5 - L[62] * t47_6 - L[121] * t47_11 - L[145] * t47_13 - L[167] * t47_15 - L[220] * t47_20 - L[254] * t47_23 - L[282] * t47_25 - L[295] * t47_26 - L[303] * t47_27 - L[376] * t47_34 - L[407] * t47_37 - L[419] * t47_38 - L[431] * t47_39 - L[451] * t47_41 - L[467] * t47_43 - L[478] * t47_44 - L[494] * t47_45 - L[512] * t47_46) * D_inv[47];
+        L[530] = (-L[10] * t47_0 - L[101] * t47_9 - L[146] * t47_13 - L[168] * t47_15 - L[304] * t47_27 - L[366] * t47_33 - L[432] * t47_39 - L[479] * t47_44 - L[495] * t47_45 - L[513] * t47_46) * D_inv[47];
+        L[531] = (-L[63] * t47_6 - L[102] * t47_9 - L[169] * t47_15 - L[255] * t47_23 - L[283] * t47_25 - L[296] * t47_26 - L[305] * t47_27 - L[408] * t47_37 - L[420] * t47_38 - L[468] * t47_43 - L[496] * t47_45 - L[514] * t47_46) * D_inv[47];
+        L[532] = (-L[54] * t47_5 - L[64] * t47_6 - L[147] * t47_13 - L[170] * t47_15 - L[221] * t47_20 - L[269] * t47_24 - L[297] * t47_26 - L[409] * t47_37 - L[421] * t47_38 - L[433] * t47_39 - L[452] * t47_41 - L[469] * t47_43 - L[497] * t47_45 - L[515] * t47_46) * D_inv[47];
+        L[533] = (-L[11] * t47_0 - L[65] * t47_6 - L[103] * t47_9 - L[122] * t47_11 - L[148] * t47_13 - L[171] * t47_15 - L[222] * t47_20 - L[256] * t47_23 - L[270] * t47_24 - L[284] * t47_25 - L[306] * t47_27 - L[327] * t47_29 - L[367] * t47_33 - L[410] * t47_37 - L[498] * t47_45 - L[516] * t47_46) * D_inv[47];
+        L[534] = (-L[12] * t47_0 - L[104] * t47_9 - L[123] * t47_11 - L[172] * t47_15 - L[257] * t47_23 - L[285] * t47_25 - L[307] * t47_27 - L[368] * t47_33 - L[377] * t47_34 - L[387] * t47_35 - L[422] * t47_38 - L[434] * t47_39 - L[480] * t47_44 - L[499] * t47_45 - L[517] * t47_46) * D_inv[47];
+        const double t48_0 = L[3] * D[0];
+        const double t48_3 = L[30] * D[3];
+        const double t48_7 = L[67] * D[7];
+        const double t48_8 = L[79] * D[8];
+        const double t48_9 = L[95] * D[9];
+        const double t48_12 = L[126] * D[12];
+        const double t48_14 = L[151] * D[14];
+        const double t48_15 = L[161] * D[15];
+        const double t48_16 = L[175] * D[16];
+        const double t48_17 = L[182] * D[17];
+        const double t48_20 = L[212] * D[20];
+        const double t48_23 = L[247] * D[23];
+        const double t48_25 = L[274] * D[25];
+        const double t48_26 = L[289] * D[26];
+        const double t48_29 = L[322] * D[29];
+        const double t48_30 = L[328] * D[30];
+        const double t48_31 = L[340] * D[31];
+        const double t48_32 = L[350] * D[32];
+        const double t48_35 = L[380] * D[35];
+        const double t48_36 = L[389] * D[36];
+        const double t48_41 = L[446] * D[41];
+        const double t48_43 = L[462] * D[43];
+        const double t48_45 = L[483] * D[45];
+        const double t48_46 = L[501] * D[46];
+        const double t48_47 = L[518] * D[47];
+        D[48] = Kx[3] - L[3] * t48_0 - L[30] * t48_3 - L[67] * t48_7 - L[79] * t48_8 - L[95] * t48_9 - L[126] * t48_12 - L[151] * t48_14 - L[161] * t48_15 - L[175] * t48_16 - L[182] * t48_17 - L[212] * t48_20 - L[247] * t48_23 - L[274] * t48_25 - L[289] * t48_26 - L[322] * t48_29 - L[328] * t48_30 - L[340] * t48_31 - L[350] * t48_32 - L[380] * t48_35 - L[389] * t48_36 - L[446] * t48_41 - L[462] * t48_43 - L[483] * t48_45 - L[501] * t48_46 - L[518] * t48_47;
+        D_inv[48] = 1. / D[48];
+        L[535] = (-L[68] * t48_7 - L[80] * t48_8 - L[96] * t48_9 - L[152] * t48_14 - L[162] * t48_15 - L[176] * t48_16 - L[213] * t48_20 - L[248] * t48_23 - L[329] * t48_30 - L[381] * t48_35 - L[390] * t48_36 - L[447] * t48_41 - L[484] * t48_45 - L[502] * t48_46 - L[519] * t48_47) * D_inv[48];
+        L[536] = (-L[4] * t48_0 - L[69] * t48_7 - L[81] * t48_8 - L[127] * t48_12 - L[153] * t48_14 - L[183] * t48_17 - L[214] * t48_20 - L[249] * t48_23 - L[275] * t48_25 - L[323] * t48_29 - L[330] * t48_30 - L[341] * t48_31 - L[351] * t48_32 - L[448] * t48_41 - L[485] * t48_45 - L[503] * t48_46 - L[520] * t48_47) * D_inv[48];
+        L[537] = (-L[82] * t48_8 - L[97] * t48_9 - L[215] * t48_20 - L[276] * t48_25 - L[290] * t48_26 - L[331] * t48_30 - L[352] * t48_32 - L[391] * t48_36 - L[463] * t48_43 - L[486] * t48_45 - L[504] * t48_46 - L[521] * t48_47) * D_inv[48];
+        L[538] = (-L[5] * t48_0 - L[31] * t48_3 - L[83] * t48_8 - L[128] * t48_12 - L[184] * t48_17 - L[277] * t48_25 - L[342] * t48_31 - L[382] * t48_35 - L[392] * t48_36 - L[449] * t48_41 - L[464] * t48_43 - L[487] * t48_45 - L[505] * t48_46 - L[522] * t48_47) * D_inv[48];
+        L[539] = (-L[84] * t48_8 - L[98] * t48_9 - L[129] * t48_12 - L[163] * t48_15 - L[216] * t48_20 - L[278] * t48_25 - L[324] * t48_29 - L[343] * t48_31 - L[353] * t48_32 - L[383] * t48_35 - L[393] * t48_36 - L[450] * t48_41 - L[465] * t48_43 - L[488] * t48_45 - L[506] * t48_46 - L[523] * t48_47) * D_inv[48];
+        L[540] = (-L[6] * t48_0 - L[70] * t48_7 - L[85] * t48_8 - L[99] * t48_9 - L[130] * t48_12 - L[164] * t48_15 - L[177] * t48_16 - L[250] * t48_23 - L[279] * t48_25 - L[291] * t48_26 - L[332] * t48_30 - L[344] * t48_31 - L[384] * t48_35 - L[394] * t48_36 - L[489] * t48_45 - L[507] * t48_46 - L[524] * t48_47) * D_inv[48];
+        L[541] = (-L[32] * t48_3 - L[71] * t48_7 - L[131] * t48_12 - L[154] * t48_14 - L[185] * t48_17 - L[217] * t48_20 - L[251] * t48_23 - L[292] * t48_26 - L[325] * t48_29 - L[333] * t48_30 - L[385] * t48_35 - L[395] * t48_36 - L[490] * t48_45 - L[508] * t48_46 - L[525] * t48_47) * D_inv[48];
+        L[542] = (-L[33] * t48_3 - L[72] * t48_7 - L[86] * t48_8 - L[100] * t48_9 - L[155] * t48_14 - L[165] * t48_15 - L[178] * t48_16 - L[218] * t48_20 - L[252] * t48_23 - L[280] * t48_25 - L[293] * t48_26 - L[334] * t48_30 - L[396] * t48_36 - L[466] * t48_43 - L[491] * t48_45 - L[509] * t48_46 - L[526] * t48_47) * D_inv[48];
+        L[543] = (-L[7] * t48_0 - L[34] * t48_3 - L[73] * t48_7 - L[87] * t48_8 - L[166] * t48_15 - L[186] * t48_17 - L[281] * t48_25 - L[294] * t48_26 - L[326] * t48_29 - L[335] * t48_30 - L[354] * t48_32 - L[492] * t48_45 - L[510] * t48_46 - L[527] * t48_47) * D_inv[48];
+        L[544] = (-L[8] * t48_0 - L[35] * t48_3 - L[74] * t48_7 - L[187] * t48_17 - L[219] * t48_20 - L[253] * t48_23 - L[345] * t48_31 - L[386] * t48_35 - L[493] * t48_45 - L[511] * t48_46 - L[528] * t48_47) * D_inv[48];
+        L[545] = (-L[9] * t48_0 - L[75] * t48_7 - L[132] * t48_12 - L[167] * t48_15 - L[179] * t48_16 - L[188] * t48_17 - L[220] * t48_20 - L[254] * t48_23 - L[282] * t48_25 - L[295] * t48_26 - L[336] * t48_30 - L[451] * t48_41 - L[467] * t48_43 - L[494] * t48_45 - L[512] * t48_46 - L[529] * t48_47) * D_inv[48];
+        L[546] = (-L[10] * t48_0 - L[88] * t48_8 - L[101] * t48_9 - L[133] * t48_12 - L[156] * t48_14 - L[168] * t48_15 - L[189] * t48_17 - L[337] * t48_30 - L[346] * t48_31 - L[355] * t48_32 - L[495] * t48_45 - L[513] * t48_46 - L[530] * t48_47) * D_inv[48];
+        L[547] = (-L[76] * t48_7 - L[89] * t48_8 - L[102] * t48_9 - L[134] * t48_12 - L[157] * t48_14 - L[169] * t48_15 - L[180] * t48_16 - L[190] * t48_17 - L[255] * t48_23 - L[283] * t48_25 - L[296] * t48_26 - L[347] * t48_31 - L[356] * t48_32 - L[397] * t48_36 - L[468] * t48_43 - L[496] * t48_45 - L[514] * t48_46 - L[531] * t48_47) * D_inv[48];
+        L[548] = (-L[77] * t48_7 - L[135] * t48_12 - L[158] * t48_14 - L[170] * t48_15 - L[221] * t48_20 - L[297] * t48_26 - L[338] * t48_30 - L[348] * t48_31 - L[357] * t48_32 - L[398] * t48_36 - L[452] * t48_41 - L[469] * t48_43 - L[497] * t48_45 - L[515] * t48_46 - L[532] * t48_47) * D_inv[48];
+        L[549] = (-L[11] * t48_0 - L[36] * t48_3 - L[78] * t48_7 - L[90] * t48_8 - L[103] * t48_9 - L[171] * t48_15 - L[181] * t48_16 - L[191] * t48_17 - L[222] * t48_20 - L[256] * t48_23 - L[284] * t48_25 - L[327] * t48_29 - L[498] * t48_45 - L[516] * t48_46 - L[533] * t48_47) * D_inv[48];
+        L[550] = (-L[12] * t48_0 - L[37] * t48_3 - L[91] * t48_8 - L[104] * t48_9 - L[172] * t48_15 - L[257] * t48_23 - L[285] * t48_25 - L[358] * t48_32 - L[387] * t48_35 - L[399] * t48_36 - L[499] * t48_45 - L[517] * t48_46 - L[534] * t48_47) * D_inv[48];
+        const double t49_4 = L[39] * D[4];
+        const double t49_5 = L[49] * D[5];
+        const double t49_6 = L[56] * D[6];
+        const double t49_7 = L[68] * D[7];
+        const double t49_8 = L[80] * D[8];
+        const double t49_9 = L[96] * D[9];
+        const double t49_10 = L[105] * D[10];
+        const double t49_14 = L[152] * D[14];
+        const double t49_15 = L[162] * D[15];
+        const double t49_16 = L[176] * D[16];
+        const double t49_18 = L[194] * D[18];
+        const double t49_19 = L[206] * D[19];
+        const double t49_20 = L[213] * D[20];
+        const double t49_21 = L[224] * D[21];
+        const double t49_23 = L[248] * D[23];
+        const double t49_24 = L[259] * D[24];
+        const double t49_28 = L[309] * D[28];
+        const double t49_30 = L[329] * D[30];
+        const double t49_34 = L[371] * D[34];
+        const double t49_35 = L[381] * D[35];
+        const double t49_36 = L[390] * D[36];
+        const double t49_38 = L[413] * D[38];
+        const double t49_40 = L[437] * D[40];
+        const double t49_41 = L[447] * D[41];
+        const double t49_44 = L[471] * D[44];
+        const double t49_45 = L[484] * D[45];
+        const double t49_46 = L[502] * D[46];
+        const double t49_47 = L[519] * D[47];
+        const double t49_48 = L[535] * D[48];
+        D[49] = Kx[4] - L[39] * t49_4 - L[49] * t49_5 - L[56] * t49_6 - L[68] * t49_7 - L[80] * t49_8 - L[96] * t49_9 - L[105] * t49_10 - L[152] * t49_14 - L[162] * t49_15 - L[176] * t49_16 - L[194] * t49_18 - L[206] * t49_19 - L[213] * t49_20 - L[224] * t49_21 - L[248] * t49_23 - L[259] * t49_24 - L[309] * t49_28 - L[329] * t49_30 - L[371] * t49_34 - L[381] * t49_35 - L[390] * t49_36 - L[413] * t49_38 - L[437] * t49_40 - L[447] * t49_41 - L[471] * t49_44 - L[484] * t49_45 - L[502] * t49_46 - L[519] * t49_47 - L[535] * t49_48;
+        D_inv[49] = 1. / D[49];
+        L[551] = (-L[69] * t49_7 - L[81] * t49_8 - L[106] * t49_10 - L[153] * t49_14 - L[195] * t49_18 - L[214] * t49_20 - L[225] * t49_21 - L[249] * t49_23 - L[260] * t49_24 - L[310] * t49_28 - L[330] * t49_30 - L[448] * t49_41 - L[472] * t49_44 - L[485] * t49_45 - L[503] * t49_46 - L[520] * t49_47 - L[536] * t49_48) * D_inv[49];
+        L[552] = (-L[40] * t49_4 - L[50] * t49_5 - L[57] * t49_6 - L[82] * t49_8 - L[97] * t49_9 - L[107] * t49_10 - L[207] * t49_19 - L[215] * t49_20 - L[226] * t49_21 - L[261] * t49_24 - L[331] * t49_30 - L[372] * t49_34 - L[391] * t49_36 - L[414] * t49_38 - L[473] * t49_44 - L[486] * t49_45 - L[504] * t49_46 - L[521] * t49_47 - L[537] * t49_48) * D_inv[49];
+        L[553] = (-L[41] * t49_4 - L[83] * t49_8 - L[196] * t49_18 - L[208] * t49_19 - L[227] * t49_21 - L[262] * t49_24 - L[373] * t49_34 - L[382] * t49_35 - L[392] * t49_36 - L[415] * t49_38 - L[438] * t49_40 - L[449] * t49_41 - L[487] * t49_45 - L[505] * t49_46 - L[522] * t49_47 - L[538] * t49_48) * D_inv[49];
+        L[554] = (-L[58] * t49_6 - L[84] * t49_8 - L[98] * t49_9 - L[163] * t49_15 - L[197] * t49_18 - L[216] * t49_20 - L[263] * t49_24 - L[311] * t49_28 - L[383] * t49_35 - L[393] * t49_36 - L[450] * t49_41 - L[474] * t49_44 - L[488] * t49_45 - L[506] * t49_46 - L[523] * t49_47 - L[539] * t49_48) * D_inv[49];
+        L[555] = (-L[42] * t49_4 - L[70] * t49_7 - L[85] * t49_8 - L[99] * t49_9 - L[164] * t49_15 - L[177] * t49_16 - L[250] * t49_23 - L[264] * t49_24 - L[332] * t49_30 - L[384] * t49_35 - L[394] * t49_36 - L[416] * t49_38 - L[489] * t49_45 - L[507] * t49_46 - L[524] * t49_47 - L[540] * t49_48) * D_inv[49];
+        L[556] = (-L[43] * t49_4 - L[59] * t49_6 - L[71] * t49_7 - L[108] * t49_10 - L[154] * t49_14 - L[198] * t49_18 - L[217] * t49_20 - L[228] * t49_21 - L[251] * t49_23 - L[265] * t49_24 - L[333] * t49_30 - L[385] * t49_35 - L[395] * t49_36 - L[417] * t49_38 - L[475] * t49_44 - L[490] * t49_45 - L[508] * t49_46 - L[525] * t49_47 - L[541] * t49_48) * D_inv[49];
+        L[557] = (-L[72] * t49_7 - L[86] * t49_8 - L[100] * t49_9 - L[155] * t49_14 - L[165] * t49_15 - L[178] * t49_16 - L[199] * t49_18 - L[218] * t49_20 - L[229] * t49_21 - L[252] * t49_23 - L[266] * t49_24 - L[312] * t49_28 - L[334] * t49_30 - L[374] * t49_34 - L[396] * t49_36 - L[439] * t49_40 - L[476] * t49_44 - L[491] * t49_45 - L[509] * t49_46 - L[526] * t49_47 - L[542] * t49_48) * D_inv[49];
+        L[558] = (-L[51] * t49_5 - L[60] * t49_6 - L[73] * t49_7 - L[87] * t49_8 - L[166] * t49_15 - L[209] * t49_19 - L[230] * t49_21 - L[267] * t49_24 - L[313] * t49_28 - L[335] * t49_30 - L[375] * t49_34 - L[418] * t49_38 - L[492] * t49_45 - L[510] * t49_46 - L[527] * t49_47 - L[543] * t49_48) * D_inv[49];
+        L[559] = (-L[44] * t49_4 - L[52] * t49_5 - L[61] * t49_6 - L[74] * t49_7 - L[109] * t49_10 - L[219] * t49_20 - L[253] * t49_23 - L[268] * t49_24 - L[314] * t49_28 - L[386] * t49_35 - L[477] * t49_44 - L[493] * t49_45 - L[511] * t49_46 - L[528] * t49_47 - L[544] * t49_48) * D_inv[49];
+        L[560] = (-L[53] * t49_5 - L[62] * t49_6 - L[75] * t49_7 - L[167] * t49_15 - L[179] * t49_16 - L[200] * t49_18 - L[220] * t49_20 - L[254] * t49_23 - L[336] * t49_30 - L[376] * t49_34 - L[419] * t49_38 - L[440] * t49_40 - L[451] * t49_41 - L[478] * t49_44 - L[494] * t49_45 - L[512] * t49_46 - L[529] * t49_47 - L[545] * t49_48) * D_inv[49];
+        L[561] = (-L[88] * t49_8 - L[101] * t49_9 - L[110] * t49_10 - L[156] * t49_14 - L[168] * t49_15 - L[231] * t49_21 - L[337] * t49_30 - L[441] * t49_40 - L[479] * t49_44 - L[495] * t49_45 - L[513] * t49_46 - L[530] * t49_47 - L[546] * t49_48) * D_inv[49];
+        L[562] = (-L[45] * t49_4 - L[63] * t49_6 - L[76] * t49_7 - L[89] * t49_8 - L[102] * t49_9 - L[111] * t49_10 - L[157] * t49_14 - L[169] * t49_15 - L[180] * t49_16 - L[201] * t49_18 - L[232] * t49_21 - L[255] * t49_23 - L[315] * t49_28 - L[397] * t49_36 - L[420] * t49_38 - L[442] * t49_40 - L[496] * t49_45 - L[514] * t49_46 - L[531] * t49_47 - L[547] * t49_48) * D_inv[49];
+        L[563] = (-L[54] * t49_5 - L[64] * t49_6 - L[77] * t49_7 - L[112] * t49_10 - L[158] * t49_14 - L[170] * t49_15 - L[221] * t49_20 - L[233] * t49_21 - L[269] * t49_24 - L[316] * t49_28 - L[338] * t49_30 - L[398] * t49_36 - L[421] * t49_38 - L[452] * t49_41 - L[497] * t49_45 - L[515] * t49_46 - L[532] * t49_47 - L[548] * t49_48) * D_inv[49];
+        L[564] = (-L[46] * t49_4 - L[65] * t49_6 - L[78] * t49_7 - L[90] * t49_8 - L[103] * t49_9 - L[171] * t49_15 - L[181] * t49_16 - L[202] * t49_18 - L[222] * t49_20 - L[234] * t49_21 - L[256] * t49_23 - L[270] * t49_24 - L[317] * t49_28 - L[443] * t49_40 - L[498] * t49_45 - L[516] * t49_46 - L[533] * t49_47 - L[549] * t49_48) * D_inv[49];
+        L[565] = (-L[47] * t49_4 - L[91] * t49_8 - L[104] * t49_9 - L[113] * t49_10 - L[172] * t49_15 - L[203] * t49_18 - L[235] * t49_21 - L[257] * t49_23 - L[318] * t49_28 - L[377] * t49_34 - L[387] * t49_35 - L[399] * t49_36 - L[422] * t49_38 - L[444] * t49_40 - L[480] * t49_44 - L[499] * t49_45 - L[517] * t49_46 - L[534] * t49_47 - L[550] * t49_48) * D_inv[49];
+        const double t50_0 = L[4] * D[0];
+        const double t50_7 = L[69] * D[7];
+        const double t50_8 = L[81] * D[8];
+        const double t50_10 = L[106] * D[10];
+        const double t50_11 = L[117] * D[11];
+        const double t50_12 = L[127] * D[12];
+        const double t50_13 = L[139] * D[13];
+        const double t50_14 = L[153] * D[14];
+        const double t50_17 = L[183] * D[17];
+        const double t50_18 = L[195] * D[18];
+        const double t50_20 = L[214] * D[20];
+        const double t50_21 = L[225] * D[21];
+        const double t50_22 = L[236] * D[22];
+        const double t50_23 = L[249] * D[23];
+        const double t50_24 = L[260] * D[24];
+        const double t50_25 = L[275] * D[25];
+        const double t50_27 = L[301] * D[27];
+        const double t50_28 = L[310] * D[28];
+        const double t50_29 = L[323] * D[29];
+        const double t50_30 = L[330] * D[30];
+        const double t50_31 = L[341] * D[31];
+        const double t50_32 = L[351] * D[32];
+        const double t50_33 = L[361] * D[33];
+        const double t50_37 = L[401] * D[37];
+        const double t50_39 = L[426] * D[39];
+        const double t50_41 = L[448] * D[41];
+        const double t50_44 = L[472] * D[44];
+        const double t50_45 = L[485] * D[45];
+        const double t50_46 = L[503] * D[46];
+        const double t50_47 = L[520] * D[47];
+        const double t50_48 = L[536] * D[48];
+        const double t50_49 = L[551] * D[49];
+        D[50] = Kx[5] - L[4] * t50_0 - L[69] * t50_7 - L[81] * t50_8 - L[106] * t50_10 - L[117] * t50_11 - L[127] * t50_12 - L[139] * t50_13 - L[153] * t50_14 - L[183] * t50_17 - L[195] * t50_18 - L[214] * t50_20 - L[225] * t50_21 - L[236] * t50_22 - L[249] * t50_23 - L[260] * t50_24 - L[275] * t50_25 - L[301] * t50_27 - L[310] * t50_28 - L[323] * t50_29 - L[330] * t50_30 - L[341] * t50_31 - L[351] * t50_32 - L[361] * t50_33 - L[401] * t50_37 - L[426] * t50_39 - L[448] * t50_41 - L[472] * t50_44 - L[485] * t50_45 - L[503] * t50_46 - L[520] * t50_47 - L[536] * t50_48 - L[551] * t50_49;
+        D_inv[50] = 1. / D[50];
+        L[566] = (-L[82] * t50_8 - L[107] * t50_10 - L[140] * t50_13 - L[215] * t50_20 - L[226] * t50_21 - L[237] * t50_22 - L[261] * t50_24 - L[276] * t50_25 - L[331] * t50_30 - L[352] * t50_32 - L[362] * t50_33 - L[427] * t50_39 - L[473] * t50_44 - L[486] * t50_45 - L[504] * t50_46 - L[521] * t50_47 - L[537] * t50_48 - L[552] * t50_49) * D_inv[50];
+        L[567] = (-L[5] * t50_0 - L[83] * t50_8 - L[128] * t50_12 - L[184] * t50_17 - L[196] * t50_18 - L[227] * t50_21 - L[238] * t50_22 - L[262] * t50_24 - L[277] * t50_25 - L[342] * t50_31 - L[402] * t50_37 - L[449] * t50_41 - L[487] * t50_45 - L[505] * t50_46 - L[522] * t50_47 - L[538] * t50_48 - L[553] * t50_49) * D_inv[50];
+        L[568] = (-L[84] * t50_8 - L[129] * t50_12 - L[141] * t50_13 - L[197] * t50_18 - L[216] * t50_20 - L[263] * t50_24 - L[278] * t50_25 - L[311] * t50_28 - L[324] * t50_29 - L[343] * t50_31 - L[353] * t50_32 - L[450] * t50_41 - L[474] * t50_44 - L[488] * t50_45 - L[506] * t50_46 - L[523] * t50_47 - L[539] * t50_48 - L[554] * t50_49) * D_inv[50];
+        L[569] = (-L[6] * t50_0 - L[70] * t50_7 - L[85] * t50_8 - L[118] * t50_11 - L[130] * t50_12 - L[250] * t50_23 - L[264] * t50_24 - L[279] * t50_25 - L[332] * t50_30 - L[344] * t50_31 - L[403] * t50_37 - L[489] * t50_45 - L[507] * t50_46 - L[524] * t50_47 - L[540] * t50_48 - L[555] * t50_49) * D_inv[50];
+        L[570] = (-L[71] * t50_7 - L[108] * t50_10 - L[119] * t50_11 - L[131] * t50_12 - L[142] * t50_13 - L[154] * t50_14 - L[185] * t50_17 - L[198] * t50_18 - L[217] * t50_20 - L[228] * t50_21 - L[239] * t50_22 - L[251] * t50_23 - L[265] * t50_24 - L[325] * t50_29 - L[333] * t50_30 - L[404] * t50_37 - L[428] * t50_39 - L[475] * t50_44 - L[490] * t50_45 - L[508] * t50_46 - L[525] * t50_47 - L[541] * t50_48 - L[556] * t50_49) * D_inv[50];
+        L[571] = (-L[72] * t50_7 - L[86] * t50_8 - L[120] * t50_11 - L[155] * t50_14 - L[199] * t50_18 - L[218] * t50_20 - L[229] * t50_21 - L[252] * t50_23 - L[266] * t50_24 - L[280] * t50_25 - L[302] * t50_27 - L[312] * t50_28 - L[334] * t50_30 - L[363] * t50_33 - L[429] * t50_39 - L[476] * t50_44 - L[491] * t50_45 - L[509] * t50_46 - L[526] * t50_47 - L[542] * t50_48 - L[557] * t50_49) * D_inv[50];
+        L[572] = (-L[7] * t50_0 - L[73] * t50_7 - L[87] * t50_8 - L[143] * t50_13 - L[186] * t50_17 - L[230] * t50_21 - L[267] * t50_24 - L[281] * t50_25 - L[313] * t50_28 - L[326] * t50_29 - L[335] * t50_30 - L[354] * t50_32 - L[364] * t50_33 - L[405] * t50_37 - L[430] * t50_39 - L[492] * t50_45 - L[510] * t50_46 - L[527] * t50_47 - L[543] * t50_48 - L[558] * t50_49) * D_inv[50];
+        L[573] = (-L[8] * t50_0 - L[74] * t50_7 - L[109] * t50_10 - L[144] * t50_13 - L[187] * t50_17 - L[219] * t50_20 - L[240] * t50_22 - L[253] * t50_23 - L[268] * t50_24 - L[314] * t50_28 - L[345] * t50_31 - L[365] * t50_33 - L[406] * t50_37 - L[477] * t50_44 - L[493] * t50_45 - L[511] * t50_46 - L[528] * t50_47 - L[544] * t50_48 - L[559] * t50_49) * D_inv[50];
+        L[574] = (-L[9] * t50_0 - L[75] * t50_7 - L[121] * t50_11 - L[132] * t50_12 - L[145] * t50_13 - L[188] * t50_17 - L[200] * t50_18 - L[220] * t50_20 - L[254] * t50_23 - L[282] * t50_25 - L[303] * t50_27 - L[336] * t50_30 - L[407] * t50_37 - L[431] * t50_39 - L[451] * t50_41 - L[478] * t50_44 - L[494] * t50_45 - L[512] * t50_46 - L[529] * t50_47 - L[545] * t50_48 - L[560] * t50_49) * D_inv[50];
+        L[575] = (-L[10] * t50_0 - L[88] * t50_8 - L[110] * t50_10 - L[133] * t50_12 - L[146] * t50_13 - L[156] * t50_14 - L[189] * t50_17 - L[231] * t50_21 - L[241] * t50_22 - L[304] * t50_27 - L[337] * t50_30 - L[346] * t50_31 - L[355] * t50_32 - L[366] * t50_33 - L[432] * t50_39 - L[479] * t50_44 - L[495] * t50_45 - L[513] * t50_46 - L[530] * t50_47 - L[546] * t50_48 - L[561] * t50_49) * D_inv[50];
+        L[576] = (-L[76] * t50_7 - L[89] * t50_8 - L[111] * t50_10 - L[134] * t50_12 - L[157] * t50_14 - L[190] * t50_17 - L[201] * t50_18 - L[232] * t50_21 - L[242] * t50_22 - L[255] * t50_23 - L[283] * t50_25 - L[305] * t50_27 - L[315] * t50_28 - L[347] * t50_31 - L[356] * t50_32 - L[408] * t50_37 - L[496] * t50_45 - L[514] * t50_46 - L[531] * t50_47 - L[547] * t50_48 - L[562] * t50_49) * D_inv[50];
+        L[577] = (-L[77] * t50_7 - L[112] * t50_10 - L[135] * t50_12 - L[147] * t50_13 - L[158] * t50_14 - L[221] * t50_20 - L[233] * t50_21 - L[243] * t50_22 - L[269] * t50_24 - L[316] * t50_28 - L[338] * t50_30 - L[348] * t50_31 - L[357] * t50_32 - L[409] * t50_37 - L[433] * t50_39 - L[452] * t50_41 - L[497] * t50_45 - L[515] * t50_46 - L[532] * t50_47 - L[548] * t50_48 - L[563] * t50_49) * D_inv[50];
+        L[578] = (-L[11] * t50_0 - L[78] * t50_7 - L[90] * t50_8 - L[122] * t50_11 - L[148] * t50_13 - L[191] * t50_17 - L[202] * t50_18 - L[222] * t50_20 - L[234] * t50_21 - L[256] * t50_23 - L[270] * t50_24 - L[284] * t50_25 - L[306] * t50_27 - L[317] * t50_28 - L[327] * t50_29 - L[367] * t50_33 - L[410] * t50_37 - L[498] * t50_45 - L[516] * t50_46 - L[533] * t50_47 - L[549] * t50_48 - L[564] * t50_49) * D_inv[50];
+        L[579] = (-L[12] * t50_0 - L[91] * t50_8 - L[113] * t50_10 - L[123] * t50_11 - L[203] * t50_18 - L[235] * t50_21 - L[244] * t50_22 - L[257] * t50_23 - L[285] * t50_25 - L[307] * t50_27 - L[318] * t50_28 - L[358] * t50_32 - L[368] * t50_33 - L[434] * t50_39 - L[480] * t50_44 - L[499] * t50_45 - L[517] * t50_46 - L[534] * t50_47 - L[550] * t50_48 - L[565] * t50_49) * D_inv[50];
+        const double t51_1 = L[14] * D[1];
+        const double t51_4 = L[40] * D[4];
+        const double t51_5 = L[50] * D[5];
+        const double t51_6 = L[57] * D[6];
+        const double t51_8 = L[82] * D[8];
+        const double t51_9 = L[97] * D[9];
+        const double t51_10 = L[107] * D[10];
+        const double t51_13 = L[140] * D[13];
+        const double t51_19 = L[207] * D[19];
+        const double t51_20 = L[215] * D[20];
+        const double t51_21 = L[226] * D[21];
+        const double t51_22 = L[237] * D[22];
+        const double t51_24 = L[261] * D[24];
+        const double t51_25 = L[276] * D[25];
+        const double t51_26 = L[290] * D[26];
+        const double t51_30 = L[331] * D[30];
+        const double t51_32 = L[352] * D[32];
+        const double t51_33 = L[362] * D[33];
+        const double t51_34 = L[372] * D[34];
+        const double t51_36 = L[391] * D[36];
+        const double t51_38 = L[414] * D[38];
+        const double t51_39 = L[427] * D[39];
+        const double t51_43 = L[463] * D[43];
+        const double t51_44 = L[473] * D[44];
+        const double t51_45 = L[486] * D[45];
+        const double t51_46 = L[504] * D[46];
+        const double t51_47 = L[521] * D[47];
+        const double t51_48 = L[537] * D[48];
+        const double t51_49 = L[552] * D[49];
+        const double t51_50 = L[566] * D[50];
+        D[51] = Kx[6] - L[14] * t51_1 - L[40] * t51_4 - L[50] * t51_5 - L[57] * t51_6 - L[82] * t51_8 - L[97] * t51_9 - L[107] * t51_10 - L[140] * t51_13 - L[207] * t51_19 - L[215] * t51_20 - L[226] * t51_21 - L[237] * t51_22 - L[261] * t51_24 - L[276] * t51_25 - L[290] * t51_26 - L[331] * t51_30 - L[352] * t51_32 - L[362] * t51_33 - L[372] * t51_34 - L[391] * t51_36 - L[414] * t51_38 - L[427] * t51_39 - L[463] * t51_43 - L[473] * t51_44 - L[486] * t51_45 - L[504] * t51_46 - L[521] * t51_47 - L[537] * t51_48 - L[552] * t51_49 - L[566] * t51_50;
+        D_inv[51] = 1. / D[51];
+        L[580] = (-L[15] * t51_1 - L[41] * t51_4 - L[83] * t51_8 - L[208] * t51_19 - L[227] * t51_21 - L[238] * t51_22 - L[262] * t51_24 - L[277] * t51_25 - L[373] * t51_34 - L[392] * t51_36 - L[415] * t51_38 - L[464] * t51_43 - L[487] * t51_45 - L[505] * t51_46 - L[522] * t51_47 - L[538] * t51_48 - L[553] * t51_49 - L[567] * t51_50) * D_inv[51];
+        L[581] = (-L[58] * t51_6 - L[84] * t51_8 - L[98] * t51_9 - L[141] * t51_13 - L[216] * t51_20 - L[263] * t51_24 - L[278] * t51_25 - L[353] * t51_32 - L[393] * t51_36 - L[465] * t51_43 - L[474] * t51_44 - L[488] * t51_45 - L[506] * t51_46 - L[523] * t51_47 - L[539] * t51_48 - L[554] * t51_49 - L[568] * t51_50) * D_inv[51];
+        L[582] = (-L[42] * t51_4 - L[85] * t51_8 - L[99] * t51_9 - L[264] * t51_24 - L[279] * t51_25 - L[291] * t51_26 - L[332] * t51_30 - L[394] * t51_36 - L[416] * t51_38 - L[489] * t51_45 - L[507] * t51_46 - L[524] * t51_47 - L[540] * t51_48 - L[555] * t51_49 - L[569] * t51_50) * D_inv[51];
+        L[583] = (-L[16] * t51_1 - L[43] * t51_4 - L[59] * t51_6 - L[108] * t51_10 - L[142] * t51_13 - L[217] * t51_20 - L[228] * t51_21 - L[239] * t51_22 - L[265] * t51_24 - L[292] * t51_26 - L[333] * t51_30 - L[395] * t51_36 - L[417] * t51_38 - L[428] * t51_39 - L[475] * t51_44 - L[490] * t51_45 - L[508] * t51_46 - L[525] * t51_47 - L[541] * t51_48 - L[556] * t51_49 - L[570] * t51_50) * D_inv[51];
+        L[584] = (-L[86] * t51_8 - L[100] * t51_9 - L[218] * t51_20 - L[229] * t51_21 - L[266] * t51_24 - L[280] * t51_25 - L[293] * t51_26 - L[334] * t51_30 - L[363] * t51_33 - L[374] * t51_34 - L[396] * t51_36 - L[429] * t51_39 - L[466] * t51_43 - L[476] * t51_44 - L[491] * t51_45 - L[509] * t51_46 - L[526] * t51_47 - L[542] * t51_48 - L[557] * t51_49 - L[571] * t51_50) * D_inv[51];
+        L[585] = (-L[17] * t51_1 - L[51] * t51_5 - L[60] * t51_6 - L[87] * t51_8 - L[143] * t51_13 - L[209] * t51_19 - L[230] * t51_21 - L[267] * t51_24 - L[281] * t51_25 - L[294] * t51_26 - L[335] * t51_30 - L[354] * t51_32 - L[364] * t51_33 - L[375] * t51_34 - L[418] * t51_38 - L[430] * t51_39 - L[492] * t51_45 - L[510] * t51_46 - L[527] * t51_47 - L[543] * t51_48 - L[558] * t51_49 - L[572] * t51_50) * D_inv[51];
+        L[586] = (-L[44] * t51_4 - L[52] * t51_5 - L[61] * t51_6 - L[109] * t51_10 - L[144] * t51_13 - L[219] * t51_20 - L[240] * t51_22 - L[268] * t51_24 - L[365] * t51_33 - L[477] * t51_44 - L[493] * t51_45 - L[511] * t51_46 - L[528] * t51_47 - L[544] * t51_48 - L[559] * t51_49 - L[573] * t51_50) * D_inv[51];
+        L[587] = (-L[18] * t51_1 - L[53] * t51_5 - L[62] * t51_6 - L[145] * t51_13 - L[220] * t51_20 - L[282] * t51_25 - L[295] * t51_26 - L[336] * t51_30 - L[376] * t51_34 - L[419] * t51_38 - L[431] * t51_39 - L[467] * t51_43 - L[478] * t51_44 - L[494] * t51_45 - L[512] * t51_46 - L[529] * t51_47 - L[545] * t51_48 - L[560] * t51_49 - L[574] * t51_50) * D_inv[51];
+        L[588] = (-L[19] * t51_1 - L[88] * t51_8 - L[101] * t51_9 - L[110] * t51_10 - L[146] * t51_13 - L[231] * t51_21 - L[241] * t51_22 - L[337] * t51_30 - L[355] * t51_32 - L[366] * t51_33 - L[432] * t51_39 - L[479] * t51_44 - L[495] * t51_45 - L[513] * t51_46 - L[530] * t51_47 - L[546] * t51_48 - L[561] * t51_49 - L[575] * t51_50) * D_inv[51];
+        L[589] = (-L[45] * t51_4 - L[63] * t51_6 - L[89] * t51_8 - L[102] * t51_9 - L[111] * t51_10 - L[232] * t51_21 - L[242] * t51_22 - L[283] * t51_25 - L[296] * t51_26 - L[356] * t51_32 - L[397] * t51_36 - L[420] * t51_38 - L[468] * t51_43 - L[496] * t51_45 - L[514] * t51_46 - L[531] * t51_47 - L[547] * t51_48 - L[562] * t51_49 - L[576] * t51_50) * D_inv[51];
+        L[590] = (-L[20] * t51_1 - L[54] * t51_5 - L[64] * t51_6 - L[112] * t51_10 - L[147] * t51_13 - L[221] * t51_20 - L[233] * t51_21 - L[243] * t51_22 - L[269] * t51_24 - L[297] * t51_26 - L[338] * t51_30 - L[357] * t51_32 - L[398] * t51_36 - L[421] * t51_38 - L[433] * t51_39 - L[469] * t51_43 - L[497] * t51_45 - L[515] * t51_46 - L[532] * t51_47 - L[548] * t51_48 - L[563] * t51_49 - L[577] * t51_50) * D_inv[51];
+        L[591] = (-L[46] * t51_4 - L[65] * t51_6 - L[90] * t51_8 - L[103] * t51_9 - L[148] * t51_13 - L[222] * t51_20 - L[234] * t51_21 - L[270] * t51_24 - L[284] * t51_25 - L[367] * t51_33 - L[498] * t51_45 - L[516] * t51_46 - L[533] * t51_47 - L[549] * t51_48 - L[564] * t51_49 - L[578] * t51_50) * D_inv[51];
+        L[592] = (-L[21] * t51_1 - L[47] * t51_4 - L[91] * t51_8 - L[104] * t51_9 - L[113] * t51_10 - L[235] * t51_21 - L[244] * t51_22 - L[285] * t51_25 - L[358] * t51_32 - L[368] * t51_33 - L[377] * t51_34 - L[399] * t51_36 - L[422] * t51_38 - L[434] * t51_39 - L[480] * t51_44 - L[499] * t51_45 - L[517] * t51_46 - L[534] * t51_47 - L[550] * t51_48 - L[565] * t51_49 - L[579] * t51_50) * D_inv[51];
+        const double t52_0 = L[5] * D[0];
+        const double t52_1 = L[15] * D[1];
+        const double t52_3 = L[31] * D[3];
+        const double t52_4 = L[41] * D[4];
+        const double t52_8 = L[83] * D[8];
+        const double t52_12 = L[128] * D[12];
+        const double t52_17 = L[184] * D[17];
+        const double t52_18 = L[196] * D[18];
+        const double t52_19 = L[208] * D[19];
+        const double t52_21 = L[227] * D[21];
+        const double t52_22 = L[238] * D[22];
+        const double t52_24 = L[262] * D[24];
+        const double t52_25 = L[277] * D[25];
+        const double t52_31 = L[342] * D[31];
+        const double t52_34 = L[373] * D[34];
+        const double t52_35 = L[382] * D[35];
+        const double t52_36 = L[392] * D[36];
+        const double t52_37 = L[402] * D[37];
+        const double t52_38 = L[415] * D[38];
+        const double t52_40 = L[438] * D[40];
+        const double t52_41 = L[449] * D[41];
+        const double t52_42 = L[454] * D[42];
+        const double t52_43 = L[464] * D[43];
+        const double t52_45 = L[487] * D[45];
+        const double t52_46 = L[505] * D[46];
+        const double t52_47 = L[522] * D[47];
+        const double t52_48 = L[538] * D[48];
+        const double t52_49 = L[553] * D[49];
+        const double t52_50 = L[567] * D[50];
+        const double t52_51 = L[580] * D[51];
+        D[52] = Kx[7] - L[5] * t52_0 - L[15] * t52_1 - L[31] * t52_3 - L[41] * t52_4 - L[83] * t52_8 - L[128] * t52_12 - L[184] * t52_17 - L[196] * t52_18 - L[208] * t52_19 - L[227] * t52_21 - L[238] * t52_22 - L[262] * t52_24 - L[277] * t52_25 - L[342] * t52_31 - L[373] * t52_34 - L[382] * t52_35 - L[392] * t52_36 - L[402] * t52_37 - L[415] * t52_38 - L[438] * t52_40 - L[449] * t52_41 - L[454] * t52_42 - L[464] * t52_43 - L[487] * t52_45 - L[505] * t52_46 - L[522] * t52_47 - L[538] * t52_48 - L[553] * t52_49 - L[567] * t52_50 - L[580] * t52_51;
+        D_inv[52] = 1. / D[52];
+        L[593] = (-L[84] * t52_8 - L[129] * t52_12 - L[197] * t52_18 - L[263] * t52_24 - L[278] * t52_25 - L[343] * t52_31 - L[383] * t52_35 - L[393] * t52_36 - L[450] * t52_41 - L[465] * t52_43 - L[488] * t52_45 - L[506] * t52_46 - L[523] * t52_47 - L[539] * t52_48 - L[554] * t52_49 - L[568] * t52_50 - L[581] * t52_51) * D_inv[52];
+        L[594] = (-L[6] * t52_0 - L[42] * t52_4 - L[85] * t52_8 - L[130] * t52_12 - L[264] * t52_24 - L[279] * t52_25 - L[344] * t52_31 - L[384] * t52_35 - L[394] * t52_36 - L[403] * t52_37 - L[416] * t52_38 - L[455] * t52_42 - L[489] * t52_45 - L[507] * t52_46 - L[524] * t52_47 - L[540] * t52_48 - L[555] * t52_49 - L[569] * t52_50 - L[582] * t52_51) * D_inv[52];
+        L[595] = (-L[16] * t52_1 - L[32] * t52_3 - L[43] * t52_4 - L[131] * t52_12 - L[185] * t52_17 - L[198] * t52_18 - L[228] * t52_21 - L[239] * t52_22 - L[265] * t52_24 - L[385] * t52_35 - L[395] * t52_36 - L[404] * t52_37 - L[417] * t52_38 - L[490] * t52_45 - L[508] * t52_46 - L[525] * t52_47 - L[541] * t52_48 - L[556] * t52_49 - L[570] * t52_50 - L[583] * t52_51) * D_inv[52];
+        L[596] = (-L[33] * t52_3 - L[86] * t52_8 - L[199] * t52_18 - L[229] * t52_21 - L[266] * t52_24 - L[280] * t52_25 - L[374] * t52_34 - L[396] * t52_36 - L[439] * t52_40 - L[456] * t52_42 - L[466] * t52_43 - L[491] * t52_45 - L[509] * t52_46 - L[526] * t52_47 - L[542] * t52_48 - L[557] * t52_49 - L[571] * t52_50 - L[584] * t52_51) * D_inv[52];
+        L[597] = (-L[7] * t52_0 - L[17] * t52_1 - L[34] * t52_3 - L[87] * t52_8 - L[186] * t52_17 - L[209] * t52_19 - L[230] * t52_21 - L[267] * t52_24 - L[281] * t52_25 - L[375] * t52_34 - L[405] * t52_37 - L[418] * t52_38 - L[492] * t52_45 - L[510] * t52_46 - L[527] * t52_47 - L[543] * t52_48 - L[558] * t52_49 - L[572] * t52_50 - L[585] * t52_51) * D_inv[52];
+        L[598] = (-L[8] * t52_0 - L[35] * t52_3 - L[44] * t52_4 - L[187] * t52_17 - L[240] * t52_22 - L[268] * t52_24 - L[345] * t52_31 - L[386] * t52_35 - L[406] * t52_37 - L[457] * t52_42 - L[493] * t52_45 - L[511] * t52_46 - L[528] * t52_47 - L[544] * t52_48 - L[559] * t52_49 - L[573] * t52_50 - L[586] * t52_51) * D_inv[52];
+        L[599] = (-L[9] * t52_0 - L[18] * t52_1 - L[132] * t52_12 - L[188] * t52_17 - L[200] * t52_18 - L[282] * t52_25 - L[376] * t52_34 - L[407] * t52_37 - L[419] * t52_38 - L[440] * t52_40 - L[451] * t52_41 - L[467] * t52_43 - L[494] * t52_45 - L[512] * t52_46 - L[529] * t52_47 - L[545] * t52_48 - L[560] * t52_49 - L[574] * t52_50 - L[587] * t52_51) * D_inv[52];
+        L[600] = (-L[10] * t52_0 - L[19] * t52_1 - L[88] * t52_8 - L[133] * t52_12 - L[189] * t52_17 - L[231] * t52_21 - L[241] * t52_22 - L[346] * t52_31 - L[441] * t52_40 - L[495] * t52_45 - L[513] * t52_46 - L[530] * t52_47 - L[546] * t52_48 - L[561] * t52_49 - L[575] * t52_50 - L[588] * t52_51) * D_inv[52];
+        L[601] = (-L[45] * t52_4 - L[89] * t52_8 - L[134] * t52_12 - L[190] * t52_17 - L[201] * t52_18 - L[232] * t52_21 - L[242] * t52_22 - L[283] * t52_25 - L[347] * t52_31 - L[397] * t52_36 - L[408] * t52_37 - L[420] * t52_38 - L[442] * t52_40 - L[458] * t52_42 - L[468] * t52_43 - L[496] * t52_45 - L[514] * t52_46 - L[531] * t52_47 - L[547] * t52_48 - L[562] * t52_49 - L[576] * t52_50 - L[589] * t52_51) * D_inv[52];
+        L[602] = (-L[20] * t52_1 - L[135] * t52_12 - L[233] * t52_21 - L[243] * t52_22 - L[269] * t52_24 - L[348] * t52_31 - L[398] * t52_36 - L[409] * t52_37 - L[421] * t52_38 - L[452] * t52_41 - L[459] * t52_42 - L[469] * t52_43 - L[497] * t52_45 - L[515] * t52_46 - L[532] * t52_47 - L[548] * t52_48 - L[563] * t52_49 - L[577] * t52_50 - L[590] * t52_51) * D_inv[52];
+        L[603] = (-L[11] * t52_0 - L[36] * t52_3 - L[46] * t52_4 - L[90] * t52_8 - L[191] * t52_17 - L[202] * t52_18 - L[234] * t52_21 - L[270] * t52_24 - L[284] * t52_25 - L[410] * t52_37 - L[443] * t52_40 - L[498] * t52_45 - L[516] * t52_46 - L[533] * t52_47 - L[549] * t52_48 - L[564] * t52_49 - L[578] * t52_50 - L[591] * t52_51) * D_inv[52];
+        L[604] = (-L[12] * t52_0 - L[21] * t52_1 - L[37] * t52_3 - L[47] * t52_4 - L[91] * t52_8 - L[203] * t52_18 - L[235] * t52_21 - L[244] * t52_22 - L[285] * t52_25 - L[377] * t52_34 - L[387] * t52_35 - L[399] * t52_36 - L[422] * t52_38 - L[444] * t52_40 - L[499] * t52_45 - L[517] * t52_46 - L[534] * t52_47 - L[550] * t52_48 - L[565] * t52_49 - L[579] * t52_50 - L[592] * t52_51) * D_inv[52];
+        const double t53_2 = L[24] * D[2];
+        const double t53_6 = L[58] * D[6];
+        const double t53_8 = L[84] * D[8];
+        const double t53_9 = L[98] * D[9];
+        const double t53_12 = L[129] * D[12];
+        const double t53_13 = L[141] * D[13];
+        const double t53_15 = L[163] * D[15];
+        const double t53_18 = L[197] * D[18];
+        const double t53_20 = L[216] * D[20];
+        const double t53_24 = L[263] * D[24];
+        const double t53_25 = L[278] * D[25];
+        const double t53_28 = L[311] * D[28];
+        const double t53_29 = L[324] * D[29];
+        const double t53_31 = L[343] * D[31];
+        const double t53_32 = L[353] * D[32];
+        const double t53_35 = L[383] * D[35];
+        const double t53_36 = L[393] * D[36];
+        const double t53_41 = L[450] * D[41];
+        const double t53_43 = L[465] * D[43];
+        const double t53_44 = L[474] * D[44];
+        const double t53_45 = L[488] * D[45];
+        const double t53_46 = L[506] * D[46];
+        const double t53_47 = L[523] * D[47];
+        const double t53_48 = L[539] * D[48];
+        const double t53_49 = L[554] * D[49];
+        const double t53_50 = L[568] * D[50];
+        const double t53_51 = L[581] * D[51];
+        const double t53_52 = L[593] * D[52];
+        D[53] = Kx[8] - L[24] * t53_2 - L[58] * t53_6 - L[84] * t53_8 - L[98] * t53_9 - L[129] * t53_12 - L[141] * t53_13 - L[163] * t53_15 - L[197] * t53_18 - L[216] * t53_20 - L[263] * t53_24 - L[278] * t53_25 - L[311] * t53_28 - L[324] * t53_29 - L[343] * t53_31 - L[353] * t53_32 - L[383] * t53_35 - L[393] * t53_36 - L[450] * t53_41 - L[465] * t53_43 - L[474] * t53_44 - L[488] * t53_45 - L[506] * t53_46 - L[523] * t53_47 - L[539] * t53_48 - L[554] * t53_49 - L[568] * t53_50 - L[581] * t53_51 - L[593] * t53_52;
+        D_inv[53] = 1. / D[53];
+        L[605] = (-L[25] * t53_2 - L[85] * t53_8 - L[99] * t53_9 - L[130] * t53_12 - L[164] * t53_15 - L[264] * t53_24 - L[279] * t53_25 - L[344] * t53_31 - L[384] * t53_35 - L[394] * t53_36 - L[489] * t53_45 - L[507] * t53_46 - L[524] * t53_47 - L[540] * t53_48 - L[555] * t53_49 - L[569] * t53_50 - L[582] * t53_51 - L[594] * t53_52) * D_inv[53];
+        L[606] = (-L[26] * t53_2 - L[59] * t53_6 - L[131] * t53_12 - L[142] * t53_13 - L[198] * t53_18 - L[217] * t53_20 - L[265] * t53_24 - L[325] * t53_29 - L[385] * t53_35 - L[395] * t53_36 - L[475] * t53_44 - L[490] * t53_45 - L[508] * t53_46 - L[525] * t53_47 - L[541] * t53_48 - L[556] * t53_49 - L[570] * t53_50 - L[583] * t53_51 - L[595] * t53_52) * D_inv[53];
+        L[607] = (-L[86] * t53_8 - L[100] * t53_9 - L[165] * t53_15 - L[199] * t53_18 - L[218] * t53_20 - L[266] * t53_24 - L[280] * t53_25 - L[312] * t53_28 - L[396] * t53_36 - L[466] * t53_43 - L[476] * t53_44 - L[491] * t53_45 - L[509] * t53_46 - L[526] * t53_47 - L[542] * t53_48 - L[557] * t53_49 - L[571] * t53_50 - L[584] * t53_51 - L[596] * t53_52) * D_inv[53];
+        L[608] = (-L[60] * t53_6 - L[87] * t53_8 - L[143] * t53_13 - L[166] * t53_15 - L[267] * t53_24 - L[281] * t53_25 - L[313] * t53_28 - L[326] * t53_29 - L[354] * t53_32 - L[492] * t53_45 - L[510] * t53_46 - L[527] * t53_47 - L[543] * t53_48 - L[558] * t53_49 - L[572] * t53_50 - L[585] * t53_51 - L[597] * t53_52) * D_inv[53];
+        L[609] = (-L[61] * t53_6 - L[144] * t53_13 - L[219] * t53_20 - L[268] * t53_24 - L[314] * t53_28 - L[345] * t53_31 - L[386] * t53_35 - L[477] * t53_44 - L[493] * t53_45 - L[511] * t53_46 - L[528] * t53_47 - L[544] * t53_48 - L[559] * t53_49 - L[573] * t53_50 - L[586] * t53_51 - L[598] * t53_52) * D_inv[53];
+        L[610] = (-L[62] * t53_6 - L[132] * t53_12 - L[145] * t53_13 - L[167] * t53_15 - L[200] * t53_18 - L[220] * t53_20 - L[282] * t53_25 - L[451] * t53_41 - L[467] * t53_43 - L[478] * t53_44 - L[494] * t53_45 - L[512] * t53_46 - L[529] * t53_47 - L[545] * t53_48 - L[560] * t53_49 - L[574] * t53_50 - L[587] * t53_51 - L[599] * t53_52) * D_inv[53];
+        L[611] = (-L[88] * t53_8 - L[101] * t53_9 - L[133] * t53_12 - L[146] * t53_13 - L[168] * t53_15 - L[346] * t53_31 - L[355] * t53_32 - L[479] * t53_44 - L[495] * t53_45 - L[513] * t53_46 - L[530] * t53_47 - L[546] * t53_48 - L[561] * t53_49 - L[575] * t53_50 - L[588] * t53_51 - L[600] * t53_52) * D_inv[53];
+        L[612] = (-L[63] * t53_6 - L[89] * t53_8 - L[102] * t53_9 - L[134] * t53_12 - L[169] * t53_15 - L[201] * t53_18 - L[283] * t53_25 - L[315] * t53_28 - L[347] * t53_31 - L[356] * t53_32 - L[397] * t53_36 - L[468] * t53_43 - L[496] * t53_45 - L[514] * t53_46 - L[531] * t53_47 - L[547] * t53_48 - L[562] * t53_49 - L[576] * t53_50 - L[589] * t53_51 - L[601] * t53_52) * D_inv[53];
+        L[613] = (-L[64] * t53_6 - L[135] * t53_12 - L[147] * t53_13 - L[170] * t53_15 - L[221] * t53_20 - L[269] * t53_24 - L[316] * t53_28 - L[348] * t53_31 - L[357] * t53_32 - L[398] * t53_36 - L[452] * t53_41 - L[469] * t53_43 - L[497] * t53_45 - L[515] * t53_46 - L[532] * t53_47 - L[548] * t53_48 - L[563] * t53_49 - L[577] * t53_50 - L[590] * t53_51 - L[602] * t53_52) * D_inv[53];
+        L[614] = (-L[27] * t53_2 - L[65] * t53_6 - L[90] * t53_8 - L[103] * t53_9 - L[148] * t53_13 - L[171] * t53_15 - L[202] * t53_18 - L[222] * t53_20 - L[270] * t53_24 - L[284] * t53_25 - L[317] * t53_28 - L[327] * t53_29 - L[498] * t53_45 - L[516] * t53_46 - L[533] * t53_47 - L[549] * t53_48 - L[564] * t53_49 - L[578] * t53_50 - L[591] * t53_51 - L[603] * t53_52) * D_inv[53];
+        L[615] = (-L[28] * t53_2 - L[91] * t53_8 - L[104] * t53_9 - L[172] * t53_15 - L[203] * t53_18 - L[285] * t53_25 - L[318] * t53_28 - L[358] * t53_32 - L[387] * t53_35 - L[399] * t53_36 - L[480] * t53_44 - L[499] * t53_45 - L[517] * t53_46 - L[534] * t53_47 - L[550] * t53_48 - L[565] * t53_49 - L[579] * t53_50 - L[592] * t53_51 - L[604] * t53_52) * D_inv[53];
+        const double t54_0 = L[6] * D[0];
+        const double t54_2 = L[25] * D[2];
+        const double t54_4 = L[42] * D[4];
+        const double t54_7 = L[70] * D[7];
+        const double t54_8 = L[85] * D[8];
+        const double t54_9 = L[99] * D[9];
+        const double t54_11 = L[118] * D[11];
+        const double t54_12 = L[130] * D[12];
+        const double t54_15 = L[164] * D[15];
+        const double t54_16 = L[177] * D[16];
+        const double t54_23 = L[250] * D[23];
+        const double t54_24 = L[264] * D[24];
+        const double t54_25 = L[279] * D[25];
+        const double t54_26 = L[291] * D[26];
+        const double t54_30 = L[332] * D[30];
+        const double t54_31 = L[344] * D[31];
+        const double t54_35 = L[384] * D[35];
+        const double t54_36 = L[394] * D[36];
+        const double t54_37 = L[403] * D[37];
+        const double t54_38 = L[416] * D[38];
+        const double t54_42 = L[455] * D[42];
+        const double t54_45 = L[489] * D[45];
+        const double t54_46 = L[507] * D[46];
+        const double t54_47 = L[524] * D[47];
+        const double t54_48 = L[540] * D[48];
+        const double t54_49 = L[555] * D[49];
+        const double t54_50 = L[569] * D[50];
+        const double t54_51 = L[582] * D[51];
+        const double t54_52 = L[594] * D[52];
+        const double t54_53 = L[605] * D[53];
+        D[54] = Kx[9] - L[6] * t54_0 - L[25] * t54_2 - L[42] * t54_4 - L[70] * t54_7 - L[85] * t54_8 - L[99] * t54_9 - L[118] * t54_11 - L[130] * t54_12 - L[164] * t54_15 - L[177] * t54_16 - L[250] * t54_23 - L[264] * t54_24 - L[279] * t54_25 - L[291] * t54_26 - L[332] * t54_30 - L[344] * t54_31 - L[384] * t54_35 - L[394] * t54_36 - L[403] * t54_37 - L[416] * t54_38 - L[455] * t54_42 - L[489] * t54_45 - L[507] * t54_46 - L[524] * t54_47 - L[540] * t54_48 - L[555] * t54_49 - L[569] * t54_50 - L[582] * t54_51 - L[594] * t54_52 - L[605] * t54_53;
+        D_inv[54] = 1. / D[54];
+        L[616] = (-L[26] * t54_2 - L[43] * t54_4 - L[71] * t54_7 - L[119] * t54_11 - L[131] * t54_12 - L[251] * t54_23 - L[265] * t54_24 - L[292] * t54_26 - L[333] * t54_30 - L[385] * t54_35 - L[395] * t54_36 - L[404] * t54_37 - L[417] * t54_38 - L[490] * t54_45 - L[508] * t54_46 - L[525] * t54_47 - L[541] * t54_48 - L[556] * t54_49 - L[570] * t54_50 - L[583] * t54_51 - L[595] * t54_52 - L[606] * t54_53) * D_inv[54];
+        L[617] = (-L[72] * t54_7 - L[86] * t54_8 - L[100] * t54_9 - L[120] * t54_11 - L[165] * t54_15 - L[178] * t54_16 - L[252] * t54_23 - L[266] * t54_24 - L[280] * t54_25 - L[293] * t54_26 - L[334] * t54_30 - L[396] * t54_36 - L[456] * t54_42 - L[491] * t54_45 - L[509] * t54_46 - L[526] * t54_47 - L[542] * t54_48 - L[557] * t54_49 - L[571] * t54_50 - L[584] * t54_51 - L[596] * t54_52 - L[607] * t54_53) * D_inv[54];
+        L[618] = (-L[7] * t54_0 - L[73] * t54_7 - L[87] * t54_8 - L[166] * t54_15 - L[267] * t54_24 - L[281] * t54_25 - L[294] * t54_26 - L[335] * t54_30 - L[405] * t54_37 - L[418] * t54_38 - L[492] * t54_45 - L[510] * t54_46 - L[527] * t54_47 - L[543] * t54_48 - L[558] * t54_49 - L[572] * t54_50 - L[585] * t54_51 - L[597] * t54_52 - L[608] * t54_53) * D_inv[54];
+        L[619] = (-L[8] * t54_0 - L[44] * t54_4 - L[74] * t54_7 - L[253] * t54_23 - L[268] * t54_24 - L[345] * t54_31 - L[386] * t54_35 - L[406] * t54_37 - L[457] * t54_42 - L[493] * t54_45 - L[511] * t54_46 - L[528] * t54_47 - L[544] * t54_48 - L[559] * t54_49 - L[573] * t54_50 - L[586] * t54_51 - L[598] * t54_52 - L[609] * t54_53) * D_inv[54];
+        L[620] = (-L[9] * t54_0 - L[75] * t54_7 - L[121] * t54_11 - L[132] * t54_12 - L[167] * t54_15 - L[179] * t54_16 - L[254] * t54_23 - L[282] * t54_25 - L[295] * t54_26 - L[336] * t54_30 - L[407] * t54_37 - L[419] * t54_38 - L[494] * t54_45 - L[512] * t54_46 - L[529] * t54_47 - L[545] * t54_48 - L[560] * t54_49 - L[574] * t54_50 - L[587] * t54_51 - L[599] * t54_52 - L[610] * t54_53) * D_inv[54];
+        L[621] = (-L[10] * t54_0 - L[88] * t54_8 - L[101] * t54_9 - L[133] * t54_12 - L[168] * t54_15 - L[337] * t54_30 - L[346] * t54_31 - L[495] * t54_45 - L[513] * t54_46 - L[530] * t54_47 - L[546] * t54_48 - L[561] * t54_49 - L[575] * t54_50 - L[588] * t54_51 - L[600] * t54_52 - L[611] * t54_53) * D_inv[54];
+        L[622] = (-L[45] * t54_4 - L[76] * t54_7 - L[89] * t54_8 - L[102] * t54_9 - L[134] * t54_12 - L[169] * t54_15 - L[180] * t54_16 - L[255] * t54_23 - L[283] * t54_25 - L[296] * t54_26 - L[347] * t54_31 - L[397] * t54_36 - L[408] * t54_37 - L[420] * t54_38 - L[458] * t54_42 - L[496] * t54_45 - L[514] * t54_46 - L[531] * t54_47 - L[547] * t54_48 - L[562] * t54_49 - L[576] * t54_50 - L[589] * t54_51 - L[601] * t54_52 - L[612] * t54_53) * D_inv[54];
+        L[623] = (-L[77] * t54_7 - L[135] * t54_12 - L[170] * t54_15 - L[269] * t54_24 - L[297] * t54_26 - L[338] * t54_30 - L[348] * t54_31 - L[398] * t54_36 - L[409] * t54_37 - L[421] * t54_38 - L[459] * t54_42 - L[497] * t54_45 - L[515] * t54_46 - L[532] * t54_47 - L[548] * t54_48 - L[563] * t54_49 - L[577] * t54_50 - L[590] * t54_51 - L[602] * t54_52 - L[613] * t54_53) * D_inv[54];
+        L[624] = (-L[11] * t54_0 - L[27] * t54_2 - L[46] * t54_4 - L[78] * t54_7 - L[90] * t54_8 - L[103] * t54_9 - L[122] * t54_11 - L[171] * t54_15 - L[181] * t54_16 - L[256] * t54_23 - L[270] * t54_24 - L[284] * t54_25 - L[410] * t54_37 - L[498] * t54_45 - L[516] * t54_46 - L[533] * t54_47 - L[549] * t54_48 - L[564] * t54_49 - L[578] * t54_50 - L[591] * t54_51 - L[603] * t54_52 - L[614] * t54_53) * D_inv[54];
+        L[625] = (-L[12] * t54_0 - L[28] * t54_2 - L[47] * t54_4 - L[91] * t54_8 - L[104] * t54_9 - L[123] * t54_11 - L[172] * t54_15 - L[257] * t54_23 - L[285] * t54_25 - L[387] * t54_35 - L[399] * t54_36 - L[422] * t54_38 - L[499] * t54_45 - L[517] * t54_46 - L[534] * t54_47 - L[550] * t54_48 - L[565] * t54_49 - L[579] * t54_50 - L[592] * t54_51 - L[604] * t54_52 - L[615] * t54_53) * D_inv[54];
+        const double t55_1 = L[16] * D[1];
+        const double t55_2 = L[26] * D[2];
+        const double t55_3 = L[32] * D[3];
+        const double t55_4 = L[43] * D[4];
+        const double t55_6 = L[59] * D[6];
+        const double t55_7 = L[71] * D[7];
+        const double t55_10 = L[108] * D[10];
+        const double t55_11 = L[119] * D[11];
+        const double t55_12 = L[131] * D[12];
+        const double t55_13 = L[142] * D[13];
+        const double t55_14 = L[154] * D[14];
+        const double t55_17 = L[185] * D[17];
+        const double t55_18 = L[198] * D[18];
+        const double t55_20 = L[217] * D[20];
+        const double t55_21 = L[228] * D[21];
+        const double t55_22 = L[239] * D[22];
+        const double t55_23 = L[251] * D[23];
+        const double t55_24 = L[265] * D[24];
+        const double t55_26 = L[292] * D[26];
+        const double t55_29 = L[325] * D[29];
+        const double t55_30 = L[333] * D[30];
+        const double t55_35 = L[385] * D[35];
+        const double t55_36 = L[395] * D[36];
+        const double t55_37 = L[404] * D[37];
+        const double t55_38 = L[417] * D[38];
+        const double t55_39 = L[428] * D[39];
+        const double t55_44 = L[475] * D[44];
+        const double t55_45 = L[490] * D[45];
+        const double t55_46 = L[508] * D[46];
+        const double t55_47 = L[525] * D[47];
+        const double t55_48 = L[541] * D[48];
+        const double t55_49 = L[556] * D[49];
+        const double t55_50 = L[570] * D[50];
+        const double t55_51 = L[583] * D[51];
+        const double t55_52 = L[595] * D[52];
+        const double t55_53 = L[606] * D[53];
+        const double t55_54 = L[616] * D[54];
+        D[55] = Kx[10] - L[16] * t55_1 - L[26] * t55_2 - L[32] * t55_3 - L[43] * t55_4 - L[59] * t55_6 - L[71] * t55_7 - L[108] * t55_10 - L[119] * t55_11 - L[131] * t55_12 - L[142] * t55_13 - L[154] * t55_14 - L[185] * t55_17 - L[198] * t55_18 - L[217] * t55_20 - L[228] * t55_21 - L[239] * t55_22 - L[251] * t55_23 - L[265] * t55_24 - L[292] * t55_26 - L[325] * t55_29 - L[333] * t55_30 - L[385] * t55_35 - L[395] * t55_36 - L[404] * t55_37 - L[417] * t55_38 - L[428] * t55_39 - L[475] * t55_44 - L[490] * t55_45 - L[508] * t55_46 - L[525] * t55_47 - L[541] * t55_48 - L[556] * t55_49 - L[570] * t55_50 - L[583] * t55_51 - L[595] * t55_52 - L[606] * t55_53 - L[616] * t55_54;
+        D_inv[55] = 1. / D[55];
+        L[626] = (-L[33] * t55_3 - L[72] * t55_7 - L[120] * t55_11 - L[155] * t55_14 - L[199] * t55_18 - L[218] * t55_20 - L[229] * t55_21 - L[252] * t55_23 - L[266] * t55_24 - L[293] * t55_26 - L[334] * t55_30 - L[396] * t55_36 - L[429] * t55_39 - L[476] * t55_44 - L[491] * t55_45 - L[509] * t55_46 - L[526] * t55_47 - L[542] * t55_48 - L[557] * t55_49 - L[571] * t55_50 - L[584] * t55_51 - L[596] * t55_52 - L[607] * t55_53 - L[617] * t55_54) * D_inv[55];
+        L[627] = (-L[17] * t55_1 - L[34] * t55_3 - L[60] * t55_6 - L[73] * t55_7 - L[143] * t55_13 - L[186] * t55_17 - L[230] * t55_21 - L[267] * t55_24 - L[294] * t55_26 - L[326] * t55_29 - L[335] * t55_30 - L[405] * t55_37 - L[418] * t55_38 - L[430] * t55_39 - L[492] * t55_45 - L[510] * t55_46 - L[527] * t55_47 - L[543] * t55_48 - L[558] * t55_49 - L[572] * t55_50 - L[585] * t55_51 - L[597] * t55_52 - L[608] * t55_53 - L[618] * t55_54) * D_inv[55];
+        L[628] = (-L[35] * t55_3 - L[44] * t55_4 - L[61] * t55_6 - L[74] * t55_7 - L[109] * t55_10 - L[144] * t55_13 - L[187] * t55_17 - L[219] * t55_20 - L[240] * t55_22 - L[253] * t55_23 - L[268] * t55_24 - L[386] * t55_35 - L[406] * t55_37 - L[477] * t55_44 - L[493] * t55_45 - L[511] * t55_46 - L[528] * t55_47 - L[544] * t55_48 - L[559] * t55_49 - L[573] * t55_50 - L[586] * t55_51 - L[598] * t55_52 - L[609] * t55_53 - L[619] * t55_54) * D_inv[55];
+        L[629] = (-L[18] * t55_1 - L[62] * t55_6 - L[75] * t55_7 - L[121] * t55_11 - L[132] * t55_12 - L[145] * t55_13 - L[188] * t55_17 - L[200] * t55_18 - L[220] * t55_20 - L[254] * t55_23 - L[295] * t55_26 - L[336] * t55_30 - L[407] * t55_37 - L[419] * t55_38 - L[431] * t55_39 - L[478] * t55_44 - L[494] * t55_45 - L[512] * t55_46 - L[529] * t55_47 - L[545] * t55_48 - L[560] * t55_49 - L[574] * t55_50 - L[587] * t55_51 - L[599] * t55_52 - L[610] * t55_53 - L[620] * t55_54) * D_inv[55];
+        L[630] = (-L[19] * t55_1 - L[110] * t55_10 - L[133] * t55_12 - L[146] * t55_13 - L[156] * t55_14 - L[189] * t55_17 - L[231] * t55_21 - L[241] * t55_22 - L[337] * t55_30 - L[432] * t55_39 - L[479] * t55_44 - L[495] * t55_45 - L[513] * t55_46 - L[530] * t55_47 - L[546] * t55_48 - L[561] * t55_49 - L[575] * t55_50 - L[588] * t55_51 - L[600] * t55_52 - L[611] * t55_53 - L[621] * t55_54) * D_inv[55];
+        L[631] = (-L[45] * t55_4 - L[63] * t55_6 - L[76] * t55_7 - L[111] * t55_10 - L[134] * t55_12 - L[157] * t55_14 - L[190] * t55_17 - L[201] * t55_18 - L[232] * t55_21 - L[242] * t55_22 - L[255] * t55_23 - L[296] * t55_26 - L[397] * t55_36 - L[408] * t55_37 - L[420] * t55_38 - L[496] * t55_45 - L[514] * t55_46 - L[531] * t55_47 - L[547] * t55_48 - L[562] * t55_49 - L[576] * t55_50 - L[589] * t55_51 - L[601] * t55_52 - L[612] * t55_53 - L[622] * t55_54) * D_inv[55];
+        L[632] = (-L[20] * t55_1 - L[64] * t55_6 - L[77] * t55_7 - L[112] * t55_10 - L[135] * t55_12 - L[147] * t55_13 - L[158] * t55_14 - L[221] * t55_20 - L[233] * t55_21 - L[243] * t55_22 - L[269] * t55_24 - L[297] * t55_26 - L[338] * t55_30 - L[398] * t55_36 - L[409] * t55_37 - L[421] * t55_38 - L[433] * t55_39 - L[497] * t55_45 - L[515] * t55_46 - L[532] * t55_47 - L[548] * t55_48 - L[563] * t55_49 - L[577] * t55_50 - L[590] * t55_51 - L[602] * t55_52 - L[613] * t55_53 - L[623] * t55_54) * D_inv[55];
+        L[633] = (-L[27] * t55_2 - L[36] * t55_3 - L[46] * t55_4 - L[65] * t55_6 - L[78] * t55_7 - L[122] * t55_11 - L[148] * t55_13 - L[191] * t55_17 - L[202] * t55_18 - L[222] * t55_20 - L[234] * t55_21 - L[256] * t55_23 - L[270] * t55_24 - L[327] * t55_29 - L[410] * t55_37 - L[498] * t55_45 - L[516] * t55_46 - L[533] * t55_47 - L[549] * t55_48 - L[564] * t55_49 - L[578] * t55_50 - L[591] * t55_51 - L[603] * t55_52 - L[614] * t55_53 - L[624] * t55_54) * D_inv[55];
+        L[634] = (-L[21] * t55_1 - L[28] * t55_2 - L[37] * t55_3 - L[47] * t55_4 - L[113] * t55_10 - L[123] * t55_11 - L[203] * t55_18 - L[235] * t55_21 - L[244] * t55_22 - L[257] * t55_23 - L[387] * t55_35 - L[399] * t55_36 - L[422] * t55_38 - L[434] * t55_39 - L[480] * t55_44 - L[499] * t55_45 - L[517] * t55_46 - L[534] * t55_47 - L[550] * t55_48 - L[565] * t55_49 - L[579] * t55_50 - L[592] * t55_51 - L[604] * t55_52 - L[615] * t55_53 - L[625] * t55_54) * D_inv[55];
+        const double t56_3 = L[33] * D[3];
+        const double t56_7 = L[72] * D[7];
+        const double t56_8 = L[86] * D[8];
+        const double t56_9 = L[100] * D[9];
+        const double t56_11 = L[120] * D[11];
+        const double t56_14 = L[155] * D[14];
+        const double t56_15 = L[165] * D[15];
+        const double t56_16 = L[178] * D[16];
+        const double t56_18 = L[199] * D[18];
+        const double t56_20 = L[218] * D[20];
+        const double t56_21 = L[229] * D[21];
+        const double t56_23 = L[252] * D[23];
+        const double t56_24 = L[266] * D[24];
+        const double t56_25 = L[280] * D[25];
+        const double t56_26 = L[293] * D[26];
+        const double t56_27 = L[302] * D[27];
+        const double t56_28 = L[312] * D[28];
+        const double t56_30 = L[334] * D[30];
+        const double t56_33 = L[363] * D[33];
+        const double t56_34 = L[374] * D[34];
+        const double t56_36 = L[396] * D[36];
+        const double t56_39 = L[429] * D[39];
+        const double t56_40 = L[439] * D[40];
+        const double t56_42 = L[456] * D[42];
+        const double t56_43 = L[466] * D[43];
+        const double t56_44 = L[476] * D[44];
+        const double t56_45 = L[491] * D[45];
+        const double t56_46 = L[509] * D[46];
+        const double t56_47 = L[526] * D[47];
+        const double t56_48 = L[542] * D[48];
+        const double t56_49 = L[557] * D[49];
+        const double t56_50 = L[571] * D[50];
+        const double t56_51 = L[584] * D[51];
+        const double t56_52 = L[596] * D[52];
+        const double t56_53 = L[607] * D[53];
+        const double t56_54 = L[617] * D[54];
+        const double t56_55 = L[626] * D[55];
+        D[56] = Kx[11] - L[33] * t56_3 - L[72] * t56_7 - L[86] * t56_8 - L[100] * t56_9 - L[120] * t56_11 - L[155] * t56_14 - L[165] * t56_15 - L[178] * t56_16 - L[199] * t56_18 - L[218] * t56_20 - L[229] * t56_21 - L[252] * t56_23 - L[266] * t56_24 - L[280] * t56_25 - L[293] * t56_26 - L[302] * t56_27 - L[312] * t56_28 - L[334] * t56_30 - L[363] * t56_33 - L[374] * t56_34 - L[396] * t56_36 - L[429] * t56_39 - L[439] * t56_40 - L[456] * t56_42 - L[466] * t56_43 - L[476] * t56_44 - L[491] * t56_45 - L[509] * t56_46 - L[526] * t56_47 - L[542] * t56_48 - L[557] * t56_49 - L[571] * t56_50 - L[584] * t56_51 - L[596] * t56_52 - L[607] * t56_53 - L[617] * t56_54 - L[626] * t56_55;
+        D_inv[56] = 1. / D[56];
+        L[635] = (-L[34] * t56_3 - L[73] * t56_7 - L[87] * t56_8 - L[166] * t56_15 - L[230] * t56_21 - L[267] * t56_24 - L[281] * t56_25 - L[294] * t56_26 - L[313] * t56_28 - L[335] * t56_30 - L[364] * t56_33 - L[375] * t56_34 - L[430] * t56_39 - L[492] * t56_45 - L[510] * t56_46 - L[527] * t56_47 - L[543] * t56_48 - L[558] * t56_49 - L[572] * t56_50 - L[585] * t56_51 - L[597] * t56_52 - L[608] * t56_53 - L[618] * t56_54 - L[627] * t56_55) * D_inv[56];
+        L[636] = (-L[35] * t56_3 - L[74] * t56_7 - L[219] * t56_20 - L[253] * t56_23 - L[268] * t56_24 - L[314] * t56_28 - L[365] * t56_33 - L[457] * t56_42 - L[477] * t56_44 - L[493] * t56_45 - L[511] * t56_46 - L[528] * t56_47 - L[544] * t56_48 - L[559] * t56_49 - L[573] * t56_50 - L[586] * t56_51 - L[598] * t56_52 - L[609] * t56_53 - L[619] * t56_54 - L[628] * t56_55) * D_inv[56];
+        L[637] = (-L[75] * t56_7 - L[121] * t56_11 - L[167] * t56_15 - L[179] * t56_16 - L[200] * t56_18 - L[220] * t56_20 - L[254] * t56_23 - L[282] * t56_25 - L[295] * t56_26 - L[303] * t56_27 - L[336] * t56_30 - L[376] * t56_34 - L[431] * t56_39 - L[440] * t56_40 - L[467] * t56_43 - L[478] * t56_44 - L[494] * t56_45 - L[512] * t56_46 - L[529] * t56_47 - L[545] * t56_48 - L[560] * t56_49 - L[574] * t56_50 - L[587] * t56_51 - L[599] * t56_52 - L[610] * t56_53 - L[620] * t56_54 - L[629] * t56_55) * D_inv[56];
+        L[638] = (-L[88] * t56_8 - L[101] * t56_9 - L[156] * t56_14 - L[168] * t56_15 - L[231] * t56_21 - L[304] * t56_27 - L[337] * t56_30 - L[366] * t56_33 - L[432] * t56_39 - L[441] * t56_40 - L[479] * t56_44 - L[495] * t56_45 - L[513] * t56_46 - L[530] * t56_47 - L[546] * t56_48 - L[561] * t56_49 - L[575] * t56_50 - L[588] * t56_51 - L[600] * t56_52 - L[611] * t56_53 - L[621] * t56_54 - L[630] * t56_55) * D_inv[56];
+        L[639] = (-L[76] * t56_7 - L[89] * t56_8 - L[102] * t56_9 - L[157] * t56_14 - L[169] * t56_15 - L[180] * t56_16 - L[201] * t56_18 - L[232] * t56_21 - L[255] * t56_23 - L[283] * t56_25 - L[296] * t56_26 - L[305] * t56_27 - L[315] * t56_28 - L[397] * t56_36 - L[442] * t56_40 - L[458] * t56_42 - L[468] * t56_43 - L[496] * t56_45 - L[514] * t56_46 - L[531] * t56_47 - L[547] * t56_48 - L[562] * t56_49 - L[576] * t56_50 - L[589] * t56_51 - L[601] * t56_52 - L[612] * t56_53 - L[622] * t56_54 - L[631] * t56_55) * D_inv[56];
+        L[640] = (-L[77] * t56_7 - L[158] * t56_14 - L[170] * t56_15 - L[221] * t56_20 - L[233] * t56_21 - L[269] * t56_24 - L[297] * t56_26 - L[316] * t56_28 - L[338] * t56_30 - L[398] * t56_36 - L[433] * t56_39 - L[459] * t56_42 - L[469] * t56_43 - L[497] * t56_45 - L[515] * t56_46 - L[532] * t56_47 - L[548] * t56_48 - L[563] * t56_49 - L[577] * t56_50 - L[590] * t56_51 - L[602] * t56_52 - L[613] * t56_53 - L[623] * t56_54 - L[632] * t56_55) * D_inv[56];
+        L[641] = (-L[36] * t56_3 - L[78] * t56_7 - L[90] * t56_8 - L[103] * t56_9 - L[122] * t56_11 - L[171] * t56_15 - L[181] * t56_16 - L[202] * t56_18 - L[222] * t56_20 - L[234] * t56_21 - L[256] * t56_23 - L[270] * t56_24 - L[284] * t56_25 - L[306] * t56_27 - L[317] * t56_28 - L[367] * t56_33 - L[443] * t56_40 - L[498] * t56_45 - L[516] * t56_46 - L[533] * t56_47 - L[549] * t56_48 - L[564] * t56_49 - L[578] * t56_50 - L[591] * t56_51 - L[603] * t56_52 - L[614] * t56_53 - L[624] * t56_54 - L[633] * t56_55) * D_inv[56];
+        L[642] = (-L[37] * t56_3 - L[91] * t56_8 - L[104] * t56_9 - L[123] * t56_11 - L[172] * t56_15 - L[203] * t56_18 - L[235] * t56_21 - L[257] * t56_23 - L[285] * t56_25 - L[307] * t56_27 - L[318] * t56_28 - L[368] * t56_33 - L[377] * t56_34 - L[399] * t56_36 - L[434] * t56_39 - L[444] * t56_40 - L[480] * t56_44 - L[499] * t56_45 - L[517] * t56_46 - L[534] * t56_47 - L[550] * t56_48 - L[565] * t56_49 - L[579] * t56_50 - L[592] * t56_51 - L[604] * t56_52 - L[615] * t56_53 - L[625] * t56_54 - L[634] * t56_55) * D_inv[56];
+        const double t57_0 = L[7] * D[0];
+        const double t57_1 = L[17] * D[1];
+        const double t57_3 = L[34] * D[3];
+        const double t57_5 = L[51] * D[5];
+        const double t57_6 = L[60] * D[6];
+        const double t57_7 = L[73] * D[7];
+        const double t57_8 = L[87] * D[8];
+        const double t57_13 = L[143] * D[13];
+        const double t57_15 = L[166] * D[15];
+        const double t57_17 = L[186] * D[17];
+        const double t57_19 = L[209] * D[19];
+        const double t57_21 = L[230] * D[21];
+        const double t57_24 = L[267] * D[24];
+        const double t57_25 = L[281] * D[25];
+        const double t57_26 = L[294] * D[26];
+        const double t57_28 = L[313] * D[28];
+        const double t57_29 = L[326] * D[29];
+        const double t57_30 = L[335] * D[30];
+        const double t57_32 = L[354] * D[32];
+        const double t57_33 = L[364] * D[33];
+        const double t57_34 = L[375] * D[34];
+        const double t57_37 = L[405] * D[37];
+        const double t57_38 = L[418] * D[38];
+        const double t57_39 = L[430] * D[39];
+        const double t57_45 = L[492] * D[45];
+        const double t57_46 = L[510] * D[46];
+        const double t57_47 = L[527] * D[47];
+        const double t57_48 = L[543] * D[48];
+        const double t57_49 = L[558] * D[49];
+        const double t57_50 = L[572] * D[50];
+        const double t57_51 = L[585] * D[51];
+        const double t57_52 = L[597] * D[52];
+        const double t57_53 = L[608] * D[53];
+        const double t57_54 = L[618] * D[54];
+        const double t57_55 = L[627] * D[55];
+        const double t57_56 = L[635] * D[56];
+        D[57] = Kx[12] - L[7] * t57_0 - L[17] * t57_1 - L[34] * t57_3 - L[51] * t57_5 - L[60] * t57_6 - L[73] * t57_7 - L[87] * t57_8 - L[143] * t57_13 - L[166] * t57_15 - L[186] * t57_17 - L[209] * t57_19 - L[230] * t57_21 - L[267] * t57_24 - L[281] * t57_25 - L[294] * t57_26 - L[313] * t57_28 - L[326] * t57_29 - L[335] * t57_30 - L[354] * t57_32 - L[364] * t57_33 - L[375] * t57_34 - L[405] * t57_37 - L[418] * t57_38 - L[430] * t57_39 - L[492] * t57_45 - L[510] * t57_46 - L[527] * t57_47 - L[543] * t57_48 - L[558] * t57_49 - L[572] * t57_50 - L[585] * t57_51 - L[597] * t57_52 - L[608] * t57_53 - L[618] * t57_54 - L[627] * t57_55 - L[635] * t57_56;
+        D_inv[57] = 1. / D[57];
+        L[643] = (-L[8] * t57_0 - L[35] * t57_3 - L[52] * t57_5 - L[61] * t57_6 - L[74] * t57_7 - L[144] * t57_13 - L[187] * t57_17 - L[268] * t57_24 - L[314] * t57_28 - L[365] * t57_33 - L[406] * t57_37 - L[493] * t57_45 - L[511] * t57_46 - L[528] * t57_47 - L[544] * t57_48 - L[559] * t57_49 - L[573] * t57_50 - L[586] * t57_51 - L[598] * t57_52 - L[609] * t57_53 - L[619] * t57_54 - L[628] * t57_55 - L[636] * t57_56) * D_inv[57];
+        L[644] = (-L[9] * t57_0 - L[18] * t57_1 - L[53] * t57_5 - L[62] * t57_6 - L[75] * t57_7 - L[145] * t57_13 - L[167] * t57_15 - L[188] * t57_17 - L[282] * t57_25 - L[295] * t57_26 - L[336] * t57_30 - L[376] * t57_34 - L[407] * t57_37 - L[419] * t57_38 - L[431] * t57_39 - L[494] * t57_45 - L[512] * t57_46 - L[529] * t57_47 - L[545] * t57_48 - L[560] * t57_49 - L[574] * t57_50 - L[587] * t57_51 - L[599] * t57_52 - L[610] * t57_53 - L[620] * t57_54 - L[629] * t57_55 - L[637] * t57_56) * D_inv[57];
+        L[645] = (-L[10] * t57_0 - L[19] * t57_1 - L[88] * t57_8 - L[146] * t57_13 - L[168] * t57_15 - L[189] * t57_17 - L[231] * t57_21 - L[337] * t57_30 - L[355] * t57_32 - L[366] * t57_33 - L[432] * t57_39 - L[495] * t57_45 - L[513] * t57_46 - L[530] * t57_47 - L[546] * t57_48 - L[561] * t57_49 - L[575] * t57_50 - L[588] * t57_51 - L[600] * t57_52 - L[611] * t57_53 - L[621] * t57_54 - L[630] * t57_55 - L[638] * t57_56) * D_inv[57];
+        L[646] = (-L[63] * t57_6 - L[76] * t57_7 - L[89] * t57_8 - L[169] * t57_15 - L[190] * t57_17 - L[232] * t57_21 - L[283] * t57_25 - L[296] * t57_26 - L[315] * t57_28 - L[356] * t57_32 - L[408] * t57_37 - L[420] * t57_38 - L[496] * t57_45 - L[514] * t57_46 - L[531] * t57_47 - L[547] * t57_48 - L[562] * t57_49 - L[576] * t57_50 - L[589] * t57_51 - L[601] * t57_52 - L[612] * t57_53 - L[622] * t57_54 - L[631] * t57_55 - L[639] * t57_56) * D_inv[57];
+        L[647] = (-L[20] * t57_1 - L[54] * t57_5 - L[64] * t57_6 - L[77] * t57_7 - L[147] * t57_13 - L[170] * t57_15 - L[233] * t57_21 - L[269] * t57_24 - L[297] * t57_26 - L[316] * t57_28 - L[338] * t57_30 - L[357] * t57_32 - L[409] * t57_37 - L[421] * t57_38 - L[433] * t57_39 - L[497] * t57_45 - L[515] * t57_46 - L[532] * t57_47 - L[548] * t57_48 - L[563] * t57_49 - L[577] * t57_50 - L[590] * t57_51 - L[602] * t57_52 - L[613] * t57_53 - L[623] * t57_54 - L[632] * t57_55 - L[640] * t57_56) * D_inv[57];
+        L[648] = (-L[11] * t57_0 - L[36] * t57_3 - L[65] * t57_6 - L[78] * t57_7 - L[90] * t57_8 - L[148] * t57_13 - L[171] * t57_15 - L[191] * t57_17 - L[234] * t57_21 - L[270] * t57_24 - L[284] * t57_25 - L[317] * t57_28 - L[327] * t57_29 - L[367] * t57_33 - L[410] * t57_37 - L[498] * t57_45 - L[516] * t57_46 - L[533] * t57_47 - L[549] * t57_48 - L[564] * t57_49 - L[578] * t57_50 - L[591] * t57_51 - L[603] * t57_52 - L[614] * t57_53 - L[624] * t57_54 - L[633] * t57_55 - L[641] * t57_56) * D_inv[57];
+        L[649] = (-L[12] * t57_0 - L[21] * t57_1 - L[37] * t57_3 - L[91] * t57_8 - L[172] * t57_15 - L[235] * t57_21 - L[285] * t57_25 - L[318] * t57_28 - L[358] * t57_32 - L[368] * t57_33 - L[377] * t57_34 - L[422] * t57_38 - L[434] * t57_39 - L[499] * t57_45 - L[517] * t57_46 - L[534] * t57_47 - L[550] * t57_48 - L[565] * t57_49 - L[579] * t57_50 - L[592] * t57_51 - L[604] * t57_52 - L[615] * t57_53 - L[625] * t57_54 - L[634] * t57_55 - L[642] * t57_56) * D_inv[57];
+        const double t58_0 = L[8] * D[0];
+        const double t58_3 = L[35] * D[3];
+        const double t58_4 = L[44] * D[4];
+        const double t58_5 = L[52] * D[5];
+        const double t58_6 = L[61] * D[6];
+        const double t58_7 = L[74] * D[7];
+        const double t58_10 = L[109] * D[10];
+        const double t58_13 = L[144] * D[13];
+        const double t58_17 = L[187] * D[17];
+        const double t58_20 = L[219] * D[20];
+        const double t58_22 = L[240] * D[22];
+        const double t58_23 = L[253] * D[23];
+        const double t58_24 = L[268] * D[24];
+        const double t58_28 = L[314] * D[28];
+        const double t58_31 = L[345] * D[31];
+        const double t58_33 = L[365] * D[33];
+        const double t58_35 = L[386] * D[35];
+        const double t58_37 = L[406] * D[37];
+        const double t58_42 = L[457] * D[42];
+        const double t58_44 = L[477] * D[44];
+        const double t58_45 = L[493] * D[45];
+        const double t58_46 = L[511] * D[46];
+        const double t58_47 = L[528] * D[47];
+        const double t58_48 = L[544] * D[48];
+        const double t58_49 = L[559] * D[49];
+        const double t58_50 = L[573] * D[50];
+        const double t58_51 = L[586] * D[51];
+        const double t58_52 = L[598] * D[52];
+        const double t58_53 = L[609] * D[53];
+        const double t58_54 = L[619] * D[54];
+        const double t58_55 = L[628] * D[55];
+        const double t58_56 = L[636] * D[56];
+        const double t58_57 = L[643] * D[57];
+        D[58] = Kx[13] - L[8] * t58_0 - L[35] * t58_3 - L[44] * t58_4 - L[52] * t58_5 - L[61] * t58_6 - L[74] * t58_7 - L[109] * t58_10 - L[144] * t58_13 - L[187] * t58_17 - L[219] * t58_20 - L[240] * t58_22 - L[253] * t58_23 - L[268] * t58_24 - L[314] * t58_28 - L[345] * t58_31 - L[365] * t58_33 - L[386] * t58_35 - L[406] * t58_37 - L[457] * t58_42 - L[477] * t58_44 - L[493] * t58_45 - L[511] * t58_46 - L[528] * t58_47 - L[544] * t58_48 - L[559] * t58_49 - L[573] * t58_50 - L[586] * t58_51 - L[598] * t58_52 - L[609] * t58_53 - L[619] * t58_54 - L[628] * t58_55 - L[636] * t58_56 - L[643] * t58_57;
+        D_inv[58] = 1. / D[58];
+        L[650] = (-L[9] * t58_0 - L[53] * t58_5 - L[62] * t58_6 - L[75] * t58_7 - L[145] * t58_13 - L[188] * t58_17 - L[220] * t58_20 - L[254] * t58_23 - L[407] * t58_37 - L[478] * t58_44 - L[494] * t58_45 - L[512] * t58_46 - L[529] * t58_47 - L[545] * t58_48 - L[560] * t58_49 - L[574] * t58_50 - L[587] * t58_51 - L[599] * t58_52 - L[610] * t58_53 - L[620] * t58_54 - L[629] * t58_55 - L[637] * t58_56 - L[644] * t58_57) * D_inv[58];
+        L[651] = (-L[10] * t58_0 - L[110] * t58_10 - L[146] * t58_13 - L[189] * t58_17 - L[241] * t58_22 - L[346] * t58_31 - L[366] * t58_33 - L[479] * t58_44 - L[495] * t58_45 - L[513] * t58_46 - L[530] * t58_47 - L[546] * t58_48 - L[561] * t58_49 - L[575] * t58_50 - L[588] * t58_51 - L[600] * t58_52 - L[611] * t58_53 - L[621] * t58_54 - L[630] * t58_55 - L[638] * t58_56 - L[645] * t58_57) * D_inv[58];
+        L[652] = (-L[45] * t58_4 - L[63] * t58_6 - L[76] * t58_7 - L[111] * t58_10 - L[190] * t58_17 - L[242] * t58_22 - L[255] * t58_23 - L[315] * t58_28 - L[347] * t58_31 - L[408] * t58_37 - L[458] * t58_42 - L[496] * t58_45 - L[514] * t58_46 - L[531] * t58_47 - L[547] * t58_48 - L[562] * t58_49 - L[576] * t58_50 - L[589] * t58_51 - L[601] * t58_52 - L[612] * t58_53 - L[622] * t58_54 - L[631] * t58_55 - L[639] * t58_56 - L[646] * t58_57) * D_inv[58];
+        L[653] = (-L[54] * t58_5 - L[64] * t58_6 - L[77] * t58_7 - L[112] * t58_10 - L[147] * t58_13 - L[221] * t58_20 - L[243] * t58_22 - L[269] * t58_24 - L[316] * t58_28 - L[348] * t58_31 - L[409] * t58_37 - L[459] * t58_42 - L[497] * t58_45 - L[515] * t58_46 - L[532] * t58_47 - L[548] * t58_48 - L[563] * t58_49 - L[577] * t58_50 - L[590] * t58_51 - L[602] * t58_52 - L[613] * t58_53 - L[623] * t58_54 - L[632] * t58_55 - L[640] * t58_56 - L[647] * t58_57) * D_inv[58];
+        L[654] = (-L[11] * t58_0 - L[36] * t58_3 - L[46] * t58_4 - L[65] * t58_6 - L[78] * t58_7 - L[148] * t58_13 - L[191] * t58_17 - L[222] * t58_20 - L[256] * t58_23 - L[270] * t58_24 - L[317] * t58_28 - L[367] * t58_33 - L[410] * t58_37 - L[498] * t58_45 - L[516] * t58_46 - L[533] * t58_47 - L[549] * t58_48 - L[564] * t58_49 - L[578] * t58_50 - L[591] * t58_51 - L[603] * t58_52 - L[614] * t58_53 - L[624] * t58_54 - L[633] * t58_55 - L[641] * t58_56 - L[648] * t58_57) * D_inv[58];
+        L[655] = (-L[12] * t58_0 - L[37] * t58_3 - L[47] * t58_4 - L[113] * t58_10 - L[244] * t58_22 - L[257] * t58_23 - L[318] * t58_28 - L[368] * t58_33 - L[387] * t58_35 - L[480] * t58_44 - L[499] * t58_45 - L[517] * t58_46 - L[534] * t58_47 - L[550] * t58_48 - L[565] * t58_49 - L[579] * t58_50 - L[592] * t58_51 - L[604] * t58_52 - L[615] * t58_53 - L[625] * t58_54 - L[634] * t58_55 - L[642] * t58_56 - L[649] * t58_57) * D_inv[58];
+        const double t59_0 = L[9] * D[0];
+        const double t59_1 = L[18] * D[1];
+        const double t59_5 = L[53] * D[5];
+        const double t59_6 = L[62] * D[6];
+        const double t59_7 = L[75] * D[7];
+        const double t59_11 = L[121] * D[11];
+        const double t59_12 = L[132] * D[12];
+        const double t59_13 = L[145] * D[13];
+        const double t59_15 = L[167] * D[15];
+        const double t59_16 = L[179] * D[16];
+        const double t59_17 = L[188] * D[17];
+        const double t59_18 = L[200] * D[18];
+        const double t59_20 = L[220] * D[20];
+        const double t59_23 = L[254] * D[23];
+        const double t59_25 = L[282] * D[25];
+        const double t59_26 = L[295] * D[26];
+        const double t59_27 = L[303] * D[27];
+        const double t59_30 = L[336] * D[30];
+        const double t59_34 = L[376] * D[34];
+        const double t59_37 = L[407] * D[37];
+        const double t59_38 = L[419] * D[38];
+        const double t59_39 = L[431] * D[39];
+        const double t59_40 = L[440] * D[40];
+        const double t59_41 = L[451] * D[41];
+        const double t59_43 = L[467] * D[43];
+        const double t59_44 = L[478] * D[44];
+        const double t59_45 = L[494] * D[45];
+        const double t59_46 = L[512] * D[46];
+        const double t59_47 = L[529] * D[47];
+        const double t59_48 = L[545] * D[48];
+        const double t59_49 = L[560] * D[49];
+        const double t59_50 = L[574] * D[50];
+        const double t59_51 = L[587] * D[51];
+        const double t59_52 = L[599] * D[52];
+        const double t59_53 = L[610] * D[53];
+        const double t59_54 = L[620] * D[54];
+        const double t59_55 = L[629] * D[55];
+        const double t59_56 = L[637] * D[56];
+        const double t59_57 = L[644] * D[57];
+        const double t59_58 = L[650] * D[58];
+        D[59] = Kx[14] - L[9] * t59_0 - L[18] * t59_1 - L[53] * t59_5 - L[62] * t59_6 - L[75] * t59_7 - L[121] * t59_11 - L[132] * t59_12 - L[145] * t59_13 - L[167] * t59_15 - L[179] * t59_16 - L[188] * t59_17 - L[200] * t59_18 - L[220] * t59_20 - L[254] * t59_23 - L[282] * t59_25 - L[295] * t59_26 - L[303] * t59_27 - L[336] * t59_30 - L[376] * t59_34 - L[407] * t59_37 - L[419] * t59_38 - L[431] * t59_39 - L[440] * t59_40 - L[451] * t59_41 - L[467] * t59_43 - L[478] * t59_44 - L[494] * t59_45 - L[512] * t59_46 - L[529] * t59_47 - L[545] * t59_48 - L[560] * t59_49 - L[574] * t59_50 - L[587] * t59_51 - L[599] * t59_52 - L[610] * t59_53 - L[620] * t59_54 - L[629] * t59_55 - L[637] * t59_56 - L[644] * t59_57 - L[650] * t59_58;
+        D_inv[59] = 1. / D[59];
+        L[656] = (-L[10] * t59_0 - L[19] * t59_1 - L[133] * t59_12 - L[146] * t59_13 - L[168] * t59_15 - L[189] * t59_17 - L[304] * t59_27 - L[337] * t59_30 - L[432] * t59_39 - L[441] * t59_40 - L[479] * t59_44 - L[495] * t59_45 - L[513] * t59_46 - L[530] * t59_47 - L[546] * t59_48 - L[561] * t59_49 - L[575] * t59_50 - L[588] * t59_51 - L[600] * t59_52 - L[611] * t59_53 - L[621] * t59_54 - L[630] * t59_55 - L[638] * t59_56 - L[645] * t59_57 - L[651] * t59_58) * D_inv[59];
+        L[657] = (-L[63] * t59_6 - L[76] * t59_7 - L[134] * t59_12 - L[169] * t59_15 - L[180] * t59_16 - L[190] * t59_17 - L[201] * t59_18 - L[255] * t59_23 - L[283] * t59_25 - L[296] * t59_26 - L[305] * t59_27 - L[408] * t59_37 - L[420] * t59_38 - L[442] * t59_40 - L[468] * t59_43 - L[496] * t59_45 - L[514] * t59_46 - L[531] * t59_47 - L[547] * t59_48 - L[562] * t59_49 - L[576] * t59_50 - L[589] * t59_51 - L[601] * t59_52 - L[612] * t59_53 - L[622] * t59_54 - L[631] * t59_55 - L[639] * t59_56 - L[646] * t59_57 - L[652] * t59_58) * D_inv[59];
+        L[658] = (-L[20] * t59_1 - L[54] * t59_5 - L[64] * t59_6 - L[77] * t59_7 - L[135] * t59_12 - L[147] * t59_13 - L[170] * t59_15 - L[221] * t59_20 - L[297] * t59_26 - L[338] * t59_30 - L[409] * t59_37 - L[421] * t59_38 - L[433] * t59_39 - L[452] * t59_41 - L[469] * t59_43 - L[497] * t59_45 - L[515] * t59_46 - L[532] * t59_47 - L[548] * t59_48 - L[563] * t59_49 - L[577] * t59_50 - L[590] * t59_51 - L[602] * t59_52 - L[613] * t59_53 - L[623] * t59_54 - L[632] * t59_55 - L[640] * t59_56 - L[647] * t59_57 - L[653] * t59_58) * D_inv[59];
+        L[659] = (-L[11] * t59_0 - L[65] * t59_6 - L[78] * t59_7 - L[122] * t59_11 - L[148] * t59_13 - L[171] * t59_15 - L[181] * t59_16 - L[191] * t59_17 - L[202] * t59_18 - L[222] * t59_20 - L[256] * t59_23 - L[284] * t59_25 - L[306] * t59_27 - L[410] * t59_37 - L[443] * t59_40 - L[498] * t59_45 - L[516] * t59_46 - L[533] * t59_47 - L[549] * t59_48 - L[564] * t59_49 - L[578] * t59_50 - L[591] * t59_51 - L[603] * t59_52 - L[614] * t59_53 - L[624] * t59_54 - L[633] * t59_55 - L[641] * t59_56 - L[648] * t59_57 - L[654] * t59_58) * D_inv[59];
+        L[660] = (-L[12] * t59_0 - L[21] * t59_1 - L[123] * t59_11 - L[172] * t59_15 - L[203] * t59_18 - L[257] * t59_23 - L[285] * t59_25 - L[307] * t59_27 - L[377] * t59_34 - L[422] * t59_38 - L[434] * t59_39 - L[444] * t59_40 - L[480] * t59_44 - L[499] * t59_45 - L[517] * t59_46 - L[534] * t59_47 - L[550] * t59_48 - L[565] * t59_49 - L[579] * t59_50 - L[592] * t59_51 - L[604] * t59_52 - L[615] * t59_53 - L[625] * t59_54 - L[634] * t59_55 - L[642] * t59_56 - L[649] * t59_57 - L[655] * t59_58) * D_inv[59];
+        const double t60_0 = L[10] * D[0];
+        const double t60_1 = L[19] * D[1];
+        const double t60_8 = L[88] * D[8];
+        const double t60_9 = L[101] * D[9];
+        const double t60_10 = L[110] * D[10];
+        const double t60_12 = L[133] * D[12];
+        const double t60_13 = L[146] * D[13];
+        const double t60_14 = L[156] * D[14];
+        const double t60_15 = L[168] * D[15];
+        const double t60_17 = L[189] * D[17];
+        const double t60_21 = L[231] * D[21];
+        const double t60_22 = L[241] * D[22];
+        const double t60_27 = L[304] * D[27];
+        const double t60_30 = L[337] * D[30];
+        const double t60_31 = L[346] * D[31];
+        const double t60_32 = L[355] * D[32];
+        const double t60_33 = L[366] * D[33];
+        const double t60_39 = L[432] * D[39];
+        const double t60_40 = L[441] * D[40];
+        const double t60_44 = L[479] * D[44];
+        const double t60_45 = L[495] * D[45];
+        const double t60_46 = L[513] * D[46];
+        const double t60_47 = L[530] * D[47];
+        const double t60_48 = L[546] * D[48];
+        const double t60_49 = L[561] * D[49];
+        const double t60_50 = L[575] * D[50];
+        const double t60_51 = L[588] * D[51];
+        const double t60_52 = L[600] * D[52];
+        const double t60_53 = L[611] * D[53];
+        const double t60_54 = L[621] * D[54];
+        const double t60_55 = L[630] * D[55];
+        const double t60_56 = L[638] * D[56];
+        const double t60_57 = L[645] * D[57];
+        const double t60_58 = L[651] * D[58];
+        const double t60_59 = L[656] * D[59];
+        D[60] = Kx[15] - L[10] * t60_0 - L[19] * t60_1 - L[88] * t60_8 - L[101] * t60_9 - L[110] * t60_10 - L[133] * t60_12 - L[146] * t60_13 - L[156] * t60_14 - L[168] * t60_15 - L[189] * t60_17 - L[231] * t60_21 - L[241] * t60_22 - L[304] * t60_27 - L[337] * t60_30 - L[346] * t60_31 - L[355] * t60_32 - L[366] * t60_33 - L[432] * t60_39 - L[441] * t60_40 - L[479] * t60_44 - L[495] * t60_45 - L[513] * t60_46 - L[530] * t60_47 - L[546] * t60_48 - L[561] * t60_49 - L[575] * t60_50 - L[588] * t60_51 - L[600] * t60_52 - L[611] * t60_53 - L[621] * t60_54 - L[630] * t60_55 - L[638] * t60_56 - L[645] * t60_57 - L[651] * t60_58 - L[656] * t60_59;
+        D_inv[60] = 1. / D[60];
+        L[661] = (-L[89] * t60_8 - L[102] * t60_9 - L[111] * t60_10 - L[134] * t60_12 - L[157] * t60_14 - L[169] * t60_15 - L[190] * t60_17 - L[232] * t60_21 - L[242] * t60_22 - L[305] * t60_27 - L[347] * t60_31 - L[356] * t60_32 - L[442] * t60_40 - L[496] * t60_45 - L[514] * t60_46 - L[531] * t60_47 - L[547] * t60_48 - L[562] * t60_49 - L[576] * t60_50 - L[589] * t60_51 - L[601] * t60_52 - L[612] * t60_53 - L[622] * t60_54 - L[631] * t60_55 - L[639] * t60_56 - L[646] * t60_57 - L[652] * t60_58 - L[657] * t60_59) * D_inv[60];
+        L[662] = (-L[20] * t60_1 - L[112] * t60_10 - L[135] * t60_12 - L[147] * t60_13 - L[158] * t60_14 - L[170] * t60_15 - L[233] * t60_21 - L[243] * t60_22 - L[338] * t60_30 - L[348] * t60_31 - L[357] * t60_32 - L[433] * t60_39 - L[497] * t60_45 - L[515] * t60_46 - L[532] * t60_47 - L[548] * t60_48 - L[563] * t60_49 - L[577] * t60_50 - L[590] * t60_51 - L[602] * t60_52 - L[613] * t60_53 - L[623] * t60_54 - L[632] * t60_55 - L[640] * t60_56 - L[647] * t60_57 - L[653] * t60_58 - L[658] * t60_59) * D_inv[60];
+        L[663] = (-L[11] * t60_0 - L[90] * t60_8 - L[103] * t60_9 - L[148] * t60_13 - L[171] * t60_15 - L[191] * t60_17 - L[234] * t60_21 - L[306] * t60_27 - L[367] * t60_33 - L[443] * t60_40 - L[498] * t60_45 - L[516] * t60_46 - L[533] * t60_47 - L[549] * t60_48 - L[564] * t60_49 - L[578] * t60_50 - L[591] * t60_51 - L[603] * t60_52 - L[614] * t60_53 - L[624] * t60_54 - L[633] * t60_55 - L[641] * t60_56 - L[648] * t60_57 - L[654] * t60_58 - L[659] * t60_59) * D_inv[60];
+        L[664] = (-L[12] * t60_0 - L[21] * t60_1 - L[91] * t60_8 - L[104] * t60_9 - L[113] * t60_10 - L[172] * t60_15 - L[235] * t60_21 - L[244] * t60_22 - L[307] * t60_27 - L[358] * t60_32 - L[368] * t60_33 - L[434] * t60_39 - L[444] * t60_40 - L[480] * t60_44 - L[499] * t60_45 - L[517] * t60_46 - L[534] * t60_47 - L[550] * t60_48 - L[565] * t60_49 - L[579] * t60_50 - L[592] * t60_51 - L[604] * t60_52 - L[615] * t60_53 - L[625] * t60_54 - L[634] * t60_55 - L[642] * t60_56 - L[649] * t60_57 - L[655] * t60_58 - L[660] * t60_59) * D_inv[60];
+        const double t61_4 = L[45] * D[4];
+        const double t61_6 = L[63] * D[6];
+        const double t61_7 = L[76] * D[7];
+        const double t61_8 = L[89] * D[8];
+        const double t61_9 = L[102] * D[9];
+        const double t61_10 = L[111] * D[10];
+        const double t61_12 = L[134] * D[12];
+        const double t61_14 = L[157] * D[14];
+        const double t61_15 = L[169] * D[15];
+        const double t61_16 = L[180] * D[16];
+        const double t61_17 = L[190] * D[17];
+        const double t61_18 = L[201] * D[18];
+        const double t61_21 = L[232] * D[21];
+        const double t61_22 = L[242] * D[22];
+        const double t61_23 = L[255] * D[23];
+        const double t61_25 = L[283] * D[25];
+        const double t61_26 = L[296] * D[26];
+        const double t61_27 = L[305] * D[27];
+        const double t61_28 = L[315] * D[28];
+        const double t61_31 = L[347] * D[31];
+        const double t61_32 = L[356] * D[32];
+        const double t61_36 = L[397] * D[36];
+        const double t61_37 = L[408] * D[37];
+        const double t61_38 = L[420] * D[38];
+        const double t61_40 = L[442] * D[40];
+        const double t61_42 = L[458] * D[42];
+        const double t61_43 = L[468] * D[43];
+        const double t61_45 = L[496] * D[45];
+        const double t61_46 = L[514] * D[46];
+        const double t61_47 = L[531] * D[47];
+        const double t61_48 = L[547] * D[48];
+        const double t61_49 = L[562] * D[49];
+        const double t61_50 = L[576] * D[50];
+        const double t61_51 = L[589] * D[51];
+        const double t61_52 = L[601] * D[52];
+        const double t61_53 = L[612] * D[53];
+        const double t61_54 = L[622] * D[54];
+        const double t61_55 = L[631] * D[55];
+        const double t61_56 = L[639] * D[56];
+        const double t61_57 = L[646] * D[57];
+        const double t61_58 = L[652] * D[58];
+        const double t61_59 = L[657] * D[59];
+        const double t61_60 = L[661] * D[60];
+        D[61] = Kx[16] - L[45] * t61_4 - L[63] * t61_6 - L[76] * t61_7 - L[89] * t61_8 - L[102] * t61_9 - L[111] * t61_10 - L[134] * t61_12 - L[157] * t61_14 - L[169] * t61_15 - L[180] * t61_16 - L[190] * t61_17 - L[201] * t61_18 - L[232] * t61_21 - L[242] * t61_22 - L[255] * t61_23 - L[283] * t61_25 - L[296] * t61_26 - L[305] * t61_27 - L[315] * t61_28 - L[347] * t61_31 - L[356] * t61_32 - L[397] * t61_36 - L[408] * t61_37 - L[420] * t61_38 - L[442] * t61_40 - L[458] * t61_42 - L[468] * t61_43 - L[496] * t61_45 - L[514] * t61_46 - L[531] * t61_47 - L[547] * t61_48 - L[562] * t61_49 - L[576] * t61_50 - L[589] * t61_51 - L[601] * t61_52 - L[612] * t61_53 - L[622] * t61_54 - L[631] * t61_55 - L[639] * t61_56 - L[646] * t61_57 - L[652] * t61_58 - L[657] * t61_59 - L[661] * t61_60;
+        D_inv[61] = 1. / D[61];
+        L[665] = (-L[64] * t61_6 - L[77] * t61_7 - L[112] * t61_10 - L[135] * t61_12 - L[158] * t61_14 - L[170] * t61_15 - L[233] * t61_21 - L[243] * t61_22 - L[297] * t61_26 - L[316] * t61_28 - L[348] * t61_31 - L[357] * t61_32 - L[398] * t61_36 - L[409] * t61_37 - L[421] * t61_38 - L[459] * t61_42 - L[469] * t61_43 - L[497] * t61_45 - L[515] * t61_46 - L[532] * t61_47 - L[548] * t61_48 - L[563] * t61_49 - L[577] * t61_50 - L[590] * t61_51 - L[602] * t61_52 - L[613] * t61_53 - L[623] * t61_54 - L[632] * t61_55 - L[640] * t61_56 - L[647] * t61_57 - L[653] * t61_58 - L[658] * t61_59 - L[662] * t61_60) * D_inv[61];
+        L[666] = (-L[46] * t61_4 - L[65] * t61_6 - L[78] * t61_7 - L[90] * t61_8 - L[103] * t61_9 - L[171] * t61_15 - L[181] * t61_16 - L[191] * t61_17 - L[202] * t61_18 - L[234] * t61_21 - L[256] * t61_23 - L[284] * t61_25 - L[306] * t61_27 - L[317] * t61_28 - L[410] * t61_37 - L[443] * t61_40 - L[498] * t61_45 - L[516] * t61_46 - L[533] * t61_47 - L[549] * t61_48 - L[564] * t61_49 - L[578] * t61_50 - L[591] * t61_51 - L[603] * t61_52 - L[614] * t61_53 - L[624] * t61_54 - L[633] * t61_55 - L[641] * t61_56 - L[648] * t61_57 - L[654] * t61_58 - L[659] * t61_59 - L[663] * t61_60) * D_inv[61];
+        L[667] = (-L[47] * t61_4 - L[91] * t61_8 - L[104] * t61_9 - L[113] * t61_10 - L[172] * t61_15 - L[203] * t61_18 - L[235] * t61_21 - L[244] * t61_22 - L[257] * t61_23 - L[285] * t61_25 - L[307] * t61_27 - L[318] * t61_28 - L[358] * t61_32 - L[399] * t61_36 - L[422] * t61_38 - L[444] * t61_40 - L[499] * t61_45 - L[517] * t61_46 - L[534] * t61_47 - L[550] * t61_48 - L[565] * t61_49 - L[579] * t61_50 - L[592] * t61_51 - L[604] * t61_52 - L[615] * t61_53 - L[625] * t61_54 - L[634] * t61_55 - L[642] * t61_56 - L[649] * t61_57 - L[655] * t61_58 - L[660] * t61_59 - L[664] * t61_60) * D_inv[61];
+        const double t62_1 = L[20] * D[1];
+        const double t62_5 = L[54] * D[5];
+        const double t62_6 = L[64] * D[6];
+        const double t62_7 = L[77] * D[7];
+        const double t62_10 = L[112] * D[10];
+        const double t62_12 = L[135] * D[12];
+        const double t62_13 = L[147] * D[13];
+        const double t62_14 = L[158] * D[14];
+        const double t62_15 = L[170] * D[15];
+        const double t62_20 = L[221] * D[20];
+        const double t62_21 = L[233] * D[21];
+        const double t62_22 = L[243] * D[22];
+        const double t62_24 = L[269] * D[24];
+        const double t62_26 = L[297] * D[26];
+        const double t62_28 = L[316] * D[28];
+        const double t62_30 = L[338] * D[30];
+        const double t62_31 = L[348] * D[31];
+        const double t62_32 = L[357] * D[32];
+        const double t62_36 = L[398] * D[36];
+        const double t62_37 = L[409] * D[37];
+        const double t62_38 = L[421] * D[38];
+        const double t62_39 = L[433] * D[39];
+        const double t62_41 = L[452] * D[41];
+        const double t62_42 = L[459] * D[42];
+        const double t62_43 = L[469] * D[43];
+        const double t62_45 = L[497] * D[45];
+        const double t62_46 = L[515] * D[46];
+        const double t62_47 = L[532] * D[47];
+        const double t62_48 = L[548] * D[48];
+        const double t62_49 = L[563] * D[49];
+        const double t62_50 = L[577] * D[50];
+        const double t62_51 = L[590] * D[51];
+        const double t62_52 = L[602] * D[52];
+        const double t62_53 = L[613] * D[53];
+        const double t62_54 = L[623] * D[54];
+        const double t62_55 = L[632] * D[55];
+        const double t62_56 = L[640] * D[56];
+        const double t62_57 = L[647] * D[57];
+        const double t62_58 = L[653] * D[58];
+        const double t62_59 = L[658] * D[59];
+        const double t62_60 = L[662] * D[60];
+        const double t62_61 = L[665] * D[61];
+        D[62] = Kx[17] - L[20] * t62_1 - L[54] * t62_5 - L[64] * t62_6 - L[77] * t62_7 - L[112] * t62_10 - L[135] * t62_12 - L[147] * t62_13 - L[158] * t62_14 - L[170] * t62_15 - L[221] * t62_20 - L[233] * t62_21 - L[243] * t62_22 - L[269] * t62_24 - L[297] * t62_26 - L[316] * t62_28 - L[338] * t62_30 - L[348] * t62_31 - L[357] * t62_32 - L[398] * t62_36 - L[409] * t62_37 - L[421] * t62_38 - L[433] * t62_39 - L[452] * t62_41 - L[459] * t62_42 - L[469] * t62_43 - L[497] * t62_45 - L[515] * t62_46 - L[532] * t62_47 - L[548] * t62_48 - L[563] * t62_49 - L[577] * t62_50 - L[590] * t62_51 - L[602] * t62_52 - L[613] * t62_53 - L[623] * t62_54 - L[632] * t62_55 - L[640] * t62_56 - L[647] * t62_57 - L[653] * t62_58 - L[658] * t62_59 - L[662] * t62_60 - L[665] * t62_61;
+        D_inv[62] = 1. / D[62];
+        L[668] = (-L[65] * t62_6 - L[78] * t62_7 - L[148] * t62_13 - L[171] * t62_15 - L[222] * t62_20 - L[234] * t62_21 - L[270] * t62_24 - L[317] * t62_28 - L[410] * t62_37 - L[498] * t62_45 - L[516] * t62_46 - L[533] * t62_47 - L[549] * t62_48 - L[564] * t62_49 - L[578] * t62_50 - L[591] * t62_51 - L[603] * t62_52 - L[614] * t62_53 - L[624] * t62_54 - L[633] * t62_55 - L[641] * t62_56 - L[648] * t62_57 - L[654] * t62_58 - L[659] * t62_59 - L[663] * t62_60 - L[666] * t62_61) * D_inv[62];
+        L[669] = (-L[21] * t62_1 - L[113] * t62_10 - L[172] * t62_15 - L[235] * t62_21 - L[244] * t62_22 - L[318] * t62_28 - L[358] * t62_32 - L[399] * t62_36 - L[422] * t62_38 - L[434] * t62_39 - L[499] * t62_45 - L[517] * t62_46 - L[534] * t62_47 - L[550] * t62_48 - L[565] * t62_49 - L[579] * t62_50 - L[592] * t62_51 - L[604] * t62_52 - L[615] * t62_53 - L[625] * t62_54 - L[634] * t62_55 - L[642] * t62_56 - L[649] * t62_57 - L[655] * t62_58 - L[660] * t62_59 - L[664] * t62_60 - L[667] * t62_61) * D_inv[62];
+        const double t63_0 = L[11] * D[0];
+        const double t63_2 = L[27] * D[2];
+        const double t63_3 = L[36] * D[3];
+        const double t63_4 = L[46] * D[4];
+        const double t63_6 = L[65] * D[6];
+        const double t63_7 = L[78] * D[7];
+        const double t63_8 = L[90] * D[8];
+        const double t63_9 = L[103] * D[9];
+        const double t63_11 = L[122] * D[11];
+        const double t63_13 = L[148] * D[13];
+        const double t63_15 = L[171] * D[15];
+        const double t63_16 = L[181] * D[16];
+        const double t63_17 = L[191] * D[17];
+        const double t63_18 = L[202] * D[18];
+        const double t63_20 = L[222] * D[20];
+        const double t63_21 = L[234] * D[21];
+        const double t63_23 = L[256] * D[23];
+        const double t63_24 = L[270] * D[24];
+        const double t63_25 = L[284] * D[25];
+        const double t63_27 = L[306] * D[27];
+        const double t63_28 = L[317] * D[28];
+        const double t63_29 = L[327] * D[29];
+        const double t63_33 = L[367] * D[33];
+        const double t63_37 = L[410] * D[37];
+        const double t63_40 = L[443] * D[40];
+        const double t63_45 = L[498] * D[45];
+        const double t63_46 = L[516] * D[46];
+        const double t63_47 = L[533] * D[47];
+        const double t63_48 = L[549] * D[48];
+        const double t63_49 = L[564] * D[49];
+        const double t63_50 = L[578] * D[50];
+        const double t63_51 = L[591] * D[51];
+        const double t63_52 = L[603] * D[52];
+        const double t63_53 = L[614] * D[53];
+        const double t63_54 = L[624] * D[54];
+        const double t63_55 = L[633] * D[55];
+        const double t63_56 = L[641] * D[56];
+        const double t63_57 = L[648] * D[57];
+        const double t63_58 = L[654] * D[58];
+        const double t63_59 = L[659] * D[59];
+        const double t63_60 = L[663] * D[60];
+        const double t63_61 = L[666] * D[61];
+        const double t63_62 = L[668] * D[62];
+        D[63] = Kx[18] - L[11] * t63_0 - L[27] * t63_2 - L[36] * t63_3 - L[46] * t63_4 - L[65] * t63_6 - L[78] * t63_7 - L[90] * t63_8 - L[103] * t63_9 - L[122] * t63_11 - L[148] * t63_13 - L[171] * t63_15 - L[181] * t63_16 - L[191] * t63_17 - L[202] * t63_18 - L[222] * t63_20 - L[234] * t63_21 - L[256] * t63_23 - L[270] * t63_24 - L[284] * t63_25 - L[306] * t63_27 - L[317] * t63_28 - L[327] * t63_29 - L[367] * t63_33 - L[410] * t63_37 - L[443] * t63_40 - L[498] * t63_45 - L[516] * t63_46 - L[533] * t63_47 - L[549] * t63_48 - L[564] * t63_49 - L[578] * t63_50 - L[591] * t63_51 - L[603] * t63_52 - L[614] * t63_53 - L[624] * t63_54 - L[633] * t63_55 - L[641] * t63_56 - L[648] * t63_57 - L[654] * t63_58 - L[659] * t63_59 - L[663] * t63_60 - L[666] * t63_61 - L[668] * t63_62;
+        D_inv[63] = 1. / D[63];
+        L[670] = (-L[12] * t63_0 - L[28] * t63_2 - L[37] * t63_3 - L[47] * t63_4 - L[91] * t63_8 - L[104] * t63_9 - L[123] * t63_11 - L[172] * t63_15 - L[203] * t63_18 - L[235] * t63_21 - L[257] * t63_23 - L[285] * t63_25 - L[307] * t63_27 - L[318] * t63_28 - L[368] * t63_33 - L[444] * t63_40 - L[499] * t63_45 - L[517] * t63_46 - L[534] * t63_47 - L[550] * t63_48 - L[565] * t63_49 - L[579] * t63_50 - L[592] * t63_51 - L[604] * t63_52 - L[615] * t63_53 - L[625] * t63_54 - L[634] * t63_55 - L[642] * t63_56 - L[649] * t63_57 - L[655] * t63_58 - L[660] * t63_59 - L[664] * t63_60 - L[667] * t63_61 - L[669] * t63_62) * D_inv[63];
+        const double t64_0 = L[12] * D[0];
+        const double t64_1 = L[21] * D[1];
+        const double t64_2 = L[28] * D[2];
+        const double t64_3 = L[37] * D[3];
+        const double t64_4 = L[47] * D[4];
+        const double t64_8 = L[91] * D[8];
+        const double t64_9 = L[104] * D[9];
+        const double t64_10 = L[113] * D[10];
+        const double t64_11 = L[123] * D[11];
+        const double t64_15 = L[172] * D[15];
+        const double t64_18 = L[203] * D[18];
+        const double t64_21 = L[235] * D[21];
+        const double t64_22 = L[244] * D[22];
+        const double t64_23 = L[257] * D[23];
+        const double t64_25 = L[285] * D[25];
+        const double t64_27 = L[307] * D[27];
+        const double t64_28 = L[318] * D[28];
+        const double t64_32 = L[358] * D[32];
+        const double t64_33 = L[368] * D[33];
+        const double t64_34 = L[377] * D[34];
+        const double t64_35 = L[387] * D[35];
+        const double t64_36 = L[399] * D[36];
+        const double t64_38 = L[422] * D[38];
+        const double t64_39 = L[434] * D[39];
+        const double t64_40 = L[444] * D[40];
+        const double t64_44 = L[480] * D[44];
+        const double t64_45 = L[499] * D[45];
+        const double t64_46 = L[517] * D[46];
+        const double t64_47 = L[534] * D[47];
+        const double t64_48 = L[550] * D[48];
+        const double t64_49 = L[565] * D[49];
+        const double t64_50 = L[579] * D[50];
+        const double t64_51 = L[592] * D[51];
+        const double t64_52 = L[604] * D[52];
+        const double t64_53 = L[615] * D[53];
+        const double t64_54 = L[625] * D[54];
+        const double t64_55 = L[634] * D[55];
+        const double t64_56 = L[642] * D[56];
+        const double t64_57 = L[649] * D[57];
+        const double t64_58 = L[655] * D[58];
+        const double t64_59 = L[660] * D[59];
+        const double t64_60 = L[664] * D[60];
+        const double t64_61 = L[667] * D[61];
+        const double t64_62 = L[669] * D[62];
+        const double t64_63 = L[670] * D[63];
+        D[64] = Kx[19] - L[12] * t64_0 - L[21] * t64_1 - L[28] * t64_2 - L[37] * t64_3 - L[47] * t64_4 - L[91] * t64_8 - L[104] * t64_9 - L[113] * t64_10 - L[123] * t64_11 - L[172] * t64_15 - L[203] * t64_18 - L[235] * t64_21 - L[244] * t64_22 - L[257] * t64_23 - L[285] * t64_25 - L[307] * t64_27 - L[318] * t64_28 - L[358] * t64_32 - L[368] * t64_33 - L[377] * t64_34 - L[387] * t64_35 - L[399] * t64_36 - L[422] * t64_38 - L[434] * t64_39 - L[444] * t64_40 - L[480] * t64_44 - L[499] * t64_45 - L[517] * t64_46 - L[534] * t64_47 - L[550] * t64_48 - L[565] * t64_49 - L[579] * t64_50 - L[592] * t64_51 - L[604] * t64_52 - L[615] * t64_53 - L[625] * t64_54 - L[634] * t64_55 - L[642] * t64_56 - L[649] * t64_57 - L[655] * t64_58 - L[660] * t64_59 - L[664] * t64_60 - L[667] * t64_61 - L[669] * t64_62 - L[670] * t64_63;
+        D_inv[64] = 1. / D[64];
+        for (int k = 0; k < dim; k++)
+        {
+            if (not std::isfinite(D_inv[k]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /* Overwrites x = b with the solution of K * x = b, requires a previous factor() */
+    inline void solve(double *x)
+    {
+        work[0] = x[20];
+        work[1] = x[21];
+        work[2] = x[22];
+        work[3] = x[23];
+        work[4] = x[24];
+        work[5] = x[45];
+        work[6] = x[25];
+        work[7] = x[26];
+        work[8] = x[27];
+        work[9] = x[28];
+        work[10] = x[29];
+        work[11] = x[30];
+        work[12] = x[31];
+        work[13] = x[32];
+        work[14] = x[33];
+        work[15] = x[34];
+        work[16] = x[35];
+        work[17] = x[36];
+        work[18] = x[37];
+        work[19] = x[38];
+        work[20] = x[39];
+        work[21] = x[40];
+        work[22] = x[41];
+        work[23] = x[42];
+        work[24] = x[43];
+        work[25] = x[44];
+        work[26] = x[46];
+        work[27] = x[47];
+        work[28] = x[48];
+        work[29] = x[49];
+        work[30] = x[50];
+        work[31] = x[51];
+        work[32] = x[52];
+        work[33] = x[53];
+        work[34] = x[54];
+        work[35] = x[55];
+        work[36] = x[56];
+        work[37] = x[57];
+        work[38] = x[58];
+        work[39] = x[59];
+        work[40] = x[60];
+        work[41] = x[61];
+        work[42] = x[62];
+        work[43] = x[63];
+        work[44] = x[64];
+        work[45] = x[0];
+        work[46] = x[1];
+        work[47] = x[2];
+        work[48] = x[3];
+        work[49] = x[4];
+        work[50] = x[5];
+        work[51] = x[6];
+        work[52] = x[7];
+        work[53] = x[8];
+        work[54] = x[9];
+        work[55] = x[10];
+        work[56] = x[11];
+        work[57] = x[12];
+        work[58] = x[13];
+        work[59] = x[14];
+        work[60] = x[15];
+        work[61] = x[16];
+        work[62] = x[17];
+        work[63] = x[18];
+        work[64] = x[19];
+        work[45] -= L[0] * work[0];
+        work[45] -= L[13] * work[1];
+        work[45] -= L[22] * work[2];
+        work[45] -= L[29] * work[3];
+        work[45] -= L[92] * work[9];
+        work[45] -= L[114] * work[11];
+        work[45] -= L[124] * work[12];
+        work[45] -= L[136] * work[13];
+        work[45] -= L[149] * work[14];
+        work[45] -= L[173] * work[16];
+        work[45] -= L[192] * work[18];
+        work[45] -= L[210] * work[20];
+        work[45] -= L[271] * work[25];
+        work[45] -= L[286] * work[26];
+        work[45] -= L[298] * work[27];
+        work[45] -= L[308] * work[28];
+        work[45] -= L[319] * work[29];
+        work[45] -= L[349] * work[32];
+        work[45] -= L[369] * work[34];
+        work[45] -= L[411] * work[38];
+        work[45] -= L[423] * work[39];
+        work[45] -= L[435] * work[40];
+        work[45] -= L[453] * work[42];
+        work[45] -= L[460] * work[43];
+        work[46] -= L[1] * work[0];
+        work[46] -= L[23] * work[2];
+        work[46] -= L[38] * work[4];
+        work[46] -= L[66] * work[7];
+        work[46] -= L[93] * work[9];
+        work[46] -= L[115] * work[11];
+        work[46] -= L[125] * work[12];
+        work[46] -= L[137] * work[13];
+        work[46] -= L[150] * work[14];
+        work[46] -= L[159] * work[15];
+        work[46] -= L[174] * work[16];
+        work[46] -= L[193] * work[18];
+        work[46] -= L[204] * work[19];
+        work[46] -= L[223] * work[21];
+        work[46] -= L[245] * work[23];
+        work[46] -= L[272] * work[25];
+        work[46] -= L[287] * work[26];
+        work[46] -= L[299] * work[27];
+        work[46] -= L[320] * work[29];
+        work[46] -= L[339] * work[31];
+        work[46] -= L[359] * work[33];
+        work[46] -= L[378] * work[35];
+        work[46] -= L[388] * work[36];
+        work[46] -= L[424] * work[39];
+        work[46] -= L[436] * work[40];
+        work[46] -= L[481] * work[45];
+        work[47] -= L[2] * work[0];
+        work[47] -= L[48] * work[5];
+        work[47] -= L[55] * work[6];
+        work[47] -= L[94] * work[9];
+        work[47] -= L[116] * work[11];
+        work[47] -= L[138] * work[13];
+        work[47] -= L[160] * work[15];
+        work[47] -= L[205] * work[19];
+        work[47] -= L[211] * work[20];
+        work[47] -= L[246] * work[23];
+        work[47] -= L[258] * work[24];
+        work[47] -= L[273] * work[25];
+        work[47] -= L[288] * work[26];
+        work[47] -= L[300] * work[27];
+        work[47] -= L[321] * work[29];
+        work[47] -= L[360] * work[33];
+        work[47] -= L[370] * work[34];
+        work[47] -= L[379] * work[35];
+        work[47] -= L[400] * work[37];
+        work[47] -= L[412] * work[38];
+        work[47] -= L[425] * work[39];
+        work[47] -= L[445] * work[41];
+        work[47] -= L[461] * work[43];
+        work[47] -= L[470] * work[44];
+        work[47] -= L[482] * work[45];
+        work[47] -= L[500] * work[46];
+        work[48] -= L[3] * work[0];
+        work[48] -= L[30] * work[3];
+        work[48] -= L[67] * work[7];
+        work[48] -= L[79] * work[8];
+        work[48] -= L[95] * work[9];
+        work[48] -= L[126] * work[12];
+        work[48] -= L[151] * work[14];
+        work[48] -= L[161] * work[15];
+        work[48] -= L[175] * work[16];
+        work[48] -= L[182] * work[17];
+        work[48] -= L[212] * work[20];
+        work[48] -= L[247] * work[23];
+        work[48] -= L[274] * work[25];
+        work[48] -= L[289] * work[26];
+        work[48] -= L[322] * work[29];
+        work[48] -= L[328] * work[30];
+        work[48] -= L[340] * work[31];
+        work[48] -= L[350] * work[32];
+        work[48] -= L[380] * work[35];
+        work[48] -= L[389] * work[36];
+        work[48] -= L[446] * work[41];
+        work[48] -= L[462] * work[43];
+        work[48] -= L[483] * work[45];
+        work[48] -= L[501] * work[46];
+        work[48] -= L[518] * work[47];
+        work[49] -= L[39] * work[4];
+        work[49] -= L[49] * work[5];
+        work[49] -= L[56] * work[6];
+        work[49] -= L[68] * work[7];
+        work[49] -= L[80] * work[8];
+        work[49] -= L[96] * work[9];
+        work[49] -= L[105] * work[10];
+        work[49] -= L[152] * work[14];
+        work[49] -= L[162] * work[15];
+        work[49] -= L[176] * work[16];
+        work[49] -= L[194] * work[18];
+        work[49] -= L[206] * work[19];
+        work[49] -= L[213] * work[20];
+        work[49] -= L[224] * work[21];
+        work[49] -= L[248] * work[23];
+        work[49] -= L[259] * work[24];
+        work[49] -= L[309] * work[28];
+        work[49] -= L[329] * work[30];
+        work[49] -= L[371] * work[34];
+        work[49] -= L[381] * work[35];
+        work[49] -= L[390] * work[36];
+        work[49] -= L[413] * work[38];
+        work[49] -= L[437] * work[40];
+        work[49] -= L[447] * work[41];
+        work[49] -= L[471] * work[44];
+        work[49] -= L[484] * work[45];
+        work[49] -= L[502] * work[46];
+        work[49] -= L[519] * work[47];
+        work[49] -= L[535] * work[48];
+        work[50] -= L[4] * work[0];
+        work[50] -= L[69] * work[7];
+        work[50] -= L[81] * work[8];
+        work[50] -= L[106] * work[10];
+        work[50] -= L[117] * work[11];
+        work[50] -= L[127] * work[12];
+        work[50] -= L[139] * work[13];
+        work[50] -= L[153] * work[14];
+        work[50] -= L[183] * work[17];
+        work[50] -= L[195] * work[18];
+        work[50] -= L[214] * work[20];
+        work[50] -= L[225] * work[21];
+        work[50] -= L[236] * work[22];
+        work[50] -= L[249] * work[23];
+        work[50] -= L[260] * work[24];
+        work[50] -= L[275] * work[25];
+        work[50] -= L[301] * work[27];
+        work[50] -= L[310] * work[28];
+        work[50] -= L[323] * work[29];
+        work[50] -= L[330] * work[30];
+        work[50] -= L[341] * work[31];
+        work[50] -= L[351] * work[32];
+        work[50] -= L[361] * work[33];
+        work[50] -= L[401] * work[37];
+        work[50] -= L[426] * work[39];
+        work[50] -= L[448] * work[41];
+        work[50] -= L[472] * work[44];
+        work[50] -= L[485] * work[45];
+        work[50] -= L[503] * work[46];
+        work[50] -= L[520] * work[47];
+        work[50] -= L[536] * work[48];
+        work[50] -= L[551] * work[49];
+        work[51] -= L[14] * work[1];
+        work[51] -= L[40] * work[4];
+        work[51] -= L[50] * work[5];
+        work[51] -= L[57] * work[6];
+        work[51] -= L[82] * work[8];
+        work[51] -= L[97] * work[9];
+        work[51] -= L[107] * work[10];
+        work[51] -= L[140] * work[13];
+        work[51] -= L[207] * work[19];
+        work[51] -= L[215] * work[20];
+        work[51] -= L[226] * work[21];
+        work[51] -= L[237] * work[22];
+        work[51] -= L[261] * work[24];
+        work[51] -= L[276] * work[25];
+        work[51] -= L[290] * work[26];
+        work[51] -= L[331] * work[30];
+        work[51] -= L[352] * work[32];
+        work[51] -= L[362] * work[33];
+        work[51] -= L[372] * work[34];
+        work[51] -= L[391] * work[36];
+        work[51] -= L[414] * work[38];
+        work[51] -= L[427] * work[39];
+        work[51] -= L[463] * work[43];
+        work[51] -= L[473] * work[44];
+        work[51] -= L[486] * work[45];
+        work[51] -= L[504] * work[46];
+        work[51] -= L[521] * work[47];
+        work[51] -= L[537] * work[48];
+        work[51] -= L[552] * work[49];
+        work[51] -= L[566] * work[50];
+        work[52] -= L[5] * work[0];
+        work[52] -= L[15] * work[1];
+        work[52] -= L[31] * work[3];
+        work[52] -= L[41] * work[4];
+        work[52] -= L[83] * work[8];
+        work[52] -= L[128] * work[12];
+        work[52] -= L[184] * work[17];
+        work[52] -= L[196] * work[18];
+        work[52] -= L[208] * work[19];
+        work[52] -= L[227] * work[21];
+        work[52] -= L[238] * work[22];
+        work[52] -= L[262] * work[24];
+        work[52] -= L[277] * work[25];
+        work[52] -= L[342] * work[31];
+        work[52] -= L[373] * work[34];
+        work[52] -= L[382] * work[35];
+        work[52] -= L[392] * work[36];
+        work[52] -= L[402] * work[37];
+        work[52] -= L[415] * work[38];
+        work[52] -= L[438] * work[40];
+        work[52] -= L[449] * work[41];
+        work[52] -= L[454] * work[42];
+        work[52] -= L[464] * work[43];
+        work[52] -= L[487] * work[45];
+        work[52] -= L[505] * work[46];
+        work[52] -= L[522] * work[47];
+        work[52] -= L[538] * work[48];
+        work[52] -= L[553] * work[49];
+        work[52] -= L[567] * work[50];
+        work[52] -= L[580] * work[51];
+        work[53] -= L[24] * work[2];
+        work[53] -= L[58] * work[6];
+        work[53] -= L[84] * work[8];
+        work[53] -= L[98] * work[9];
+        work[53] -= L[129] * work[12];
+        work[53] -= L[141] * work[13];
+        work[53] -= L[163] * work[15];
+        work[53] -= L[197] * work[18];
+        work[53] -= L[216] * work[20];
+        work[53] -= L[263] * work[24];
+        work[53] -= L[278] * work[25];
+        work[53] -= L[311] * work[28];
+        work[53] -= L[324] * work[29];
+        work[53] -= L[343] * work[31];
+        work[53] -= L[353] * work[32];
+        work[53] -= L[383] * work[35];
+        work[53] -= L[393] * work[36];
+        work[53] -= L[450] * work[41];
+        work[53] -= L[465] * work[43];
+        work[53] -= L[474] * work[44];
+        work[53] -= L[488] * work[45];
+        work[53] -= L[506] * work[46];
+        work[53] -= L[523] * work[47];
+        work[53] -= L[539] * work[48];
+        work[53] -= L[554] * work[49];
+        work[53] -= L[568] * work[50];
+        work[53] -= L[581] * work[51];
+        work[53] -= L[593] * work[52];
+        work[54] -= L[6] * work[0];
+        work[54] -= L[25] * work[2];
+        work[54] -= L[42] * work[4];
+        work[54] -= L[70] * work[7];
+        work[54] -= L[85] * work[8];
+        work[54] -= L[99] * work[9];
+        work[54] -= L[118] * work[11];
+        work[54] -= L[130] * work[12];
+        work[54] -= L[164] * work[15];
+        work[54] -= L[177] * work[16];
+        work[54] -= L[250] * work[23];
+        work[54] -= L[264] * work[24];
+        work[54] -= L[279] * work[25];
+        work[54] -= L[291] * work[26];
+        work[54] -= L[332] * work[30];
+        work[54] -= L[344] * work[31];
+        work[54] -= L[384] * work[35];
+        work[54] -= L[394] * work[36];
+        work[54] -= L[403] * work[37];
+        work[54] -= L[416] * work[38];
+        work[54] -= L[455] * work[42];
+        work[54] -= L[489] * work[45];
+        work[54] -= L[507] * work[46];
+        work[54] -= L[524] * work[47];
+        work[54] -= L[540] * work[48];
+        work[54] -= L[555] * work[49];
+        work[54] -= L[569] * work[50];
+        work[54] -= L[582] * work[51];
+        work[54] -= L[594] * work[52];
+        work[54] -= L[605] * work[53];
+        work[55] -= L[16] * work[1];
+        work[55] -= L[26] * work[2];
+        work[55] -= L[32] * work[3];
+        work[55] -= L[43] * work[4];
+        work[55] -= L[59] * work[6];
+        work[55] -= L[71] * work[7];
+        work[55] -= L[108] * work[10];
+        work[55] -= L[119] * work[11];
+        work[55] -= L[131] * work[12];
+        work[55] -= L[142] * work[13];
+        work[55] -= L[154] * work[14];
+        work[55] -= L[185] * work[17];
+        work[55] -= L[198] * work[18];
+        work[55] -= L[217] * work[20];
+        work[55] -= L[228] * work[21];
+        work[55] -= L[239] * work[22];
+        work[55] -= L[251] * work[23];
+        work[55] -= L[265] * work[24];
+        work[55] -= L[292] * work[26];
+        work[55] -= L[325] * work[29];
+        work[55] -= L[333] * work[30];
+        work[55] -= L[385] * work[35];
+        work[55] -= L[395] * work[36];
+        work[55] -= L[404] * work[37];
+        work[55] -= L[417] * work[38];
+        work[55] -= L[428] * work[39];
+        work[55] -= L[475] * work[44];
+        work[55] -= L[490] * work[45];
+        work[55] -= L[508] * work[46];
+        work[55] -= L[525] * work[47];
+        work[55] -= L[541] * work[48];
+        work[55] -= L[556] * work[49];
+        work[55] -= L[570] * work[50];
+        work[55] -= L[583] * work[51];
+        work[55] -= L[595] * work[52];
+        work[55] -= L[606] * work[53];
+        work[55] -= L[616] * work[54];
+        work[56] -= L[33] * work[3];
+        work[56] -= L[72] * work[7];
+        work[56] -= L[86] * work[8];
+        work[56] -= L[100] * work[9];
+        work[56] -= L[120] * work[11];
+        work[56] -= L[155] * work[14];
+        work[56] -= L[165] * work[15];
+        work[56] -= L[178] * work[16];
+        work[56] -= L[199] * work[18];
+        work[56] -= L[218] * work[20];
+        work[56] -= L[229] * work[21];
+        work[56] -= L[252] * work[23];
+        work[56] -= L[266] * work[24];
+        work[56] -= L[280] * work[25];
+        work[56] -= L[293] * work[26];
+        work[56] -= L[302] * work[27];
+        work[56] -= L[312] * work[28];
+        work[56] -= L[334] * work[30];
+        work[56] -= L[363] * work[33];
+        work[56] -= L[374] * work[34];
+        work[56] -= L[396] * work[36];
+        work[56] -= L[429] * work[39];
+        work[56] -= L[439] * work[40];
+        work[56] -= L[456] * work[42];
+        work[56] -= L[466] * work[43];
+        work[56] -= L[476] * work[44];
+        work[56] -= L[491] * work[45];
+        work[56] -= L[509] * work[46];
+        work[56] -= L[526] * work[47];
+        work[56] -= L[542] * work[48];
+        work[56] -= L[557] * work[49];
+        work[56] -= L[571] * work[50];
+        work[56] -= L[584] * work[51];
+        work[56] -= L[596] * work[52];
+        work[56] -= L[607] * work[53];
+        work[56] -= L[617] * work[54];
+        work[56] -= L[626] * work[55];
+        work[57] -= L[7] * work[0];
+        work[57] -= L[17] * work[1];
+        work[57] -= L[34] * work[3];
+        work[57] -= L[51] * work[5];
+        work[57] -= L[60] * work[6];
+        work[57] -= L[73] * work[7];
+        work[57] -= L[87] * work[8];
+        work[57] -= L[143] * work[13];
+        work[57] -= L[166] * work[15];
+        work[57] -= L[186] * work[17];
+        work[57] -= L[209] * work[19];
+        work[57] -= L[230] * work[21];
+        work[57] -= L[267] * work[24];
+        work[57] -= L[281] * work[25];
+        work[57] -= L[294] * work[26];
+        work[57] -= L[313] * work[28];
+        work[57] -= L[326] * work[29];
+        work[57] -= L[335] * work[30];
+        work[57] -= L[354] * work[32];
+        work[57] -= L[364] * work[33];
+        work[57] -= L[375] * work[34];
+        work[57] -= L[405] * work[37];
+        work[57] -= L[418] * work[38];
+        work[57] -= L[430] * work[39];
+        work[57] -= L[492] * work[45];
+        work[57] -= L[510] * work[46];
+        work[57] -= L[527] * work[47];
+        work[57] -= L[543] * work[48];
+        work[57] -= L[558] * work[49];
+        work[57] -= L[572] * work[50];
+        work[57] -= L[585] * work[51];
+        work[57] -= L[597] * work[52];
+        work[57] -= L[608] * work[53];
+        work[57] -= L[618] * work[54];
+        work[57] -= L[627] * work[55];
+        work[57] -= L[635] * work[56];
+        work[58] -= L[8] * work[0];
+        work[58] -= L[35] * work[3];
+        work[58] -= L[44] * work[4];
+        work[58] -= L[52] * work[5];
+        work[58] -= L[61] * work[6];
+        work[58] -= L[74] * work[7];
+        work[58] -= L[109] * work[10];
+        work[58] -= L[144] * work[13];
+        work[58] -= L[187] * work[17];
+        work[58] -= L[219] * work[20];
+        work[58] -= L[240] * work[22];
+        work[58] -= L[253] * work[23];
+        work[58] -= L[268] * work[24];
+        work[58] -= L[314] * work[28];
+        work[58] -= L[345] * work[31];
+        work[58] -= L[365] * work[33];
+        work[58] -= L[386] * work[35];
+        work[58] -= L[406] * work[37];
+        work[58] -= L[457] * work[42];
+        work[58] -= L[477] * work[44];
+        work[58] -= L[493] * work[45];
+        work[58] -= L[511] * work[46];
+        work[58] -= L[528] * work[47];
+        work[58] -= L[544] * work[48];
+        work[58] -= L[559] * work[49];
+        work[58] -= L[573] * work[50];
+        work[58] -= L[586] * work[51];
+        work[58] -= L[598] * work[52];
+        work[58] -= L[609] * work[53];
+        work[58] -= L[619] * work[54];
+        work[58] -= L[628] * work[55];
+        work[58] -= L[636] * work[56];
+        work[58] -= L[643] * work[57];
+        work[59] -= L[9] * work[0];
+        work[59] -= L[18] * work[1];
+        work[59] -= L[53] * work[5];
+        work[59] -= L[62] * work[6];
+        work[59] -= L[75] * work[7];
+        work[59] -= L[121] * work[11];
+        work[59] -= L[132] * work[12];
+        work[59] -= L[145] * work[13];
+        work[59] -= L[167] * work[15];
+        work[59] -= L[179] * work[16];
+        work[59] -= L[188] * work[17];
+        work[59] -= L[200] * work[18];
+        work[59] -= L[220] * work[20];
+        work[59] -= L[254] * work[23];
+        work[59] -= L[282] * work[25];
+        work[59] -= L[295] * work[26];
+        work[59] -= L[303] * work[27];
+        work[59] -= L[336] * work[30];
+        work[59] -= L[376] * work[34];
+        work[59] -= L[407] * work[37];
+        work[59] -= L[419] * work[38];
+        work[59] -= L[431] * work[39];
+        work[59] -= L[440] * work[40];
+        work[59] -= L[451] * work[41];
+        work[59] -= L[467] * work[43];
+        work[59] -= L[478] * work[44];
+        work[59] -= L[494] * work[45];
+        work[59] -= L[512] * work[46];
+        work[59] -= L[529] * work[47];
+        work[59] -= L[545] * work[48];
+        work[59] -= L[560] * work[49];
+        work[59] -= L[574] * work[50];
+        work[59] -= L[587] * work[51];
+        work[59] -= L[599] * work[52];
+        work[59] -= L[610] * work[53];
+        work[59] -= L[620] * work[54];
+        work[59] -= L[629] * work[55];
+        work[59] -= L[637] * work[56];
+        work[59] -= L[644] * work[57];
+        work[59] -= L[650] * work[58];
+        work[60] -= L[10] * work[0];
+        work[60] -= L[19] * work[1];
+        work[60] -= L[88] * work[8];
+        work[60] -= L[101] * work[9];
+        work[60] -= L[110] * work[10];
+        work[60] -= L[133] * work[12];
+        work[60] -= L[146] * work[13];
+        work[60] -= L[156] * work[14];
+        work[60] -= L[168] * work[15];
+        work[60] -= L[189] * work[17];
+        work[60] -= L[231] * work[21];
+        work[60] -= L[241] * work[22];
+        work[60] -= L[304] * work[27];
+        work[60] -= L[337] * work[30];
+        work[60] -= L[346] * work[31];
+        work[60] -= L[355] * work[32];
+        work[60] -= L[366] * work[33];
+        work[60] -= L[432] * work[39];
+        work[60] -= L[441] * work[40];
+        work[60] -= L[479] * work[44];
+        work[60] -= L[495] * work[45];
+        work[60] -= L[513] * work[46];
+        work[60] -= L[530] * work[47];
+        work[60] -= L[546] * work[48];
+        work[60] -= L[561] * work[49];
+        work[60] -= L[575] * work[50];
+        work[60] -= L[588] * work[51];
+        work[60] -= L[600] * work[52];
+        work[60] -= L[611] * work[53];
+        work[60] -= L[621] * work[54];
+        work[60] -= L[630] * work[55];
+        work[60] -= L[638] * work[56];
+        work[60] -= L[645] * work[57];
+        work[60] -= L[651] * work[58];
+        work[60] -= L[656] * work[59];
+        work[61] -= L[45] * work[4];
+        work[61] -= L[63] * work[6];
+        work[61] -= L[76] * work[7];
+        work[61] -= L[89] * work[8];
+        work[61] -= L[102] * work[9];
+        work[61] -= L[111] * work[10];
+        work[61] -= L[134] * work[12];
+        work[61] -= L[157] * work[14];
+        work[61] -= L[169] * work[15];
+        work[61] -= L[180] * work[16];
+        work[61] -= L[190] * work[17];
+        work[61] -= L[201] * work[18];
+        work[61] -= L[232] * work[21];
+        work[61] -= L[242] * work[22];
+        work[61] -= L[255] * work[23];
+        work[61] -= L[283] * work[25];
+        work[61] -= L[296] * work[26];
+        work[61] -= L[305] * work[27];
+        work[61] -= L[315] * work[28];
+        work[61] -= L[347] * work[31];
+        work[61] -= L[356] * work[32];
+        work[61] -= L[397] * work[36];
+        work[61] -= L[408] * work[37];
+        work[61] -= L[420] * work[38];
+        work[61] -= L[442] * work[40];
+        work[61] -= L[458] * work[42];
+        work[61] -= L[468] * work[43];
+        work[61] -= L[496] * work[45];
+        work[61] -= L[514] * work[46];
+        work[61] -= L[531] * work[47];
+        work[61] -= L[547] * work[48];
+        work[61] -= L[562] * work[49];
+        work[61] -= L[576] * work[50];
+        work[61] -= L[589] * work[51];
+        work[61] -= L[601] * work[52];
+        work[61] -= L[612] * work[53];
+        work[61] -= L[622] * work[54];
+        work[61] -= L[631] * work[55];
+        work[61] -= L[639] * work[56];
+        work[61] -= L[646] * work[57];
+        work[61] -= L[652] * work[58];
+        work[61] -= L[657] * work[59];
+        work[61] -= L[661] * work[60];
+        work[62] -= L[20] * work[1];
+        work[62] -= L[54] * work[5];
+        work[62] -= L[64] * work[6];
+        work[62] -= L[77] * work[7];
+        work[62] -= L[112] * work[10];
+        work[62] -= L[135] * work[12];
+        work[62] -= L[147] * work[13];
+        work[62] -= L[158] * work[14];
+        work[62] -= L[170] * work[15];
+        work[62] -= L[221] * work[20];
+        work[62] -= L[233] * work[21];
+        work[62] -= L[243] * work[22];
+        work[62] -= L[269] * work[24];
+        work[62] -= L[297] * work[26];
+        work[62] -= L[316] * work[28];
+        work[62] -= L[338] * work[30];
+        work[62] -= L[348] * work[31];
+        work[62] -= L[357] * work[32];
+        work[62] -= L[398] * work[36];
+        work[62] -= L[409] * work[37];
+        work[62] -= L[421] * work[38];
+        work[62] -= L[433] * work[39];
+        work[62] -= L[452] * work[41];
+        work[62] -= L[459] * work[42];
+        work[62] -= L[469] * work[43];
+        work[62] -= L[497] * work[45];
+        work[62] -= L[515] * work[46];
+        work[62] -= L[532] * work[47];
+        work[62] -= L[548] * work[48];
+        work[62] -= L[563] * work[49];
+        work[62] -= L[577] * work[50];
+        work[62] -= L[590] * work[51];
+        work[62] -= L[602] * work[52];
+        work[62] -= L[613] * work[53];
+        work[62] -= L[623] * work[54];
+        work[62] -= L[632] * work[55];
+        work[62] -= L[640] * work[56];
+        work[62] -= L[647] * work[57];
+        work[62] -= L[653] * work[58];
+        work[62] -= L[658] * work[59];
+        work[62] -= L[662] * work[60];
+        work[62] -= L[665] * work[61];
+        work[63] -= L[11] * work[0];
+        work[63] -= L[27] * work[2];
+        work[63] -= L[36] * work[3];
+        work[63] -= L[46] * work[4];
+        work[63] -= L[65] * work[6];
+        work[63] -= L[78] * work[7];
+        work[63] -= L[90] * work[8];
+        work[63] -= L[103] * work[9];
+        work[63] -= L[122] * work[11];
+        work[63] -= L[148] * work[13];
+        work[63] -= L[171] * work[15];
+        work[63] -= L[181] * work[16];
+        work[63] -= L[191] * work[17];
+        work[63] -= L[202] * work[18];
+        work[63] -= L[222] * work[20];
+        work[63] -= L[234] * work[21];
+        work[63] -= L[256] * work[23];
+        work[63] -= L[270] * work[24];
+        work[63] -= L[284] * work[25];
+        work[63] -= L[306] * work[27];
+        work[63] -= L[317] * work[28];
+        work[63] -= L[327] * work[29];
+        work[63] -= L[367] * work[33];
+        work[63] -= L[410] * work[37];
+        work[63] -= L[443] * work[40];
+        work[63] -= L[498] * work[45];
+        work[63] -= L[516] * work[46];
+        work[63] -= L[533] * work[47];
+        work[63] -= L[549] * work[48];
+        work[63] -= L[564] * work[49];
+        work[63] -= L[578] * work[50];
+        work[63] -= L[591] * work[51];
+        work[63] -= L[603] * work[52];
+        work[63] -= L[614] * work[53];
+        work[63] -= L[624] * work[54];
+        work[63] -= L[633] * work[55];
+        work[63] -= L[641] * work[56];
+        work[63] -= L[648] * work[57];
+        work[63] -= L[654] * work[58];
+        work[63] -= L[659] * work[59];
+        work[63] -= L[663] * work[60];
+        work[63] -= L[666] * work[61];
+        work[63] -= L[668] * work[62];
+        work[64] -= L[12] * work[0];
+        work[64] -= L[21] * work[1];
+        work[64] -= L[28] * work[2];
+        work[64] -= L[37] * work[3];
+        work[64] -= L[47] * work[4];
+        work[64] -= L[91] * work[8];
+        work[64] -= L[104] * work[9];
+        work[64] -= L[113] * work[10];
+        work[64] -= L[123] * work[11];
+        work[64] -= L[172] * work[15];
+        work[64] -= L[203] * work[18];
+        work[64] -= L[235] * work[21];
+        work[64] -= L[244] * work[22];
+        work[64] -= L[257] * work[23];
+        work[64] -= L[285] * work[25];
+        work[64] -= L[307] * work[27];
+        work[64] -= L[318] * work[28];
+        work[64] -= L[358] * work[32];
+        work[64] -= L[368] * work[33];
+        work[64] -= L[377] * work[34];
+        work[64] -= L[387] * work[35];
+        work[64] -= L[399] * work[36];
+        work[64] -= L[422] * work[38];
+        work[64] -= L[434] * work[39];
+        work[64] -= L[444] * work[40];
+        work[64] -= L[480] * work[44];
+        work[64] -= L[499] * work[45];
+        work[64] -= L[517] * work[46];
+        work[64] -= L[534] * work[47];
+        work[64] -= L[550] * work[48];
+        work[64] -= L[565] * work[49];
+        work[64] -= L[579] * work[50];
+        work[64] -= L[592] * work[51];
+        work[64] -= L[604] * work[52];
+        work[64] -= L[615] * work[53];
+        work[64] -= L[625] * work[54];
+        work[64] -= L[634] * work[55];
+        work[64] -= L[642] * work[56];
+        work[64] -= L[649] * work[57];
+        work[64] -= L[655] * work[58];
+        work[64] -= L[660] * work[59];
+        work[64] -= L[664] * work[60];
+        work[64] -= L[667] * work[61];
+        work[64] -= L[669] * work[62];
+        work[64] -= L[670] * work[63];
+        work[0] *= D_inv[0];
+        work[1] *= D_inv[1];
+        work[2] *= D_inv[2];
+        work[3] *= D_inv[3];
+        work[4] *= D_inv[4];
+        work[5] *= D_inv[5];
+        work[6] *= D_inv[6];
+        work[7] *= D_inv[7];
+        work[8] *= D_inv[8];
+        work[9] *= D_inv[9];
+        work[10] *= D_inv[10];
+        work[11] *= D_inv[11];
+        work[12] *= D_inv[12];
+        work[13] *= D_inv[13];
+        work[14] *= D_inv[14];
+        work[15] *= D_inv[15];
+        work[16] *= D_inv[16];
+        work[17] *= D_inv[17];
+        work[18] *= D_inv[18];
+        work[19] *= D_inv[19];
+        work[20] *= D_inv[20];
+        work[21] *= D_inv[21];
+        work[22] *= D_inv[22];
+        work[23] *= D_inv[23];
+        work[24] *= D_inv[24];
+        work[25] *= D_inv[25];
+        work[26] *= D_inv[26];
+        work[27] *= D_inv[27];
+        work[28] *= D_inv[28];
+        work[29] *= D_inv[29];
+        work[30] *= D_inv[30];
+        work[31] *= D_inv[31];
+        work[32] *= D_inv[32];
+        work[33] *= D_inv[33];
+        work[34] *= D_inv[34];
+        work[35] *= D_inv[35];
+        work[36] *= D_inv[36];
+        work[37] *= D_inv[37];
+        work[38] *= D_inv[38];
+        work[39] *= D_inv[39];
+        work[40] *= D_inv[40];
+        work[41] *= D_inv[41];
+        work[42] *= D_inv[42];
+        work[43] *= D_inv[43];
+        work[44] *= D_inv[44];
+        work[45] *= D_inv[45];
+        work[46] *= D_inv[46];
+        work[47] *= D_inv[47];
+        work[48] *= D_inv[48];
+        work[49] *= D_inv[49];
+        work[50] *= D_inv[50];
+        work[51] *= D_inv[51];
+        work[52] *= D_inv[52];
+        work[53] *= D_inv[53];
+        work[54] *= D_inv[54];
+        work[55] *= D_inv[55];
+        work[56] *= D_inv[56];
+        work[57] *= D_inv[57];
+        work[58] *= D_inv[58];
+        work[59] *= D_inv[59];
+        work[60] *= D_inv[60];
+        work[61] *= D_inv[61];
+        work[62] *= D_inv[62];
+        work[63] *= D_inv[63];
+        work[64] *= D_inv[64];
+        work[63] -= L[670] * work[64];
+        work[62] -= L[668] * work[63];
+        work[62] -= L[669] * work[64];
+        work[61] -= L[665] * work[62];
+        work[61] -= L[666] * work[63];
+        work[61] -= L[667] * work[64];
+        work[60] -= L[661] * work[61];
+        work[60] -= L[662] * work[62];
+        work[60] -= L[663] * work[63];
+        work[60] -= L[664] * work[64];
+        work[59] -= L[656] * work[60];
+        work[59] -= L[657] * work[61];
+        work[59] -= L[658] * work[62];
+        work[59] -= L[659] * work[63];
+        work[59] -= L[660] * work[64];
+        work[58] -= L[650] * work[59];
+        work[58] -= L[651] * work[60];
+        work[58] -= L[652] * work[61];
+        work[58] -= L[653] * work[62];
+        work[58] -= L[654] * work[63];
+        work[58] -= L[655] * work[64];
+        work[57] -= L[643] * work[58];
+        work[57] -= L[644] * work[59];
+        work[57] -= L[645] * work[60];
+        work[57] -= L[646] * work[61];
+        work[57] -= L[647] * work[62];
+        work[57] -= L[648] * work[63];
+        work[57] -= L[649] * work[64];
+        work[56] -= L[635] * work[57];
+        work[56] -= L[636] * work[58];
+        work[56] -= L[637] * work[59];
+        work[56] -= L[638] * work[60];
+        work[56] -= L[639] * work[61];
+        work[56] -= L[640] * work[62];
+        work[56] -= L[641] * work[63];
+        work[56] -= L[642] * work[64];
+        work[55] -= L[626] * work[56];
+        work[55] -= L[627] * work[57];
+        work[55] -= L[628] * work[58];
+        work[55] -= L[629] * work[59];
+        work[55] -= L[630] * work[60];
+        work[55] -= L[631] * work[61];
+        work[55] -= L[632] * work[62];
+        work[55] -= L[633] * work[63];
+        work[55] -= L[634] * work[64];
+        work[54] -= L[616] * work[55];
+        work[54] -= L[617] * work[56];
+        work[54] -= L[618] * work[57];
+        work[54] -= L[619] * work[58];
+        work[54] -= L[620] * work[59];
+        work[54] -= L[621] * work[60];
+        work[54] -= L[622] * work[61];
+        work[54] -= L[623] * work[62];
+        work[54] -= L[624] * work[63];
+        work[54] -= L[625] * work[64];
+        work[53] -= L[605] * work[54];
+        work[53] -= L[606] * work[55];
+        work[53] -= L[607] * work[56];
+        work[53] -= L[608] * work[57];
+        work[53] -= L[609] * work[58];
+        work[53] -= L[610] * work[59];
+        work[53] -= L[611] * work[60];
+        work[53] -= L[612] * work[61];
+        work[53] -= L[613] * work[62];
+        work[53] -= L[614] * work[63];
+        work[53] -= L[615] * work[64];
+        work[52] -= L[593] * work[53];
+        work[52] -= L[594] * work[54];
+        work[52] -= L[595] * work[55];
+        work[52] -= L[596] * work[56];
+        work[52] -= L[597] * work[57];
+        work[52] -= L[598] * work[58];
+        work[52] -= L[599] * work[59];
+        work[52] -= L[600] * work[60];
+        work[52] -= L[601] * work[61];
+        work[52] -= L[602] * work[62];
+        work[52] -= L[603] * work[63];
+        work[52] -= L[604] * work[64];
+        work[51] -= L[580] * work[52];
+        work[51] -= L[581] * work[53];
+        work[51] -= L[582] * work[54];
+        work[51] -= L[583] * work[55];
+        work[51] -= L[584] * work[56];
+        work[51] -= L[585] * work[57];
+        work[51] -= L[586] * work[58];
+        work[51] -= L[587] * work[59];
+        work[51] -= L[588] * work[60];
+        work[51] -= L[589] * work[61];
+        work[51] -= L[590] * work[62];
+        work[51] -= L[591] * work[63];
+        work[51] -= L[592] * work[64];
+        work[50] -= L[566] * work[51];
+        work[50] -= L[567] * work[52];
+        work[50] -= L[568] * work[53];
+        work[50] -= L[569] * work[54];
+        work[50] -= L[570] * work[55];
+        work[50] -= L[571] * work[56];
+        work[50] -= L[572] * work[57];
+        work[50] -= L[573] * work[58];
+        work[50] -= L[574] * work[59];
+        work[50] -= L[575] * work[60];
+        work[50] -= L[576] * work[61];
+        work[50] -= L[577] * work[62];
+        work[50] -= L[578] * work[63];
+        work[50] -= L[579] * work[64];
+        work[49] -= L[551] * work[50];
+        work[49] -= L[552] * work[51];
+        work[49] -= L[553] * work[52];
+        work[49] -= L[554] * work[53];
+        work[49] -= L[555] * work[54];
+        work[49] -= L[556] * work[55];
+        work[49] -= L[557] * work[56];
+        work[49] -= L[558] * work[57];
+        work[49] -= L[559] * work[58];
+        work[49] -= L[560] * work[59];
+        work[49] -= L[561] * work[60];
+        work[49] -= L[562] * work[61];
+        work[49] -= L[563] * work[62];
+        work[49] -= L[564] * work[63];
+        work[49] -= L[565] * work[64];
+        work[48] -= L[535] * work[49];
+        work[48] -= L[536] * work[50];
+        work[48] -= L[537] * work[51];
+        work[48] -= L[538] * work[52];
+        work[48] -= L[539] * work[53];
+        work[48] -= L[540] * work[54];
+        work[48] -= L[541] * work[55];
+        work[48] -= L[542] * work[56];
+        work[48] -= L[543] * work[57];
+        work[48] -= L[544] * work[58];
+        work[48] -= L[545] * work[59];
+        work[48] -= L[546] * work[60];
+        work[48] -= L[547] * work[61];
+        work[48] -= L[548] * work[62];
+        work[48] -= L[549] * work[63];
+        work[48] -= L[550] * work[64];
+        work[47] -= L[518] * work[48];
+        work[47] -= L[519] * work[49];
+        work[47] -= L[520] * work[50];
+        work[47] -= L[521] * work[51];
+        work[47] -= L[522] * work[52];
+        work[47] -= L[523] * work[53];
+        work[47] -= L[524] * work[54];
+        work[47] -= L[525] * work[55];
+        work[47] -= L[526] * work[56];
+        work[47] -= L[527] * work[57];
+        work[47] -= L[528] * work[58];
+        work[47] -= L[529] * work[59];
+        work[47] -= L[530] * work[60];
+        work[47] -= L[531] * work[61];
+        work[47] -= L[532] * work[62];
+        work[47] -= L[533] * work[63];
+        work[47] -= L[534] * work[64];
+        work[46] -= L[500] * work[47];
+        work[46] -= L[501] * work[48];
+        work[46] -= L[502] * work[49];
+        work[46] -= L[503] * work[50];
+        work[46] -= L[504] * work[51];
+        work[46] -= L[505] * work[52];
+        work[46] -= L[506] * work[53];
+        work[46] -= L[507] * work[54];
+        work[46] -= L[508] * work[55];
+        work[46] -= L[509] * work[56];
+        work[46] -= L[510] * work[57];
+        work[46] -= L[511] * work[58];
+        work[46] -= L[512] * work[59];
+        work[46] -= L[513] * work[60];
+        work[46] -= L[514] * work[61];
+        work[46] -= L[515] * work[62];
+        work[46] -= L[516] * work[63];
+        work[46] -= L[517] * work[64];
+        work[45] -= L[481] * work[46];
+        work[45] -= L[482] * work[47];
+        work[45] -= L[483] * work[48];
+        work[45] -= L[484] * work[49];
+        work[45] -= L[485] * work[50];
+        work[45] -= L[486] * work[51];
+        work[45] -= L[487] * work[52];
+        work[45] -= L[488] * work[53];
+        work[45] -= L[489] * work[54];
+        work[45] -= L[490] * work[55];
+        work[45] -= L[491] * work[56];
+        work[45] -= L[492] * work[57];
+        work[45] -= L[493] * work[58];
+        work[45] -= L[494] * work[59];
+        work[45] -= L[495] * work[60];
+        work[45] -= L[496] * work[61];
+        work[45] -= L[497] * work[62];
+        work[45] -= L[498] * work[63];
+        work[45] -= L[499] * work[64];
+        work[44] -= L[470] * work[47];
+        work[44] -= L[471] * work[49];
+        work[44] -= L[472] * work[50];
+        work[44] -= L[473] * work[51];
+        work[44] -= L[474] * work[53];
+        work[44] -= L[475] * work[55];
+        work[44] -= L[476] * work[56];
+        work[44] -= L[477] * work[58];
+        work[44] -= L[478] * work[59];
+        work[44] -= L[479] * work[60];
+        work[44] -= L[480] * work[64];
+        work[43] -= L[460] * work[45];
+        work[43] -= L[461] * work[47];
+        work[43] -= L[462] * work[48];
+        work[43] -= L[463] * work[51];
+        work[43] -= L[464] * work[52];
+        work[43] -= L[465] * work[53];
+        work[43] -= L[466] * work[56];
+        work[43] -= L[467] * work[59];
+        work[43] -= L[468] * work[61];
+        work[43] -= L[469] * work[62];
+        work[42] -= L[453] * work[45];
+        work[42] -= L[454] * work[52];
+        work[42] -= L[455] * work[54];
+        work[42] -= L[456] * work[56];
+        work[42] -= L[457] * work[58];
+        work[42] -= L[458] * work[61];
+        work[42] -= L[459] * work[62];
+        work[41] -= L[445] * work[47];
+        work[41] -= L[446] * work[48];
+        work[41] -= L[447] * work[49];
+        work[41] -= L[448] * work[50];
+        work[41] -= L[449] * work[52];
+        work[41] -= L[450] * work[53];
+        work[41] -= L[451] * work[59];
+        work[41] -= L[452] * work[62];
+        work[40] -= L[435] * work[45];
+        work[40] -= L[436] * work[46];
+        work[40] -= L[437] * work[49];
+        work[40] -= L[438] * work[52];
+        work[40] -= L[439] * work[56];
+        work[40] -= L[440] * work[59];
+        work[40] -= L[441] * work[60];
+        work[40] -= L[442] * work[61];
+        work[40] -= L[443] * work[63];
+        work[40] -= L[444] * work[64];
+        work[39] -= L[423] * work[45];
+        work[39] -= L[424] * work[46];
+        work[39] -= L[425] * work[47];
+        work[39] -= L[426] * work[50];
+        work[39] -= L[427] * work[51];
+        work[39] -= L[428] * work[55];
+        work[39] -= L[429] * work[56];
+        work[39] -= L[430] * work[57];
+        work[39] -= L[431] * work[59];
+        work[39] -= L[432] * work[60];
+        work[39] -= L[433] * work[62];
+        work[39] -= L[434] * work[64];
+        work[38] -= L[411] * work[45];
+        work[38] -= L[412] * work[47];
+        work[38] -= L[413] * work[49];
+        work[38] -= L[414] * work[51];
+        work[38] -= L[415] * work[52];
+        work[38] -= L[416] * work[54];
+        work[38] -= L[417] * work[55];
+        work[38] -= L[418] * work[57];
+        work[38] -= L[419] * work[59];
+        work[38] -= L[420] * work[61];
+        work[38] -= L[421] * work[62];
+        work[38] -= L[422] * work[64];
+        work[37] -= L[400] * work[47];
+        work[37] -= L[401] * work[50];
+        work[37] -= L[402] * work[52];
+        work[37] -= L[403] * work[54];
+        work[37] -= L[404] * work[55];
+        work[37] -= L[405] * work[57];
+        work[37] -= L[406] * work[58];
+        work[37] -= L[407] * work[59];
+        work[37] -= L[408] * work[61];
+        work[37] -= L[409] * work[62];
+        work[37] -= L[410] * work[63];
+        work[36] -= L[388] * work[46];
+        work[36] -= L[389] * work[48];
+        work[36] -= L[390] * work[49];
+        work[36] -= L[391] * work[51];
+        work[36] -= L[392] * work[52];
+        work[36] -= L[393] * work[53];
+        work[36] -= L[394] * work[54];
+        work[36] -= L[395] * work[55];
+        work[36] -= L[396] * work[56];
+        work[36] -= L[397] * work[61];
+        work[36] -= L[398] * work[62];
+        work[36] -= L[399] * work[64];
+        work[35] -= L[378] * work[46];
+        work[35] -= L[379] * work[47];
+        work[35] -= L[380] * work[48];
+        work[35] -= L[381] * work[49];
+        work[35] -= L[382] * work[52];
+        work[35] -= L[383] * work[53];
+        work[35] -= L[384] * work[54];
+        work[35] -= L[385] * work[55];
+        work[35] -= L[386] * work[58];
+        work[35] -= L[387] * work[64];
+        work[34] -= L[369] * work[45];
+        work[34] -= L[370] * work[47];
+        work[34] -= L[371] * work[49];
+        work[34] -= L[372] * work[51];
+        work[34] -= L[373] * work[52];
+        work[34] -= L[374] * work[56];
+        work[34] -= L[375] * work[57];
+        work[34] -= L[376] * work[59];
+        work[34] -= L[377] * work[64];
+        work[33] -= L[359] * work[46];
+        work[33] -= L[360] * work[47];
+        work[33] -= L[361] * work[50];
+        work[33] -= L[362] * work[51];
+        work[33] -= L[363] * work[56];
+        work[33] -= L[364] * work[57];
+        work[33] -= L[365] * work[58];
+        work[33] -= L[366] * work[60];
+        work[33] -= L[367] * work[63];
+        work[33] -= L[368] * work[64];
+        work[32] -= L[349] * work[45];
+        work[32] -= L[350] * work[48];
+        work[32] -= L[351] * work[50];
+        work[32] -= L[352] * work[51];
+        work[32] -= L[353] * work[53];
+        work[32] -= L[354] * work[57];
+        work[32] -= L[355] * work[60];
+        work[32] -= L[356] * work[61];
+        work[32] -= L[357] * work[62];
+        work[32] -= L[358] * work[64];
+        work[31] -= L[339] * work[46];
+        work[31] -= L[340] * work[48];
+        work[31] -= L[341] * work[50];
+        work[31] -= L[342] * work[52];
+        work[31] -= L[343] * work[53];
+        work[31] -= L[344] * work[54];
+        work[31] -= L[345] * work[58];
+        work[31] -= L[346] * work[60];
+        work[31] -= L[347] * work[61];
+        work[31] -= L[348] * work[62];
+        work[30] -= L[328] * work[48];
+        work[30] -= L[329] * work[49];
+        work[30] -= L[330] * work[50];
+        work[30] -= L[331] * work[51];
+        work[30] -= L[332] * work[54];
+        work[30] -= L[333] * work[55];
+        work[30] -= L[334] * work[56];
+        work[30] -= L[335] * work[57];
+        work[30] -= L[336] * work[59];
+        work[30] -= L[337] * work[60];
+        work[30] -= L[338] * work[62];
+        work[29] -= L[319] * work[45];
+        work[29] -= L[320] * work[46];
+        work[29] -= L[321] * work[47];
+        work[29] -= L[322] * work[48];
+        work[29] -= L[323] * work[50];
+        work[29] -= L[324] * work[53];
+        work[29] -= L[325] * work[55];
+        work[29] -= L[326] * work[57];
+        work[29] -= L[327] * work[63];
+        work[28] -= L[308] * work[45];
+        work[28] -= L[309] * work[49];
+        work[28] -= L[310] * work[50];
+        work[28] -= L[311] * work[53];
+        work[28] -= L[312] * work[56];
+        work[28] -= L[313] * work[57];
+        work[28] -= L[314] * work[58];
+        work[28] -= L[315] * work[61];
+        work[28] -= L[316] * work[62];
+        work[28] -= L[317] * work[63];
+        work[28] -= L[318] * work[64];
+        work[27] -= L[298] * work[45];
+        work[27] -= L[299] * work[46];
+        work[27] -= L[300] * work[47];
+        work[27] -= L[301] * work[50];
+        work[27] -= L[302] * work[56];
+        work[27] -= L[303] * work[59];
+        work[27] -= L[304] * work[60];
+        work[27] -= L[305] * work[61];
+        work[27] -= L[306] * work[63];
+        work[27] -= L[307] * work[64];
+        work[26] -= L[286] * work[45];
+        work[26] -= L[287] * work[46];
+        work[26] -= L[288] * work[47];
+        work[26] -= L[289] * work[48];
+        work[26] -= L[290] * work[51];
+        work[26] -= L[291] * work[54];
+        work[26] -= L[292] * work[55];
+        work[26] -= L[293] * work[56];
+        work[26] -= L[294] * work[57];
+        work[26] -= L[295] * work[59];
+        work[26] -= L[296] * work[61];
+        work[26] -= L[297] * work[62];
+        work[25] -= L[271] * work[45];
+        work[25] -= L[272] * work[46];
+        work[25] -= L[273] * work[47];
+        work[25] -= L[274] * work[48];
+        work[25] -= L[275] * work[50];
+        work[25] -= L[276] * work[51];
+        work[25] -= L[277] * work[52];
+        work[25] -= L[278] * work[53];
+        work[25] -= L[279] * work[54];
+        work[25] -= L[280] * work[56];
+        work[25] -= L[281] * work[57];
+        work[25] -= L[282] * work[59];
+        work[25] -= L[283] * work[61];
+        work[25] -= L[284] * work[63];
+        work[25] -= L[285] * work[64];
+        work[24] -= L[258] * work[47];
+        work[24] -= L[259] * work[49];
+        work[24] -= L[260] * work[50];
+        work[24] -= L[261] * work[51];
+        work[24] -= L[262] * work[52];
+        work[24] -= L[263] * work[53];
+        work[24] -= L[264] * work[54];
+        work[24] -= L[265] * work[55];
+        work[24] -= L[266] * work[56];
+        work[24] -= L[267] * work[57];
+        work[24] -= L[268] * work[58];
+        work[24] -= L[269] * work[62];
+        work[24] -= L[270] * work[63];
+        work[23] -= L[245] * work[46];
+        work[23] -= L[246] * work[47];
+        work[23] -= L[247] * work[48];
+        work[23] -= L[248] * work[49];
+        work[23] -= L[249] * work[50];
+        work[23] -= L[250] * work[54];
+        work[23] -= L[251] * work[55];
+        work[23] -= L[252] * work[56];
+        work[23] -= L[253] * work[58];
+        work[23] -= L[254] * work[59];
+        work[23] -= L[255] * work[61];
+        work[23] -= L[256] * work[63];
+        work[23] -= L[257] * work[64];
+        work[22] -= L[236] * work[50];
+        work[22] -= L[237] * work[51];
+        work[22] -= L[238] * work[52];
+        work[22] -= L[239] * work[55];
+        work[22] -= L[240] * work[58];
+        work[22] -= L[241] * work[60];
+        work[22] -= L[242] * work[61];
+        work[22] -= L[243] * work[62];
+        work[22] -= L[244] * work[64];
+        work[21] -= L[223] * work[46];
+        work[21] -= L[224] * work[49];
+        work[21] -= L[225] * work[50];
+        work[21] -= L[226] * work[51];
+        work[21] -= L[227] * work[52];
+        work[21] -= L[228] * work[55];
+        work[21] -= L[229] * work[56];
+        work[21] -= L[230] * work[57];
+        work[21] -= L[231] * work[60];
+        work[21] -= L[232] * work[61];
+        work[21] -= L[233] * work[62];
+        work[21] -= L[234] * work[63];
+        work[21] -= L[235] * work[64];
+        work[20] -= L[210] * work[45];
+        work[20] -= L[211] * work[47];
+        work[20] -= L[212] * work[48];
+        work[20] -= L[213] * work[49];
+        work[20] -= L[214] * work[50];
+        work[20] -= L[215] * work[51];
+        work[20] -= L[216] * work[53];
+        work[20] -= L[217] * work[55];
+        work[20] -= L[218] * work[56];
+        work[20] -= L[219] * work[58];
+        work[20] -= L[220] * work[59];
+        work[20] -= L[221] * work[62];
+        work[20] -= L[222] * work[63];
+        work[19] -= L[204] * work[46];
+        work[19] -= L[205] * work[47];
+        work[19] -= L[206] * work[49];
+        work[19] -= L[207] * work[51];
+        work[19] -= L[208] * work[52];
+        work[19] -= L[209] * work[57];
+        work[18] -= L[192] * work[45];
+        work[18] -= L[193] * work[46];
+        work[18] -= L[194] * work[49];
+        work[18] -= L[195] * work[50];
+        work[18] -= L[196] * work[52];
+        work[18] -= L[197] * work[53];
+        work[18] -= L[198] * work[55];
+        work[18] -= L[199] * work[56];
+        work[18] -= L[200] * work[59];
+        work[18] -= L[201] * work[61];
+        work[18] -= L[202] * work[63];
+        work[18] -= L[203] * work[64];
+        work[17] -= L[182] * work[48];
+        work[17] -= L[183] * work[50];
+        work[17] -= L[184] * work[52];
+        work[17] -= L[185] * work[55];
+        work[17] -= L[186] * work[57];
+        work[17] -= L[187] * work[58];
+        work[17] -= L[188] * work[59];
+        work[17] -= L[189] * work[60];
+        work[17] -= L[190] * work[61];
+        work[17] -= L[191] * work[63];
+        work[16] -= L[173] * work[45];
+        work[16] -= L[174] * work[46];
+        work[16] -= L[175] * work[48];
+        work[16] -= L[176] * work[49];
+        work[16] -= L[177] * work[54];
+        work[16] -= L[178] * work[56];
+        work[16] -= L[179] * work[59];
+        work[16] -= L[180] * work[61];
+        work[16] -= L[181] * work[63];
+        work[15] -= L[159] * work[46];
+        work[15] -= L[160] * work[47];
+        work[15] -= L[161] * work[48];
+        work[15] -= L[162] * work[49];
+        work[15] -= L[163] * work[53];
+        work[15] -= L[164] * work[54];
+        work[15] -= L[165] * work[56];
+        work[15] -= L[166] * work[57];
+        work[15] -= L[167] * work[59];
+        work[15] -= L[168] * work[60];
+        work[15] -= L[169] * work[61];
+        work[15] -= L[170] * work[62];
+        work[15] -= L[171] * work[63];
+        work[15] -= L[172] * work[64];
+        work[14] -= L[149] * work[45];
+        work[14] -= L[150] * work[46];
+        work[14] -= L[151] * work[48];
+        work[14] -= L[152] * work[49];
+        work[14] -= L[153] * work[50];
+        work[14] -= L[154] * work[55];
+        work[14] -= L[155] * work[56];
+        work[14] -= L[156] * work[60];
+        work[14] -= L[157] * work[61];
+        work[14] -= L[158] * work[62];
+        work[13] -= L[136] * work[45];
+        work[13] -= L[137] * work[46];
+        work[13] -= L[138] * work[47];
+        work[13] -= L[139] * work[50];
+        work[13] -= L[140] * work[51];
+        work[13] -= L[141] * work[53];
+        work[13] -= L[142] * work[55];
+        work[13] -= L[143] * work[57];
+        work[13] -= L[144] * work[58];
+        work[13] -= L[145] * work[59];
+        work[13] -= L[146] * work[60];
+        work[13] -= L[147] * work[62];
+        work[13] -= L[148] * work[63];
+        work[12] -= L[124] * work[45];
+        work[12] -= L[125] * work[46];
+        work[12] -= L[126] * work[48];
+        work[12] -= L[127] * work[50];
+        work[12] -= L[128] * work[52];
+        work[12] -= L[129] * work[53];
+        work[12] -= L[130] * work[54];
+        work[12] -= L[131] * work[55];
+        work[12] -= L[132] * work[59];
+        work[12] -= L[133] * work[60];
+        work[12] -= L[134] * work[61];
+        work[12] -= L[135] * work[62];
+        work[11] -= L[114] * work[45];
+        work[11] -= L[115] * work[46];
+        work[11] -= L[116] * work[47];
+        work[11] -= L[117] * work[50];
+        work[11] -= L[118] * work[54];
+        work[11] -= L[119] * work[55];
+        work[11] -= L[120] * work[56];
+        work[11] -= L[121] * work[59];
+        work[11] -= L[122] * work[63];
+        work[11] -= L[123] * work[64];
+        work[10] -= L[105] * work[49];
+        work[10] -= L[106] * work[50];
+        work[10] -= L[107] * work[51];
+        work[10] -= L[108] * work[55];
+        work[10] -= L[109] * work[58];
+        work[10] -= L[110] * work[60];
+        work[10] -= L[111] * work[61];
+        work[10] -= L[112] * work[62];
+        work[10] -= L[113] * work[64];
+        work[9] -= L[92] * work[45];
+        work[9] -= L[93] * work[46];
+        work[9] -= L[94] * work[47];
+        work[9] -= L[95] * work[48];
+        work[9] -= L[96] * work[49];
+        work[9] -= L[97] * work[51];
+        work[9] -= L[98] * work[53];
+        work[9] -= L[99] * work[54];
+        work[9] -= L[100] * work[56];
+        work[9] -= L[101] * work[60];
+        work[9] -= L[102] * work[61];
+        work[9] -= L[103] * work[63];
+        work[9] -= L[104] * work[64];
+        work[8] -= L[79] * work[48];
+        work[8] -= L[80] * work[49];
+        work[8] -= L[81] * work[50];
+        work[8] -= L[82] * work[51];
+        work[8] -= L[83] * work[52];
+        work[8] -= L[84] * work[53];
+        work[8] -= L[85] * work[54];
+        work[8] -= L[86] * work[56];
+        work[8] -= L[87] * work[57];
+        work[8] -= L[88] * work[60];
+        work[8] -= L[89] * work[61];
+        work[8] -= L[90] * work[63];
+        work[8] -= L[91] * work[64];
+        work[7] -= L[66] * work[46];
+        work[7] -= L[67] * work[48];
+        work[7] -= L[68] * work[49];
+        work[7] -= L[69] * work[50];
+        work[7] -= L[70] * work[54];
+        work[7] -= L[71] * work[55];
+        work[7] -= L[72] * work[56];
+        work[7] -= L[73] * work[57];
+        work[7] -= L[74] * work[58];
+        work[7] -= L[75] * work[59];
+        work[7] -= L[76] * work[61];
+        work[7] -= L[77] * work[62];
+        work[7] -= L[78] * work[63];
+        work[6] -= L[55] * work[47];
+        work[6] -= L[56] * work[49];
+        work[6] -= L[57] * work[51];
+        work[6] -= L[58] * work[53];
+        work[6] -= L[59] * work[55];
+        work[6] -= L[60] * work[57];
+        work[6] -= L[61] * work[58];
+        work[6] -= L[62] * work[59];
+        work[6] -= L[63] * work[61];
+        work[6] -= L[64] * work[62];
+        work[6] -= L[65] * work[63];
+        work[5] -= L[48] * work[47];
+        work[5] -= L[49] * work[49];
+        work[5] -= L[50] * work[51];
+        work[5] -= L[51] * work[57];
+        work[5] -= L[52] * work[58];
+        work[5] -= L[53] * work[59];
+        work[5] -= L[54] * work[62];
+        work[4] -= L[38] * work[46];
+        work[4] -= L[39] * work[49];
+        work[4] -= L[40] * work[51];
+        work[4] -= L[41] * work[52];
+        work[4] -= L[42] * work[54];
+        work[4] -= L[43] * work[55];
+        work[4] -= L[44] * work[58];
+        work[4] -= L[45] * work[61];
+        work[4] -= L[46] * work[63];
+        work[4] -= L[47] * work[64];
+        work[3] -= L[29] * work[45];
+        work[3] -= L[30] * work[48];
+        work[3] -= L[31] * work[52];
+        work[3] -= L[32] * work[55];
+        work[3] -= L[33] * work[56];
+        work[3] -= L[34] * work[57];
+        work[3] -= L[35] * work[58];
+        work[3] -= L[36] * work[63];
+        work[3] -= L[37] * work[64];
+        work[2] -= L[22] * work[45];
+        work[2] -= L[23] * work[46];
+        work[2] -= L[24] * work[53];
+        work[2] -= L[25] * work[54];
+        work[2] -= L[26] * work[55];
+        work[2] -= L[27] * work[63];
+        work[2] -= L[28] * work[64];
+        work[1] -= L[13] * work[45];
+        work[1] -= L[14] * work[51];
+        work[1] -= L[15] * work[52];
+        work[1] -= L[16] * work[55];
+        work[1] -= L[17] * work[57];
+        work[1] -= L[18] * work[59];
+        work[1] -= L[19] * work[60];
+        work[1] -= L[20] * work[62];
+        work[1] -= L[21] * work[64];
+        work[0] -= L[0] * work[45];
+        work[0] -= L[1] * work[46];
+        work[0] -= L[2] * work[47];
+        work[0] -= L[3] * work[48];
+        work[0] -= L[4] * work[50];
+        work[0] -= L[5] * work[52];
+        work[0] -= L[6] * work[54];
+        work[0] -= L[7] * work[57];
+        work[0] -= L[8] * work[58];
+        work[0] -= L[9] * work[59];
+        work[0] -= L[10] * work[60];
+        work[0] -= L[11] * work[63];
+        work[0] -= L[12] * work[64];
+        x[20] = work[0];
+        x[21] = work[1];
+        x[22] = work[2];
+        x[23] = work[3];
+        x[24] = work[4];
+        x[45] = work[5];
+        x[25] = work[6];
+        x[26] = work[7];
+        x[27] = work[8];
+        x[28] = work[9];
+        x[29] = work[10];
+        x[30] = work[11];
+        x[31] = work[12];
+        x[32] = work[13];
+        x[33] = work[14];
+        x[34] = work[15];
+        x[35] = work[16];
+        x[36] = work[17];
+        x[37] = work[18];
+        x[38] = work[19];
+        x[39] = work[20];
+        x[40] = work[21];
+        x[41] = work[22];
+        x[42] = work[23];
+        x[43] = work[24];
+        x[44] = work[25];
+        x[46] = work[26];
+        x[47] = work[27];
+        x[48] = work[28];
+        x[49] = work[29];
+        x[50] = work[30];
+        x[51] = work[31];
+        x[52] = work[32];
+        x[53] = work[33];
+        x[54] = work[34];
+        x[55] = work[35];
+        x[56] = work[36];
+        x[57] = work[37];
+        x[58] = work[38];
+        x[59] = work[39];
+        x[60] = work[40];
+        x[61] = work[41];
+        x[62] = work[42];
+        x[63] = work[43];
+        x[64] = work[44];
+        x[0] = work[45];
+        x[1] = work[46];
+        x[2] = work[47];
+        x[3] = work[48];
+        x[4] = work[49];
+        x[5] = work[50];
+        x[6] = work[51];
+        x[7] = work[52];
+        x[8] = work[53];
+        x[9] = work[54];
+        x[10] = work[55];
+        x[11] = work[56];
+        x[12] = work[57];
+        x[13] = work[58];
+        x[14] = work[59];
+        x[15] = work[60];
+        x[16] = work[61];
+        x[17] = work[62];
+        x[18] = work[63];
+        x[19] = work[64];
+    }
+
+} // namespace kkt_update_data
@@ -0,0 +1,80 @@
+#include "ecos.h"
+#include "minunit.h"
+
+/**
+ * Stacks the update_data LP and the SOC problem of githubIssue98 into one problem
+ * with two independent blocks. The variables and the linear rows of the SOC problem
+ * come first, the cone rows come last, so the blocks are interleaved.
+ */
+static char *test_decomposition()
+{
+    const int n_lp = udd_n, m_lp = udd_m, p_lp = udd_p;
+    const int n_soc = 5, l_soc = 6, m_soc = 11;
+
+    const Eigen::SparseMatrix<double> G_lp = Eigen::Map<Eigen::SparseMatrix<double>>(m_lp, n_lp, udd_Gjc[n_lp], udd_Gjc, udd_Gir, udd_G1pr);
+    const Eigen::SparseMatrix<double> A_lp = Eigen::Map<Eigen::SparseMatrix<double>>(p_lp, n_lp, udd_Ajc[n_lp], udd_Ajc, udd_Air, udd_A1pr);
+    const Eigen::SparseMatrix<double> G_soc = Eigen::Map<Eigen::SparseMatrix<double>>(m_soc, n_soc, Gp[n_soc], Gp, Gi, Gx);
+
+    const int n = n_lp + n_soc;
+    const int m = m_lp + m_soc;
+
+    /* Row of the stacked problem for a row of the SOC problem */
+    auto soc_row = [&](int row) { return row < l_soc ? row : m_lp + row; };
+
+    std::vector<Eigen::Triplet<double>> G_triplets, A_triplets;
+    for (int col = 0; col < n_lp; col++)
+    {
+        for (Eigen::SparseMatrix<double>::InnerIterator it(G_lp, col); it; ++it)
+            G_triplets.emplace_back(l_soc + it.row(), n_soc + col, it.value());
+        for (Eigen::SparseMatrix<double>::InnerIterator it(A_lp, col); it; ++it)
+            A_triplets.emplace_back(it.row(), n_soc + col, it.value());
+    }
+    for (int col = 0; col < n_soc; col++)
+    {
+        for (Eigen::SparseMatrix<double>::InnerIterator it(G_soc, col); it; ++it)
+            G_triplets.emplace_back(soc_row(it.row()), col, it.value());
+    }
+    Eigen::SparseMatrix<double> G(m, n), A(p_lp, n);
+    G.setFromTriplets(G_triplets.begin(), G_triplets.end());
+    A.setFromTriplets(A_triplets.begin(), A_triplets.end());
+
+    Eigen::VectorXd c_(n), h_(m);
+    c_ << Eigen::Map<Eigen::VectorXd>(c, n_soc), Eigen::Map<Eigen::VectorXd>(udd_c1, n_lp);
+    h_ << Eigen::Map<Eigen::VectorXd>(h, l_soc), Eigen::Map<Eigen::VectorXd>(udd_h1, m_lp),
+        Eigen::Map<Eigen::VectorXd>(h + l_soc, m_soc - l_soc);
+    const Eigen::VectorXd b_ = Eigen::Map<Eigen::VectorXd>(udd_b1, p_lp);
+    const Eigen::VectorXi q_ = Eigen::Map<Eigen::VectorXi>(q, 1);
+
+    EiCOS::Solver solver(G, A, c_, h_, b_, q_);
+    EiCOS::Solver decomposed_solver(G, A, c_, h_, b_, q_);
+    decomposed_solver.getSettings().decompose = true;
+
+    const EiCOS::exitcode code = solver.solve();
+    const EiCOS::exitcode decomposed_code = decomposed_solver.solve();
+
+    const Eigen::VectorXd &x = decomposed_solver.solution();
+    const Eigen::VectorXd &s = decomposed_solver.slack();
+    const double pcost = c_.dot(solver.solution());
+    const double decomposed_pcost = c_.dot(x);
+
+    mu_assert("decomposition: stacked problem not solved",
+              code == EiCOS::exitcode::optimal and decomposed_code == EiCOS::exitcode::optimal);
+    mu_assert("decomposition: cost differs from the undecomposed problem",
+              std::abs(pcost - decomposed_pcost) < 1e-6 * (1. + std::abs(pcost)) and
+                  std::abs(decomposed_solver.getInfo().pcost - decomposed_pcost) < 1e-6 * (1. + std::abs(pcost)));
+    mu_assert("decomposition: combined solution is infeasible",
+              (A * x - b_).lpNorm<Eigen::Infinity>() < 1e-6 and
+                  (G * x + s - h_).lpNorm<Eigen::Infinity>() < 1e-6);
+    mu_assert("decomposition: statistics of the blocks not added up",
+              decomposed_solver.getStatistics().factorizations >= decomposed_solver.getInfo().iter and
+                  decomposed_solver.getStatistics().refinement_steps > 0);
+
+    /* Settings changed after the setup reach the blocks, too few fixed iterations do not converge */
+    decomposed_solver.getSettings().fixed_iters = 3;
+    mu_assert("decomposition: fixed iterations not passed to the blocks",
+              decomposed_solver.solve() != EiCOS::exitcode::optimal);
+    decomposed_solver.getSettings().fixed_iters = 30;
+    mu_assert("decomposition: fixed iterations did not converge", decomposed_solver.solve() == EiCOS::exitcode::optimal);
+
+    return 0;
+}
@@ -44,6 +44,27 @@
 #include "LPnetlib/lp_beaconfd.h"
 #include "LPnetlib/lp_blend.h"
 #include "LPnetlib/lp_bnl1.h"
+#include "matrixFree/matrix_free.h"
+#include "admm/admm.h"
+#include "codegen/codegen.h"
+#include "decomposition/decomposition.h"
+#include "arrow/arrow.h"
+#include "spmv/spmv.h"
+#include "reorder/reorder.h"
+#include "setup/setup.h"
+#include "symbolicCache/symbolic_cache.h"
+#include "kernels/kernels.h"
+#include "staticSolver/static_solver.h"
+#include "latency/latency.h"
+#include "autotune/autotune.h"
+#include "threadPool/thread_pool.h"
+#include "logSink/log_sink.h"
+#include "metrics/metrics.h"
+#include "problemIO/problem_io.h"
+#include "solutionCache/solution_cache.h"
+#ifdef EICOS_SERVER
+#include "server/server.h"
+#endif
 
 int tests_run = 0;
 
@@ -70,6 +91,27 @@ static char *all_tests()
     mu_run_test(test_lp_bnl1);
     mu_run_test(test_emptyProblem);
     mu_run_test(test_issue98);
+    mu_run_test(test_matrix_free);
+    mu_run_test(test_admm);
+    mu_run_test(test_codegen);
+    mu_run_test(test_decomposition);
+    mu_run_test(test_arrow);
+    mu_run_test(test_spmv);
+    mu_run_test(test_reorder);
+    mu_run_test(test_setup);
+    mu_run_test(test_symbolic_cache);
+    mu_run_test(test_kernels);
+    mu_run_test(test_static_solver);
+    mu_run_test(test_latency);
+    mu_run_test(test_autotune);
+    mu_run_test(test_thread_pool);
+    mu_run_test(test_log_sink);
+    mu_run_test(test_metrics);
+    mu_run_test(test_problem_io);
+    mu_run_test(test_solution_cache);
+#ifdef EICOS_SERVER
+    mu_run_test(test_server);
+#endif
 
     return 0;
 }
@@ -0,0 +1,53 @@
+#include "ecos.h"
+#include "minunit.h"
+
+#include "kernels.hpp"
+
+#include <cstring>
+
+/* The dispatched kernels must give the same results as Eigen, whatever the instruction set */
+static char *test_kernels()
+{
+    const char *level = EiCOS::cpuDispatchLevel();
+    mu_assert("kernels: unknown instruction set",
+              std::strcmp(level, "avx512f") == 0 or std::strcmp(level, "avx2") == 0 or
+                  std::strcmp(level, "sse4.2") == 0 or std::strcmp(level, "default") == 0);
+
+    /* Odd length, so the vector loops have a remainder */
+    const int n = 37;
+    const Eigen::VectorXd a = Eigen::VectorXd::LinSpaced(n, 0.5, 7.);
+    const Eigen::VectorXd b = Eigen::VectorXd::LinSpaced(n, 3., 0.25);
+
+    Eigen::VectorXd out(n), y = b;
+    EiCOS::multiplyElements(n, a.data(), b.data(), out.data());
+    mu_assert("kernels: product differs", out == a.cwiseProduct(b));
+    EiCOS::divideElements(n, a.data(), b.data(), out.data());
+    mu_assert("kernels: quotient differs", out == a.cwiseQuotient(b));
+    EiCOS::sqrtElements(n, a.data(), out.data());
+    mu_assert("kernels: square root differs", out == a.cwiseSqrt());
+    EiCOS::addProductElements(n, a.data(), b.data(), y.data());
+    mu_assert("kernels: sum of products differs", y == b + a.cwiseProduct(b));
+
+    /* Equilibration of the columns and rows of G */
+    Eigen::SparseMatrix<double> G = Eigen::Map<Eigen::SparseMatrix<double>>(MPC01_m, MPC01_n, MPC01_Gjc[MPC01_n], MPC01_Gjc, MPC01_Gir, MPC01_Gpr);
+    G.makeCompressed();
+
+    Eigen::VectorXd col_max = Eigen::VectorXd::Zero(G.cols());
+    EiCOS::maxAbsRanges(G.outerIndexPtr(), G.valuePtr(), col_max.data(), 0, G.cols());
+    mu_assert("kernels: column maximum differs",
+              col_max == Eigen::MatrixXd(G).cwiseAbs().colwise().maxCoeff().transpose());
+
+    const Eigen::VectorXd row_scale = Eigen::VectorXd::LinSpaced(G.rows(), 1., 2.);
+    Eigen::SparseMatrix<double> G_ref = G;
+    for (int col = 0; col < G_ref.cols(); col++)
+    {
+        for (Eigen::SparseMatrix<double>::InnerIterator it(G_ref, col); it; ++it)
+        {
+            it.valueRef() /= row_scale(it.row());
+        }
+    }
+    EiCOS::divideByIndex(G.outerIndexPtr(), G.innerIndexPtr(), row_scale.data(), G.valuePtr(), 0, G.cols());
+    mu_assert("kernels: row scaling differs", Eigen::MatrixXd(G) == Eigen::MatrixXd(G_ref));
+
+    return 0;
+}
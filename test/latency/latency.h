@@ -0,0 +1,48 @@
+#include "ecos.h"
+#include "minunit.h"
+
+#include "latency.hpp"
+#include "static_solver.hpp"
+
+/* With fixed_iters every solve runs the same iterations and gives the same result */
+static char *test_latency()
+{
+    EiCOS::Solver reference(udd_n, udd_m, udd_p, udd_l, udd_ncones, udd_q,
+                            udd_G1pr, udd_Gjc, udd_Gir,
+                            udd_A1pr, udd_Ajc, udd_Air,
+                            udd_c1, udd_h1, udd_b1);
+    mu_assert("latency: reference solve failed", reference.solve() == EiCOS::exitcode::optimal);
+
+    EiCOS::Solver solver(udd_n, udd_m, udd_p, udd_l, udd_ncones, udd_q,
+                         udd_G1pr, udd_Gjc, udd_Gir,
+                         udd_A1pr, udd_Ajc, udd_Air,
+                         udd_c1, udd_h1, udd_b1);
+    solver.getSettings().fixed_iters = 25;
+    solver.getSettings().fixed_nitref = 2;
+
+    mu_assert("latency: fixed iterations did not converge", solver.solve() == EiCOS::exitcode::optimal);
+    const Eigen::VectorXd x = solver.solution();
+    mu_assert("latency: fixed iterations give a different optimum",
+              std::abs(solver.getInfo().pcost - reference.getInfo().pcost) < 1e-6 * std::abs(reference.getInfo().pcost));
+
+    mu_assert("latency: second solve differs", solver.solve() == EiCOS::exitcode::optimal and solver.solution() == x);
+
+    const EiCOS::LatencyReport report = EiCOS::measureLatency(solver, 3);
+    mu_assert("latency: inconsistent report",
+              report.runs == 3 and report.iterations == 25 and
+                  report.best > 0. and report.best <= report.mean and report.mean <= report.worst);
+
+    /* Same mode in the static solver */
+    const Eigen::SparseMatrix<double> G = Eigen::Map<Eigen::SparseMatrix<double>>(40, 20, udd_Gjc[20], udd_Gjc, udd_Gir, udd_G1pr);
+    const Eigen::SparseMatrix<double> A = Eigen::Map<Eigen::SparseMatrix<double>>(5, 20, udd_Ajc[20], udd_Ajc, udd_Air, udd_A1pr);
+    using LP = EiCOS::StaticSolver<20, 5, 40>;
+    LP static_solver{LP::MatrixG(G), LP::MatrixA(A), Eigen::Map<LP::VectorX>(udd_c1),
+                     Eigen::Map<LP::VectorZ>(udd_h1), Eigen::Map<LP::VectorY>(udd_b1)};
+    static_solver.getSettings().fixed_iters = 25;
+    mu_assert("latency: static solver did not converge", static_solver.solve() == EiCOS::exitcode::optimal);
+    const LP::VectorX x_static = static_solver.solution();
+    mu_assert("latency: static solves differ",
+              static_solver.solve() == EiCOS::exitcode::optimal and static_solver.solution() == x_static);
+
+    return 0;
+}
@@ -0,0 +1,61 @@
+#include "ecos.h"
+#include "minunit.h"
+#include "admm.hpp"
+
+#include <cstdio>
+#include <string>
+
+/* Keeps the records in memory */
+class RecordingSink : public EiCOS::LogSink
+{
+public:
+    void iteration(const EiCOS::Information &info) override { iterations.push_back(info.iter); }
+    void message(const std::string &text) override { messages.push_back(text); }
+
+    std::vector<size_t> iterations;
+    std::vector<std::string> messages;
+};
+
+static char *test_log_sink()
+{
+    EiCOS::Solver solver(udd_n, udd_m, udd_p, udd_l, udd_ncones, udd_q,
+                         udd_G1pr, udd_Gjc, udd_Gir,
+                         udd_A1pr, udd_Ajc, udd_Air,
+                         udd_c1, udd_h1, udd_b1);
+
+    auto recording = std::make_shared<RecordingSink>();
+    solver.getSettings().log_sink = recording;
+    mu_assert("log sink: solve failed", solver.solve(true) == EiCOS::exitcode::optimal);
+    mu_assert("log sink: iterations missing", recording->iterations.size() == solver.getInfo().iter + 1 and
+                                                  recording->iterations.back() == solver.getInfo().iter);
+    mu_assert("log sink: messages missing", not recording->messages.empty());
+
+    /* The asynchronous sink writes the same output in the background */
+    std::FILE *file = std::tmpfile();
+    {
+        auto async = std::make_shared<EiCOS::AsyncLogSink>(file);
+        solver.getSettings().log_sink = async;
+        mu_assert("log sink: asynchronous solve failed", solver.solve(true) == EiCOS::exitcode::optimal);
+        async->flush();
+        mu_assert("log sink: records dropped", async->dropped() == 0);
+        solver.getSettings().log_sink.reset();
+    }
+    const long size = std::ftell(file);
+    std::fclose(file);
+    mu_assert("log sink: nothing written", size > 0);
+
+    /* The first-order solver logs through the same interface */
+    const Eigen::SparseMatrix<double> G = Eigen::Map<Eigen::SparseMatrix<double>>(udd_m, udd_n, udd_Gjc[udd_n], udd_Gjc, udd_Gir, udd_G1pr);
+    const Eigen::SparseMatrix<double> A = Eigen::Map<Eigen::SparseMatrix<double>>(udd_p, udd_n, udd_Ajc[udd_n], udd_Ajc, udd_Air, udd_A1pr);
+    EiCOS::ADMMSolver admm(G, A,
+                           Eigen::Map<Eigen::VectorXd>(udd_c1, udd_n),
+                           Eigen::Map<Eigen::VectorXd>(udd_h1, udd_m),
+                           Eigen::Map<Eigen::VectorXd>(udd_b1, udd_p),
+                           Eigen::VectorXi());
+    auto admm_recording = std::make_shared<RecordingSink>();
+    admm.getSettings().log_sink = admm_recording;
+    admm.solve(true);
+    mu_assert("log sink: first-order solver output missing", admm_recording->messages.size() > 2);
+
+    return 0;
+}
@@ -0,0 +1,79 @@
+#include "ecos.h"
+#include "minunit.h"
+
+/* Wraps a sparse matrix into a linear operator for the matrix-free interface */
+static EiCOS::LinearOperator mf_operator(const Eigen::SparseMatrix<double> &M)
+{
+    EiCOS::LinearOperator op;
+    op.rows = M.rows();
+    op.cols = M.cols();
+    op.apply = [M](const Eigen::VectorXd &x, Eigen::VectorXd &y) { y = M * x; };
+    op.apply_transpose = [M](const Eigen::VectorXd &x, Eigen::VectorXd &y) { y = M.transpose() * x; };
+    op.apply_transpose_squared = [M](const Eigen::VectorXd &x, Eigen::VectorXd &y) {
+        y = M.cwiseAbs2().transpose() * x;
+    };
+    return op;
+}
+
+static bool mf_compare(idxint n, idxint m, idxint p, idxint ncones, idxint *q,
+                       pfloat *Gpr, idxint *Gjc, idxint *Gir,
+                       pfloat *Apr, idxint *Ajc, idxint *Air,
+                       pfloat *c, pfloat *h, pfloat *b)
+{
+    Eigen::SparseMatrix<double> G = Eigen::Map<Eigen::SparseMatrix<double>>(m, n, Gjc[n], Gjc, Gir, Gpr);
+    Eigen::SparseMatrix<double> A;
+    Eigen::VectorXd b_;
+    if (p > 0)
+    {
+        A = Eigen::Map<Eigen::SparseMatrix<double>>(p, n, Ajc[n], Ajc, Air, Apr);
+        b_ = Eigen::Map<Eigen::VectorXd>(b, p);
+    }
+    const Eigen::VectorXd c_ = Eigen::Map<Eigen::VectorXd>(c, n);
+    const Eigen::VectorXd h_ = Eigen::Map<Eigen::VectorXd>(h, m);
+    const Eigen::VectorXi q_ = ncones > 0 ? Eigen::VectorXi(Eigen::Map<Eigen::VectorXi>(q, ncones))
+                                          : Eigen::VectorXi();
+
+    EiCOS::Solver sparse_solver(G, A, c_, h_, b_, q_);
+    EiCOS::Solver mf_solver(mf_operator(G), mf_operator(A), c_, h_, b_, q_);
+
+    const EiCOS::exitcode sparse_code = sparse_solver.solve();
+    const EiCOS::exitcode mf_code = mf_solver.solve();
+
+    const double pcost_sparse = c_.dot(sparse_solver.solution());
+    const double pcost_mf = c_.dot(mf_solver.solution());
+
+    return sparse_code == EiCOS::exitcode::optimal and
+           mf_code == EiCOS::exitcode::optimal and
+           std::abs(pcost_sparse - pcost_mf) < 1e-6 * (1. + std::abs(pcost_sparse));
+}
+
+static char *test_matrix_free()
+{
+    mu_assert("matrix_free: update_data problem does not match sparse solver",
+              mf_compare(udd_n, udd_m, udd_p, udd_ncones, udd_q,
+                         udd_G1pr, udd_Gjc, udd_Gir,
+                         udd_A1pr, udd_Ajc, udd_Air,
+                         udd_c1, udd_h1, udd_b1));
+
+    mu_assert("matrix_free: MPC01 does not match sparse solver",
+              mf_compare(MPC01_n, MPC01_m, MPC01_p, MPC01_ncones, MPC01_q,
+                         MPC01_Gpr, MPC01_Gjc, MPC01_Gir,
+                         MPC01_Apr, MPC01_Ajc, MPC01_Air,
+                         MPC01_c, MPC01_h, MPC01_b));
+
+    /* With fixed_iters the conjugate gradients run to cg_maxit, and every solve gives the same result */
+    const Eigen::SparseMatrix<double> G = Eigen::Map<Eigen::SparseMatrix<double>>(udd_m, udd_n, udd_Gjc[udd_n], udd_Gjc, udd_Gir, udd_G1pr);
+    const Eigen::SparseMatrix<double> A = Eigen::Map<Eigen::SparseMatrix<double>>(udd_p, udd_n, udd_Ajc[udd_n], udd_Ajc, udd_Air, udd_A1pr);
+    EiCOS::Solver fixed_solver(mf_operator(G), mf_operator(A),
+                               Eigen::Map<Eigen::VectorXd>(udd_c1, udd_n),
+                               Eigen::Map<Eigen::VectorXd>(udd_h1, udd_m),
+                               Eigen::Map<Eigen::VectorXd>(udd_b1, udd_p),
+                               Eigen::VectorXi());
+    fixed_solver.getSettings().fixed_iters = 25;
+    mu_assert("matrix_free: fixed iterations did not converge", fixed_solver.solve() == EiCOS::exitcode::optimal);
+    const Eigen::VectorXd x = fixed_solver.solution();
+    mu_assert("matrix_free: fixed iterations differ between solves",
+              fixed_solver.solve() == EiCOS::exitcode::optimal and fixed_solver.solution() == x);
+
+    return 0;
+}
@@ -0,0 +1,59 @@
+#include "ecos.h"
+#include "minunit.h"
+#include "solution_cache.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+static char *test_metrics()
+{
+    EiCOS::Solver solver(udd_n, udd_m, udd_p, udd_l, udd_ncones, udd_q,
+                         udd_G1pr, udd_Gjc, udd_Gir,
+                         udd_A1pr, udd_Ajc, udd_Air,
+                         udd_c1, udd_h1, udd_b1);
+
+    auto metrics = std::make_shared<EiCOS::Metrics>();
+    solver.getSettings().metrics = metrics;
+
+    std::string exported;
+    {
+        EiCOS::MetricsExporter exporter(metrics, EiCOS::Metrics::Format::json, std::chrono::milliseconds(10),
+                                        [&](const std::string &text) { exported = text; });
+        mu_assert("metrics: first solve failed", solver.solve() == EiCOS::exitcode::optimal);
+        mu_assert("metrics: second solve failed", solver.solve() == EiCOS::exitcode::optimal);
+    }
+
+    const EiCOS::SolveStatistics &statistics = solver.getStatistics();
+    mu_assert("metrics: statistics missing", statistics.factorizations == solver.getInfo().iter + 1 and
+                                                 statistics.solve_time >= statistics.factor_time and
+                                                 statistics.factor_time > 0.);
+
+    const std::string prometheus = metrics->text(EiCOS::Metrics::Format::prometheus);
+    mu_assert("metrics: solves not counted", metrics->solves() == 2 and
+                                                 prometheus.find("eicos_solves_total 2\n") != std::string::npos and
+                                                 prometheus.find("eicos_exit_codes_total{code=\"optimal\"} 2\n") != std::string::npos and
+                                                 prometheus.find("eicos_iterations_count 2\n") != std::string::npos);
+    mu_assert("metrics: final export missing", exported.find("\"solves\":2,") != std::string::npos);
+
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "eicos_metrics_test.prom";
+    mu_assert("metrics: file not written", metrics->writeFile(path.string(), EiCOS::Metrics::Format::prometheus));
+    std::ifstream in(path);
+    std::stringstream content;
+    content << in.rdbuf();
+    std::filesystem::remove(path);
+    mu_assert("metrics: file differs", content.str().find("eicos_solves_total 2\n") != std::string::npos);
+
+    /* Results from a solution cache are counted apart, without iterations or times */
+    solver.setSolutionCache(std::make_shared<EiCOS::SolutionCache>());
+    mu_assert("metrics: solve with cache failed", solver.solve() == EiCOS::exitcode::optimal and
+                                                      solver.solve() == EiCOS::exitcode::optimal);
+    const std::string with_hit = metrics->text(EiCOS::Metrics::Format::prometheus);
+    mu_assert("metrics: cache hit not counted apart", metrics->solves() == 3 and metrics->cacheHits() == 1 and
+                                                          with_hit.find("eicos_cache_hits_total 1\n") != std::string::npos and
+                                                          with_hit.find("eicos_iterations_count 3\n") != std::string::npos and
+                                                          with_hit.find("eicos_solve_seconds_count 3\n") != std::string::npos);
+
+    return 0;
+}
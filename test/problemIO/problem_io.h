@@ -0,0 +1,108 @@
+#include "ecos.h"
+#include "minunit.h"
+#include "problem_io.hpp"
+
+#include <limits>
+#include <sstream>
+
+static char *test_problem_io()
+{
+    std::string error;
+    EiCOS::Problem problem;
+
+    /* Binary streams hold any number of problems */
+    EiCOS::Problem udd;
+    udd.name = "udd";
+    udd.G = Eigen::Map<Eigen::SparseMatrix<double>>(udd_m, udd_n, udd_Gjc[udd_n], udd_Gjc, udd_Gir, udd_G1pr);
+    udd.A = Eigen::Map<Eigen::SparseMatrix<double>>(udd_p, udd_n, udd_Ajc[udd_n], udd_Ajc, udd_Air, udd_A1pr);
+    udd.c = Eigen::Map<Eigen::VectorXd>(udd_c1, udd_n);
+    udd.h = Eigen::Map<Eigen::VectorXd>(udd_h1, udd_m);
+    udd.b = Eigen::Map<Eigen::VectorXd>(udd_b1, udd_p);
+    std::stringstream stream;
+    mu_assert("problem io: write failed", EiCOS::writeProblem(stream, udd) and EiCOS::writeProblem(stream, udd));
+
+    EiCOS::Solver reference(udd.G, udd.A, udd.c, udd.h, udd.b, udd.soc_dims);
+    reference.solve();
+    for (int k = 0; k < 2; k++)
+    {
+        mu_assert("problem io: read failed", EiCOS::readProblem(stream, EiCOS::ProblemFormat::binary, problem, error));
+        mu_assert("problem io: problem differs", problem.name == "udd" and problem.G.isApprox(udd.G) and
+                                                     problem.A.isApprox(udd.A) and problem.h == udd.h);
+        EiCOS::Solver solver(problem.G, problem.A, problem.c, problem.h, problem.b, problem.soc_dims);
+        mu_assert("problem io: solution differs", solver.solve() == EiCOS::exitcode::optimal and
+                                                      solver.solution() == reference.solution());
+    }
+    mu_assert("problem io: end of stream", not EiCOS::readProblem(stream, EiCOS::ProblemFormat::binary, problem, error) and
+                                               error.empty());
+
+    std::istringstream garbage("EICOSPRX and more");
+    mu_assert("problem io: invalid data accepted", not EiCOS::readProblem(garbage, EiCOS::ProblemFormat::binary, problem, error) and
+                                                       not error.empty());
+
+    /* Huge counts in a short stream fail at its end, without allocating them */
+    std::string huge = stream.str().substr(0, 12);
+    const int32_t huge_dims[4] = {1, std::numeric_limits<int32_t>::max(), 0, 0};
+    const int32_t huge_jc[2] = {0, std::numeric_limits<int32_t>::max()};
+    huge.append(reinterpret_cast<const char *>(huge_dims), sizeof(huge_dims));
+    huge.append(reinterpret_cast<const char *>(huge_jc), sizeof(huge_jc));
+    std::istringstream huge_in(huge);
+    mu_assert("problem io: huge matrix accepted", not EiCOS::readProblem(huge_in, EiCOS::ProblemFormat::binary, problem, error) and
+                                                      error == "truncated matrix");
+
+    /* Ranges, bounds, the constant of the objective and a dropped second objective */
+    const std::string mps = "NAME          TINYLP\n"
+                            "OBJSENSE\n"
+                            "    MAX\n"
+                            "ROWS\n"
+                            " N  COST\n"
+                            " N  AUX\n"
+                            " L  LIM1\n"
+                            " G  LIM2\n"
+                            " E  LIM3\n"
+                            "COLUMNS\n"
+                            "    X1        COST      1.0        LIM1      1.0\n"
+                            "    X1        LIM2      1.0\n"
+                            "    X2        COST      2.0        LIM1      1.0\n"
+                            "    X2        LIM2      -1.0       LIM3      1.0\n"
+                            "    X2        AUX       7.0\n"
+                            "RHS\n"
+                            "    RHS       LIM1      4.0        LIM2      -2.0\n"
+                            "    RHS       COST      -10.0\n"
+                            "RANGES\n"
+                            "    RNG       LIM3      5.0\n"
+                            "BOUNDS\n"
+                            " UP BND       X1        3.0\n"
+                            "ENDATA\n";
+    std::istringstream mps_in(mps);
+    mu_assert("problem io: MPS not read", EiCOS::readProblem(mps_in, EiCOS::ProblemFormat::mps, problem, error) and
+                                              problem.name == "TINYLP" and problem.maximize);
+    EiCOS::Solver lp(problem.G, problem.A, problem.c, problem.h, problem.b, problem.soc_dims);
+    mu_assert("problem io: MPS solve failed", lp.solve() == EiCOS::exitcode::optimal and
+                                                  std::abs(EiCOS::objectiveValue(problem, lp.getInfo().pcost) - 17.) < 1e-6);
+
+    /* Distance of (1, 2) to the line x1 + x2 = 1 */
+    const std::string cbf = "# comment\n"
+                            "VER\n1\n"
+                            "OBJSENSE\nMIN\n"
+                            "VAR\n3 1\nF 3\n"
+                            "CON\n4 2\nL= 1\nQ 3\n"
+                            "OBJACOORD\n1\n0 1.0\n"
+                            "ACOORD\n5\n0 1 1.0\n0 2 1.0\n1 0 1.0\n2 1 1.0\n3 2 1.0\n"
+                            "BCOORD\n3\n0 -1.0\n2 -1.0\n3 -2.0\n";
+    std::istringstream cbf_in(cbf);
+    mu_assert("problem io: CBF not read", EiCOS::readProblem(cbf_in, EiCOS::ProblemFormat::cbf, problem, error) and
+                                              problem.soc_dims.size() == 1 and problem.A.rows() == 1);
+    EiCOS::Solver socp(problem.G, problem.A, problem.c, problem.h, problem.b, problem.soc_dims);
+    mu_assert("problem io: CBF solve failed", socp.solve() == EiCOS::exitcode::optimal and
+                                                  std::abs(socp.getInfo().pcost - std::sqrt(2.)) < 1e-6);
+
+    std::istringstream uncovered("VER\n1\nVAR\n3 1\nF 2\n");
+    mu_assert("problem io: partial cones accepted", not EiCOS::readProblem(uncovered, EiCOS::ProblemFormat::cbf, problem, error) and
+                                                        error == "cones do not cover the VAR space");
+
+    std::istringstream psd("VER\n1\nPSDVAR\n1\n2\n");
+    mu_assert("problem io: PSD accepted", not EiCOS::readProblem(psd, EiCOS::ProblemFormat::cbf, problem, error) and
+                                              error == "unsupported keyword PSDVAR");
+
+    return 0;
+}
@@ -0,0 +1,58 @@
+#include "ecos.h"
+#include "minunit.h"
+
+/* Results of the reordered solver must be in the original order */
+static bool reorder_compare(EiCOS::Solver &solver, EiCOS::Solver &reordered_solver)
+{
+    const EiCOS::exitcode code = solver.solve();
+    const EiCOS::exitcode reordered_code = reordered_solver.solve();
+
+    auto close = [](const Eigen::VectorXd &a, const Eigen::VectorXd &b) {
+        return a.size() == b.size() and (a - b).lpNorm<Eigen::Infinity>() < 1e-5 * (1. + a.lpNorm<Eigen::Infinity>());
+    };
+
+    return code == EiCOS::exitcode::optimal and reordered_code == EiCOS::exitcode::optimal and
+           std::abs(solver.getInfo().pcost - reordered_solver.getInfo().pcost) < 1e-6 * (1. + std::abs(solver.getInfo().pcost)) and
+           close(solver.solution(), reordered_solver.solution()) and
+           close(solver.dualEquality(), reordered_solver.dualEquality()) and
+           close(solver.dualConic(), reordered_solver.dualConic()) and
+           close(solver.slack(), reordered_solver.slack());
+}
+
+static char *test_reorder()
+{
+    {
+        EiCOS::Solver solver(MPC01_n, MPC01_m, MPC01_p, MPC01_l, MPC01_ncones, MPC01_q,
+                             MPC01_Gpr, MPC01_Gjc, MPC01_Gir,
+                             MPC01_Apr, MPC01_Ajc, MPC01_Air,
+                             MPC01_c, MPC01_h, MPC01_b);
+        EiCOS::Solver reordered_solver(MPC01_n, MPC01_m, MPC01_p, MPC01_l, MPC01_ncones, MPC01_q,
+                                       MPC01_Gpr, MPC01_Gjc, MPC01_Gir,
+                                       MPC01_Apr, MPC01_Ajc, MPC01_Air,
+                                       MPC01_c, MPC01_h, MPC01_b);
+        reordered_solver.reorder();
+
+        mu_assert("reorder: MPC01 differs from the original order", reorder_compare(solver, reordered_solver));
+    }
+
+    {
+        EiCOS::Solver solver(udd_n, udd_m, udd_p, udd_l, udd_ncones, udd_q,
+                             udd_G1pr, udd_Gjc, udd_Gir,
+                             udd_A1pr, udd_Ajc, udd_Air,
+                             udd_c1, udd_h1, udd_b1);
+        EiCOS::Solver reordered_solver(udd_n, udd_m, udd_p, udd_l, udd_ncones, udd_q,
+                                       udd_G1pr, udd_Gjc, udd_Gir,
+                                       udd_A1pr, udd_Ajc, udd_Air,
+                                       udd_c1, udd_h1, udd_b1);
+        reordered_solver.reorder();
+
+        mu_assert("reorder: update_data differs from the original order", reorder_compare(solver, reordered_solver));
+
+        solver.updateData(udd_G2pr, udd_A2pr, udd_c2, udd_h2, udd_b2);
+        reordered_solver.updateData(udd_G2pr, udd_A2pr, udd_c2, udd_h2, udd_b2);
+
+        mu_assert("reorder: updated data differs from the original order", reorder_compare(solver, reordered_solver));
+    }
+
+    return 0;
+}
@@ -0,0 +1,151 @@
+#include "ecos.h"
+#include "minunit.h"
+#include "server.hpp"
+
+#include <cstring>
+#include <filesystem>
+#include <limits>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+/* Sends a hello for slots of slot_size * n_slots values with memory_fd attached, returns the status of the reply */
+static uint32_t server_raw_hello(const std::string &socket_path, uint64_t slot_size, uint64_t n_slots, int memory_fd)
+{
+    sockaddr_un address = {};
+    address.sun_family = AF_UNIX;
+    std::strcpy(address.sun_path, socket_path.c_str());
+    const int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (connect(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0)
+    {
+        close(fd);
+        return 0;
+    }
+
+    const uint32_t header[4] = {1, 0, 16, 0};
+    const uint64_t sizes[2] = {slot_size, n_slots};
+    char data[32];
+    std::memcpy(data, header, 16);
+    std::memcpy(data + 16, sizes, 16);
+    char control[CMSG_SPACE(sizeof(int))] = {};
+    iovec io = {data, sizeof(data)};
+    msghdr message = {};
+    message.msg_iov = &io;
+    message.msg_iovlen = 1;
+    message.msg_control = control;
+    message.msg_controllen = sizeof(control);
+    cmsghdr *cmsg = CMSG_FIRSTHDR(&message);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+    std::memcpy(CMSG_DATA(cmsg), &memory_fd, sizeof(int));
+
+    uint32_t reply[5] = {};
+    const bool ok = sendmsg(fd, &message, 0) == sizeof(data) and
+                    recv(fd, reply, sizeof(reply), MSG_WAITALL) == sizeof(reply);
+    close(fd);
+    return ok ? reply[4] : 0;
+}
+
+static char *test_server()
+{
+    const std::string socket_path = (std::filesystem::temp_directory_path() /
+                                     ("eicos_server_test_" + std::to_string(getpid()) + ".sock"))
+                                        .string();
+    EiCOS::SolverServer server(socket_path, 2);
+    mu_assert("server: not listening", server.listening());
+    std::thread accepting([&server] { server.run(); });
+
+    const size_t slot_size = 433 + 48 + 20 + 40 + 5;
+    EiCOS::ServerClient client(socket_path, slot_size);
+    mu_assert("server: client not connected", client.connected());
+    const uint64_t structure = client.setup(udd_n, udd_m, udd_p, udd_l, udd_ncones, udd_q,
+                                            udd_G1pr, udd_Gjc, udd_Gir,
+                                            udd_A1pr, udd_Ajc, udd_Air,
+                                            udd_c1, udd_h1, udd_b1);
+    mu_assert("server: setup failed", structure != 0);
+
+    EiCOS::Solver local(udd_n, udd_m, udd_p, udd_l, udd_ncones, udd_q,
+                        udd_G1pr, udd_Gjc, udd_Gir,
+                        udd_A1pr, udd_Ajc, udd_Air,
+                        udd_c1, udd_h1, udd_b1);
+    local.solve();
+
+    EiCOS::ServerResult result;
+    mu_assert("server: first solve failed", client.solve(structure, udd_G1pr, udd_A1pr, udd_c1, udd_h1, udd_b1, result) and
+                                                result.code == EiCOS::exitcode::optimal);
+    mu_assert("server: first solution differs", (result.x - local.solution()).lpNorm<Eigen::Infinity>() < 1e-8 and
+                                                    result.info.iter == local.getInfo().iter);
+
+    /* Two solves in flight, on different slots */
+    mu_assert("server: submit failed", client.submit(structure, udd_G2pr, udd_A2pr, udd_c2, udd_h2, udd_b2) and
+                                           client.submit(structure, udd_G1pr, udd_A1pr, udd_c1, udd_h1, udd_b1));
+    local.updateData(udd_G2pr, udd_A2pr, udd_c2, udd_h2, udd_b2);
+    local.solve();
+    mu_assert("server: second solve failed", client.receive(result) and result.code == EiCOS::exitcode::optimal);
+    mu_assert("server: second solution differs", (result.x - local.solution()).lpNorm<Eigen::Infinity>() < 1e-8 and
+                                                     (result.s - local.slack()).lpNorm<Eigen::Infinity>() < 1e-8);
+    mu_assert("server: third solve failed", client.receive(result) and result.code == EiCOS::exitcode::optimal);
+
+    /* Another process with the same structure shares the warm solver */
+    {
+        EiCOS::ServerClient other(socket_path, slot_size, 1);
+        const uint64_t same = other.setup(udd_n, udd_m, udd_p, udd_l, udd_ncones, udd_q,
+                                          udd_G2pr, udd_Gjc, udd_Gir,
+                                          udd_A2pr, udd_Ajc, udd_Air,
+                                          udd_c2, udd_h2, udd_b2);
+        mu_assert("server: structure not shared", same == structure);
+        mu_assert("server: shared solve failed", other.solve(same, udd_G2pr, udd_A2pr, udd_c2, udd_h2, udd_b2, result) and
+                                                     result.code == EiCOS::exitcode::optimal);
+    }
+    mu_assert("server: solvers not reused", server.structures() == 1 and server.solversCreated() == 1);
+
+    /* Rows out of order within a column and non-finite values are refused */
+    std::vector<int> unsorted(udd_Gir, udd_Gir + udd_Gjc[udd_n]);
+    int col = 0;
+    while (udd_Gjc[col + 1] - udd_Gjc[col] < 2)
+    {
+        col++;
+    }
+    std::swap(unsorted[udd_Gjc[col]], unsorted[udd_Gjc[col] + 1]);
+    mu_assert("server: unsorted rows accepted", client.setup(udd_n, udd_m, udd_p, udd_l, udd_ncones, udd_q,
+                                                             udd_G1pr, udd_Gjc, unsorted.data(),
+                                                             udd_A1pr, udd_Ajc, udd_Air,
+                                                             udd_c1, udd_h1, udd_b1) == 0);
+    std::vector<double> c_nan(udd_c1, udd_c1 + udd_n);
+    c_nan[0] = std::numeric_limits<double>::quiet_NaN();
+    mu_assert("server: non-finite setup accepted", client.setup(udd_n, udd_m, udd_p, udd_l, udd_ncones, udd_q,
+                                                                udd_G1pr, udd_Gjc, udd_Gir,
+                                                                udd_A1pr, udd_Ajc, udd_Air,
+                                                                c_nan.data(), udd_h1, udd_b1) == 0);
+    mu_assert("server: non-finite solve accepted", client.solve(structure, udd_G1pr, udd_A1pr, c_nan.data(), udd_h1, udd_b1, result) and
+                                                       result.code == EiCOS::exitcode::fatal);
+    mu_assert("server: solve after refusal failed", client.solve(structure, udd_G1pr, udd_A1pr, udd_c1, udd_h1, udd_b1, result) and
+                                                        result.code == EiCOS::exitcode::optimal);
+    mu_assert("server: refused structures registered", server.structures() == 1);
+
+    /* Slot memory that is too small or can still shrink is refused */
+    const int small_fd = memfd_create("eicos-test", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+    mu_assert("server: small memory accepted",
+              ftruncate(small_fd, 64) == 0 and fcntl(small_fd, F_ADD_SEALS, F_SEAL_SHRINK) == 0 and
+                  server_raw_hello(socket_path, slot_size, 4, small_fd) == 0);
+    close(small_fd);
+    const size_t bytes = slot_size * 4 * sizeof(double);
+    const int unsealed_fd = memfd_create("eicos-test", MFD_CLOEXEC);
+    mu_assert("server: unsealed memory accepted",
+              ftruncate(unsealed_fd, bytes) == 0 and server_raw_hello(socket_path, slot_size, 4, unsealed_fd) == 0);
+    const int sealed_fd = memfd_create("eicos-test", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+    mu_assert("server: sealed memory refused",
+              ftruncate(sealed_fd, bytes) == 0 and fcntl(sealed_fd, F_ADD_SEALS, F_SEAL_SHRINK) == 0 and
+                  server_raw_hello(socket_path, slot_size, 4, sealed_fd) == 1);
+    close(unsealed_fd);
+    close(sealed_fd);
+
+    server.stop();
+    accepting.join();
+    return 0;
+}
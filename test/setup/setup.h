@@ -0,0 +1,44 @@
+#include "ecos.h"
+#include "minunit.h"
+
+#include "sparse_rows.hpp"
+
+static char *test_setup()
+{
+    const Eigen::SparseMatrix<double> G = Eigen::Map<Eigen::SparseMatrix<double>>(MPC01_m, MPC01_n, MPC01_Gjc[MPC01_n], MPC01_Gjc, MPC01_Gir, MPC01_Gpr);
+    const Eigen::SparseMatrix<double> A(0, MPC01_n);
+    const Eigen::VectorXd c = Eigen::Map<Eigen::VectorXd>(MPC01_c, MPC01_n);
+    const Eigen::VectorXd h = Eigen::Map<Eigen::VectorXd>(MPC01_h, MPC01_m);
+    const Eigen::VectorXd b(0);
+    const Eigen::VectorXi q = Eigen::Map<Eigen::VectorXi>(MPC01_q, MPC01_ncones);
+
+    /* The row index does not depend on the number of parallel ranges */
+    EiCOS::SparseRows rows, parallel_rows;
+    rows.setup(G);
+    parallel_rows.setup(G, 7);
+    mu_assert("setup: parallel row index differs",
+              std::equal(rows.outerIndexPtr(), rows.outerIndexPtr() + G.rows() + 1, parallel_rows.outerIndexPtr()) and
+                  std::equal(rows.colPtr(), rows.colPtr() + G.nonZeros(), parallel_rows.colPtr()) and
+                  std::equal(rows.positionPtr(), rows.positionPtr() + G.nonZeros(), parallel_rows.positionPtr()));
+
+    /* Every stage is reported once, in order */
+    std::vector<std::string> stages;
+    std::vector<double> fractions;
+    EiCOS::Solver solver(G, A, c, h, b, q, [&](const std::string &stage, double progress) {
+        stages.push_back(stage);
+        fractions.push_back(progress);
+        return true;
+    });
+    mu_assert("setup: progress not reported",
+              stages.size() > 2 and stages.back() == "done" and fractions.front() == 0. and fractions.back() == 1. and
+                  std::is_sorted(fractions.begin(), fractions.end()));
+    mu_assert("setup: problem with progress reports not solved", solver.solve() == EiCOS::exitcode::optimal);
+
+    /* Cancel before the KKT matrix is assembled */
+    EiCOS::Solver cancelled_solver(G, A, c, h, b, q, [](const std::string &stage, double) {
+        return stage != "KKT assembly";
+    });
+    mu_assert("setup: cancelled setup not reported", cancelled_solver.solve() == EiCOS::exitcode::interrupted);
+
+    return 0;
+}
@@ -0,0 +1,90 @@
+#include "ecos.h"
+#include "minunit.h"
+#include "latency.hpp"
+#include "solution_cache.hpp"
+
+#include <thread>
+
+static char *test_solution_cache()
+{
+    auto cache = std::make_shared<EiCOS::SolutionCache>();
+
+    EiCOS::Solver first(udd_n, udd_m, udd_p, udd_l, udd_ncones, udd_q,
+                        udd_G1pr, udd_Gjc, udd_Gir,
+                        udd_A1pr, udd_Ajc, udd_Air,
+                        udd_c1, udd_h1, udd_b1);
+    first.setSolutionCache(cache);
+    mu_assert("solution cache: first solve failed", first.solve() == EiCOS::exitcode::optimal and
+                                                        cache->size() == 1 and cache->misses() == 1);
+
+    /* Same problem in another solver */
+    EiCOS::Solver second(udd_n, udd_m, udd_p, udd_l, udd_ncones, udd_q,
+                         udd_G1pr, udd_Gjc, udd_Gir,
+                         udd_A1pr, udd_Ajc, udd_Air,
+                         udd_c1, udd_h1, udd_b1);
+    second.setSolutionCache(cache);
+    mu_assert("solution cache: no hit", second.solve() == EiCOS::exitcode::optimal and cache->hits() == 1 and
+                                            second.getStatistics().factorizations == 0);
+    mu_assert("solution cache: stored result differs", second.solution() == first.solution() and
+                                                           second.dualConic() == first.dualConic() and
+                                                           second.getInfo().iter == first.getInfo().iter);
+
+    /* New values are solved, the old ones are still known */
+    second.updateData(udd_G2pr, udd_A2pr, udd_c2, udd_h2, udd_b2);
+    mu_assert("solution cache: new values hit", second.solve() == EiCOS::exitcode::optimal and
+                                                    second.getStatistics().factorizations > 0 and cache->size() == 2);
+    second.updateData(udd_G1pr, udd_A1pr, udd_c1, udd_h1, udd_b1);
+    mu_assert("solution cache: old values missed", second.solve() == EiCOS::exitcode::optimal and
+                                                       second.getStatistics().factorizations == 0 and
+                                                       second.solution() == first.solution());
+
+    /* A pending initial point is solved from, and the next solve hits again */
+    const size_t misses = cache->misses();
+    second.setInitialPoint(first.solution(), first.dualEquality(), first.dualConic(), first.slack());
+    mu_assert("solution cache: initial point ignored", second.solve() == EiCOS::exitcode::optimal and
+                                                          second.getStatistics().factorizations > 0 and
+                                                          cache->misses() == misses);
+    mu_assert("solution cache: no hit after initial point", second.solve() == EiCOS::exitcode::optimal and
+                                                               second.getStatistics().factorizations == 0);
+
+    /* Latency measurements time solves, not cache hits */
+    EiCOS::measureLatency(second, 2);
+    mu_assert("solution cache: latency of a cache hit", second.getStatistics().factorizations > 0 and
+                                                           second.solutionCache() == cache);
+
+    /* Room for one result, the least recently used one goes */
+    cache->setCapacity(cache->bytes() / 2 + 1);
+    mu_assert("solution cache: not evicted", cache->size() == 1);
+    second.updateData(udd_G2pr, udd_A2pr, udd_c2, udd_h2, udd_b2);
+    second.solve();
+    first.solve();
+    mu_assert("solution cache: evicted result hit", first.getStatistics().factorizations > 0 and cache->size() == 1);
+    cache->clear();
+    mu_assert("solution cache: not cleared", cache->size() == 0 and cache->bytes() == 0);
+
+    /* Concurrent solvers share the results */
+    cache = std::make_shared<EiCOS::SolutionCache>();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++)
+    {
+        threads.emplace_back([&cache] {
+            EiCOS::Solver solver(udd_n, udd_m, udd_p, udd_l, udd_ncones, udd_q,
+                                 udd_G1pr, udd_Gjc, udd_Gir,
+                                 udd_A1pr, udd_Ajc, udd_Air,
+                                 udd_c1, udd_h1, udd_b1);
+            solver.setSolutionCache(cache);
+            for (int k = 0; k < 3; k++)
+            {
+                solver.solve();
+            }
+        });
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+    mu_assert("solution cache: concurrent solves", cache->size() == 1 and
+                                                       cache->hits() >= 8 and cache->hits() + cache->misses() == 12);
+
+    return 0;
+}
@@ -0,0 +1,48 @@
+#include "ecos.h"
+#include "minunit.h"
+
+#include "spmv.hpp"
+
+/* Products split into a different number of row ranges must match Eigen exactly */
+static bool spmv_compare(const Eigen::SparseMatrix<double> &M, size_t n_parts)
+{
+    const Eigen::SparseMatrix<double> Mt = M.transpose();
+    const Eigen::SparseMatrix<double> MM = Mt.transpose();
+    const Eigen::VectorXd x = Eigen::VectorXd::LinSpaced(M.cols(), -1., 2.);
+    const Eigen::VectorXd x_t = Eigen::VectorXd::LinSpaced(M.rows(), 3., -1.);
+
+    Eigen::VectorXd y = Eigen::VectorXd::LinSpaced(M.rows(), 0., 1.);
+    Eigen::VectorXd y_ref = y;
+    y_ref.noalias() += -1. * M * x;
+    EiCOS::multiplyRows(Mt, EiCOS::partitionRows(Mt, n_parts), x, y, -1.);
+
+    /* Row index over the values of M */
+    EiCOS::SparseRows rows;
+    rows.setup(MM);
+    Eigen::VectorXd y_rows = Eigen::VectorXd::LinSpaced(M.rows(), 0., 1.);
+    EiCOS::multiplyRows(rows, MM, EiCOS::partitionRows(rows, n_parts), x, y_rows, -1.);
+
+    Eigen::VectorXd y_t = Eigen::VectorXd::Zero(M.cols());
+    Eigen::VectorXd y_t_ref = y_t;
+    y_t_ref.noalias() += Mt * x_t;
+    EiCOS::multiplyRows(MM, EiCOS::partitionRows(MM, n_parts), x_t, y_t);
+
+    /* Any alpha, not only +-1: Eigen scales x, 0.3 * M * x would scale the values of M */
+    Eigen::VectorXd y_alpha = Eigen::VectorXd::LinSpaced(M.rows(), 0., 1.);
+    Eigen::VectorXd y_alpha_ref = y_alpha;
+    y_alpha_ref.noalias() += M * (0.3 * x);
+    EiCOS::multiplyRows(rows, MM, EiCOS::partitionRows(rows, n_parts), x, y_alpha, 0.3);
+
+    return y == y_ref and y_rows == y_ref and y_t == y_t_ref and y_alpha == y_alpha_ref;
+}
+
+static char *test_spmv()
+{
+    const Eigen::SparseMatrix<double> G = Eigen::Map<Eigen::SparseMatrix<double>>(MPC01_m, MPC01_n, MPC01_Gjc[MPC01_n], MPC01_Gjc, MPC01_Gir, MPC01_Gpr);
+
+    mu_assert("spmv: single range differs from Eigen", spmv_compare(G, 1));
+    mu_assert("spmv: partitioned product differs from Eigen", spmv_compare(G, 7));
+    mu_assert("spmv: more ranges than rows", spmv_compare(G.topRows(3), 16));
+
+    return 0;
+}
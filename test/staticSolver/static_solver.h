@@ -0,0 +1,80 @@
+#include "ecos.h"
+#include "minunit.h"
+
+#include "static_solver.hpp"
+
+/* Solves a problem with Solver and with the StaticSolver of its dimensions, the results must agree */
+template <typename Static>
+static bool staticMatchesSolver(const Eigen::SparseMatrix<double> &G, const Eigen::SparseMatrix<double> &A,
+                                const Eigen::VectorXd &c, const Eigen::VectorXd &h, const Eigen::VectorXd &b,
+                                const Eigen::VectorXi &soc_dims, EiCOS::exitcode expected)
+{
+    EiCOS::Solver solver(G, A, c, h, b, soc_dims);
+    const EiCOS::exitcode code = solver.solve();
+
+    Static static_solver(typename Static::MatrixG(G), typename Static::MatrixA(A), c, h, b);
+    const EiCOS::exitcode static_code = static_solver.solve();
+
+    if (code != expected or static_code != expected)
+    {
+        return false;
+    }
+    if (expected != EiCOS::exitcode::optimal)
+    {
+        return true;
+    }
+
+    const double tol = 1e-6;
+    return std::abs(static_solver.getInfo().pcost - solver.getInfo().pcost) <= tol * (1. + std::abs(solver.getInfo().pcost)) and
+           (static_solver.solution() - solver.solution()).template lpNorm<Eigen::Infinity>() <= tol * (1. + solver.solution().template lpNorm<Eigen::Infinity>());
+}
+
+static char *test_static_solver()
+{
+    /* LP with equality constraints */
+    {
+        const Eigen::SparseMatrix<double> G = Eigen::Map<Eigen::SparseMatrix<double>>(40, 20, udd_Gjc[20], udd_Gjc, udd_Gir, udd_G1pr);
+        const Eigen::SparseMatrix<double> A = Eigen::Map<Eigen::SparseMatrix<double>>(5, 20, udd_Ajc[20], udd_Ajc, udd_Air, udd_A1pr);
+        const bool match = staticMatchesSolver<EiCOS::StaticSolver<20, 5, 40>>(
+            G, A, Eigen::Map<Eigen::VectorXd>(udd_c1, 20), Eigen::Map<Eigen::VectorXd>(udd_h1, 40),
+            Eigen::Map<Eigen::VectorXd>(udd_b1, 5), Eigen::VectorXi(), EiCOS::exitcode::optimal);
+        mu_assert("static solver: LP result differs", match);
+    }
+
+    /* Linear constraints and a second-order cone (githubIssue98) */
+    {
+        const Eigen::SparseMatrix<double> G = Eigen::Map<Eigen::SparseMatrix<double>>(11, 5, Gp[5], Gp, Gi, Gx);
+        const bool match = staticMatchesSolver<EiCOS::StaticSolver<5, 0, 6, 5>>(
+            G, Eigen::SparseMatrix<double>(0, 5), Eigen::Map<Eigen::VectorXd>(c, 5), Eigen::Map<Eigen::VectorXd>(h, 11),
+            Eigen::VectorXd(), Eigen::Map<Eigen::VectorXi>(q, 1), EiCOS::exitcode::optimal);
+        mu_assert("static solver: SOC result differs", match);
+    }
+
+    /* Unbounded LP (unboundedLP1) */
+    {
+        Eigen::Matrix<double, 4, 2> G;
+        G << -2., -1., -1., -3., -1., 0., 0., -1.;
+        Eigen::VectorXd c_(2), h_(4);
+        c_ << -1., -1.;
+        h_ << -1., -1., 0., 0.;
+        const bool match = staticMatchesSolver<EiCOS::StaticSolver<2, 0, 4>>(
+            G.sparseView(), Eigen::SparseMatrix<double>(0, 2), c_, h_, Eigen::VectorXd(), Eigen::VectorXi(),
+            EiCOS::exitcode::dual_infeasible);
+        mu_assert("static solver: unbounded problem not detected", match);
+    }
+
+    /* Infeasible LP (infeasible1) */
+    {
+        Eigen::Matrix<double, 2, 1> G;
+        G << -1., 1.;
+        Eigen::VectorXd c_(1), h_(2);
+        c_ << -1.;
+        h_ << -2., 1.;
+        const bool match = staticMatchesSolver<EiCOS::StaticSolver<1, 0, 2>>(
+            G.sparseView(), Eigen::SparseMatrix<double>(0, 1), c_, h_, Eigen::VectorXd(), Eigen::VectorXi(),
+            EiCOS::exitcode::primal_infeasible);
+        mu_assert("static solver: infeasible problem not detected", match);
+    }
+
+    return 0;
+}
@@ -0,0 +1,77 @@
+#include "ecos.h"
+#include "minunit.h"
+
+#include <filesystem>
+#include <fstream>
+
+static char *test_symbolic_cache()
+{
+    const Eigen::SparseMatrix<double> G = Eigen::Map<Eigen::SparseMatrix<double>>(MPC01_m, MPC01_n, MPC01_Gjc[MPC01_n], MPC01_Gjc, MPC01_Gir, MPC01_Gpr);
+    const Eigen::SparseMatrix<double> A(0, MPC01_n);
+    const Eigen::VectorXd c = Eigen::Map<Eigen::VectorXd>(MPC01_c, MPC01_n);
+    const Eigen::VectorXd h = Eigen::Map<Eigen::VectorXd>(MPC01_h, MPC01_m);
+    const Eigen::VectorXd b(0);
+    const Eigen::VectorXi q = Eigen::Map<Eigen::VectorXi>(MPC01_q, MPC01_ncones);
+
+    EiCOS::SymbolicCache &cache = EiCOS::SymbolicCache::global();
+    cache.clear();
+
+    /* Solves a new instance and checks that the cache was hit or missed */
+    auto solve = [&](bool hit, EiCOS::Information &info) {
+        const size_t hits = cache.hits(), misses = cache.misses();
+        EiCOS::Solver solver(G, A, c, h, b, q);
+        const bool optimal = solver.solve() == EiCOS::exitcode::optimal;
+        info = solver.getInfo();
+        return optimal and cache.hits() == hits + hit and cache.misses() == misses + not hit;
+    };
+    auto same = [](const EiCOS::Information &a, const EiCOS::Information &b) {
+        return a.iter == b.iter and a.pcost == b.pcost and a.dcost == b.dcost;
+    };
+
+    EiCOS::Information analyzed, cached, from_file;
+    mu_assert("symbolic cache: first analysis not missed", solve(false, analyzed));
+    mu_assert("symbolic cache: second analysis not cached", solve(true, cached) and same(analyzed, cached));
+
+    const std::filesystem::path directory = std::filesystem::temp_directory_path() / "eicos_symbolic_cache_test";
+    std::filesystem::create_directories(directory);
+    cache.setDirectory(directory.string());
+    cache.clear();
+    mu_assert("symbolic cache: file not written", solve(false, analyzed) and not std::filesystem::is_empty(directory));
+    cache.clear();
+    mu_assert("symbolic cache: file not loaded", solve(true, from_file) and same(analyzed, from_file));
+
+    /* A file whose ordering is not a permutation is ignored and replaced */
+    const std::filesystem::path file = std::filesystem::directory_iterator(directory)->path();
+    {
+        std::fstream damaged(file, std::ios::binary | std::ios::in | std::ios::out);
+        int32_t first;
+        damaged.seekg(24);
+        damaged.read(reinterpret_cast<char *>(&first), sizeof(first));
+        damaged.seekp(28);
+        damaged.write(reinterpret_cast<const char *>(&first), sizeof(first));
+    }
+    cache.clear();
+    mu_assert("symbolic cache: damaged file loaded", solve(false, from_file) and same(analyzed, from_file));
+    cache.clear();
+    mu_assert("symbolic cache: damaged file not replaced", solve(true, from_file) and same(analyzed, from_file));
+
+    /* An ordering of another pattern is only a worse ordering, the factor is computed from the matrix */
+    {
+        std::fstream foreign(file, std::ios::binary | std::ios::in | std::ios::out);
+        int32_t dim;
+        foreign.seekg(20);
+        foreign.read(reinterpret_cast<char *>(&dim), sizeof(dim));
+        foreign.seekp(24);
+        for (int32_t i = dim - 1; i >= 0; i--)
+        {
+            foreign.write(reinterpret_cast<const char *>(&i), sizeof(i));
+        }
+    }
+    cache.clear();
+    mu_assert("symbolic cache: foreign ordering not used", solve(true, from_file) and from_file.iter == analyzed.iter);
+
+    cache.setDirectory("");
+    std::filesystem::remove_all(directory);
+
+    return 0;
+}
@@ -0,0 +1,62 @@
+#include "ecos.h"
+#include "minunit.h"
+
+#include "parallel.hpp"
+
+#include <atomic>
+#include <thread>
+
+static char *test_thread_pool()
+{
+    /* Every index once, also from nested loops, which run inline */
+    EiCOS::ThreadPool pool(4);
+    std::vector<std::atomic<int>> visits(1000);
+    pool.parallelFor(visits.size(), [&](size_t i) {
+        visits[i]++;
+        pool.parallelFor(2, [&](size_t) { visits[i]++; });
+    });
+    bool once = true;
+    for (const std::atomic<int> &count : visits)
+    {
+        once = once and count == 3;
+    }
+    mu_assert("thread pool: indices not visited exactly once", pool.size() == 4 and once);
+
+    EiCOS::ThreadPool inline_pool(1);
+    const std::thread::id caller = std::this_thread::get_id();
+    bool on_caller = true;
+    inline_pool.parallelFor(100, [&](size_t) { on_caller = on_caller and std::this_thread::get_id() == caller; });
+    mu_assert("thread pool: inline pool used another thread", on_caller);
+
+    {
+        const EiCOS::ThreadPool::Scope scope(&inline_pool);
+        mu_assert("thread pool: scope not current", &EiCOS::ThreadPool::current() == &inline_pool);
+    }
+    mu_assert("thread pool: scope not restored", &EiCOS::ThreadPool::current() == &EiCOS::ThreadPool::global());
+
+    /* The solver gives the same results on any pool */
+    EiCOS::Solver reference(udd_n, udd_m, udd_p, udd_l, udd_ncones, udd_q,
+                            udd_G1pr, udd_Gjc, udd_Gir,
+                            udd_A1pr, udd_Ajc, udd_Air,
+                            udd_c1, udd_h1, udd_b1);
+    mu_assert("thread pool: reference solve failed", reference.solve() == EiCOS::exitcode::optimal);
+
+    std::vector<int> cpus = EiCOS::numaNodeCpus(0);
+    if (cpus.empty())
+    {
+        cpus = {0};
+    }
+    for (const auto &solver_pool : {std::make_shared<EiCOS::ThreadPool>(1),
+                                    std::make_shared<EiCOS::ThreadPool>(0, cpus)})
+    {
+        EiCOS::Solver solver(udd_n, udd_m, udd_p, udd_l, udd_ncones, udd_q,
+                             udd_G1pr, udd_Gjc, udd_Gir,
+                             udd_A1pr, udd_Ajc, udd_Air,
+                             udd_c1, udd_h1, udd_b1);
+        solver.setThreadPool(solver_pool);
+        mu_assert("thread pool: solve on own pool differs",
+                  solver.solve() == EiCOS::exitcode::optimal and solver.solution() == reference.solution());
+    }
+
+    return 0;
+}